@@ -15,12 +15,13 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
+import threading
 from typing import List, Union
 
 import numpy as np
 
-from ngraph.impl import Function, Node, Shape, serialize, util
-from ngraph.impl.runtime import Backend, Executable, Tensor
+from ngraph.impl import Function, Node, serialize, util
+from ngraph.impl.runtime import Backend, Tensor
 from ngraph.utils.types import get_dtype, NumericData
 from ngraph.exceptions import UserInputError
 
@@ -69,38 +70,61 @@ class Computation(object):
         self.parameters = ng_function.get_parameters()
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
+        self.memory_attach = self.runtime.backend.is_supported_property(
+            Backend.Property.memory_attach)
 
+        # Tensors shared by all calls on backends that cannot use the memory of the arrays;
+        # calls copy through them one at a time. Empty when the backend supports memory_attach.
         self.tensor_views = []  # type: List[Tensor]
-        for parameter in self.parameters:
-            shape = parameter.get_shape()
-            element_type = parameter.get_element_type()
-            self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
-
         self.result_views = []  # type: List[Tensor]
-        for result in self.results:
-            shape = result.get_shape()
-            element_type = result.get_element_type()
-            self.result_views.append(runtime.backend.create_tensor(element_type, shape))
+        self._views_lock = threading.Lock()
+        if not self.memory_attach:
+            for parameter in self.parameters:
+                self.tensor_views.append(runtime.backend.create_tensor(
+                    parameter.get_element_type(), parameter.get_shape()))
+            for result in self.results:
+                self.result_views.append(runtime.backend.create_tensor(
+                    result.get_element_type(), result.get_shape()))
 
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
     def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
-
-        self.handle.call(self.result_views, self.tensor_views)
+        """Run computation on input values and return result.
 
-        results = []
-        for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
-            results.append(result)
+        If the backend supports memory_attach, backend tensors are created for this call
+        directly over the memory of the input and result arrays, so C-contiguous inputs of the
+        parameter's dtype are not copied. Otherwise the values are copied through the tensors
+        created with the computation, and concurrent calls take turns using them. The GIL is
+        released while the computation runs.
+        """
+        input_arrays = []  # type: List[np.ndarray]
+        for parameter, value in zip(self.parameters, input_values):
+            input_arrays.append(Computation._as_parameter_array(parameter, value))
 
+        results = []  # type: List[np.ndarray]
+        for result in self.results:
+            results.append(np.empty(list(result.get_shape()),
+                                    dtype=get_dtype(result.get_element_type())))
+
+        if self.memory_attach:
+            tensor_views = [
+                self.runtime.backend.create_tensor(
+                    parameter.get_element_type(), parameter.get_shape(), value)
+                for parameter, value in zip(self.parameters, input_arrays)]
+            result_views = [
+                self.runtime.backend.create_tensor(
+                    result.get_element_type(), result.get_shape(), output)
+                for result, output in zip(self.results, results)]
+            self.handle.call(result_views, tensor_views)
+        else:
+            with self._views_lock:
+                for tensor_view, value in zip(self.tensor_views, input_arrays):
+                    tensor_view.write(util.numpy_to_c(value), value.nbytes)
+                self.handle.call(self.result_views, self.tensor_views)
+                for result_view, output in zip(self.result_views, results):
+                    result_view.read(util.numpy_to_c(output), output.nbytes)
         return results
 
     def serialize(self, indent=0):  # type: (int) -> str
@@ -112,32 +136,24 @@ class Computation(object):
         return serialize(self.function, indent)
 
     @staticmethod
-    def _get_buffer_size(element_type, element_count):  # type: (Tensor, int) -> int
-        return int((element_type.bitwidth / 8.0) * element_count)
+    def _as_parameter_array(parameter, value):  # type: (Node, NumericData) -> np.ndarray
+        """Return value as a C-contiguous array of the parameter's shape and dtype.
 
-    @staticmethod
-    def _write_ndarray_to_tensor_view(value, tensor_view):
-        # type: (np.ndarray, Tensor) -> None
-        tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
-                                 list(value.shape), list(tensor_view.shape))
-        if value.dtype != tensor_view_dtype:
+        Arrays that already qualify are returned as they are, so that they can be used in place.
+        """
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
+        shape = list(parameter.get_shape())
+        if list(value.shape) != shape:
+            if len(value.shape) > 0:
+                raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
+                                     list(value.shape), shape)
+            value = np.broadcast_to(value, shape)
+        parameter_dtype = get_dtype(parameter.get_element_type())
+        if value.dtype != parameter_dtype:
             log.warning(
                 'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
                 value.dtype,
-                tensor_view.element_type)
-            value = value.astype(tensor_view_dtype)
-
-        buffer_size = Computation._get_buffer_size(
-            tensor_view.element_type, tensor_view.element_count)
-
-        nparray = np.ascontiguousarray(value)
-        tensor_view.write(util.numpy_to_c(nparray), buffer_size)
-
-    @staticmethod
-    def _read_tensor_view_to_ndarray(tensor_view, output):
-        # type: (Tensor, np.ndarray) -> None
-        buffer_size = Computation._get_buffer_size(
-            tensor_view.element_type, tensor_view.element_count)
-        tensor_view.read(util.numpy_to_c(output), buffer_size)
+                parameter.get_element_type())
+            value = value.astype(parameter_dtype)
+        return np.ascontiguousarray(value)
@@ -20,6 +20,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/backend.hpp"
+#include "pyngraph/runtime/tensor.hpp"
 
 namespace py = pybind11;
 
@@ -36,16 +37,52 @@ static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
     return ngraph::runtime::Backend::create(type, must_support_dynamic);
 }
 
+// Creates a tensor that uses the memory of a C-contiguous Python buffer (e.g. a NumPy array)
+// directly, without copying
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_on_buffer(ngraph::runtime::Backend* self,
+                            const ngraph::element::Type& element_type,
+                            const ngraph::Shape& shape,
+                            py::buffer buffer)
+{
+    py::buffer_info info = buffer.request();
+    if (info.itemsize != static_cast<py::ssize_t>(element_type.size()) ||
+        info.shape.size() != shape.size())
+    {
+        throw py::value_error("Buffer does not match the tensor element type or rank");
+    }
+    py::ssize_t stride = info.itemsize;
+    for (size_t i = shape.size(); i-- > 0;)
+    {
+        if (info.shape[i] != static_cast<py::ssize_t>(shape[i]))
+        {
+            throw py::value_error("Buffer does not match the tensor shape");
+        }
+        if (shape[i] > 1 && info.strides[i] != stride)
+        {
+            throw py::value_error("Buffer is not C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    return wrap_host_buffer(self->create_tensor(element_type, shape, info.ptr), info.ptr);
+}
+
 void regclass_pyngraph_runtime_Backend(py::module m)
 {
     py::class_<ngraph::runtime::Backend, std::shared_ptr<ngraph::runtime::Backend>> backend(
         m, "Backend");
     backend.doc() = "ngraph.impl.runtime.Backend wraps ngraph::runtime::Backend";
+    py::enum_<ngraph::runtime::Backend::Property>(backend, "Property")
+        .value("memory_attach", ngraph::runtime::Backend::Property::memory_attach)
+        .value("concurrent_compile", ngraph::runtime::Backend::Property::concurrent_compile);
     backend.def_static("create", &create);
     backend.def_static("get_registered_devices", &ngraph::runtime::Backend::get_registered_devices);
     backend.def("create_tensor",
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // The buffer is kept alive for as long as the tensor is
+    backend.def("create_tensor", &create_tensor_on_buffer, py::keep_alive<0, 4>());
+    backend.def("is_supported_property", &ngraph::runtime::Backend::is_supported_property);
     backend.def("compile", &compile);
 }
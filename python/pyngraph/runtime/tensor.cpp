@@ -14,15 +14,100 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/tensor.hpp"
 
 namespace py = pybind11;
 
+// Host memory of tensors created over Python buffers
+static std::mutex s_host_buffers_mutex;
+static std::unordered_map<const ngraph::runtime::Tensor*, void*> s_host_buffers;
+
+std::shared_ptr<ngraph::runtime::Tensor>
+    wrap_host_buffer(const std::shared_ptr<ngraph::runtime::Tensor>& tensor, void* memory)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_host_buffers_mutex);
+        s_host_buffers[tensor.get()] = memory;
+    }
+    return std::shared_ptr<ngraph::runtime::Tensor>(
+        tensor.get(), [tensor](ngraph::runtime::Tensor* self) {
+            std::lock_guard<std::mutex> lock(s_host_buffers_mutex);
+            s_host_buffers.erase(self);
+        });
+}
+
+static void* get_host_buffer(ngraph::runtime::Tensor& self)
+{
+    if (auto host_tensor = dynamic_cast<ngraph::runtime::HostTensor*>(&self))
+    {
+        return host_tensor->get_data_ptr();
+    }
+    std::lock_guard<std::mutex> lock(s_host_buffers_mutex);
+    auto it = s_host_buffers.find(&self);
+    if (it == s_host_buffers.end())
+    {
+        throw std::runtime_error("Tensor memory is not accessible from the host");
+    }
+    return it->second;
+}
+
+static std::string get_buffer_format(const ngraph::element::Type& type)
+{
+    switch (type)
+    {
+    case ngraph::element::Type_t::boolean: return py::format_descriptor<bool>::format();
+    case ngraph::element::Type_t::f16: return "e";
+    case ngraph::element::Type_t::f32: return py::format_descriptor<float>::format();
+    case ngraph::element::Type_t::f64: return py::format_descriptor<double>::format();
+    case ngraph::element::Type_t::i8: return py::format_descriptor<int8_t>::format();
+    case ngraph::element::Type_t::i16: return py::format_descriptor<int16_t>::format();
+    case ngraph::element::Type_t::i32: return py::format_descriptor<int32_t>::format();
+    case ngraph::element::Type_t::i64: return py::format_descriptor<int64_t>::format();
+    case ngraph::element::Type_t::u8: return py::format_descriptor<uint8_t>::format();
+    case ngraph::element::Type_t::u16: return py::format_descriptor<uint16_t>::format();
+    case ngraph::element::Type_t::u32: return py::format_descriptor<uint32_t>::format();
+    case ngraph::element::Type_t::u64: return py::format_descriptor<uint64_t>::format();
+    case ngraph::element::Type_t::u1:
+    case ngraph::element::Type_t::bf16:
+    case ngraph::element::Type_t::undefined:
+    case ngraph::element::Type_t::dynamic: break;
+    }
+    throw std::runtime_error("Element type " + type.c_type_string() +
+                           " has no buffer protocol format");
+}
+
+static py::buffer_info get_buffer_info(ngraph::runtime::Tensor& self)
+{
+    const ngraph::Shape& shape = self.get_shape();
+    py::ssize_t item_size = self.get_element_type().size();
+    std::vector<py::ssize_t> dims(shape.begin(), shape.end());
+    std::vector<py::ssize_t> strides(shape.size());
+    py::ssize_t stride = item_size;
+    for (size_t i = shape.size(); i-- > 0;)
+    {
+        strides[i] = stride;
+        stride *= shape[i];
+    }
+    return py::buffer_info(get_host_buffer(self),
+                           item_size,
+                           get_buffer_format(self.get_element_type()),
+                           shape.size(),
+                           dims,
+                           strides);
+}
+
 static void read_(ngraph::runtime::Tensor* self, void* p, size_t n)
 {
     self->read(p, n);
@@ -35,11 +120,12 @@ static void write_(ngraph::runtime::Tensor* self, void* p, size_t n)
 
 void regclass_pyngraph_runtime_Tensor(py::module m)
 {
-    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(m,
-                                                                                         "Tensor");
+    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(
+        m, "Tensor", py::buffer_protocol());
     tensor.doc() = "ngraph.impl.runtime.Tensor wraps ngraph::runtime::Tensor";
     tensor.def("write", &write_);
     tensor.def("read", &read_);
+    tensor.def_buffer(&get_buffer_info);
 
     tensor.def_property_readonly("shape", &ngraph::runtime::Tensor::get_shape);
     tensor.def_property_readonly("element_count", &ngraph::runtime::Tensor::get_element_count);
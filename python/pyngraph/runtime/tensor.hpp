@@ -16,8 +16,18 @@
 
 #pragma once
 
+#include <memory>
+
 #include <pybind11/pybind11.h>
 
+#include "ngraph/runtime/tensor.hpp"
+
 namespace py = pybind11;
 
 void regclass_pyngraph_runtime_Tensor(py::module m);
+
+/// \brief Records `memory` as the host buffer backing `tensor`, so that the tensor can be
+///        exposed through the buffer protocol. The returned handle shares ownership of
+///        `tensor`; the record is dropped once the last handle is released.
+std::shared_ptr<ngraph::runtime::Tensor>
+    wrap_host_buffer(const std::shared_ptr<ngraph::runtime::Tensor>& tensor, void* memory);
@@ -16,9 +16,11 @@
 import numpy as np
 import pytest
 import json
+import threading
 
 import ngraph as ng
 from ngraph.exceptions import UserInputError
+from ngraph.impl import util
 
 import test
 from test.ngraph.util import get_runtime, run_op_node
@@ -51,6 +53,76 @@ def test_simple_computation_on_ndarrays(dtype):
     assert np.allclose(result, np.array([[630, 704], [782, 864]], dtype=dtype))
 
 
+class NoMemoryAttachBackend(object):
+    """Backend proxy that reports no memory_attach support."""
+
+    def __init__(self, backend):
+        self.backend = backend
+
+    def is_supported_property(self, prop):
+        return False
+
+    def __getattr__(self, name):
+        return getattr(self.backend, name)
+
+
+@pytest.mark.parametrize('memory_attach', [True, False])
+def test_computation_tensor_views(memory_attach):
+    runtime = get_runtime()
+    if not memory_attach:
+        runtime.backend = NoMemoryAttachBackend(runtime.backend)
+
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a - parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
+    result = computation(value_a, value_b)
+    assert np.allclose(result, value_a - value_b)
+
+    if memory_attach:
+        # Each call attaches tensors of its own to the arrays
+        assert computation.tensor_views == []
+        assert computation.result_views == []
+    else:
+        # The shared tensors hold the values of the most recent call
+        assert len(computation.tensor_views) == 2
+        assert len(computation.result_views) == 1
+        output = np.empty(shape, dtype=np.float32)
+        computation.result_views[0].read(util.numpy_to_c(output), output.nbytes)
+        assert np.allclose(output, value_a - value_b)
+
+
+@pytest.mark.parametrize('memory_attach', [True, False])
+def test_computation_concurrent_calls(memory_attach):
+    runtime = get_runtime()
+    if not memory_attach:
+        runtime.backend = NoMemoryAttachBackend(runtime.backend)
+
+    shape = [64, 64]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    def run(index, errors):
+        value_a = np.full(shape, index, dtype=np.float32)
+        value_b = np.full(shape, 2, dtype=np.float32)
+        for _ in range(20):
+            result = computation(value_a, value_b)[0]
+            if not np.array_equal(result, value_a * value_b):
+                errors.append(index)
+
+    errors = []
+    threads = [threading.Thread(target=run, args=(index, errors)) for index in range(8)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert errors == []
+
+
 def test_serialization():
     dtype = np.float32
     backend_name = test.BACKEND_NAME
@@ -1343,3 +1343,35 @@ def test_convolutionBackpropFilters():
            [ 425832,  190752,  432960.],
            [1084212,  485232, 1100250.]]]])
     assert np.allclose(result_arr, result_arr_ref)
+
+
+def test_tensor_on_ndarray():
+
+    element_type = Type.f32
+    shape = Shape([2, 2])
+    A = Parameter(element_type, shape)
+    B = Parameter(element_type, shape)
+    function = Function([Add(A, B)], [A, B], 'test')
+    backend = Backend.create(test.BACKEND_NAME)
+
+    a_arr = np.array([[1, 6], [7, 4]], dtype=np.float32)
+    b_arr = np.array([[5, 2], [3, 8]], dtype=np.float32)
+    result_arr = np.zeros((2, 2), dtype=np.float32)
+
+    # The tensors use the arrays' memory, so results land in result_arr without a read
+    a = backend.create_tensor(element_type, shape, a_arr)
+    b = backend.create_tensor(element_type, shape, b_arr)
+    result = backend.create_tensor(element_type, shape, result_arr)
+    handle = backend.compile(function)
+    handle.call([result], [a, b])
+    assert np.allclose(result_arr, a_arr + b_arr)
+
+    # Tensors expose their memory through the buffer protocol
+    a_arr[0, 0] = 10
+    assert np.array(a, copy=False)[0, 0] == 10
+    assert np.allclose(np.array(result, copy=False), result_arr)
+
+    with pytest.raises(ValueError):
+        backend.create_tensor(element_type, shape, np.zeros((2, 3), dtype=np.float32))
+    with pytest.raises(ValueError):
+        backend.create_tensor(element_type, shape, np.zeros((2, 4), dtype=np.float32)[:, ::2])
@@ -20,6 +20,7 @@
 #include "cpu_backend.hpp"
 #include "contrib/mlir/backend/pass/affine_lowerer.hpp"
 #include "contrib/mlir/backend/pass/memory_optimization.hpp"
+#include "contrib/mlir/backend/pass/parallel_outlining.hpp"
 #include "contrib/mlir/utils.hpp"
 #include "ngraph/check.hpp"
 
@@ -27,6 +28,7 @@
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
 #include <llvm/IR/Module.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
@@ -53,6 +55,11 @@ static llvm::cl::opt<bool>
                              llvm::cl::init(false),
                              llvm::cl::desc("Enable loop fusion optimization in Affine dialect"));
 
+static llvm::cl::opt<bool> clEnableParallelLoops(
+    "ngraph-parallel-loops",
+    llvm::cl::init(true),
+    llvm::cl::desc("Split parallel loop nests into tasks executed by the nGraph thread pool"));
+
 static llvm::cl::opt<bool>
     clEnableAffineLoopTiling("ngraph-affine-loop-tile",
                              llvm::cl::init(false),
@@ -99,6 +106,21 @@ static llvm::Expected<std::unique_ptr<llvm::TargetMachine>>
     //   Aggressive   // -O3
     // };
     machineBuilder->setCodeGenOptLevel((llvm::CodeGenOpt::Level)optLevel);
+
+    // Target the host CPU and all its features so that the LLVM vectorizers use the host SIMD
+    // width, e.g., 8 or 16 floats with AVX2 or AVX-512.
+    machineBuilder->setCPU(llvm::sys::getHostCPUName());
+    llvm::StringMap<bool> hostFeatures;
+    if (llvm::sys::getHostCPUFeatures(hostFeatures))
+    {
+        std::vector<std::string> features;
+        for (auto& feature : hostFeatures)
+        {
+            features.push_back((feature.second ? "+" : "-") + feature.first().str());
+        }
+        machineBuilder->addFeatures(features);
+    }
+
     return machineBuilder->createTargetMachine();
 }
 
@@ -171,6 +193,13 @@ void MLIRCPUBackend::lowerNgDialect()
     pm.addPass(mlir::createDialectLoweringPass());
     pm.addPass(mlir::createCanonicalizerPass());
 
+    // Outline loop nests into stages before any loop transformation since tiling and fusion drop
+    // the parallel loop tags set by the lowering.
+    if (clEnableParallelLoops && m_numTasks > 1)
+    {
+        pm.addPass(mlir::createParallelOutliningPass(m_numTasks));
+    }
+
     // Apply any generic pass manager command line options.
     mlir::applyPassManagerCLOptions(pm);
 
@@ -57,6 +57,11 @@ namespace ngraph
                 // codegen LLVM dialect from nGraph dialect applying CPU backend optimization passes
                 void codegen() override;
 
+                /// Sets the maximum number of tasks that the parallel loop nests of the generated
+                /// code are split into, typically the number of threads of the pool that the
+                /// runtime dispatches the tasks to. Loop nests are not split if lower than 2.
+                void set_num_tasks(unsigned num_tasks) { m_numTasks = num_tasks; }
+
             private:
                 // Apply CPU specific optimizations at nGraph dialect level
                 void optimizeNgDialect();
@@ -70,6 +75,8 @@ namespace ngraph
                 // Apply affine dialect optimizations
                 void optimizeAffineDialect();
 
+                unsigned m_numTasks = 1;
+
             public:
                 // JIT optimization level
                 static llvm::CodeGenOpt::Level mlirOptLevel;
@@ -22,8 +22,11 @@
 #include "contrib/mlir/core/ngraph_dialect/ops.hpp"
 #include "contrib/mlir/core/ngraph_dialect/type.hpp"
 #include "ngraph/assertion.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 
+#include <llvm/ADT/DenseMap.h>
 #include <llvm/ADT/DenseSet.h>
+#include <mlir/Dialect/AffineOps/AffineOps.h>
 #include <mlir/EDSC/Builders.h>
 #include <mlir/EDSC/Helpers.h>
 #include <mlir/EDSC/Intrinsics.h>
@@ -33,6 +36,7 @@
 #include <mlir/IR/StandardTypes.h>
 #include <mlir/Transforms/DialectConversion.h>
 
+#include <algorithm>
 #include <map>
 
 #define PASS_NAME "convert-ngraph-to-affine"
@@ -162,7 +166,22 @@ namespace
                                PatternRewriter& rewriter,
                                DialectLoweringPass& pass);
 
+    template <typename RedOp>
+    void lowerAxisReduction(Operation* op,
+                            ArrayRef<Value*> operands,
+                            PatternRewriter& rewriter,
+                            DialectLoweringPass& pass);
+
+    template <typename OP>
+    void lowerPooling(Operation* op,
+                      ArrayRef<Value*> operands,
+                      PatternRewriter& rewriter,
+                      DialectLoweringPass& pass);
+
     ValueHandle createZeroConstant(mlir::Type type);
+    ValueHandle createFloatConstant(mlir::Type type, double value);
+    IntegerSet createNonPaddedRangeSet(ArrayRef<int64_t> padBelow, PatternRewriter& rewriter);
+    void markOuterLoopParallel(ArrayRef<IndexHandle> ivs);
 
     /// Conversion from types in the nGraph dialect to the Standard dialect.
     class NGraphTypeConverter : public TypeConverter
@@ -185,9 +204,6 @@ namespace
         SmallVector<Value*, 4> buildOutputDefs(Operation* op, PatternRewriter& rewriter);
         Value* createTempTensor(Type type, PatternRewriter& rewriter);
 
-        /// Inserts dealloc Ops for each temporary allocated by AllocOp
-        void insertDeallocs(PatternRewriter& rewriter);
-
         NGraphTypeConverter& getTypeConverter() { return typeConverter; }
     private:
         /// Collect a set of patterns to convert from the nGraph dialect to Affine dialect.
@@ -196,10 +212,12 @@ namespace
         void findOutputValues();
         void insertNoAliasArgAttrs();
 
+        /// Turns the temporaries allocated by the lowering into extra function arguments that
+        /// are placed in a single arena.
+        void planTempsInArena();
+
     private:
         NGraphTypeConverter typeConverter;
-        // List of temporary memrefs to deallocate at end of function
-        SmallVector<Value*, 4> memRefsToDealloc;
 
         // Ops maybe assigned mem-refs in previous memory optimization passes.
         // Track pre-assigned buffers  for each Value and re-use it if one is available.
@@ -253,6 +271,11 @@ namespace
             // TODO: Encode no alias attribute as part of the function signature conversion or as a
             // separate rewrite pattern. Retrieve new function after signature conversion.
             insertNoAliasArgAttrs();
+
+            // Temporaries become arguments only after the no-alias attributes are set: two
+            // temporaries with disjoint live ranges may share the same arena memory.
+            planTempsInArena();
+            m_id_to_memref.clear();
         }
     }
 
@@ -350,8 +373,9 @@ namespace
 
         NGRAPH_CHECK(memRefType.hasStaticShape(), "Dynamic shapes are not supported");
 
+        // The allocation is replaced with a function argument bound to the arena by
+        // planTempsInArena once the whole function has been lowered.
         Value* alloc = rewriter.create<mlir::AllocOp>(rewriter.getUnknownLoc(), memRefType);
-        memRefsToDealloc.push_back(alloc);
 
         // TODO:
         // Enable dynamic memref allocation via call-back to nGraph allocator
@@ -385,12 +409,97 @@ namespace
         }
     }
 
-    void DialectLoweringPass::insertDeallocs(PatternRewriter& rewriter)
+    /// Each temporary is live from its allocation to the top-level operation holding its last
+    /// use. Offsets are assigned in program order with the first-fit nGraph memory manager, so
+    /// temporaries with disjoint live ranges share memory. The arena size and the offset of each
+    /// temporary argument are recorded as function attributes for the runtime, which allocates
+    /// the arena once and binds the temporary arguments to it. No memory is allocated or freed
+    /// when the function is invoked.
+    void DialectLoweringPass::planTempsInArena()
     {
-        for (auto value : memRefsToDealloc)
+        FuncOp func = getModule().lookupSymbol<mlir::FuncOp>(funcName);
+        NGRAPH_CHECK(func, "FuncOp '" + funcName + "' not found");
+
+        struct TempTensor
+        {
+            AllocOp alloc;
+            size_t size;
+            unsigned first;
+            unsigned last;
+            size_t offset;
+        };
+
+        Block& entryBlock = func.front();
+        llvm::DenseMap<Operation*, unsigned> opPositions;
+        SmallVector<TempTensor, 8> temps;
+        unsigned numPositions = 0;
+        for (auto& op : entryBlock)
+        {
+            opPositions[&op] = numPositions++;
+        }
+
+        for (auto& op : entryBlock)
+        {
+            auto alloc = dyn_cast<AllocOp>(&op);
+            if (!alloc)
+            {
+                continue;
+            }
+
+            MemRefType type = alloc.getType();
+            size_t elemSize = std::max<size_t>(1, (type.getElementTypeBitWidth() + 7) / 8);
+            unsigned first = opPositions[&op];
+            unsigned last = first;
+            for (auto& use : alloc.getResult()->getUses())
+            {
+                Operation* user = entryBlock.findAncestorOpInBlock(*use.getOwner());
+                NGRAPH_CHECK(user, "Temporary used outside of its function body");
+                last = std::max(last, opPositions[user]);
+            }
+            temps.push_back({alloc, type.getNumElements() * elemSize, first, last, 0});
+        }
+
+        if (temps.empty())
         {
-            rewriter.create<DeallocOp>(rewriter.getUnknownLoc(), value);
+            return;
         }
+
+        ngraph::pass::MemoryManager memManager(kArenaAlignment);
+        for (unsigned pos = 0; pos < numPositions; ++pos)
+        {
+            for (auto& temp : temps)
+            {
+                if (temp.first == pos)
+                {
+                    temp.offset = memManager.allocate(temp.size);
+                }
+            }
+            for (auto& temp : temps)
+            {
+                if (temp.last == pos)
+                {
+                    memManager.free(temp.offset);
+                }
+            }
+        }
+
+        MLIRContext* context = &getContext();
+        Type i64Ty = IntegerType::get(64, context);
+        SmallVector<Type, 8> argTypes(func.getType().getInputs().begin(),
+                                      func.getType().getInputs().end());
+        SmallVector<Attribute, 8> offsets;
+        for (auto& temp : temps)
+        {
+            Value* arg = entryBlock.addArgument(temp.alloc.getType());
+            temp.alloc.getResult()->replaceAllUsesWith(arg);
+            temp.alloc.erase();
+            argTypes.push_back(arg->getType());
+            offsets.push_back(IntegerAttr::get(i64Ty, temp.offset));
+        }
+
+        func.setType(FunctionType::get(argTypes, {/*void*/}, context));
+        func.setAttr(kArenaSizeAttrName, IntegerAttr::get(i64Ty, memManager.max_allocated()));
+        func.setAttr(kArenaOffsetsAttrName, ArrayAttr::get(offsets, context));
     }
 
     // NGDialect converters
@@ -526,6 +635,7 @@ namespace
             ValueHandle zero = createZeroConstant(elemTy);
             iRes(ivs) = intrinsics::select(val > zero, val, zero);
         });
+        markOuterLoopParallel(ivs);
 
         rewriter.replaceOp(op, {result});
         return matchSuccess();
@@ -538,6 +648,88 @@ namespace
         return matchSuccess();
     }
 
+    REWRITER(NGExpOp)
+    {
+        lowerUnaryElementwise<mlir::NGExpOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGTanhOp)
+    {
+        lowerUnaryElementwise<mlir::NGTanhOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGSigmoidOp)
+    {
+        lowerUnaryElementwise<mlir::NGSigmoidOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGSumRedOp)
+    {
+        lowerAxisReduction<mlir::NGSumRedOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGMaxRedOp)
+    {
+        lowerAxisReduction<mlir::NGMaxRedOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGAvgPoolOp)
+    {
+        lowerPooling<mlir::NGAvgPoolOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGMaxPoolOp)
+    {
+        lowerPooling<mlir::NGMaxPoolOp>(op, operands, rewriter, pass);
+        return matchSuccess();
+    }
+
+    REWRITER(NGSelectOp)
+    {
+        auto loc = cast<NGSelectOp>(op).getLoc();
+        ScopedContext scope(rewriter, loc);
+
+        Value* pred = operands[0];
+        Value* onTrue = operands[1];
+        Value* onFalse = operands[2];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(pred && onTrue && onFalse && result, "Unexpected null values in SelectOp");
+
+        // Views
+        MemRefView vRes(result);
+        // Index Values
+        IndexedValue iRes(result), iPred(pred), iTrue(onTrue), iFalse(onFalse);
+        // Bounds Index Handles
+        auto lbs = vRes.getLbs();
+        auto ubs = vRes.getUbs();
+        // Loop induction vars
+        auto ivs = makeIndexHandles(vRes.rank());
+        auto pivs = makeIndexHandlePointers(ivs);
+        // Steps
+        auto steps = vRes.getSteps();
+
+        Type predTy = pred->getType().cast<MemRefType>().getElementType();
+
+        AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+            // nGraph booleans are stored as 8-bit integers, any non-zero value is true.
+            ValueHandle predVal = iPred(ivs);
+            ValueHandle cond =
+                predTy.isInteger(1) ? predVal : (predVal != createZeroConstant(predTy));
+            iRes(ivs) =
+                intrinsics::select(cond, ValueHandle(iTrue(ivs)), ValueHandle(iFalse(ivs)));
+        });
+        markOuterLoopParallel(ivs);
+
+        rewriter.replaceOp(op, {result});
+        return matchSuccess();
+    }
+
     REWRITER(NGDotOp)
     {
         auto dot = cast<NGDotOp>(op);
@@ -594,6 +786,7 @@ namespace
             LoopBuilder::makeAffine(&n, nLb, nUb, nStep)([&] {
                 LoopBuilder::makeAffine(&k, kLb, kUb, kStep)([&] { iRes(n, k) = zeroInit; });
             });
+            markOuterLoopParallel(n);
         }
         LoopBuilder::makeAffine(&n, nLb, nUb, nStep)([&] {
             LoopBuilder::makeAffine(&m, mLb, mUb, mStep)([&] {
@@ -601,6 +794,7 @@ namespace
                     [&] { iRes(n, k) += iLhs(n, m) * iRhs(m, k); });
             });
         });
+        markOuterLoopParallel(n);
 
         rewriter.replaceOp(op, {result});
 
@@ -938,36 +1132,9 @@ namespace
         IntegerSet nonPaddedRange;
         if (withPadding)
         {
-            // Create affine expressions and IntegerSet
-            // IntegerSet (d0, d1, .. d_N-1)[LB_0, LB_1, .. LB_N-1, UB_0, UB_1, .. UB_N-1], where
-            // for each dim:
-            //   (d_dim - padBelow[dim] - LB_dim >= 0),
-            //   (padBelow[dim] + UB_dim - d_dim - 1 >= 0)
-            SmallVector<AffineExpr, 4> affineExprs;
-            // Bool to indicate if expr is equality or inequality
-            SmallVector<bool, 4> isEq;
-
-            for (unsigned dim = 0; dim < spatialRank; dim++)
-            {
-                // i_dim
-                auto dimExpr = rewriter.getAffineDimExpr(dim);
-                auto imgLbExpr = rewriter.getAffineSymbolExpr(dim);
-
-                // expr1 : i_dim - padBelow[dim] - imgLB >= 0
-                auto padBelowExpr = rewriter.getAffineConstantExpr(padBelowIntValues[dim]);
-                affineExprs.push_back(dimExpr - padBelowExpr - imgLbExpr);
-                isEq.push_back(false);
-
-                // expr2: padBelow[dim] + imgUB - i_dim - 1 >= 0
-                auto imgUbExpr = rewriter.getAffineSymbolExpr(spatialRank + dim);
-                auto oneExpr = rewriter.getAffineConstantExpr(1);
-                affineExprs.push_back(padBelowExpr + imgUbExpr - dimExpr - oneExpr);
-                isEq.push_back(false);
-            }
-
-            NGRAPH_CHECK(affineExprs.size() == isEq.size() && isEq.size() == 2 * spatialRank,
-                         "Invalid number of expressions in the IntegerSet");
-            nonPaddedRange = IntegerSet::get(spatialRank, 2 * spatialRank, affineExprs, isEq);
+            SmallVector<int64_t, 4> padBelowVals(padBelowIntValues.begin(),
+                                                 padBelowIntValues.end());
+            nonPaddedRange = createNonPaddedRangeSet(padBelowVals, rewriter);
         }
 
         // Initialize output to zero
@@ -1090,9 +1257,292 @@ namespace
         return matchSuccess();
     }
 
+    REWRITER(NGBroadcastOp)
+    {
+        auto broadcast = cast<NGBroadcastOp>(op);
+        auto loc = broadcast.getLoc();
+        ScopedContext scope(rewriter, loc);
+
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(arg && result, "Unexpected null values in BroadcastOp");
+
+        MemRefView vRes(result);
+        IndexedValue iRes(result), iArg(arg);
+
+        SmallVector<bool, 4> isBroadcastAxis(vRes.rank(), false);
+        for (auto axisAttr : broadcast.axisSet())
+        {
+            isBroadcastAxis[axisAttr.cast<IntegerAttr>().getInt()] = true;
+        }
+
+        // Let result rank be R. Generate
+        //
+        // for <r_0 .. r_(R-1)> : <0 .. 0> -> <res.dim[0] .. res.dim[R-1]>
+        //   res[r_0, .. r_(R-1)] = arg[r_i for each non-broadcast axis i]
+        auto lbs = vRes.getLbs();
+        auto ubs = vRes.getUbs();
+        auto ivs = makeIndexHandles(vRes.rank());
+        auto pivs = makeIndexHandlePointers(ivs);
+        auto steps = vRes.getSteps();
+
+        AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+            SmallVector<IndexHandle, 4> argIndices;
+            for (auto i = 0; i < vRes.rank(); i++)
+            {
+                if (!isBroadcastAxis[i])
+                {
+                    argIndices.push_back(ivs[i]);
+                }
+            }
+            iRes(ivs) = iArg(argIndices);
+        });
+        markOuterLoopParallel(ivs);
+
+        rewriter.replaceOp(op, {result});
+        return matchSuccess();
+    }
+
+    REWRITER(NGSlice)
+    {
+        auto slice = cast<NGSlice>(op);
+        auto loc = slice.getLoc();
+        ScopedContext scope(rewriter, loc);
+
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(arg && result, "Unexpected null values in SliceOp");
+
+        MemRefView vRes(result);
+        IndexedValue iRes(result), iArg(arg);
+
+        SmallVector<int64_t, 4> lowerBounds, strides;
+        for (auto attrs : llvm::zip(slice.lowerBounds(), slice.strides()))
+        {
+            lowerBounds.push_back(std::get<0>(attrs).cast<IntegerAttr>().getInt());
+            strides.push_back(std::get<1>(attrs).cast<IntegerAttr>().getInt());
+        }
+
+        // Let rank be R. Generate
+        //
+        // for <r_0 .. r_(R-1)> : <0 .. 0> -> <res.dim[0] .. res.dim[R-1]>
+        //   res[r_0, .. r_(R-1)] = arg[lb_0 + r_0 * stride_0, .. lb_(R-1) + r_(R-1) * stride_(R-1)]
+        auto lbs = vRes.getLbs();
+        auto ubs = vRes.getUbs();
+        auto ivs = makeIndexHandles(vRes.rank());
+        auto pivs = makeIndexHandlePointers(ivs);
+        auto steps = vRes.getSteps();
+
+        AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+            SmallVector<IndexHandle, 4> argIndices;
+            for (auto i = 0; i < vRes.rank(); i++)
+            {
+                argIndices.push_back(
+                    IndexHandle(ivs[i] * intrinsics::constant_index(strides[i]) +
+                                intrinsics::constant_index(lowerBounds[i])));
+            }
+            iRes(ivs) = iArg(argIndices);
+        });
+        markOuterLoopParallel(ivs);
+
+        rewriter.replaceOp(op, {result});
+        return matchSuccess();
+    }
+
+    REWRITER(NGReshape)
+    {
+        auto reshape = cast<NGReshape>(op);
+        auto loc = reshape.getLoc();
+        ScopedContext scope(rewriter, loc);
+
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(arg && result, "Unexpected null values in ReshapeOp");
+
+        MemRefView vRes(result), vArg(arg);
+        IndexedValue iRes(result), iArg(arg);
+        auto argShape = arg->getType().cast<MemRefType>().getShape();
+        auto resShape = result->getType().cast<MemRefType>().getShape();
+        unsigned argRank = vArg.rank();
+        unsigned resRank = vRes.rank();
+
+        SmallVector<int64_t, 4> axisOrder;
+        for (auto axisAttr : reshape.axisOrder())
+        {
+            axisOrder.push_back(axisAttr.cast<IntegerAttr>().getInt());
+        }
+        NGRAPH_CHECK(axisOrder.size() == argRank, "Axis order does not match the argument rank");
+
+        // The argument is visited in axis order, so that the k-th element visited is the k-th
+        // element of the result in row-major order. Let the argument rank be N and
+        // A_k = arg.dim[axisOrder[k]]. Generate
+        //
+        // for <i_0 .. i_(N-1)> : <0 .. 0> -> <A_0 .. A_(N-1)>
+        //   flat = i_0 * (A_1 * .. * A_(N-1)) + .. + i_(N-1)
+        //   res[(flat floordiv resStride_0) mod res.dim[0], ..] = arg[i_(axisOrder^-1[0]), ..]
+        SmallVector<ValueHandle, 4> lbs, ubs;
+        SmallVector<int64_t, 4> steps, iterStrides(argRank), resStrides(resRank);
+        for (unsigned k = 0; k < argRank; k++)
+        {
+            lbs.push_back(vArg.lb(axisOrder[k]));
+            ubs.push_back(vArg.ub(axisOrder[k]));
+            steps.push_back(vArg.step(axisOrder[k]));
+        }
+        int64_t stride = 1;
+        for (int k = argRank - 1; k >= 0; k--)
+        {
+            iterStrides[k] = stride;
+            stride *= argShape[axisOrder[k]];
+        }
+        stride = 1;
+        for (int i = resRank - 1; i >= 0; i--)
+        {
+            resStrides[i] = stride;
+            stride *= resShape[i];
+        }
+
+        auto ivs = makeIndexHandles(argRank);
+        auto pivs = makeIndexHandlePointers(ivs);
+
+        AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+            SmallVector<IndexHandle, 4> argIndices(argRank);
+            IndexHandle flat(index_t(0));
+            for (unsigned k = 0; k < argRank; k++)
+            {
+                argIndices[axisOrder[k]] = ivs[k];
+                flat = flat + ivs[k] * intrinsics::constant_index(iterStrides[k]);
+            }
+
+            SmallVector<IndexHandle, 4> resIndices;
+            for (unsigned i = 0; i < resRank; i++)
+            {
+                resIndices.push_back(
+                    IndexHandle(floorDiv(flat, intrinsics::constant_index(resStrides[i])) %
+                                intrinsics::constant_index(resShape[i])));
+            }
+            iRes(resIndices) = iArg(argIndices);
+        });
+        // Every argument element is copied to a distinct result element.
+        markOuterLoopParallel(ivs);
+
+        rewriter.replaceOp(op, {result});
+        return matchSuccess();
+    }
+
+    REWRITER(NGSoftMax)
+    {
+        auto softmax = cast<NGSoftMax>(op);
+        auto loc = softmax.getLoc();
+        ScopedContext scope(rewriter, loc);
+
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(arg && result, "Unexpected null values in SoftmaxOp");
+
+        MemRefView vRes(result), vArg(arg);
+        IndexedValue iRes(result), iArg(arg);
+        auto argShape = arg->getType().cast<MemRefType>().getShape();
+        Type elemTy = result->getType().cast<MemRefType>().getElementType();
+        unsigned rank = vArg.rank();
+
+        SmallVector<bool, 4> isSoftmaxAxis(rank, false);
+        for (auto axisAttr : softmax.axes())
+        {
+            isSoftmaxAxis[axisAttr.cast<IntegerAttr>().getInt()] = true;
+        }
+
+        // Max and sum along the softmax axes are kept in temporaries shaped as the argument
+        // without those axes. Generate
+        //
+        //   max[red] = arg[red, 0 for the softmax axes]
+        //   sum[red] = 0
+        //   for all i: max[red(i)] = max(max[red(i)], arg[i])
+        //   for all i: res[i] = exp(arg[i] - max[red(i)]); sum[red(i)] += res[i]
+        //   for all i: res[i] = res[i] / sum[red(i)]
+        //
+        // Subtracting the max keeps exp from overflowing.
+        SmallVector<int64_t, 4> redShape;
+        for (unsigned i = 0; i < rank; i++)
+        {
+            if (!isSoftmaxAxis[i])
+            {
+                redShape.push_back(argShape[i]);
+            }
+        }
+        auto redTy = MemRefType::get(redShape, elemTy, {/* no map used */}, 0);
+        Value* maxVal = pass.createTempTensor(redTy, rewriter);
+        Value* sumVal = pass.createTempTensor(redTy, rewriter);
+        MemRefView vRed(maxVal);
+        IndexedValue iMax(maxVal), iSum(sumVal);
+
+        auto getRedIndices = [&](ArrayRef<IndexHandle> ivs) -> SmallVector<IndexHandle, 4> {
+            SmallVector<IndexHandle, 4> redIndices;
+            for (unsigned i = 0; i < rank; i++)
+            {
+                if (!isSoftmaxAxis[i])
+                {
+                    redIndices.push_back(ivs[i]);
+                }
+            }
+            return redIndices;
+        };
+
+        {
+            auto lbs = vRed.getLbs();
+            auto ubs = vRed.getUbs();
+            auto ivs = makeIndexHandles(vRed.rank());
+            auto pivs = makeIndexHandlePointers(ivs);
+            auto steps = vRed.getSteps();
+            AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+                SmallVector<IndexHandle, 4> argIndices;
+                for (unsigned i = 0, j = 0; i < rank; i++)
+                {
+                    argIndices.push_back(isSoftmaxAxis[i] ? IndexHandle(vArg.lb(i)) : ivs[j++]);
+                }
+                iMax(ivs) = iArg(argIndices);
+                iSum(ivs) = createZeroConstant(elemTy);
+            });
+        }
+
+        auto lbs = vArg.getLbs();
+        auto ubs = vArg.getUbs();
+        auto steps = vArg.getSteps();
+        {
+            auto ivs = makeIndexHandles(rank);
+            auto pivs = makeIndexHandlePointers(ivs);
+            AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+                auto redIndices = getRedIndices(ivs);
+                ValueHandle val = iArg(ivs);
+                ValueHandle currMax = iMax(redIndices);
+                iMax(redIndices) = intrinsics::select(val > currMax, val, currMax);
+            });
+        }
+        {
+            auto ivs = makeIndexHandles(rank);
+            auto pivs = makeIndexHandlePointers(ivs);
+            AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+                auto redIndices = getRedIndices(ivs);
+                ValueHandle shifted = ValueHandle(iArg(ivs)) - ValueHandle(iMax(redIndices));
+                ValueHandle expVal = ValueHandle::create<ExpOp>(elemTy, shifted);
+                iRes(ivs) = expVal;
+                iSum(redIndices) = iSum(redIndices) + expVal;
+            });
+        }
+        {
+            auto ivs = makeIndexHandles(rank);
+            auto pivs = makeIndexHandlePointers(ivs);
+            AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+                auto redIndices = getRedIndices(ivs);
+                iRes(ivs) = ValueHandle(iRes(ivs)) / ValueHandle(iSum(redIndices));
+            });
+        }
+
+        rewriter.replaceOp(op, {result});
+        return matchSuccess();
+    }
+
     REWRITER(NGReturnOp)
     {
-        pass.insertDeallocs(rewriter);
         rewriter.replaceOpWithNewOp<ReturnOp>(op);
         return matchSuccess();
     }
@@ -1139,11 +1589,33 @@ namespace
                 ValueHandle zero = createZeroConstant(elemTy);
                 iRes(ivs) = zero - val;
             }
+            else if (isa<NGExpOp>(op))
+            {
+                iRes(ivs) = ValueHandle::create<ExpOp>(elemTy, val);
+            }
+            else if (isa<NGTanhOp>(op))
+            {
+                // tanh(x) = 1 - 2 / (exp(2x) + 1), which saturates to +-1 when exp overflows or
+                // underflows.
+                ValueHandle one = createFloatConstant(elemTy, 1.0);
+                ValueHandle two = createFloatConstant(elemTy, 2.0);
+                ValueHandle expVal = ValueHandle::create<ExpOp>(elemTy, val * two);
+                iRes(ivs) = one - two / (expVal + one);
+            }
+            else if (isa<NGSigmoidOp>(op))
+            {
+                // sigmoid(x) = 1 / (1 + exp(-x))
+                ValueHandle one = createFloatConstant(elemTy, 1.0);
+                ValueHandle zero = createZeroConstant(elemTy);
+                ValueHandle expVal = ValueHandle::create<ExpOp>(elemTy, zero - val);
+                iRes(ivs) = one / (one + expVal);
+            }
             else
             {
                 NGRAPH_CHECK(false, "Unsupported op");
             }
         });
+        markOuterLoopParallel(ivs);
 
         rewriter.replaceOp(op, {result});
     }
@@ -1220,6 +1692,7 @@ namespace
                     NGRAPH_CHECK(false, "Unsupported op");
                 }
             });
+        markOuterLoopParallel(ivs);
         rewriter.replaceOp(op, {result});
     }
 
@@ -1316,6 +1789,291 @@ namespace
         rewriter.replaceOp(op, result);
     }
 
+    template <typename RedOp>
+    void lowerAxisReduction(Operation* op,
+                            ArrayRef<Value*> operands,
+                            PatternRewriter& rewriter,
+                            DialectLoweringPass& pass)
+    {
+        static_assert(std::is_same<RedOp, NGSumRedOp>() || std::is_same<RedOp, NGMaxRedOp>(),
+                      "Template parameter is not supported by lowerAxisReduction");
+
+        RedOp redOp = cast<RedOp>(op);
+        auto loc = redOp.getLoc();
+
+        NGRAPH_CHECK(operands.size() == 1 && operands[0] != nullptr,
+                     "Expected one non-null operand in Axis Reduction op");
+
+        // Retrieve/generate Values for operands and result.
+        ScopedContext scope(rewriter, loc);
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+
+        // Views
+        MemRefView vRes(result), vArg(arg);
+        // Index Values
+        IndexedValue iRes(result), iArg(arg);
+
+        unsigned argRank = vArg.rank();
+        SmallVector<bool, 4> isRedAxis(argRank, false);
+        for (auto axisAttr : redOp.axes())
+        {
+            isRedAxis[axisAttr.template cast<IntegerAttr>().getInt()] = true;
+        }
+
+        Type elemTy = result->getType().cast<MemRefType>().getElementType();
+        // Generate loop nest that initializes result to zero for sum and to the first element
+        // along the reduced axes for max.
+        {
+            auto lbs = vRes.getLbs();
+            auto ubs = vRes.getUbs();
+            auto ivs = makeIndexHandles(vRes.rank());
+            auto pivs = makeIndexHandlePointers(ivs);
+            auto steps = vRes.getSteps();
+            AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+                if (std::is_same<RedOp, NGSumRedOp>())
+                {
+                    iRes(ivs) = createZeroConstant(elemTy);
+                }
+                else
+                {
+                    SmallVector<IndexHandle, 4> argIndices;
+                    for (unsigned i = 0, j = 0; i < argRank; i++)
+                    {
+                        argIndices.push_back(isRedAxis[i] ? IndexHandle(vArg.lb(i)) : ivs[j++]);
+                    }
+                    iRes(ivs) = iArg(argIndices);
+                }
+            });
+            markOuterLoopParallel(ivs);
+        }
+
+        // Generate loop nest that accumulates every argument element into the result element
+        // given by the non-reduced indices.
+        {
+            auto lbs = vArg.getLbs();
+            auto ubs = vArg.getUbs();
+            auto ivs = makeIndexHandles(argRank);
+            auto pivs = makeIndexHandlePointers(ivs);
+            auto steps = vArg.getSteps();
+            AffineLoopNestBuilder(pivs, lbs, ubs, steps)([&] {
+                SmallVector<IndexHandle, 4> resIndices;
+                for (unsigned i = 0; i < argRank; i++)
+                {
+                    if (!isRedAxis[i])
+                    {
+                        resIndices.push_back(ivs[i]);
+                    }
+                }
+
+                if (std::is_same<RedOp, NGSumRedOp>())
+                {
+                    iRes(resIndices) = iRes(resIndices) + iArg(ivs);
+                }
+                else
+                {
+                    ValueHandle val = iArg(ivs);
+                    ValueHandle currMax = iRes(resIndices);
+                    iRes(resIndices) = intrinsics::select(val > currMax, val, currMax);
+                }
+            });
+            // Iterations of the outermost loop update distinct result elements unless that
+            // loop runs over a reduced axis.
+            if (argRank > 0 && !isRedAxis[0])
+            {
+                markOuterLoopParallel(ivs);
+            }
+        }
+
+        rewriter.replaceOp(op, {result});
+    }
+
+    template <typename OP>
+    void lowerPooling(Operation* op,
+                      ArrayRef<Value*> operands,
+                      PatternRewriter& rewriter,
+                      DialectLoweringPass& pass)
+    {
+        static_assert(std::is_same<OP, NGAvgPoolOp>() || std::is_same<OP, NGMaxPoolOp>(),
+                      "Template parameter is not supported by lowerPooling");
+        constexpr bool isAvgPool = std::is_same<OP, NGAvgPoolOp>();
+
+        OP poolOp = cast<OP>(op);
+        auto loc = poolOp.getLoc();
+        ScopedContext scope(rewriter, loc);
+
+        Value* arg = operands[0];
+        Value* result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(arg && result, "Unexpected null values in Pooling op");
+
+        Type elemTy = arg->getType().cast<MemRefType>().getElementType();
+
+        // Let Arg shape be [N, C, D_1, ... D_f], the window shape [W_1, ... W_f] and the result
+        // shape [N, C, R_1, ... R_f]. Generate
+        //
+        // for n : 0 -> N
+        //   for c : 0 -> C
+        //     for <r_1 .. r_f> : <0 .. 0> -> <R_1 ... R_f>
+        //       Output[n, c, r_1, .. r_f] = init
+        //       for <w_1 .. w_f> : <0 .. 0> -> <W_1 ... W_f>
+        //         i_k = r_k * strides[k] + w_k
+        //         if (indices in non-padded region)
+        //           Output[n, c, r_1, .. r_f] =
+        //             reduce(Output[n, c, r_1, .. r_f], Arg[n, c, i_1 - padBelow[1], ..])
+        //       Output[n, c, r_1, .. r_f] /= W_1 * .. * W_f    (average only)
+        //
+        // Max is initialized with the first element of the window, so max pooling does not
+        // support padding. Average pooling counts padding elements as zeros.
+
+        // Create view to write into result.
+        MemRefView vRes(result), vArg(arg);
+        // Indexed Values
+        IndexedValue iRes(result), iArg(arg);
+
+        unsigned spatialRank = vArg.rank() - 2;
+        SmallVector<int64_t, 4> strides, padBelow;
+        SmallVector<ValueHandle, 4> resSpatialLbs, resSpatialUbs;
+        SmallVector<ValueHandle, 4> argSpatialLbs, argSpatialUbs;
+        SmallVector<ValueHandle, 4> windowLbs, windowUbs;
+        SmallVector<int64_t, 4> resSteps, windowSteps;
+        int64_t windowSize = 1;
+        bool withPadding = false;
+
+        for (auto attrs : llvm::zip(poolOp.windowShape(),
+                                    poolOp.windowMovementStrides(),
+                                    poolOp.padBelow(),
+                                    poolOp.padAbove()))
+        {
+            auto window = std::get<0>(attrs).template cast<IntegerAttr>().getInt();
+            strides.push_back(std::get<1>(attrs).template cast<IntegerAttr>().getInt());
+            padBelow.push_back(std::get<2>(attrs).template cast<IntegerAttr>().getInt());
+            auto padAbove = std::get<3>(attrs).template cast<IntegerAttr>().getInt();
+            if (padBelow.back() || padAbove)
+            {
+                withPadding = true;
+            }
+
+            windowLbs.push_back(intrinsics::constant_index(0));
+            windowUbs.push_back(intrinsics::constant_index(window));
+            windowSteps.push_back(1);
+            windowSize *= window;
+        }
+        NGRAPH_CHECK(strides.size() == spatialRank, "Window rank mismatches argument spatial rank");
+        NGRAPH_CHECK(isAvgPool || !withPadding, "Padding is not supported for max pooling");
+
+        for (auto i = 0; i < spatialRank; i++)
+        {
+            resSpatialLbs.push_back(vRes.lb(i + 2));
+            resSpatialUbs.push_back(vRes.ub(i + 2));
+            resSteps.push_back(vRes.step(i + 2));
+            argSpatialLbs.push_back(vArg.lb(i + 2));
+            argSpatialUbs.push_back(vArg.ub(i + 2));
+        }
+
+        IntegerSet nonPaddedRange;
+        if (withPadding)
+        {
+            nonPaddedRange = createNonPaddedRangeSet(padBelow, rewriter);
+        }
+
+        auto resSpatialIndices = makeIndexHandles(spatialRank);
+        auto resSpatialIndicesPtrs = makeIndexHandlePointers(resSpatialIndices);
+        auto windowIndices = makeIndexHandles(spatialRank);
+        auto windowIndicesPtrs = makeIndexHandlePointers(windowIndices);
+
+        IndexHandle n, c;
+        LoopBuilder::makeAffine(&n, vArg.lb(0), vArg.ub(0), 1)([&] {
+            LoopBuilder::makeAffine(&c, vArg.lb(1), vArg.ub(1), 1)([&] {
+                AffineLoopNestBuilder(
+                    resSpatialIndicesPtrs, resSpatialLbs, resSpatialUbs, resSteps)([&] {
+                    SmallVector<IndexHandle, 4> resIndices{n, c};
+                    resIndices.insert(
+                        resIndices.end(), resSpatialIndices.begin(), resSpatialIndices.end());
+
+                    // Compute arg start indices of the window in the padded argument
+                    SmallVector<IndexHandle, 4> argStartIndices;
+                    for (auto i = 0; i < spatialRank; i++)
+                    {
+                        auto stride = intrinsics::constant_index(strides[i]);
+                        argStartIndices.push_back(IndexHandle(resSpatialIndices[i] * stride));
+                    }
+
+                    if (isAvgPool)
+                    {
+                        iRes(resIndices) = createZeroConstant(elemTy);
+                    }
+                    else
+                    {
+                        SmallVector<IndexHandle, 4> argIndices{n, c};
+                        argIndices.insert(
+                            argIndices.end(), argStartIndices.begin(), argStartIndices.end());
+                        iRes(resIndices) = iArg(argIndices);
+                    }
+
+                    // Window loop
+                    AffineLoopNestBuilder(
+                        windowIndicesPtrs, windowLbs, windowUbs, windowSteps)([&] {
+                        SmallVector<IndexHandle, 4> argIndices{n, c};
+                        for (auto i = 0; i < spatialRank; i++)
+                        {
+                            argIndices.push_back(
+                                IndexHandle(argStartIndices[i] + windowIndices[i]));
+                        }
+
+                        if (withPadding)
+                        {
+                            // if args : arg dims, arg lbs, arg ubs
+                            SmallVector<Value*, 4> affineIfArgs(argIndices.begin() + 2,
+                                                                argIndices.end());
+                            affineIfArgs.insert(
+                                affineIfArgs.end(), argSpatialLbs.begin(), argSpatialLbs.end());
+                            affineIfArgs.insert(
+                                affineIfArgs.end(), argSpatialUbs.begin(), argSpatialUbs.end());
+
+                            auto affineIfOp =
+                                rewriter.create<AffineIfOp>(rewriter.getUnknownLoc(),
+                                                            nonPaddedRange,
+                                                            affineIfArgs,
+                                                            /*withElseRegion=*/false);
+                            {
+                                auto rewriter = affineIfOp.getThenBodyBuilder();
+                                ScopedContext scope(rewriter, loc);
+                                // Subtract pad below before the load, since the physical
+                                // argument is not padded.
+                                SmallVector<IndexHandle, 4> adjustedArgIndices{n, c};
+                                for (auto i = 0; i < spatialRank; i++)
+                                {
+                                    adjustedArgIndices.push_back(IndexHandle(
+                                        argIndices[2 + i] -
+                                        intrinsics::constant_index(padBelow[i])));
+                                }
+                                iRes(resIndices) = iRes(resIndices) + iArg(adjustedArgIndices);
+                            }
+                        }
+                        else if (isAvgPool)
+                        {
+                            iRes(resIndices) = iRes(resIndices) + iArg(argIndices);
+                        }
+                        else
+                        {
+                            ValueHandle val = iArg(argIndices);
+                            ValueHandle currMax = iRes(resIndices);
+                            iRes(resIndices) = intrinsics::select(val > currMax, val, currMax);
+                        }
+                    });
+
+                    if (isAvgPool)
+                    {
+                        iRes(resIndices) = ValueHandle(iRes(resIndices)) /
+                                           createFloatConstant(elemTy, windowSize);
+                    }
+                });
+            });
+        });
+
+        rewriter.replaceOp(op, {result});
+    }
+
     ValueHandle createZeroConstant(mlir::Type type)
     {
         if (auto floatTy = type.dyn_cast<FloatType>())
@@ -1339,6 +2097,74 @@ namespace
         }
         NGRAPH_UNREACHABLE("Unsupported type");
     }
+
+    ValueHandle createFloatConstant(mlir::Type type, double value)
+    {
+        auto floatTy = type.dyn_cast<FloatType>();
+        NGRAPH_CHECK(floatTy, "Expected floating-point type");
+        if (floatTy.isF32())
+        {
+            return intrinsics::constant_float(llvm::APFloat(static_cast<float>(value)), floatTy);
+        }
+        else if (floatTy.isF64())
+        {
+            return intrinsics::constant_float(llvm::APFloat(value), floatTy);
+        }
+        NGRAPH_UNREACHABLE("Unsupported floating-point precision");
+    }
+
+    /// Creates the IntegerSet of virtual (padded) spatial indices that fall into the non-padded
+    /// region of a tensor. The set has one dimension per spatial index and takes the lower
+    /// bounds followed by the upper bounds of the physical spatial dimensions as symbols.
+    /// Tags the outermost loop of the nest with induction variables `ivs` as parallel, i.e.,
+    /// its iterations write disjoint memory and read nothing written by other iterations. Loop
+    /// nests without induction variables are left untouched.
+    void markOuterLoopParallel(ArrayRef<IndexHandle> ivs)
+    {
+        if (ivs.empty())
+        {
+            return;
+        }
+        if (AffineForOp loop = getForInductionVarOwner(ivs.front().getValue()))
+        {
+            loop.setAttr(kParallelLoopAttrName, UnitAttr::get(loop.getContext()));
+        }
+    }
+
+    IntegerSet createNonPaddedRangeSet(ArrayRef<int64_t> padBelow, PatternRewriter& rewriter)
+    {
+        unsigned spatialRank = padBelow.size();
+        // Create affine expressions and IntegerSet
+        // IntegerSet (d0, d1, .. d_N-1)[LB_0, LB_1, .. LB_N-1, UB_0, UB_1, .. UB_N-1], where
+        // for each dim:
+        //   (d_dim - padBelow[dim] - LB_dim >= 0),
+        //   (padBelow[dim] + UB_dim - d_dim - 1 >= 0)
+        SmallVector<AffineExpr, 4> affineExprs;
+        // Bool to indicate if expr is equality or inequality
+        SmallVector<bool, 4> isEq;
+
+        for (unsigned dim = 0; dim < spatialRank; dim++)
+        {
+            // i_dim
+            auto dimExpr = rewriter.getAffineDimExpr(dim);
+            auto imgLbExpr = rewriter.getAffineSymbolExpr(dim);
+
+            // expr1 : i_dim - padBelow[dim] - imgLB >= 0
+            auto padBelowExpr = rewriter.getAffineConstantExpr(padBelow[dim]);
+            affineExprs.push_back(dimExpr - padBelowExpr - imgLbExpr);
+            isEq.push_back(false);
+
+            // expr2: padBelow[dim] + imgUB - i_dim - 1 >= 0
+            auto imgUbExpr = rewriter.getAffineSymbolExpr(spatialRank + dim);
+            auto oneExpr = rewriter.getAffineConstantExpr(1);
+            affineExprs.push_back(padBelowExpr + imgUbExpr - dimExpr - oneExpr);
+            isEq.push_back(false);
+        }
+
+        NGRAPH_CHECK(affineExprs.size() == isEq.size() && isEq.size() == 2 * spatialRank,
+                     "Invalid number of expressions in the IntegerSet");
+        return IntegerSet::get(spatialRank, 2 * spatialRank, affineExprs, isEq);
+    }
 }
 
 namespace mlir
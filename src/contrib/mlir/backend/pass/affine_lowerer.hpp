@@ -37,4 +37,17 @@ namespace ngraph
 namespace mlir
 {
     std::unique_ptr<Pass> createDialectLoweringPass();
+
+    /// Unit attribute set by the lowering on the outermost affine.for of a loop nest whose
+    /// iterations are independent of each other.
+    constexpr const char* kParallelLoopAttrName = "ng.parallel";
+
+    /// Function attributes set by the lowering when the function uses temporaries: the size in
+    /// bytes of the arena holding them and the byte offset in the arena of each temporary. The
+    /// temporaries are the trailing function arguments, in the order of the offsets.
+    constexpr const char* kArenaSizeAttrName = "ng.arena_size";
+    constexpr const char* kArenaOffsetsAttrName = "ng.arena_offsets";
+
+    /// Alignment in bytes of the arena and of every temporary within it.
+    constexpr size_t kArenaAlignment = 64;
 }
@@ -0,0 +1,275 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since it does
+// not expose public API to the rest of nGraph codebase and heavily depends on MLIR API.
+
+#include "parallel_outlining.hpp"
+#include "contrib/mlir/backend/pass/affine_lowerer.hpp"
+
+#include "ngraph/check.hpp"
+
+#include <llvm/ADT/SmallPtrSet.h>
+#include <llvm/ADT/Twine.h>
+#include <llvm/Support/Debug.h>
+#include <mlir/Dialect/AffineOps/AffineOps.h>
+#include <mlir/Dialect/StandardOps/Ops.h>
+#include <mlir/IR/AffineExpr.h>
+#include <mlir/IR/AffineMap.h>
+#include <mlir/IR/BlockAndValueMapping.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/Function.h>
+#include <mlir/IR/Module.h>
+#include <mlir/IR/StandardTypes.h>
+
+#include <algorithm>
+#include <vector>
+
+#define DEBUG_TYPE "ngraph-parallel-outlining"
+
+// anonymous namespace
+// no need to expose any of the following outside of this file
+namespace
+{
+    using namespace mlir;
+
+    /// Parallel Outlining pass
+    /// - Splits the body of every lowered function into stages: each top-level loop nest is a
+    ///   stage and so is each run of other top-level operations. Every stage is outlined into a
+    ///   function with the arguments of the original function plus a task id.
+    /// - In loop nests tagged as parallel by the affine lowering, the outermost loop is split into
+    ///   chunks of consecutive iterations and the task id selects the chunk executed by a call.
+    /// - The runtime executes the stages in order and the tasks of a stage concurrently. The
+    ///   original function is not modified and remains the serial entry point.
+    /// Functions without any parallel loop nest or whose stages would exchange SSA values are
+    /// not outlined.
+    class ParallelOutliningPass : public ModulePass<ParallelOutliningPass>
+    {
+    public:
+        explicit ParallelOutliningPass(unsigned numTasks)
+            : numTasks(numTasks)
+        {
+        }
+
+        void runOnModule() override;
+
+    private:
+        using Stage = std::vector<Operation*>;
+
+        void outlineStages(FuncOp func);
+        bool isPartitionable(const Stage& stage);
+        bool isSelfContained(const Stage& stage, Block& body);
+        unsigned partitionLoop(AffineForOp loop, Value* taskId);
+
+        unsigned numTasks;
+    };
+
+    void ParallelOutliningPass::runOnModule()
+    {
+        if (numTasks < 2)
+        {
+            return;
+        }
+
+        // Stage functions are added to the module so collect the original functions first.
+        SmallVector<FuncOp, 2> funcs(getModule().getOps<FuncOp>());
+        for (auto func : funcs)
+        {
+            if (!func.isExternal())
+            {
+                outlineStages(func);
+            }
+        }
+    }
+
+    void ParallelOutliningPass::outlineStages(FuncOp func)
+    {
+        Block& body = func.front();
+
+        // Constants are not stages, they are cloned into every stage using them.
+        std::vector<Stage> stages;
+        bool startStage = true;
+        for (auto& op : body)
+        {
+            if (isa<ConstantOp>(op) || op.isKnownTerminator())
+            {
+                continue;
+            }
+            if (isa<AffineForOp>(op))
+            {
+                stages.push_back({&op});
+                startStage = true;
+                continue;
+            }
+            if (startStage)
+            {
+                stages.emplace_back();
+                startStage = false;
+            }
+            stages.back().push_back(&op);
+        }
+
+        if (std::none_of(stages.begin(), stages.end(), [this](const Stage& stage) {
+                return isPartitionable(stage);
+            }))
+        {
+            return;
+        }
+
+        for (auto& stage : stages)
+        {
+            if (!isSelfContained(stage, body))
+            {
+                return;
+            }
+        }
+
+        MLIRContext* context = &getContext();
+        SmallVector<Type, 8> argTypes(func.getType().getInputs().begin(),
+                                      func.getType().getInputs().end());
+        argTypes.push_back(IndexType::get(context));
+        FunctionType stageType = FunctionType::get(argTypes, {/*void*/}, context);
+        Type i64Ty = IntegerType::get(64, context);
+
+        SmallVector<Attribute, 8> stageNames;
+        for (unsigned i = 0, e = stages.size(); i < e; ++i)
+        {
+            std::string name = (func.getName() + "_stage" + llvm::Twine(i)).str();
+            FuncOp stageFunc = FuncOp::create(func.getLoc(), name, stageType);
+            getModule().push_back(stageFunc);
+            for (unsigned arg = 0, numArgs = func.getNumArguments(); arg < numArgs; ++arg)
+            {
+                stageFunc.setArgAttrs(arg, func.getArgAttrs(arg));
+            }
+
+            Block* entry = stageFunc.addEntryBlock();
+            OpBuilder builder(context);
+            builder.setInsertionPointToEnd(entry);
+
+            BlockAndValueMapping mapping;
+            for (unsigned arg = 0, numArgs = body.getNumArguments(); arg < numArgs; ++arg)
+            {
+                mapping.map(body.getArgument(arg), entry->getArgument(arg));
+            }
+            Value* taskId = entry->getArgument(body.getNumArguments());
+
+            SmallVector<Operation*, 4> clonedOps;
+            for (Operation* op : stages[i])
+            {
+                op->walk([&](Operation* nested) {
+                    for (Value* operand : nested->getOperands())
+                    {
+                        Operation* def = operand->getDefiningOp();
+                        if (def && def->getBlock() == &body && isa<ConstantOp>(def) &&
+                            !mapping.contains(operand))
+                        {
+                            builder.clone(*def, mapping);
+                        }
+                    }
+                });
+                clonedOps.push_back(builder.clone(*op, mapping));
+            }
+
+            unsigned stageTasks = 1;
+            if (isPartitionable(stages[i]))
+            {
+                stageTasks = partitionLoop(cast<AffineForOp>(clonedOps.front()), taskId);
+            }
+            builder.create<ReturnOp>(func.getLoc());
+
+            stageFunc.setAttr(kNumTasksAttrName, IntegerAttr::get(i64Ty, stageTasks));
+            stageNames.push_back(StringAttr::get(name, context));
+        }
+
+        func.setAttr(kStagesAttrName, ArrayAttr::get(stageNames, context));
+    }
+
+    /// Returns true if the stage is a parallel loop nest whose outermost loop has constant bounds
+    /// and more than one iteration.
+    bool ParallelOutliningPass::isPartitionable(const Stage& stage)
+    {
+        auto loop = dyn_cast<AffineForOp>(stage.front());
+        if (!loop || !loop.getAttr(kParallelLoopAttrName) || !loop.hasConstantBounds())
+        {
+            return false;
+        }
+        int64_t span = loop.getConstantUpperBound() - loop.getConstantLowerBound();
+        return span > loop.getStep();
+    }
+
+    /// Returns true if every value used in the stage is a function argument, a top-level constant
+    /// or is defined within the stage.
+    bool ParallelOutliningPass::isSelfContained(const Stage& stage, Block& body)
+    {
+        llvm::SmallPtrSet<Operation*, 8> stageOps(stage.begin(), stage.end());
+        bool selfContained = true;
+        for (Operation* op : stage)
+        {
+            op->walk([&](Operation* nested) {
+                for (Value* operand : nested->getOperands())
+                {
+                    Operation* def = operand->getDefiningOp();
+                    if (!def)
+                    {
+                        // Block arguments are either function arguments or induction variables of
+                        // loops within the stage.
+                        continue;
+                    }
+                    if (isa<ConstantOp>(def) ||
+                        stageOps.count(body.findAncestorOpInBlock(*def)) != 0)
+                    {
+                        continue;
+                    }
+                    selfContained = false;
+                }
+            });
+        }
+        return selfContained;
+    }
+
+    /// Restricts the outermost loop of a parallel nest to the chunk of iterations of the task
+    /// `taskId` and returns the number of tasks needed to cover all the iterations.
+    unsigned ParallelOutliningPass::partitionLoop(AffineForOp loop, Value* taskId)
+    {
+        int64_t lb = loop.getConstantLowerBound();
+        int64_t ub = loop.getConstantUpperBound();
+        int64_t step = loop.getStep();
+        int64_t tripCount = (ub - lb + step - 1) / step;
+        int64_t itersPerTask = (tripCount + numTasks - 1) / numTasks;
+        int64_t chunkSize = itersPerTask * step;
+        unsigned usedTasks = (tripCount + itersPerTask - 1) / itersPerTask;
+
+        // for %i = lb + taskId * chunkSize to min(lb + (taskId + 1) * chunkSize, ub)
+        MLIRContext* context = loop.getContext();
+        AffineExpr chunkBegin = getAffineDimExpr(0, context) * chunkSize + lb;
+        loop.setLowerBound({taskId}, AffineMap::get(1, 0, chunkBegin));
+        loop.setUpperBound(
+            {taskId},
+            AffineMap::get(1, 0, {chunkBegin + chunkSize, getAffineConstantExpr(ub, context)}));
+
+        LLVM_DEBUG(llvm::dbgs() << "Split loop with " << tripCount << " iterations into "
+                                << usedTasks << " tasks.\n");
+        return usedTasks;
+    }
+}
+
+namespace mlir
+{
+    std::unique_ptr<Pass> createParallelOutliningPass(unsigned numTasks)
+    {
+        return std::make_unique<ParallelOutliningPass>(numTasks);
+    }
+} // namespace mlir
@@ -0,0 +1,37 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since it does
+// not expose public API to the rest of nGraph codebase and heavily depends on MLIR API.
+
+#pragma once
+
+#include <mlir/Pass/Pass.h>
+
+namespace mlir
+{
+    /// Creates a pass that outlines the top-level loop nests of every lowered function into
+    /// stage functions whose parallel loops are split into at most \p numTasks tasks.
+    std::unique_ptr<Pass> createParallelOutliningPass(unsigned numTasks);
+
+    /// Attribute of a function with outlined stages: the names of the stage functions, in
+    /// execution order. Stages take the arguments of the function followed by a task id.
+    constexpr const char* kStagesAttrName = "ng.stages";
+
+    /// Attribute of a stage function: the number of tasks that must be invoked, with task ids
+    /// from 0 to the number of tasks minus one, to execute the whole stage.
+    constexpr const char* kNumTasksAttrName = "ng.num_tasks";
+}
@@ -89,10 +89,53 @@ static mlir::LogicalResult verifyBinaryArithOp(T* op)
     return verifyCompatibleOperandsAndResults(op);
 }
 
+/// Returns the integer values held by an I64 array attribute
+static SmallVector<int64_t, 4> getIntValues(ArrayAttr attr)
+{
+    SmallVector<int64_t, 4> values;
+    for (auto value : attr)
+    {
+        values.push_back(value.cast<IntegerAttr>().getInt());
+    }
+    return values;
+}
+
 template <typename T>
 static mlir::LogicalResult verifyAxisReductionOp(T* op)
 {
-    return mlir::failure();
+    NGTensorType operandType = op->operand()->getType().template cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().template cast<NGTensorType>();
+    int64_t rank = operandType.getRank();
+
+    // Reduction axes are unique and within the operand rank
+    SmallVector<bool, 4> isReduced(rank, false);
+    for (auto axis : getIntValues(op->axes()))
+    {
+        if (axis < 0 || axis >= rank || isReduced[axis])
+        {
+            return op->emitOpError("Invalid reduction axis");
+        }
+        isReduced[axis] = true;
+    }
+
+    // Result keeps the non-reduced dimensions, in order
+    if (resType.getElementType() != operandType.getElementType())
+    {
+        return op->emitOpError("Incompatible result type");
+    }
+    SmallVector<int64_t, 4> expectedShape;
+    for (int64_t i = 0; i < rank; i++)
+    {
+        if (!isReduced[i])
+        {
+            expectedShape.push_back(operandType.getShape()[i]);
+        }
+    }
+    if (resType.getShape() != Shape(expectedShape))
+    {
+        return op->emitOpError("Incompatible result shape");
+    }
+    return mlir::success();
 }
 
 template <typename T>
@@ -145,8 +188,11 @@ mlir::LogicalResult verifyOp(NGSelectOp* op)
     // arg1 arg2 of same shape and elt type
     if (!opType1.isCompatible(opType2))
         return op->emitOpError("Incompatible operand shapes or types for select op");
-    // arg0 of same shape and elt type is bool
-    if (!opType0.isCompatibleShape(opType1) || !opType0.getElementType().isa<NGBoolType>())
+    // arg0 of same shape and elt type is bool. nGraph booleans are carried as u8 tensors.
+    mlir::Type predType = opType0.getElementType();
+    bool isBoolPred = predType.isa<NGBoolType>() ||
+                      (predType.isa<NGIntegerType>() && predType.cast<NGIntegerType>().isUInt8());
+    if (!opType0.isCompatibleShape(opType1) || !isBoolPred)
         return op->emitOpError("Incompatible shape for arg0 of select op");
     // result is of same shape and elt type as arg1/2
     if (!resType.isCompatible(opType1))
@@ -306,6 +352,200 @@ mlir::LogicalResult verifyOp(NGConvolutionOp* op)
     return mlir::success();
 }
 
+template <>
+mlir::LogicalResult verifyOp(NGBroadcastOp* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().cast<NGTensorType>();
+    Shape resShape = resType.getShape();
+    int64_t resRank = resShape.size();
+
+    if (Shape(getIntValues(op->shape())) != resShape)
+    {
+        return op->emitOpError("Result shape does not match the broadcast shape");
+    }
+
+    SmallVector<bool, 4> isBroadcast(resRank, false);
+    for (auto axis : getIntValues(op->axisSet()))
+    {
+        if (axis < 0 || axis >= resRank || isBroadcast[axis])
+        {
+            return op->emitOpError("Invalid broadcast axis");
+        }
+        isBroadcast[axis] = true;
+    }
+
+    // The non-broadcast result dimensions are the argument dimensions, in order
+    SmallVector<int64_t, 4> keptShape;
+    for (int64_t i = 0; i < resRank; i++)
+    {
+        if (!isBroadcast[i])
+        {
+            keptShape.push_back(resShape[i]);
+        }
+    }
+    if (argType.getShape() != Shape(keptShape) ||
+        argType.getElementType() != resType.getElementType())
+    {
+        return op->emitOpError("Incompatible argument and result shapes or types");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGSlice* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().cast<NGTensorType>();
+    Shape argShape = argType.getShape();
+    Shape resShape = resType.getShape();
+    unsigned rank = argShape.size();
+
+    auto lowerBounds = getIntValues(op->lowerBounds());
+    auto upperBounds = getIntValues(op->upperBounds());
+    auto strides = getIntValues(op->strides());
+    if (lowerBounds.size() != rank || upperBounds.size() != rank || strides.size() != rank ||
+        resShape.size() != rank)
+    {
+        return op->emitOpError("Slice bounds, strides and result must match the argument rank");
+    }
+
+    for (unsigned i = 0; i < rank; i++)
+    {
+        if (strides[i] <= 0)
+        {
+            return op->emitOpError("Slice strides must be positive");
+        }
+        if (lowerBounds[i] < 0 || lowerBounds[i] > upperBounds[i] || upperBounds[i] > argShape[i])
+        {
+            return op->emitOpError("Slice bounds are out of the argument range");
+        }
+        if (resShape[i] != llvm::divideCeil(upperBounds[i] - lowerBounds[i], strides[i]))
+        {
+            return op->emitOpError("Invalid result shape");
+        }
+    }
+    if (argType.getElementType() != resType.getElementType())
+    {
+        return op->emitOpError("Incompatible result type");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGReshape* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().cast<NGTensorType>();
+    int64_t rank = argType.getRank();
+
+    // Axis order is a permutation of the argument axes
+    auto axisOrder = getIntValues(op->axisOrder());
+    SmallVector<bool, 4> seen(rank, false);
+    if (static_cast<int64_t>(axisOrder.size()) != rank)
+    {
+        return op->emitOpError("Axis order must match the argument rank");
+    }
+    for (auto axis : axisOrder)
+    {
+        if (axis < 0 || axis >= rank || seen[axis])
+        {
+            return op->emitOpError("Axis order is not a permutation of the argument axes");
+        }
+        seen[axis] = true;
+    }
+
+    if (Shape(getIntValues(op->shape())) != resType.getShape() ||
+        argType.getNumElements() != resType.getNumElements() ||
+        argType.getElementType() != resType.getElementType())
+    {
+        return op->emitOpError("Incompatible result shape or type");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGSoftMax* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().cast<NGTensorType>();
+
+    for (auto axis : getIntValues(op->axes()))
+    {
+        if (axis < 0 || axis >= argType.getRank())
+        {
+            return op->emitOpError("Softmax axis is out of the argument rank");
+        }
+    }
+    if (!resType.isCompatible(argType))
+    {
+        return op->emitOpError("Incompatible result shape or type");
+    }
+    return mlir::success();
+}
+
+/// Checks window, stride and padding ranks of a pooling op and its result shape
+template <typename T>
+static mlir::LogicalResult verifyPoolOp(T* op)
+{
+    NGTensorType argType = op->arg()->getType().template cast<NGTensorType>();
+    NGTensorType resType = op->res()->getType().template cast<NGTensorType>();
+    Shape argShape = argType.getShape();
+    Shape resShape = resType.getShape();
+
+    if (argShape.size() < 3)
+    {
+        return op->emitOpError("Argument shape of rank below 3");
+    }
+    unsigned spatialRank = argShape.size() - 2;
+
+    auto windowShape = getIntValues(op->windowShape());
+    auto strides = getIntValues(op->windowMovementStrides());
+    auto padBelow = getIntValues(op->padBelow());
+    auto padAbove = getIntValues(op->padAbove());
+    if (windowShape.size() != spatialRank || strides.size() != spatialRank ||
+        padBelow.size() != spatialRank || padAbove.size() != spatialRank)
+    {
+        return op->emitOpError("Argument spatial rank mismatches window, strides or padding");
+    }
+
+    if (resShape.size() != argShape.size() || resShape[0] != argShape[0] ||
+        resShape[1] != argShape[1] || resType.getElementType() != argType.getElementType())
+    {
+        return op->emitOpError("Invalid result shape or type");
+    }
+
+    for (unsigned i = 0; i < spatialRank; i++)
+    {
+        int64_t paddedDim = padBelow[i] + argShape[2 + i] + padAbove[i];
+        if (strides[i] <= 0 || windowShape[i] <= 0 || windowShape[i] > paddedDim)
+        {
+            return op->emitOpError("Invalid window shape or strides");
+        }
+        int64_t windowSpan = paddedDim - windowShape[i];
+        int64_t resDim = (op->ceilMode() ? llvm::divideCeil(windowSpan, strides[i])
+                                         : windowSpan / strides[i]) +
+                         1;
+        if (resShape[2 + i] != resDim)
+        {
+            return op->emitOpError("Invalid result spatial shape");
+        }
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGAvgPoolOp* op)
+{
+    return verifyPoolOp(op);
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGMaxPoolOp* op)
+{
+    return verifyPoolOp(op);
+}
+
 static std::string getBufferIdAttrName()
 {
     return "ng.buffer_id";
@@ -24,21 +24,33 @@
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/argmax.hpp"
 #include "ngraph/op/argmin.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/less.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
 
 using namespace ngraph::descriptor;
 using namespace ngraph::op;
@@ -498,6 +510,84 @@ bool MLIRSubgraphExtractionPass::is_supported_mlir_op(std::shared_ptr<Node> node
 
     // check on invariants expected by MLIR backend
 
+    // Transcendental ops and averaging are only lowered for f32 and f64
+    if (TI(ngraph::op::Exp) == TI(*node) || TI(ngraph::op::Tanh) == TI(*node) ||
+        TI(ngraph::op::Sigmoid) == TI(*node) || TI(ngraph::op::Softmax) == TI(*node) ||
+        TI(ngraph::op::AvgPool) == TI(*node))
+    {
+        auto et = node->get_element_type();
+        if (et != element::f32 && et != element::f64)
+        {
+            return false;
+        }
+    }
+
+    // Reduction axes must be constant. Max and Softmax start from the first element along the
+    // reduced axes, so these cannot be empty.
+    if (TI(ngraph::op::Sum) == TI(*node) || TI(ngraph::op::Max) == TI(*node))
+    {
+        auto reduction = static_cast<ngraph::op::util::ArithmeticReduction*>(node.get());
+        if (!reduction->reduction_axes_constant())
+        {
+            return false;
+        }
+        if (TI(ngraph::op::Max) == TI(*node))
+        {
+            for (auto axis : reduction->get_reduction_axes())
+            {
+                if (node->get_input_shape(0)[axis] == 0)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    if (TI(ngraph::op::Softmax) == TI(*node))
+    {
+        auto softmax = static_cast<ngraph::op::Softmax*>(node.get());
+        if (!softmax->are_axes_constant())
+        {
+            return false;
+        }
+        for (auto axis : softmax->get_axes())
+        {
+            if (node->get_input_shape(0)[axis] == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Pooling windows must stay within the padded input. Padding is only supported when it
+    // contributes zeros to an average.
+    if (TI(ngraph::op::AvgPool) == TI(*node))
+    {
+        auto avg_pool = static_cast<ngraph::op::AvgPool*>(node.get());
+        auto pad_below = avg_pool->get_padding_below();
+        auto pad_above = avg_pool->get_padding_above();
+        auto is_zero = [](size_t s) { return s == 0; };
+
+        return !avg_pool->get_ceil_mode() &&
+               (avg_pool->get_include_padding_in_avg_computation() ||
+                (std::all_of(pad_below.begin(), pad_below.end(), is_zero) &&
+                 std::all_of(pad_above.begin(), pad_above.end(), is_zero)));
+    }
+
+    if (TI(ngraph::op::MaxPool) == TI(*node))
+    {
+        auto max_pool = static_cast<ngraph::op::MaxPool*>(node.get());
+        auto pad_below = max_pool->get_padding_below();
+        auto pad_above = max_pool->get_padding_above();
+        auto is_zero = [](size_t s) { return s == 0; };
+
+        return !max_pool->get_ceil_mode() &&
+               std::all_of(pad_below.begin(), pad_below.end(), is_zero) &&
+               std::all_of(pad_above.begin(), pad_above.end(), is_zero);
+    }
+
     if (TI(ngraph::op::Divide) == TI(*node))
     {
         auto* div = static_cast<ngraph::op::Divide*>(node.get());
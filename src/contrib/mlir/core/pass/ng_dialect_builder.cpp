@@ -29,20 +29,33 @@
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/argmax.hpp"
 #include "ngraph/op/argmin.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/less.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
 #include "ngraph/op/util/index_reduction.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -113,12 +126,17 @@ namespace
 
         // Generic op lowerer to ng dialect.
         // Simply maps ngraph tensors to values and generate an OP. No op-specific logic.
+        // Only the first inNum inputs are mapped to operands if inNum is not negative, e.g., to
+        // skip constant inputs that are turned into attributes.
         template <typename Op>
-        mlir::Operation* createGenericOp(const ngraph::Node* ngNode);
+        mlir::Operation* createGenericOp(const ngraph::Node* ngNode, int inNum = -1);
 
         template <typename RedOp>
         mlir::Operation* createIndexReduction(const ngraph::Node* ngNode);
 
+        template <typename RedOp>
+        mlir::Operation* createAxisReduction(const ngraph::Node* ngNode);
+
         void createReturn();
 
         /// Converts nGraph shape-like types \p ng_shape to MLIR shape \p mlir_shape.
@@ -437,15 +455,137 @@ mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Convolutio
     return op;
 }
 
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Exp)
+{
+    return NgDialectObj.createGenericOp<mlir::NGExpOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Tanh)
+{
+    return NgDialectObj.createGenericOp<mlir::NGTanhOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Sigmoid)
+{
+    return NgDialectObj.createGenericOp<mlir::NGSigmoidOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Select)
+{
+    return NgDialectObj.createGenericOp<mlir::NGSelectOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Sum)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGSumRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Max)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGMaxRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Broadcast)
+{
+    auto broadcastNode = static_cast<const ngraph::op::Broadcast*>(ngNode);
+    auto broadcastOp =
+        llvm::cast<mlir::NGBroadcastOp>(NgDialectObj.createGenericOp<mlir::NGBroadcastOp>(ngNode));
+
+    broadcastOp.setShape(NgDialectObj.getShapeAsAttr(broadcastNode->get_broadcast_shape()));
+    broadcastOp.setAxisSet(NgDialectObj.getShapeAsAttr(broadcastNode->get_broadcast_axes()));
+    return broadcastOp.getOperation();
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Reshape)
+{
+    auto reshapeNode = static_cast<const ngraph::op::Reshape*>(ngNode);
+    auto reshapeOp =
+        llvm::cast<mlir::NGReshape>(NgDialectObj.createGenericOp<mlir::NGReshape>(ngNode));
+
+    reshapeOp.setAxisOrder(NgDialectObj.getShapeAsAttr(reshapeNode->get_input_order()));
+    reshapeOp.setShape(NgDialectObj.getShapeAsAttr(reshapeNode->get_output_shape()));
+    return reshapeOp.getOperation();
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Slice)
+{
+    auto sliceNode = static_cast<const ngraph::op::Slice*>(ngNode);
+    auto sliceOp = llvm::cast<mlir::NGSlice>(NgDialectObj.createGenericOp<mlir::NGSlice>(ngNode));
+
+    sliceOp.setLowerBounds(NgDialectObj.getShapeAsAttr(sliceNode->get_lower_bounds()));
+    sliceOp.setUpperBounds(NgDialectObj.getShapeAsAttr(sliceNode->get_upper_bounds()));
+    sliceOp.setStrides(NgDialectObj.getShapeAsAttr(sliceNode->get_strides()));
+    return sliceOp.getOperation();
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::Softmax)
+{
+    auto softmaxNode = static_cast<const ngraph::op::Softmax*>(ngNode);
+    // Softmax axes are a constant input in nGraph, so only the data input becomes an operand.
+    auto softmaxOp = llvm::cast<mlir::NGSoftMax>(
+        NgDialectObj.createGenericOp<mlir::NGSoftMax>(ngNode, 1 /* inNum */));
+
+    softmaxOp.setAxes(NgDialectObj.getShapeAsAttr(softmaxNode->get_axes()));
+    return softmaxOp.getOperation();
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::AvgPool)
+{
+    mlir::Operation* op = NgDialectObj.createGenericOp<mlir::NGAvgPoolOp>(ngNode);
+    auto avgPoolNode = static_cast<const ngraph::op::AvgPool*>(ngNode);
+    auto& builder = NgDialectObj.m_builder;
+
+    op->setAttr("windowShape", NgDialectObj.getShapeAsAttr(avgPoolNode->get_window_shape()));
+    op->setAttr("windowMovementStrides",
+                NgDialectObj.getShapeAsAttr(avgPoolNode->get_window_movement_strides()));
+    op->setAttr("padBelow", NgDialectObj.getShapeAsAttr(avgPoolNode->get_padding_below()));
+    op->setAttr("padAbove", NgDialectObj.getShapeAsAttr(avgPoolNode->get_padding_above()));
+    op->setAttr("includePadding",
+                builder.getBoolAttr(avgPoolNode->get_include_padding_in_avg_computation()));
+    op->setAttr("ceilMode", builder.getBoolAttr(avgPoolNode->get_ceil_mode()));
+    return op;
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::COMPILE_OP_DECL(ngraph::op::MaxPool)
+{
+    mlir::Operation* op = NgDialectObj.createGenericOp<mlir::NGMaxPoolOp>(ngNode);
+    auto maxPoolNode = static_cast<const ngraph::op::MaxPool*>(ngNode);
+
+    op->setAttr("windowShape", NgDialectObj.getShapeAsAttr(maxPoolNode->get_window_shape()));
+    op->setAttr("windowMovementStrides",
+                NgDialectObj.getShapeAsAttr(maxPoolNode->get_window_movement_strides()));
+    op->setAttr("padBelow", NgDialectObj.getShapeAsAttr(maxPoolNode->get_padding_below()));
+    op->setAttr("padAbove", NgDialectObj.getShapeAsAttr(maxPoolNode->get_padding_above()));
+    op->setAttr("ceilMode", NgDialectObj.m_builder.getBoolAttr(maxPoolNode->get_ceil_mode()));
+    return op;
+}
+
 template <typename Op>
-mlir::Operation* NgDialectConversionPass::createGenericOp(const ngraph::Node* ngNode)
+mlir::Operation* NgDialectConversionPass::createGenericOp(const ngraph::Node* ngNode, int inNum)
 {
     std::vector<mlir::Value*> argValues;
     std::vector<mlir::Type> resTypes;
     auto inputMap = m_compiledKernel->get_input_map();
     std::shared_ptr<descriptor::Tensor> argTensor;
+    int i = 0;
     for (auto& argOutput : ngNode->input_values())
     {
+        if (inNum != -1 && i == inNum)
+        {
+            break;
+        }
         auto argOutputNode = argOutput.get_node();
         if (as_type<op::Parameter>(argOutputNode))
         {
@@ -461,6 +601,7 @@ mlir::Operation* NgDialectConversionPass::createGenericOp(const ngraph::Node* ng
 
         auto argV = getTensorValue(argTensor.get()).m_value;
         argValues.push_back(argV);
+        i++;
     }
 
     for (auto& output : ngNode->outputs())
@@ -502,6 +643,16 @@ mlir::Operation* NgDialectConversionPass::createIndexReduction(const ngraph::Nod
     return op;
 }
 
+template <typename RedOp>
+mlir::Operation* NgDialectConversionPass::createAxisReduction(const ngraph::Node* ngNode)
+{
+    auto* axisRed = static_cast<const ngraph::op::util::ArithmeticReduction*>(ngNode);
+    // Reduction axes are a constant input in nGraph, so only the data input becomes an operand.
+    auto op = createGenericOp<RedOp>(ngNode, 1 /* inNum */);
+    op->setAttr("axes", getShapeAsAttr(axisRed->get_reduction_axes()));
+    return op;
+}
+
 std::unique_ptr<mlir::Pass>
     ngraph::pass::createNgDialectConversionPass(const ngraph::op::CompiledKernel* compiledKernel,
                                                 mlir::MLIRContext* context)
@@ -19,8 +19,12 @@
 
 #include "cpu_runtime.hpp"
 #include "contrib/mlir/backend/cpu/cpu_backend.hpp"
+#include "contrib/mlir/backend/pass/affine_lowerer.hpp"
+#include "contrib/mlir/backend/pass/parallel_outlining.hpp"
 #include "ngraph/check.hpp"
 
+#include <algorithm>
+
 #include <llvm/ADT/STLExtras.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
@@ -53,6 +57,11 @@ static llvm::cl::opt<std::string>
     clObjectFilename("ngraph-mlir-object-filename",
                      llvm::cl::desc("Dump MLIR JITted-compiled object to file jitted_mlir.o"));
 
+MLIRCPURuntime::~MLIRCPURuntime()
+{
+    cleanup();
+}
+
 void MLIRCPURuntime::run(void* args)
 {
     run_internal(*reinterpret_cast<std::vector<void*>*>(args));
@@ -60,47 +69,113 @@ void MLIRCPURuntime::run(void* args)
 
 void MLIRCPURuntime::run_internal(std::vector<void*>& externalTensors)
 {
+    if (!m_engine)
+    {
+        initialize();
+    }
+
+    bindArguments(externalTensors);
+    execute();
+}
+
+// Compiles the module and sets up everything that does not depend on the external tensors. The
+// call ABI takes a list of type-erased pointers to arguments (see allocateMemrefArgs). The
+// arguments of the MLIR function are the external tensors followed by the temporaries, which are
+// bound to their offset in the arena here, once.
+void MLIRCPURuntime::initialize()
+{
+    NGRAPH_CHECK(m_module, "MLIR module is not ready.");
+
+    auto func = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>("main");
+    NGRAPH_CHECK(func && !func.getBlocks().empty(), "Function not found");
+
     // Create an MLIR execution engine. We use a null MLIR pass manager for now to make sure we
     // don't run MLIR passes that were already run. We also pass a default transformer created with
-    // the default or user-provided optimization level.
-    auto llvmTransformer = mlir::makeOptimizingTransformer(
-        MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, MLIRCPUBackend::targetMachine.get());
+    // the default or user-provided optimization level. Every function is annotated with the host
+    // CPU and its features so that the LLVM vectorizers and code generator use the host SIMD
+    // width.
+    llvm::TargetMachine* targetMachine = MLIRCPUBackend::targetMachine.get();
+    auto optimizingTransformer = mlir::makeOptimizingTransformer(
+        MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, targetMachine);
+    auto llvmTransformer = [optimizingTransformer, targetMachine](llvm::Module* module) {
+        for (auto& function : *module)
+        {
+            function.addFnAttr("target-cpu", targetMachine->getTargetCPU());
+            function.addFnAttr("target-features", targetMachine->getTargetFeatureString());
+        }
+        return optimizingTransformer(module);
+    };
     auto maybeEngine = mlir::ExecutionEngine::create(
         m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
     NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
     m_engine = std::move(maybeEngine.get());
 
-    bindArguments(externalTensors);
-    execute();
-    cleanup();
+    if (clDumpObjectFile)
+    {
+        m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
+                                                            : clObjectFilename.getValue());
+    }
+
+    m_invokeArgs = allocateMemrefArgs(func.getNumArguments());
+    NGRAPH_CHECK(m_invokeArgs.size(), "Arguments can't be created");
+
+    if (auto offsets = func.getAttrOfType<mlir::ArrayAttr>(mlir::kArenaOffsetsAttrName))
+    {
+        auto arenaSize = func.getAttrOfType<mlir::IntegerAttr>(mlir::kArenaSizeAttrName);
+        NGRAPH_CHECK(arenaSize, "Arena size not found");
+        m_arena.reset(new AlignedBuffer(arenaSize.getInt(), mlir::kArenaAlignment));
+
+        size_t firstTemp = m_invokeArgs.size() - offsets.size();
+        for (size_t i = 0, numTemps = offsets.size(); i < numTemps; ++i)
+        {
+            auto offset = offsets.getValue()[i].cast<mlir::IntegerAttr>().getInt();
+            auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(m_invokeArgs[firstTemp + i]));
+            memRefArg->data = m_arena->get_ptr(offset);
+        }
+    }
+
+    if (auto stageNames = func.getAttrOfType<mlir::ArrayAttr>(mlir::kStagesAttrName))
+    {
+        size_t maxTasks = 1;
+        for (auto nameAttr : stageNames)
+        {
+            StringRef name = nameAttr.cast<mlir::StringAttr>().getValue();
+            auto stageFunc = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>(name);
+            NGRAPH_CHECK(stageFunc, "Stage function not found");
+            auto numTasks = stageFunc.getAttrOfType<mlir::IntegerAttr>(mlir::kNumTasksAttrName);
+            NGRAPH_CHECK(numTasks, "Number of tasks not found");
+
+            auto expectedFunc = m_engine->lookup(name);
+            NGRAPH_CHECK(expectedFunc, "Stage function not compiled");
+            m_stages.push_back({*expectedFunc, static_cast<size_t>(numTasks.getInt())});
+            maxTasks = std::max(maxTasks, m_stages.back().numTasks);
+        }
+
+        // The memref descriptors are shared by all the tasks, only the task id differs.
+        m_taskIds.resize(maxTasks);
+        m_taskArgs.resize(maxTasks);
+        for (size_t task = 0; task < maxTasks; ++task)
+        {
+            m_taskIds[task] = task;
+            m_taskArgs[task] = m_invokeArgs;
+            m_taskArgs[task].push_back(&m_taskIds[task]);
+        }
+    }
 }
 
 // Binds MLIR function arguments to the proper values. This includes externally allocated tensors
 // helpers to be used inside the function.
 void MLIRCPURuntime::bindArguments(std::vector<void*>& externalTensors)
 {
-    NGRAPH_CHECK(m_module, "MLIR module is not ready.");
-
-    auto func = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>("main");
-    NGRAPH_CHECK(func && !func.getBlocks().empty(), "Function not found");
-
     // Set external arguments
     m_externalTensors = &externalTensors;
 
-    // Create list with a type-erased double pointer for each invocation arguments.
-    // We currently use 'allocateMemrefArgs', which creates the arguments list per call ABI (see
-    // comment below).
-    // StaticMemRef is just a struct with the actual pointer to the data.
-
-    auto expectedArguments = allocateMemrefArgs();
-    NGRAPH_CHECK(expectedArguments.size(), "Arguments can't be created");
-    m_invokeArgs = std::move(expectedArguments);
-
-    NGRAPH_CHECK(m_invokeArgs.size() == m_externalTensors->size(),
+    NGRAPH_CHECK(m_invokeArgs.size() >= m_externalTensors->size(),
                  "Number of external tensors doesn't match number of function arguments");
 
-    // Assign external tensor pointers to invocation arguments.
-    for (size_t i = 0, numArgs = m_invokeArgs.size(); i < numArgs; ++i)
+    // Assign external tensor pointers to invocation arguments. The remaining arguments are the
+    // temporaries, already bound to the arena.
+    for (size_t i = 0, numArgs = m_externalTensors->size(); i < numArgs; ++i)
     {
         auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(m_invokeArgs[i]));
         memRefArg->data = reinterpret_cast<float*>((*m_externalTensors)[i]);
@@ -110,18 +185,33 @@ void MLIRCPURuntime::bindArguments(std::vector<void*>& externalTensors)
 // Lowers standard dialect to LLVM dialect and uses the MLIR execution engine to execute the code.
 void MLIRCPURuntime::execute()
 {
-    // Invoke the JIT-compiled function with the arguments. Note that, for API
-    // uniformity reasons, it takes a list of type-erased pointers to arguments.
-    // Please, note that 'invoke' method is overloaded with a parameter pack version.
-    // Make sure the MutableArrayRef version is invoked.
-    auto invocationResult = m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invokeArgs));
+    if (m_stages.empty() || !m_taskDispatcher)
+    {
+        // Invoke the JIT-compiled function with the arguments. Note that, for API
+        // uniformity reasons, it takes a list of type-erased pointers to arguments.
+        // Please, note that 'invoke' method is overloaded with a parameter pack version.
+        // Make sure the MutableArrayRef version is invoked.
+        auto invocationResult =
+            m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invokeArgs));
+        NGRAPH_CHECK(!invocationResult, "JIT invocation of 'main' failed\n");
+        return;
+    }
 
-    if (clDumpObjectFile)
+    // Stages must run in order: a stage may read anything written by the previous ones.
+    for (const Stage& stage : m_stages)
     {
-        m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                            : clObjectFilename.getValue());
+        PackedFunc stageFunc = stage.func;
+        if (stage.numTasks == 1)
+        {
+            stageFunc(m_taskArgs[0].data());
+        }
+        else
+        {
+            m_taskDispatcher(stage.numTasks, [this, stageFunc](size_t task) {
+                stageFunc(m_taskArgs[task].data());
+            });
+        }
     }
-    NGRAPH_CHECK(!invocationResult, "JIT invocation of 'main' failed\n");
 }
 
 void MLIRCPURuntime::cleanup()
@@ -133,6 +223,7 @@ void MLIRCPURuntime::cleanup()
         free(memRefArg);
         free(arg);
     }
+    m_invokeArgs.clear();
 }
 
 // The current call ABI takes a single arg pointer (argPtr) pointing to a list of args.
@@ -142,10 +233,10 @@ void MLIRCPURuntime::cleanup()
 // argPtr-> arg[0]-> StaticMemRef -> <data>
 //          arg[1]-> StaticMemRef -> <data>
 //          ...
-SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs()
+SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs(unsigned numArgs)
 {
     SmallVector<void*, 8> args;
-    for (auto i = 0; i < m_externalTensors->size(); i++)
+    for (unsigned i = 0; i < numArgs; i++)
     {
         auto descriptor = allocateMemrefDescriptor();
         StaticMemRef** arg = reinterpret_cast<StaticMemRef**>(malloc(sizeof(StaticMemRef*)));
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <mlir/ExecutionEngine/ExecutionEngine.h>
 #include <mlir/IR/Builders.h>
@@ -26,6 +27,7 @@
 #include <mlir/IR/Types.h>
 #include "contrib/mlir/backend/backend.hpp"
 #include "contrib/mlir/runtime/runtime.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 
 namespace ngraph
 {
@@ -37,18 +39,47 @@ namespace ngraph
             {
                 void* data;
             };
+            /// Runs task(i) for every i in [0, num_tasks), possibly concurrently, and returns
+            /// once all of them have completed.
+            using TaskDispatcher =
+                std::function<void(size_t num_tasks, const std::function<void(size_t)>& task)>;
+
             /// A CPU Runtime is an MLIR runtime that owns an MLIR context and a module
             /// The module should be in LLVM dialect and ready to be lowered via an MLIR
             /// ExecutionEngine. The runtime owns the context and must out-live any MLIR
             /// code Compilation and execution.
+            ///
+            /// The module is JIT-compiled on the first invocation only. The temporaries of the
+            /// module live in an arena that is allocated at that point and reused by every
+            /// subsequent invocation.
             class MLIRCPURuntime : public MLIRRuntime
             {
             public:
+                ~MLIRCPURuntime();
+
                 /// Executes a pre-compiled subgraph
                 void run(void* args) override;
 
+                /// Sets the dispatcher used to run the tasks of the parallel stages of the
+                /// module. Without a dispatcher, the module is executed serially.
+                void set_task_dispatcher(const TaskDispatcher& dispatcher)
+                {
+                    m_taskDispatcher = dispatcher;
+                }
+
             private:
+                /// Function compiled by the execution engine with the packed calling convention.
+                using PackedFunc = void (*)(void**);
+
+                struct Stage
+                {
+                    PackedFunc func;
+                    size_t numTasks;
+                };
+
                 void run_internal(std::vector<void*>& externalTensors);
+                // Creates the execution engine, the invocation arguments and the arena
+                void initialize();
                 // Bind external tensors to MLIR module entry point
                 void bindArguments(std::vector<void*>& externalTensors);
                 // Invokes an MLIR module entry point with bound arguments
@@ -57,7 +88,7 @@ namespace ngraph
                 void cleanup();
 
                 /// Helper to create memref arguments for MLIR function signature
-                llvm::SmallVector<void*, 8> allocateMemrefArgs();
+                llvm::SmallVector<void*, 8> allocateMemrefArgs(unsigned numArgs);
 
                 /// Helper to allocate a mem ref object. Handles static shapes only for now.
                 StaticMemRef* allocateMemrefDescriptor();
@@ -68,6 +99,16 @@ namespace ngraph
                 // Arguments for the MLIR function generated for the nGraph sub-graph.
                 llvm::SmallVector<void*, 8> m_invokeArgs;
                 std::unique_ptr<mlir::ExecutionEngine> m_engine;
+                // Memory for the temporaries of the MLIR function, bound to the trailing
+                // invocation arguments.
+                std::unique_ptr<AlignedBuffer> m_arena;
+                // Stages of the MLIR function, executed in order when a dispatcher is set.
+                std::vector<Stage> m_stages;
+                // Invocation arguments of each task of a stage: the arguments of the MLIR
+                // function followed by a pointer to the task id.
+                std::vector<llvm::SmallVector<void*, 8>> m_taskArgs;
+                std::vector<int64_t> m_taskIds;
+                TaskDispatcher m_taskDispatcher;
             };
         }
     }
@@ -43,5 +43,10 @@ size_t descriptor::layout::TensorLayout::get_size() const
 
 size_t descriptor::layout::TensorLayout::get_allocated_size()
 {
+    // Element types narrower than a byte (u1) are stored bit-packed.
+    if (get_element_type().bitwidth() < 8)
+    {
+        return (get_size() * get_element_type().bitwidth() + 7) / 8;
+    }
     return get_size() * get_element_type().size();
 }
@@ -30,22 +30,22 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 {
 }
 
-// Add an input to the vector of inputs that use this output.
+// Add an input to the vector of inputs that use this output. An Input is attached to at most one
+// Output at a time, so it cannot already be in the vector. Searching for it made building a
+// node with many users quadratic.
 void descriptor::Output::add_input(Input* input)
 {
     // Keep the inputs in insertion order to keep sorts deterministic
-    if (find(m_inputs.begin(), m_inputs.end(), input) == m_inputs.end())
-    {
-        m_inputs.push_back(input);
-    }
+    m_inputs.push_back(input);
 }
 
 void descriptor::Output::remove_input(Input* input)
 {
-    auto it = find(m_inputs.begin(), m_inputs.end(), input);
-    if (it != m_inputs.end())
+    // Users are usually released in reverse order of creation, so search from the back.
+    auto it = find(m_inputs.rbegin(), m_inputs.rend(), input);
+    if (it != m_inputs.rend())
     {
-        m_inputs.erase(it);
+        m_inputs.erase(std::next(it).base());
     }
 }
 
@@ -90,6 +90,10 @@ size_t descriptor::Tensor::size() const
     {
         return tvl->get_allocated_size();
     }
+    else if (m_element_type.bitwidth() < 8)
+    {
+        return (shape_size(get_shape()) * m_element_type.bitwidth() + 7) / 8;
+    }
     else
     {
         return shape_size(get_shape()) * m_element_type.size();
@@ -104,12 +104,15 @@ namespace ngraph
         protected:
             std::shared_ptr<op::Parameter> get_ng_parameter() const
             {
-                return std::make_shared<op::Parameter>(get_element_type(), get_shape());
+                auto parameter = std::make_shared<op::Parameter>(get_element_type(), get_shape());
+                parameter->set_friendly_name(get_name());
+                return parameter;
             }
 
             std::shared_ptr<op::Constant> get_ng_constant(const Weight& weight) const
             {
-                return std::make_shared<op::Constant>(weight.type(), weight.shape(), weight.data());
+                return std::make_shared<op::Constant>(
+                    weight.type(), weight.shape(), weight.data(), weight.owner());
             }
 
             std::shared_ptr<op::Constant> get_ng_constant(const Tensor& tensor) const
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -40,9 +41,16 @@ namespace ngraph
             Weight& operator=(Weight&&) = delete;
 
             Weight(const element::Type& type, const Shape& shape, std::vector<char> data)
+                : Weight(type, shape, std::make_shared<std::vector<char>>(std::move(data)))
+            {
+            }
+
+            /// \brief Weight referring to memory owned by the caller. The memory is not copied;
+            ///        it must outlive the imported function and any executable compiled from it.
+            Weight(const element::Type& type, const Shape& shape, const void* data)
                 : m_shape{shape}
                 , m_type{type}
-                , m_data{std::move(data)}
+                , m_data{data}
             {
                 for (const auto& value : m_shape)
                 {
@@ -55,16 +63,26 @@ namespace ngraph
             const element::Type& type() const { return m_type; }
             std::shared_ptr<runtime::Tensor> to_tensor(runtime::Backend& backend)
             {
-                return backend.create_tensor(
-                    m_type, m_shape, reinterpret_cast<void*>(m_data.data()));
+                return backend.create_tensor(m_type, m_shape, const_cast<void*>(m_data));
             }
 
-            const void* data() const { return reinterpret_cast<const void*>(m_data.data()); }
+            const void* data() const { return m_data; }
+            /// \return The owner of data(), or nullptr if the caller owns the memory.
+            const std::shared_ptr<const void>& owner() const { return m_owner; }
         private:
+            Weight(const element::Type& type,
+                   const Shape& shape,
+                   const std::shared_ptr<std::vector<char>>& data)
+                : Weight(type, shape, static_cast<const void*>(data->data()))
+            {
+                m_owner = data;
+            }
+
             Shape m_shape{};
             const element::Type& m_type;
             std::size_t m_size{1};
-            std::vector<char> m_data{};
+            const void* m_data{nullptr};
+            std::shared_ptr<const void> m_owner{};
         };
 
         using Weights = std::unordered_map<std::string, Weight>;
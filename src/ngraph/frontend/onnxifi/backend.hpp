@@ -53,6 +53,13 @@ namespace ngraph
                 return get().compile(function);
             }
 
+            /// \brief Returns the nGraph backend, creating it on first use.
+            std::shared_ptr<runtime::Backend> get_backend() const
+            {
+                get();
+                return m_backend;
+            }
+
         private:
             std::string m_type{};
             mutable std::shared_ptr<runtime::Backend> m_backend{nullptr};
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "event.hpp"
+#include "exceptions.hpp"
+#include "handle_manager.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace
+        {
+            using EventManager = HandleManager<::onnxEvent, Event, status::invalid_event>;
+
+            EventManager& get_event_manager()
+            {
+                static EventManager event_manager;
+                return event_manager;
+            }
+        }
+
+        void Event::signal(::onnxStatus result)
+        {
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                if (m_signalled)
+                {
+                    throw status::invalid_state{};
+                }
+                m_signalled = true;
+                m_status = result;
+            }
+            m_signalled_condition.notify_all();
+        }
+
+        ::onnxStatus Event::wait() const
+        {
+            std::unique_lock<decltype(m_mutex)> lock{m_mutex};
+            m_signalled_condition.wait(lock, [this] { return m_signalled; });
+            return m_status;
+        }
+
+        bool Event::is_signalled() const
+        {
+            std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+            return m_signalled;
+        }
+
+        ::onnxEvent Event::create()
+        {
+            return get_event_manager().add(std::make_shared<Event>());
+        }
+
+        std::shared_ptr<Event> Event::get(::onnxEvent event)
+        {
+            return get_event_manager().get(event);
+        }
+
+        void Event::release(::onnxEvent event) { get_event_manager().remove(event); }
+    } // namespace onnxifi
+
+} // namespace ngraph
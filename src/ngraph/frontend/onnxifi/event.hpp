@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <onnx/onnxifi.h>
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI event
+        /// An event starts in non-signalled state and is signalled exactly once, either by
+        /// the host through onnxSignalEvent() or by the backend when graph outputs are ready.
+        /// Besides the signalled state the event carries the status of the operation that
+        /// signalled it, which is what onnxWaitEvent() returns.
+        class Event
+        {
+        public:
+            Event(const Event&) = delete;
+            Event& operator=(const Event&) = delete;
+
+            Event(Event&&) = delete;
+            Event& operator=(Event&&) = delete;
+
+            Event() = default;
+
+            /// \brief Signals the event and wakes up all waiting threads.
+            /// \param result  status reported to the waiting threads.
+            /// \throws status::invalid_state if the event is already signalled.
+            void signal(::onnxStatus result = ONNXIFI_STATUS_SUCCESS);
+
+            /// \brief Blocks until the event is signalled.
+            /// \returns Status the event was signalled with.
+            ::onnxStatus wait() const;
+
+            bool is_signalled() const;
+
+            /// \brief Creates a new event in non-signalled state and registers its handle.
+            static ::onnxEvent create();
+
+            /// \brief Returns the event referred to by the handle.
+            /// \throws status::invalid_event if the handle is not registered.
+            static std::shared_ptr<Event> get(::onnxEvent event);
+
+            /// \brief Unregisters the handle. Graph runs still holding the event keep it alive.
+            /// \throws status::invalid_event if the handle is not registered.
+            static void release(::onnxEvent event);
+
+        private:
+            mutable std::mutex m_mutex{};
+            mutable std::condition_variable m_signalled_condition{};
+            bool m_signalled{false};
+            ::onnxStatus m_status{ONNXIFI_STATUS_SUCCESS};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,318 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <istream>   // std::istream
+#include <new>       // std::bad_alloc
+#include <streambuf> // std::streambuf
+#include <string>    // std::string
+
+#include "event.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "handle_manager.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#include "span.hpp"
+#include "tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace
+        {
+            using GraphManager = HandleManager<::onnxGraph, Graph, status::invalid_graph>;
+
+            GraphManager& get_graph_manager()
+            {
+                static GraphManager graph_manager;
+                return graph_manager;
+            }
+
+            /// \brief Read-only stream buffer over the model provided by the caller, so the
+            ///        model is parsed in place instead of being copied into a string first.
+            class ModelBuffer : public std::streambuf
+            {
+            public:
+                ModelBuffer(const void* model, std::size_t size)
+                {
+                    char* begin = const_cast<char*>(static_cast<const char*>(model));
+                    setg(begin, begin, begin + size);
+                }
+
+            protected:
+                pos_type seekoff(off_type offset,
+                                 std::ios_base::seekdir direction,
+                                 std::ios_base::openmode which) override
+                {
+                    char* position{gptr()};
+                    switch (direction)
+                    {
+                    case std::ios_base::beg: position = eback() + offset; break;
+                    case std::ios_base::cur: position = gptr() + offset; break;
+                    case std::ios_base::end: position = egptr() + offset; break;
+                    default: return pos_type(off_type(-1));
+                    }
+                    if (!(which & std::ios_base::in) || position < eback() || position > egptr())
+                    {
+                        return pos_type(off_type(-1));
+                    }
+                    setg(eback(), position, egptr());
+                    return pos_type(position - eback());
+                }
+
+                pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+                {
+                    return seekoff(off_type(position), std::ios_base::beg, which);
+                }
+            };
+
+            template <typename T>
+            std::size_t find_by_name(const std::vector<T>& nodes, const char* name)
+            {
+                for (std::size_t index{0}; index < nodes.size(); ++index)
+                {
+                    if (nodes[index]->get_friendly_name() == name)
+                    {
+                        return index;
+                    }
+                }
+                throw status::unidentified_name{};
+            }
+
+            /// \brief Creates a backend tensor using the descriptor's buffer as its storage.
+            std::shared_ptr<runtime::Tensor>
+                bind_tensor(const ::onnxTensorDescriptorV1& descriptor,
+                            const Node& node,
+                            runtime::Backend& backend)
+            {
+                Tensor tensor{descriptor};
+                const Shape& shape{node.get_output_shape(0)};
+                if (tensor.get_element_type() != node.get_output_element_type(0))
+                {
+                    throw status::mismatching_datatype{};
+                }
+                // A scalar may be described either without dimensions or with shape {1}
+                if ((tensor.get_shape() != shape) &&
+                    !(shape.empty() && (shape_size(tensor.get_shape()) == 1)))
+                {
+                    throw status::mismatching_shape{};
+                }
+                return backend.create_tensor(
+                    node.get_output_element_type(0), shape, const_cast<void*>(tensor.data()));
+            }
+        }
+
+        Graph::Graph(const Backend& backend,
+                     const void* model,
+                     std::size_t model_size,
+                     std::uint32_t weights_count,
+                     const ::onnxTensorDescriptorV1* weights)
+            : m_backend{backend.get_backend()}
+        {
+            onnx_import::Weights ng_weights;
+            for (const auto& descriptor : Span<::onnxTensorDescriptorV1>{weights, weights_count})
+            {
+                Tensor tensor{descriptor};
+                onnx_import::Weight weight{
+                    tensor.get_element_type(), tensor.get_shape(), tensor.data()};
+                ng_weights.emplace(tensor.get_name(), std::move(weight));
+            }
+
+            ModelBuffer buffer{model, model_size};
+            std::istream stream{&buffer};
+            try
+            {
+                m_function = onnx_import::import_onnx_model(stream, ng_weights);
+            }
+            catch (const ngraph_error&)
+            {
+                throw status::invalid_model{};
+            }
+            m_executable = m_backend->compile(m_function);
+            m_worker = std::thread{&Graph::worker, this};
+        }
+
+        Graph::~Graph()
+        {
+            {
+                std::lock_guard<decltype(m_queue_mutex)> lock{m_queue_mutex};
+                m_stop = true;
+            }
+            m_queue_condition.notify_all();
+            m_worker.join();
+        }
+
+        void Graph::set_io(std::uint32_t inputs_count,
+                           const ::onnxTensorDescriptorV1* inputs,
+                           std::uint32_t outputs_count,
+                           const ::onnxTensorDescriptorV1* outputs)
+        {
+            const auto& parameters = m_function->get_parameters();
+            const auto& results = m_function->get_results();
+            if ((inputs_count != parameters.size()) || (outputs_count != results.size()))
+            {
+                throw status::invalid_size{};
+            }
+            if (((inputs_count != 0) && (inputs == nullptr)) ||
+                ((outputs_count != 0) && (outputs == nullptr)))
+            {
+                throw status::null_pointer{};
+            }
+
+            // Tensors are ordered as the function parameters and results, descriptors are
+            // matched to them by name.
+            std::vector<std::shared_ptr<runtime::Tensor>> ng_inputs(parameters.size());
+            for (const auto& descriptor : Span<::onnxTensorDescriptorV1>{inputs, inputs_count})
+            {
+                std::size_t index{find_by_name(parameters, descriptor.name)};
+                ng_inputs[index] = bind_tensor(descriptor, *parameters[index], *m_backend);
+            }
+            std::vector<std::shared_ptr<runtime::Tensor>> ng_outputs(results.size());
+            for (const auto& descriptor : Span<::onnxTensorDescriptorV1>{outputs, outputs_count})
+            {
+                std::size_t index{find_by_name(results, descriptor.name)};
+                ng_outputs[index] = bind_tensor(descriptor, *results[index], *m_backend);
+            }
+            for (const auto& tensor : ng_inputs)
+            {
+                if (tensor == nullptr)
+                {
+                    throw status::unidentified_name{};
+                }
+            }
+            for (const auto& tensor : ng_outputs)
+            {
+                if (tensor == nullptr)
+                {
+                    throw status::unidentified_name{};
+                }
+            }
+
+            std::lock_guard<decltype(m_io_mutex)> lock{m_io_mutex};
+            m_inputs = std::move(ng_inputs);
+            m_outputs = std::move(ng_outputs);
+            m_io_bound = true;
+        }
+
+        void Graph::run(const ::onnxMemoryFenceV1* input_fence, ::onnxMemoryFenceV1* output_fence)
+        {
+            if ((input_fence == nullptr) || (output_fence == nullptr))
+            {
+                throw status::null_pointer{};
+            }
+            if ((input_fence->tag != ONNXIFI_TAG_MEMORY_FENCE_V1) ||
+                (output_fence->tag != ONNXIFI_TAG_MEMORY_FENCE_V1))
+            {
+                throw status::unsupported_tag{};
+            }
+            if ((input_fence->type != ONNXIFI_SYNCHRONIZATION_EVENT) ||
+                (output_fence->type != ONNXIFI_SYNCHRONIZATION_EVENT))
+            {
+                throw status::unsupported_fence_type{};
+            }
+            std::shared_ptr<Event> input_event{Event::get(input_fence->event)};
+
+            std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+            std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+            {
+                std::lock_guard<decltype(m_io_mutex)> lock{m_io_mutex};
+                if (!m_io_bound)
+                {
+                    throw status::invalid_state{};
+                }
+                inputs = m_inputs;
+                outputs = m_outputs;
+            }
+
+            ::onnxEvent output_handle{Event::create()};
+            std::shared_ptr<Event> output_event{Event::get(output_handle)};
+            std::shared_ptr<runtime::Executable> executable{m_executable};
+            auto task = [input_event, output_event, executable, inputs, outputs]() {
+                ::onnxStatus result{input_event->wait()};
+                if (result == ONNXIFI_STATUS_SUCCESS)
+                {
+                    try
+                    {
+                        // The host writes the input buffers directly, so the backend has no
+                        // other way to learn that they changed since the previous run.
+                        for (const auto& input : inputs)
+                        {
+                            input->set_stale(true);
+                        }
+                        executable->call(outputs, inputs);
+                    }
+                    catch (const std::bad_alloc&)
+                    {
+                        result = ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+                    }
+                    catch (...)
+                    {
+                        result = ONNXIFI_STATUS_INTERNAL_ERROR;
+                    }
+                }
+                output_event->signal(result);
+            };
+            {
+                std::lock_guard<decltype(m_queue_mutex)> lock{m_queue_mutex};
+                m_queue.emplace_back(std::move(task));
+            }
+            m_queue_condition.notify_all();
+            output_fence->event = output_handle;
+        }
+
+        void Graph::worker()
+        {
+            std::unique_lock<decltype(m_queue_mutex)> lock{m_queue_mutex};
+            while (true)
+            {
+                m_queue_condition.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty())
+                {
+                    // Stop was requested and all scheduled runs have finished
+                    return;
+                }
+                std::function<void()> task{std::move(m_queue.front())};
+                m_queue.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+
+        ::onnxGraph Graph::create(const Backend& backend,
+                                  const void* model,
+                                  std::size_t model_size,
+                                  std::uint32_t weights_count,
+                                  const ::onnxTensorDescriptorV1* weights)
+        {
+            return get_graph_manager().add(
+                std::make_shared<Graph>(backend, model, model_size, weights_count, weights));
+        }
+
+        std::shared_ptr<Graph> Graph::get(::onnxGraph graph)
+        {
+            return get_graph_manager().get(graph);
+        }
+
+        void Graph::release(::onnxGraph graph)
+        {
+            std::shared_ptr<Graph> released{get_graph_manager().remove(graph)};
+        }
+
+    } // namespace onnxifi
+
+} // namespace ngraph
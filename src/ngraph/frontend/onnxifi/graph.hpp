@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint32_t
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <onnx/onnxifi.h>
+#include <thread> // std::thread
+#include <vector> // std::vector
+
+#include "backend.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI graph
+        /// Imports an ONNX model, compiles it on an nGraph backend and executes it
+        /// asynchronously. Runs of one graph are executed in order by a worker thread owned
+        /// by the graph, so the host can overlap its own work with the execution.
+        class Graph
+        {
+        public:
+            Graph(const Graph&) = delete;
+            Graph& operator=(const Graph&) = delete;
+
+            Graph(Graph&&) = delete;
+            Graph& operator=(Graph&&) = delete;
+
+            Graph() = delete;
+
+            /// \brief Imports and compiles the model.
+            /// \param backend        backend to compile the model for,
+            /// \param model          serialized ONNX model (binary or text protobuf),
+            /// \param model_size     size of the model in bytes,
+            /// \param weights_count  number of weight descriptors,
+            /// \param weights        descriptors of static graph inputs. They are bound as
+            ///                       Constants referring to the descriptor buffers without
+            ///                       copying, so the buffers must stay valid and unchanged
+            ///                       until the graph is released.
+            Graph(const Backend& backend,
+                  const void* model,
+                  std::size_t model_size,
+                  std::uint32_t weights_count,
+                  const ::onnxTensorDescriptorV1* weights);
+
+            /// \brief Waits for the pending runs to finish.
+            ~Graph();
+
+            /// \brief Binds input and output buffers by name. The buffers are used directly
+            ///        as backend tensor storage and must stay valid until the next call to
+            ///        set_io() or the release of the graph.
+            void set_io(std::uint32_t inputs_count,
+                        const ::onnxTensorDescriptorV1* inputs,
+                        std::uint32_t outputs_count,
+                        const ::onnxTensorDescriptorV1* outputs);
+
+            /// \brief Schedules a run of the graph.
+            /// The run starts once the input fence is signalled. The output fence is
+            /// initialized with a new event which is signalled when the outputs are ready.
+            void run(const ::onnxMemoryFenceV1* input_fence, ::onnxMemoryFenceV1* output_fence);
+
+            /// \brief Creates a graph and registers its handle.
+            static ::onnxGraph create(const Backend& backend,
+                                      const void* model,
+                                      std::size_t model_size,
+                                      std::uint32_t weights_count,
+                                      const ::onnxTensorDescriptorV1* weights);
+
+            /// \brief Returns the graph referred to by the handle.
+            /// \throws status::invalid_graph if the handle is not registered.
+            static std::shared_ptr<Graph> get(::onnxGraph graph);
+
+            /// \brief Unregisters the handle and waits for the pending runs of the graph.
+            /// \throws status::invalid_graph if the handle is not registered.
+            static void release(::onnxGraph graph);
+
+        private:
+            std::shared_ptr<runtime::Backend> m_backend{nullptr};
+            std::shared_ptr<Function> m_function{nullptr};
+            std::shared_ptr<runtime::Executable> m_executable{nullptr};
+
+            std::mutex m_io_mutex{};
+            bool m_io_bound{false};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_inputs{};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_outputs{};
+
+            std::mutex m_queue_mutex{};
+            std::condition_variable m_queue_condition{};
+            std::deque<std::function<void()>> m_queue{};
+            bool m_stop{false};
+            std::thread m_worker{};
+
+            void worker();
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint> // std::uintptr_t
+#include <map>     // std::map
+#include <memory>  // std::shared_ptr
+#include <mutex>   // std::mutex
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief Registry of objects referred to by opaque ONNXIFI handles
+        /// A handle is the address of the object it refers to. Handles which are not
+        /// registered, including handles of released objects, are rejected by throwing
+        /// \p Invalid.
+        /// \tparam Handle   ONNXIFI handle type, e.g. ::onnxEvent,
+        /// \tparam Object   type of the object the handle refers to,
+        /// \tparam Invalid  status exception thrown for unknown handles.
+        template <typename Handle, typename Object, typename Invalid>
+        class HandleManager
+        {
+        public:
+            HandleManager() = default;
+
+            HandleManager(const HandleManager&) = delete;
+            HandleManager& operator=(const HandleManager&) = delete;
+
+            Handle add(const std::shared_ptr<Object>& object)
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto key = reinterpret_cast<std::uintptr_t>(object.get());
+                m_objects.emplace(key, object);
+                return reinterpret_cast<Handle>(key);
+            }
+
+            std::shared_ptr<Object> get(Handle handle) const
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto it = m_objects.find(reinterpret_cast<std::uintptr_t>(handle));
+                if (it == std::end(m_objects))
+                {
+                    throw Invalid{};
+                }
+                return it->second;
+            }
+
+            /// \brief Unregisters the handle. The object is destroyed once the last
+            ///        reference obtained through get() is released.
+            std::shared_ptr<Object> remove(Handle handle)
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                auto it = m_objects.find(reinterpret_cast<std::uintptr_t>(handle));
+                if (it == std::end(m_objects))
+                {
+                    throw Invalid{};
+                }
+                std::shared_ptr<Object> object{std::move(it->second)};
+                m_objects.erase(it);
+                return object;
+            }
+
+        private:
+            mutable std::mutex m_mutex{};
+            std::map<std::uintptr_t, std::shared_ptr<Object>> m_objects{};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -20,38 +20,90 @@
 #include <stdexcept>
 
 #include "backend_manager.hpp"
+#include "event.hpp"
 #include "exceptions.hpp"
+#include "graph.hpp"
+#include "ngraph/except.hpp"
 
 using namespace ngraph::onnxifi;
 
-extern "C" {
-
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
+namespace
 {
-    try
+    /// \brief Runs the function and translates the exceptions it throws into ONNXIFI status.
+    template <typename Callable>
+    onnxStatus invoke(Callable&& callable)
     {
-        BackendManager::get_backend_ids(backendIDs, numBackends);
-        return ONNXIFI_STATUS_SUCCESS;
+        try
+        {
+            callable();
+            return ONNXIFI_STATUS_SUCCESS;
+        }
+        catch (const status::runtime& e)
+        {
+            return e.get_status();
+        }
+        catch (const ngraph::unsupported_op&)
+        {
+            return ONNXIFI_STATUS_UNSUPPORTED_OPERATOR;
+        }
+        catch (const std::bad_alloc&)
+        {
+            return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        }
+        catch (...)
+        {
+            return ONNXIFI_STATUS_INTERNAL_ERROR;
+        }
     }
-    catch (const status::runtime& e)
+
+    const Backend& get_backend(onnxBackendID backend_id)
     {
-        return e.get_status();
+        try
+        {
+            return BackendManager::get(backend_id);
+        }
+        catch (const std::out_of_range&)
+        {
+            throw status::invalid_id{};
+        }
     }
-    catch (const std::bad_alloc&)
+
+    /// \brief onnxBackend handles are the IDs of the backends they were initialized from.
+    const Backend& get_backend(onnxBackend backend)
     {
-        return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        try
+        {
+            return BackendManager::get(reinterpret_cast<onnxBackendID>(backend));
+        }
+        catch (const std::out_of_range&)
+        {
+            throw status::invalid_backend{};
+        }
     }
-    catch (...)
+
+    /// \brief No auxiliary properties are supported; the list must be empty.
+    void check_no_properties(const uint64_t* properties)
     {
-        return ONNXIFI_STATUS_INTERNAL_ERROR;
+        if ((properties != nullptr) && (*properties != 0))
+        {
+            throw status::unsupported_property{};
+        }
     }
 }
 
+extern "C" {
+
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
+    onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
+{
+    return invoke([&] { BackendManager::get_backend_ids(backendIDs, numBackends); });
+}
+
 ONNXIFI_PUBLIC
-ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackendID(onnxBackendID /* backendID */)
+ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackendID(onnxBackendID backendID)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    // Backend IDs stay valid for the lifetime of the library
+    return invoke([&] { get_backend(backendID); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -70,73 +122,106 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxGetBackendCompati
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxInitBackend(onnxBackendID /* backendID */,
-                    const uint64_t* /* auxPropertiesList */,
-                    onnxBackend* /* backend */)
+    onnxInitBackend(onnxBackendID backendID,
+                    const uint64_t* auxPropertiesList,
+                    onnxBackend* backend)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (backend == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        get_backend(backendID);
+        check_no_properties(auxPropertiesList);
+        *backend = reinterpret_cast<onnxBackend>(backendID);
+    });
 }
 
 ONNXIFI_PUBLIC
-ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend /* backend */)
+ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend backend)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { get_backend(backend); });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend /* backend */,
-                                                                         onnxEvent* /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend backend,
+                                                                         onnxEvent* event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if (event == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        get_backend(backend);
+        *event = Event::create();
+    });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] { Event::get(event)->signal(); });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    onnxStatus result{ONNXIFI_STATUS_SUCCESS};
+    onnxStatus wait_status{invoke([&] { result = Event::get(event)->wait(); })};
+    return (wait_status == ONNXIFI_STATUS_SUCCESS) ? result : wait_status;
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent /* event */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { Event::release(event); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxInitGraph(onnxBackend /* backend */,
-                  const uint64_t* /* auxPropertiesList */,
-                  std::size_t /* onnxModelSize */,
-                  const void* /* onnxModel */,
-                  uint32_t /* weightsCount */,
-                  const onnxTensorDescriptorV1* /* weightDescriptors */,
-                  onnxGraph* /* graph */)
+    onnxInitGraph(onnxBackend backend,
+                  const uint64_t* auxPropertiesList,
+                  std::size_t onnxModelSize,
+                  const void* onnxModel,
+                  uint32_t weightsCount,
+                  const onnxTensorDescriptorV1* weightDescriptors,
+                  onnxGraph* graph)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        if ((graph == nullptr) || (onnxModel == nullptr) ||
+            ((weightsCount != 0) && (weightDescriptors == nullptr)))
+        {
+            throw status::null_pointer{};
+        }
+        if (onnxModelSize == 0)
+        {
+            throw status::invalid_size{};
+        }
+        const Backend& ng_backend = get_backend(backend);
+        check_no_properties(auxPropertiesList);
+        *graph =
+            Graph::create(ng_backend, onnxModel, onnxModelSize, weightsCount, weightDescriptors);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxSetGraphIO(onnxGraph /* graph */,
-                   std::uint32_t /* inputsCount */,
-                   const onnxTensorDescriptorV1* /* inputDescriptors */,
-                   std::uint32_t /* outputsCount */,
-                   const onnxTensorDescriptorV1* /* outputDescriptors */)
+    onnxSetGraphIO(onnxGraph graph,
+                   std::uint32_t inputsCount,
+                   const onnxTensorDescriptorV1* inputDescriptors,
+                   std::uint32_t outputsCount,
+                   const onnxTensorDescriptorV1* outputDescriptors)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] {
+        Graph::get(graph)->set_io(inputsCount, inputDescriptors, outputsCount, outputDescriptors);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxRunGraph(onnxGraph /* graph */,
-                 const onnxMemoryFenceV1* /* inputFence */,
-                 onnxMemoryFenceV1* /* outputFence */)
+    onnxRunGraph(onnxGraph graph,
+                 const onnxMemoryFenceV1* inputFence,
+                 onnxMemoryFenceV1* outputFence)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return invoke([&] { Graph::get(graph)->run(inputFence, outputFence); });
 }
 
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph /* graph */)
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph graph)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return invoke([&] { Graph::release(graph); });
 }
 
 } // extern "C"
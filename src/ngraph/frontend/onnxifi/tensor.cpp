@@ -90,75 +90,36 @@ namespace ngraph
             }
         }
 
-        std::shared_ptr<runtime::Tensor> Tensor::to_ng(runtime::Backend& backend) const
+        const element::Type& Tensor::get_element_type() const
         {
-            std::shared_ptr<runtime::Tensor> tensor;
             switch (m_tensor->dataType)
             {
-            case ONNXIFI_DATATYPE_FLOAT16:
-            case ONNXIFI_DATATYPE_FLOAT32:
-                tensor = backend.create_tensor(element::f32, m_shape);
-                tensor->write(data(), sizeof(float) * size());
-                break;
-            case ONNXIFI_DATATYPE_FLOAT64:
-                tensor = backend.create_tensor(element::f64, m_shape);
-                tensor->write(data(), sizeof(double) * size());
-                break;
-            case ONNXIFI_DATATYPE_INT8:
-                tensor = backend.create_tensor(element::i8, m_shape);
-                tensor->write(data(), sizeof(int8_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_INT16:
-                tensor = backend.create_tensor(element::i16, m_shape);
-                tensor->write(data(), sizeof(int16_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_INT32:
-                tensor = backend.create_tensor(element::i32, m_shape);
-                tensor->write(data(), sizeof(int32_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_INT64:
-                tensor = backend.create_tensor(element::i64, m_shape);
-                tensor->write(data(), sizeof(int64_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_UINT8:
-                tensor = backend.create_tensor(element::u8, m_shape);
-                tensor->write(data(), sizeof(uint8_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_UINT16:
-                tensor = backend.create_tensor(element::u16, m_shape);
-                tensor->write(data(), sizeof(uint16_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_UINT32:
-                tensor = backend.create_tensor(element::u32, m_shape);
-                tensor->write(data(), sizeof(uint32_t) * size());
-                break;
-            case ONNXIFI_DATATYPE_UINT64:
-                tensor = backend.create_tensor(element::u64, m_shape);
-                tensor->write(data(), sizeof(uint64_t) * size());
-                break;
+            case ONNXIFI_DATATYPE_FLOAT16: return element::f16;
+            case ONNXIFI_DATATYPE_FLOAT32: return element::f32;
+            case ONNXIFI_DATATYPE_FLOAT64: return element::f64;
+            case ONNXIFI_DATATYPE_INT8: return element::i8;
+            case ONNXIFI_DATATYPE_INT16: return element::i16;
+            case ONNXIFI_DATATYPE_INT32: return element::i32;
+            case ONNXIFI_DATATYPE_INT64: return element::i64;
+            case ONNXIFI_DATATYPE_UINT8: return element::u8;
+            case ONNXIFI_DATATYPE_UINT16: return element::u16;
+            case ONNXIFI_DATATYPE_UINT32: return element::u32;
+            case ONNXIFI_DATATYPE_UINT64: return element::u64;
             default: throw status::unsupported_datatype{};
             }
+        }
+
+        std::shared_ptr<runtime::Tensor> Tensor::to_ng(runtime::Backend& backend) const
+        {
+            const element::Type& type = get_element_type();
+            std::shared_ptr<runtime::Tensor> tensor = backend.create_tensor(type, m_shape);
+            tensor->write(data(), type.size() * size());
             return tensor;
         }
 
         void Tensor::from_ng(const runtime::Tensor& tensor)
         {
-            std::size_t readSize{tensor.get_element_count()};
-            switch (m_tensor->dataType)
-            {
-            case ONNXIFI_DATATYPE_FLOAT16:
-            case ONNXIFI_DATATYPE_FLOAT32: readSize *= sizeof(float); break;
-            case ONNXIFI_DATATYPE_FLOAT64: readSize *= sizeof(double); break;
-            case ONNXIFI_DATATYPE_INT8: readSize *= sizeof(int8_t); break;
-            case ONNXIFI_DATATYPE_INT16: readSize *= sizeof(int16_t); break;
-            case ONNXIFI_DATATYPE_INT32: readSize *= sizeof(int32_t); break;
-            case ONNXIFI_DATATYPE_INT64: readSize *= sizeof(int64_t); break;
-            case ONNXIFI_DATATYPE_UINT8: readSize *= sizeof(uint8_t); break;
-            case ONNXIFI_DATATYPE_UINT16: readSize *= sizeof(uint16_t); break;
-            case ONNXIFI_DATATYPE_UINT32: readSize *= sizeof(uint32_t); break;
-            case ONNXIFI_DATATYPE_UINT64: readSize *= sizeof(uint64_t); break;
-            default: break;
-            }
+            std::size_t readSize{tensor.get_element_count() * get_element_type().size()};
             tensor.read(reinterpret_cast<void*>(m_tensor->buffer), readSize);
         }
 
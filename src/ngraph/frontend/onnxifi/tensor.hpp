@@ -55,6 +55,7 @@ namespace ngraph
             const void* data() const { return reinterpret_cast<const void*>(m_tensor->buffer); }
             std::size_t size() const { return m_size; }
             const Shape& get_shape() const { return m_shape; }
+            const element::Type& get_element_type() const;
             const char* get_name() const { return m_tensor->name; }
         protected:
             const ::onnxTensorDescriptorV1* m_tensor;
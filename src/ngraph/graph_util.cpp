@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <map>
 #include <numeric>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -414,6 +416,232 @@ pair<shared_ptr<op::Result>, shared_ptr<op::Parameter>>
     return make_pair(res_node, par_node);
 }
 
+constexpr size_t FunctionSplit::input;
+
+FunctionSplit ngraph::split_function_by_placement(const shared_ptr<Function>& f)
+{
+    auto is_placed = [](const Node* node) { return !node->is_parameter() && !node->is_constant(); };
+
+    // Order the placed ops topologically, switching placement only when no op of the current
+    // placement is ready
+    unordered_map<Node*, size_t> position;
+    unordered_map<Node*, size_t> pending;
+    size_t count = 0;
+    unordered_map<Node*, vector<Node*>> successors;
+    map<size_t, deque<Node*>> ready;
+    size_t remaining = 0;
+    for (auto& op : f->get_ordered_ops())
+    {
+        position[op.get()] = count++;
+        if (!is_placed(op.get()))
+        {
+            continue;
+        }
+        NGRAPH_CHECK(op->get_placement_index() != Node::placement_invalid,
+                     "Cannot split function ",
+                     f->get_name(),
+                     " by placement, op ",
+                     op->get_name(),
+                     " has no placement");
+        unordered_set<Node*> predecessors;
+        for (auto& value : op->input_values())
+        {
+            if (is_placed(value.get_node()))
+            {
+                predecessors.insert(value.get_node());
+            }
+        }
+        for (auto& dependency : op->get_control_dependencies())
+        {
+            if (is_placed(dependency.get()))
+            {
+                predecessors.insert(dependency.get());
+            }
+        }
+        for (Node* predecessor : predecessors)
+        {
+            successors[predecessor].push_back(op.get());
+        }
+        pending[op.get()] = predecessors.size();
+        if (predecessors.empty())
+        {
+            ready[op->get_placement_index()].push_back(op.get());
+        }
+        remaining++;
+    }
+
+    vector<vector<Node*>> pieces;
+    vector<size_t> placements;
+    unordered_map<Node*, size_t> piece_of;
+    size_t current = Node::placement_invalid;
+    while (remaining > 0)
+    {
+        auto it = ready.find(current);
+        if (it == ready.end() || it->second.empty())
+        {
+            size_t earliest = numeric_limits<size_t>::max();
+            for (auto& placement_ready : ready)
+            {
+                if (!placement_ready.second.empty() &&
+                    position.at(placement_ready.second.front()) < earliest)
+                {
+                    earliest = position.at(placement_ready.second.front());
+                    current = placement_ready.first;
+                }
+            }
+            it = ready.find(current);
+            pieces.emplace_back();
+            placements.push_back(current);
+        }
+        Node* op = it->second.front();
+        it->second.pop_front();
+        pieces.back().push_back(op);
+        piece_of[op] = pieces.size() - 1;
+        remaining--;
+        for (Node* successor : successors[op])
+        {
+            if (--pending.at(successor) == 0)
+            {
+                ready[successor->get_placement_index()].push_back(successor);
+            }
+        }
+    }
+
+    // Values computed in one piece and used by a later one
+    vector<vector<Output<Node>>> crossing_values(pieces.size());
+    set<Output<Node>> crossing_set;
+    for (size_t p = 0; p < pieces.size(); p++)
+    {
+        for (Node* op : pieces[p])
+        {
+            for (auto& value : op->input_values())
+            {
+                if (is_placed(value.get_node()) && piece_of.at(value.get_node()) != p &&
+                    crossing_set.insert(value).second)
+                {
+                    crossing_values[piece_of.at(value.get_node())].push_back(value);
+                }
+            }
+        }
+    }
+
+    unordered_map<Node*, size_t> parameter_index;
+    for (size_t i = 0; i < f->get_parameters().size(); i++)
+    {
+        parameter_index[f->get_parameters()[i].get()] = i;
+    }
+    unordered_map<Node*, size_t> result_index;
+    for (size_t i = 0; i < f->get_results().size(); i++)
+    {
+        result_index[f->get_results()[i].get()] = i;
+    }
+
+    FunctionSplit split;
+    split.placements = placements;
+    split.result_sources.resize(f->get_results().size());
+    map<Output<Node>, FunctionSplit::Source> crossing_sources;
+    for (size_t p = 0; p < pieces.size(); p++)
+    {
+        unordered_map<Node*, shared_ptr<Node>> node_map;
+        map<Output<Node>, shared_ptr<op::Parameter>> crossing_parameters;
+        ParameterVector parameters;
+        vector<FunctionSplit::Source> sources;
+        ResultVector results;
+
+        auto map_value = [&](const Output<Node>& value) -> Output<Node> {
+            Node* node = value.get_node();
+            auto it = node_map.find(node);
+            if (it != node_map.end())
+            {
+                return Output<Node>(it->second, value.get_index());
+            }
+            if (node->is_constant())
+            {
+                auto constant = node->copy_with_new_inputs({});
+                node_map[node] = constant;
+                return Output<Node>(constant, value.get_index());
+            }
+            if (node->is_parameter())
+            {
+                auto parameter =
+                    as_type_ptr<op::Parameter>(node->copy_with_new_inputs(OutputVector{}));
+                parameter->set_friendly_name(node->get_friendly_name());
+                parameters.push_back(parameter);
+                sources.push_back({FunctionSplit::input, parameter_index.at(node)});
+                node_map[node] = parameter;
+                return parameter->output(0);
+            }
+            auto& parameter = crossing_parameters[value];
+            if (!parameter)
+            {
+                parameter =
+                    make_shared<op::Parameter>(value.get_element_type(), value.get_partial_shape());
+                parameter->set_placement_index(placements[p]);
+                parameters.push_back(parameter);
+                sources.push_back(crossing_sources.at(value));
+            }
+            return parameter->output(0);
+        };
+
+        for (Node* op : pieces[p])
+        {
+            OutputVector args;
+            for (auto& value : op->input_values())
+            {
+                args.push_back(map_value(value));
+            }
+            vector<shared_ptr<Node>> dependencies;
+            for (auto& dependency : op->get_control_dependencies())
+            {
+                auto it = node_map.find(dependency.get());
+                if (it != node_map.end())
+                {
+                    dependencies.push_back(it->second);
+                }
+            }
+            auto clone = op->copy_with_new_inputs(args, dependencies);
+            if (op->get_friendly_name() != op->get_name())
+            {
+                clone->set_friendly_name(op->get_friendly_name());
+            }
+            for (auto tag : op->get_provenance_tags())
+            {
+                clone->add_provenance_tag(tag);
+            }
+            clone->set_op_annotations(op->get_op_annotations());
+            clone->set_placement_index(op->get_placement_index());
+            node_map[op] = clone;
+
+            if (op->is_output())
+            {
+                results.push_back(as_type_ptr<op::Result>(clone));
+                FunctionSplit::Source source{p, results.size() - 1};
+                split.result_sources.at(result_index.at(op)) = source;
+                // A later piece can read the value from this result
+                Output<Node> value = op->input_value(0);
+                if (crossing_set.count(value) != 0 && crossing_sources.count(value) == 0)
+                {
+                    crossing_sources[value] = source;
+                }
+            }
+        }
+        for (auto& value : crossing_values[p])
+        {
+            if (crossing_sources.count(value) == 0)
+            {
+                Output<Node> cloned_value(node_map.at(value.get_node()), value.get_index());
+                results.push_back(make_shared<op::Result>(cloned_value));
+                crossing_sources[value] = FunctionSplit::Source{p, results.size() - 1};
+            }
+        }
+
+        split.functions.push_back(
+            make_shared<Function>(results, parameters, f->get_name() + "_" + to_string(p)));
+        split.parameter_sources.push_back(sources);
+    }
+    return split;
+}
+
 // Insert unary node between two nodes like S->D => S->N->D
 // Before:                        |  After:
 // +-----+---+       +---+-----+  |  +-----+---+       +---+-----+---+       +---+-----+
@@ -18,6 +18,7 @@
 
 #include <deque>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
 #include <stack>
@@ -398,6 +399,40 @@ namespace ngraph
     // Assert that nodes in the function is colocated and return that placement
     Placement get_colocated_function_placement(std::shared_ptr<Function> func);
 
+    /// \brief Colocated pieces of a function, see split_function_by_placement
+    struct FunctionSplit
+    {
+        /// \brief A value passed to a piece or returned by the split function. Parameter
+        ///        `index` of the split function if `function` is `FunctionSplit::input`, else
+        ///        result `index` of `functions[function]`.
+        struct Source
+        {
+            size_t function;
+            size_t index;
+        };
+        static constexpr size_t input = std::numeric_limits<size_t>::max();
+
+        /// Pieces in an order in which they can execute one after another
+        std::vector<std::shared_ptr<Function>> functions;
+        /// Placement index of every piece
+        std::vector<size_t> placements;
+        /// Source of every parameter of every piece
+        std::vector<std::vector<Source>> parameter_sources;
+        /// Source of every result of the split function
+        std::vector<Source> result_sources;
+    };
+
+    /// \brief Cuts `f` into functions whose ops share one placement index, leaving `f` as it
+    ///        is. Every op other than Parameter and Constant must have a placement index.
+    ///
+    /// Ops are ordered topologically, staying on one placement for as long as any op of that
+    /// placement is ready, and each run of one placement becomes a piece. Constants are cloned
+    /// into every piece that uses them and parameters of `f` are passed to every piece that
+    /// uses them, so only values computed by an op cross pieces. Such a value crosses once,
+    /// through a single result of its piece however many later ops use it, and a result of
+    /// `f` doubles as that result.
+    FunctionSplit split_function_by_placement(const std::shared_ptr<Function>& f);
+
     std::pair<std::shared_ptr<op::Result>, std::shared_ptr<op::Parameter>>
         insert_result_parameter_split(const std::shared_ptr<Node>& src_node,
                                       const std::shared_ptr<Node>& dst_node);
@@ -15,9 +15,12 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/descriptor/input.hpp"
@@ -36,6 +39,51 @@ constexpr NodeTypeInfo Node::type_info;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+// Type names are shared by every node of a type, so each node only keeps a pointer to the
+// interned copy. Elements of an unordered_set keep their address across rehashing.
+static const string& intern_type_name(const string& name)
+{
+    static mutex names_mutex;
+    static unordered_set<string> names;
+    lock_guard<mutex> lock(names_mutex);
+    return *names.insert(name).first;
+}
+
+// Friendly names often repeat across nodes, e.g. per-layer names in unrolled networks, so
+// nodes with the same friendly name share one copy. Unlike type names they are not bounded,
+// so a name is dropped from the table once the last node using it is gone. The table is never
+// destroyed, as nodes may still be released during static destruction.
+static shared_ptr<const string> intern_friendly_name(const string& name)
+{
+    struct FriendlyNames
+    {
+        mutex names_mutex;
+        unordered_map<string, weak_ptr<const string>> names;
+    };
+    static FriendlyNames* table = new FriendlyNames;
+
+    lock_guard<mutex> lock(table->names_mutex);
+    weak_ptr<const string>& entry = table->names[name];
+    shared_ptr<const string> interned = entry.lock();
+    if (!interned)
+    {
+        interned = shared_ptr<const string>(new string(name), [](const string* released) {
+            {
+                lock_guard<mutex> release_lock(table->names_mutex);
+                auto it = table->names.find(*released);
+                // The name may have been interned again since the last reference was dropped
+                if (it != table->names.end() && it->second.expired())
+                {
+                    table->names.erase(it);
+                }
+            }
+            delete released;
+        });
+        entry = interned;
+    }
+    return interned;
+}
+
 Node::Node(size_t output_size)
     : Node()
 {
@@ -43,7 +91,7 @@ Node::Node(size_t output_size)
 }
 
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
-    : m_node_type(node_type)
+    : m_node_type(&intern_type_name(node_type))
 {
     set_arguments(arguments);
     set_output_size(output_size);
@@ -289,12 +337,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+Node::OutputDescriptors& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const Node::OutputDescriptors& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -311,22 +359,22 @@ bool Node::is_constant() const
 
 const std::string& Node::description() const
 {
-    if (m_node_type.size() == 0)
+    if (m_node_type == nullptr)
     {
         // Terrible transitional kludge to keep description working while we change
         // type_name to const_char and virtual description() to virtual get_type_name()
-        const_cast<Node*>(this)->m_node_type = get_type_name();
+        const_cast<Node*>(this)->m_node_type = &intern_type_name(get_type_name());
     }
-    return m_node_type;
+    return *m_node_type;
 }
 
 const std::string& Node::get_friendly_name() const
 {
-    if (m_friendly_name.empty())
+    if (m_friendly_name == nullptr)
     {
         return get_name();
     }
-    return m_friendly_name;
+    return *m_friendly_name;
 }
 
 const std::string& Node::get_name() const
@@ -340,7 +388,7 @@ const std::string& Node::get_name() const
 
 void Node::set_friendly_name(const string& name)
 {
-    m_friendly_name = name;
+    m_friendly_name = name.empty() ? nullptr : intern_friendly_name(name);
 }
 
 Placement Node::get_placement() const
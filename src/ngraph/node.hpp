@@ -18,7 +18,6 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -39,6 +38,7 @@
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -112,6 +112,10 @@ namespace ngraph
         friend class Output;
 
     public:
+        /// Most nodes have at most two inputs and one output; those are stored in the node.
+        using InputDescriptors = StableVector<descriptor::Input, 2>;
+        using OutputDescriptors = StableVector<descriptor::Output, 1>;
+
         /// Throws if the node is invalid.
         virtual void validate_and_infer_types();
 
@@ -274,18 +278,16 @@ namespace ngraph
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        InputDescriptors& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
-            NGRAPH_DEPRECATED("use inputs() instead")
+        const InputDescriptors& get_inputs() const NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
-            NGRAPH_DEPRECATED("use outputs() instead");
+        OutputDescriptors& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const OutputDescriptors& get_outputs() const NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
         const std::vector<std::shared_ptr<Node>>& get_control_dependencies() const;
@@ -514,17 +516,16 @@ namespace ngraph
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
+        const std::string* m_node_type{nullptr};
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
-        std::string m_friendly_name;
+        std::shared_ptr<const std::string> m_friendly_name;
         std::string m_unique_name;
         NGRAPH_API
         static std::atomic<size_t> m_next_instance_id;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        InputDescriptors m_inputs;
+        OutputDescriptors m_outputs;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_index = placement_invalid;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ngraph/node_arena.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+shared_ptr<NodeArena> NodeArena::create(size_t block_size)
+{
+    return shared_ptr<NodeArena>(new NodeArena(block_size));
+}
+
+NodeArena::NodeArena(size_t block_size)
+    : m_block_size(block_size)
+{
+}
+
+void* NodeArena::allocate(size_t size, size_t alignment)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto align = [alignment](char* p) {
+        uintptr_t address = reinterpret_cast<uintptr_t>(p);
+        return reinterpret_cast<char*>((address + alignment - 1) & ~(uintptr_t(alignment) - 1));
+    };
+    char* result = m_next ? align(m_next) : nullptr;
+    if (result == nullptr || result + size > m_end)
+    {
+        // Requests larger than a block get a block of their own
+        size_t block_size = max(m_block_size, size + alignment);
+        m_blocks.emplace_back(new char[block_size]);
+        m_next = m_blocks.back().get();
+        m_end = m_next + block_size;
+        result = align(m_next);
+    }
+    m_allocated_bytes += (result + size) - m_next;
+    m_next = result + size;
+    return result;
+}
+
+size_t NodeArena::get_allocated_bytes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_allocated_bytes;
+}
@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Bump allocator for building very large graphs.
+    ///
+    /// Nodes made with make() are placed in large blocks instead of one heap allocation per
+    /// node, together with their shared_ptr control block and their input and output
+    /// descriptors. Memory is only returned when the arena and every node allocated from it
+    /// are gone; each node keeps the arena alive. This suits graphs that are built once and
+    /// dropped as a whole, such as unrolled recurrent networks.
+    ///
+    /// \code
+    /// auto arena = NodeArena::create();
+    /// auto sum = arena->make<op::Add>(a, b);
+    /// \endcode
+    class NodeArena : public std::enable_shared_from_this<NodeArena>
+    {
+    public:
+        /// \brief Allocator that draws from an arena; deallocation is a no-op.
+        template <typename T>
+        class Allocator
+        {
+        public:
+            using value_type = T;
+
+            explicit Allocator(const std::shared_ptr<NodeArena>& arena)
+                : m_arena(arena)
+            {
+            }
+            template <typename U>
+            Allocator(const Allocator<U>& other)
+                : m_arena(other.m_arena)
+            {
+            }
+            T* allocate(size_t n)
+            {
+                return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+            }
+            void deallocate(T*, size_t) {}
+            template <typename U>
+            bool operator==(const Allocator<U>& other) const
+            {
+                return m_arena == other.m_arena;
+            }
+            template <typename U>
+            bool operator!=(const Allocator<U>& other) const
+            {
+                return m_arena != other.m_arena;
+            }
+
+        private:
+            template <typename U>
+            friend class Allocator;
+            std::shared_ptr<NodeArena> m_arena;
+        };
+
+        static std::shared_ptr<NodeArena> create(size_t block_size = 1 << 20);
+
+        template <typename T, typename... Args>
+        std::shared_ptr<T> make(Args&&... args)
+        {
+            return std::allocate_shared<T>(Allocator<T>(shared_from_this()),
+                                           std::forward<Args>(args)...);
+        }
+
+        void* allocate(size_t size, size_t alignment);
+        /// \brief Bytes handed out so far, including alignment padding.
+        size_t get_allocated_bytes() const;
+
+    private:
+        NodeArena(size_t block_size);
+
+        size_t m_block_size;
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        char* m_next = nullptr;
+        char* m_end = nullptr;
+        size_t m_allocated_bytes = 0;
+        mutable std::mutex m_mutex;
+    };
+}
@@ -75,7 +75,7 @@ string op::Constant::convert_value_to_string(size_t index) const
     case element::Type_t::i32: rc = to_string(get_vector<int32_t>()[index]); break;
     case element::Type_t::i64: rc = to_string(get_vector<int64_t>()[index]); break;
     case element::Type_t::u1:
-        rc = to_string((get_vector<uint8_t>()[index / 8] >> (7 - (index % 8))) & 1);
+        rc = to_string((get_data_ptr<uint8_t>()[index / 8] >> (7 - (index % 8))) & 1);
         break;
     case element::Type_t::u8: rc = to_string(get_vector<uint8_t>()[index]); break;
     case element::Type_t::u16: rc = to_string(get_vector<uint16_t>()[index]); break;
@@ -179,7 +179,12 @@ vector<string> op::Constant::get_value_strings() const
             rc.push_back(to_string(value));
         }
         break;
-    case element::Type_t::u1: throw runtime_error("unsupported type");
+    case element::Type_t::u1:
+        for (size_t i = 0; i < shape_size(m_shape); ++i)
+        {
+            rc.push_back(convert_value_to_string(i));
+        }
+        break;
     case element::Type_t::undefined: throw runtime_error("unsupported type");
     case element::Type_t::dynamic: throw runtime_error("unsupported type");
     }
@@ -264,7 +269,45 @@ AxisSet op::Constant::get_axis_set_val() const
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Constant>(m_element_type, m_shape, m_data->get_ptr());
+    if (m_external_data)
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_external_data, m_external_owner);
+    }
+    return make_shared<Constant>(m_element_type, m_shape, get_data_ptr());
+}
+
+void op::Constant::share_data(const void* data, shared_ptr<const void> owner)
+{
+    load_data();
+    shared_ptr<runtime::AlignedBuffer> previous_data(m_data.release());
+    shared_ptr<const void> previous_owner = move(m_external_owner);
+    m_external_data = data;
+    m_external_owner = shared_ptr<const void>(
+        data, [owner, previous_data, previous_owner](const void*) {});
+}
+
+void op::Constant::load_data() const
+{
+    if (m_lazy)
+    {
+        call_once(m_load_flag, [this]() {
+            m_data.reset(new runtime::AlignedBuffer(mem_size(), host_alignment()));
+            m_loader(m_data->get_ptr());
+            m_loader = nullptr;
+            m_data_loaded = true;
+        });
+    }
+}
+
+bool op::Constant::get_all_data_elements_bitwise_identical() const
+{
+    if (m_lazy)
+    {
+        call_once(m_identical_flag, [this]() {
+            m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+        });
+    }
+    return m_all_elements_bitwise_identical;
 }
 
 template <typename T>
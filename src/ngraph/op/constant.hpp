@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstring>
+#include <functional>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/coordinate_diff.hpp"
@@ -47,8 +50,7 @@ namespace ngraph
             Constant(const element::Type& type, Shape shape, const std::vector<T>& values)
                 : m_element_type(type)
                 , m_shape(shape)
-                , m_data(new runtime::AlignedBuffer(shape_size(m_shape) * m_element_type.size(),
-                                                    host_alignment()))
+                , m_data(new runtime::AlignedBuffer(mem_size(), host_alignment()))
             {
                 NODE_VALIDATION_CHECK(
                     this,
@@ -83,8 +85,7 @@ namespace ngraph
             Constant(const element::Type& type, Shape shape, const std::vector<std::string>& values)
                 : m_element_type(type)
                 , m_shape(shape)
-                , m_data(new runtime::AlignedBuffer(shape_size(m_shape) * m_element_type.size(),
-                                                    host_alignment()))
+                , m_data(new runtime::AlignedBuffer(mem_size(), host_alignment()))
             {
                 NODE_VALIDATION_CHECK(
                     this,
@@ -144,14 +145,54 @@ namespace ngraph
                 , m_shape(shape)
                 , m_data(nullptr)
             {
-                size_t size = shape_size(m_shape) * m_element_type.size();
-                m_data.reset(new runtime::AlignedBuffer(shape_size(m_shape) * m_element_type.size(),
-                                                        host_alignment()));
+                size_t size = mem_size();
+                m_data.reset(new runtime::AlignedBuffer(size, host_alignment()));
                 std::memcpy(m_data->get_ptr(), data, size);
                 constructor_validate_and_infer_types();
                 m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
             }
 
+            /// \brief Constructs a tensor constant that refers to `data` instead of copying it.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data A void* to constant data. The data must stay valid and unchanged
+            ///             for as long as the constant, its copies and any executable compiled
+            ///             from them exist.
+            /// \param owner Keeps `data` alive; may be null if the caller manages the lifetime.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const void* data,
+                     std::shared_ptr<const void> owner)
+                : m_element_type(type)
+                , m_shape(shape)
+                , m_data(nullptr)
+                , m_external_data(data)
+                , m_external_owner(std::move(owner))
+            {
+                constructor_validate_and_infer_types();
+                m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+            }
+
+            /// \brief Constructs a tensor constant whose data is materialized on first access.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param loader Called at most once, with a buffer of the constant's storage size,
+            ///               the first time the data is needed.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     std::function<void(void*)> loader)
+                : m_element_type(type)
+                , m_shape(shape)
+                , m_data(nullptr)
+                , m_all_elements_bitwise_identical(false)
+                , m_loader(std::move(loader))
+                , m_lazy(true)
+            {
+                constructor_validate_and_infer_types();
+            }
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -224,16 +265,28 @@ namespace ngraph
             /// \return The initialization literals for the tensor constant.
             std::vector<std::string> get_value_strings() const;
 
+            /// \brief Returns the elements of the constant. u1 data is unpacked to one 0 or 1
+            ///        element per bit.
             template <typename T>
             std::vector<T> get_vector() const
             {
+                std::vector<T> rc;
+                if (m_element_type == element::u1)
+                {
+                    const uint8_t* bits = reinterpret_cast<const uint8_t*>(get_data_ptr());
+                    for (size_t i = 0; i < shape_size(m_shape); i++)
+                    {
+                        rc.push_back(static_cast<T>((bits[i / 8] >> (7 - i % 8)) & 1));
+                    }
+                    return rc;
+                }
+
                 if (sizeof(T) > m_element_type.size() && shape_size(m_shape) > 0)
                 {
                     throw ngraph_error("Buffer over-read");
                 }
 
-                std::vector<T> rc;
-                const T* p = reinterpret_cast<const T*>(m_data->get_ptr());
+                const T* p = reinterpret_cast<const T*>(get_data_ptr());
                 for (size_t i = 0; i < shape_size(m_shape); i++)
                 {
                     rc.push_back(p[i]);
@@ -241,7 +294,11 @@ namespace ngraph
                 return rc;
             }
 
-            const void* get_data_ptr() const { return (m_data ? m_data->get_ptr() : nullptr); }
+            const void* get_data_ptr() const
+            {
+                load_data();
+                return (m_data ? m_data->get_ptr() : m_external_data);
+            }
             template <typename T>
             const T* get_data_ptr() const
             {
@@ -250,14 +307,27 @@ namespace ngraph
 
             bool is_constant() const override { return true; }
             bool are_all_data_elements_bitwise_identical() const;
-            bool get_all_data_elements_bitwise_identical() const
-            {
-                return m_all_elements_bitwise_identical;
-            }
+            bool get_all_data_elements_bitwise_identical() const;
             std::string convert_value_to_string(size_t index) const;
+            /// \return false if the constant was constructed with a loader that has not run yet.
+            bool is_data_loaded() const { return !m_lazy || m_data_loaded; }
+            /// \return The size of the constant's data in bytes.
+            size_t get_byte_size() const { return mem_size(); }
+            /// \brief Makes the constant, and the copies made of it from now on, refer to
+            ///        `data`. The previous data stays allocated until the constant is destroyed,
+            ///        so pointers returned by get_data_ptr before the call remain valid.
+            ///
+            /// \param data Bytes equal to the constant's data, which must stay valid and
+            ///             unchanged while `owner` is alive.
+            /// \param owner Keeps `data` alive.
+            void share_data(const void* data, std::shared_ptr<const void> owner);
 
         protected:
-            void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+            void* get_data_ptr_nc()
+            {
+                load_data();
+                return (m_data ? m_data->get_ptr() : const_cast<void*>(m_external_data));
+            }
             Constant(const OutputVector& args)
                 : Op(args)
                 , m_shape({})
@@ -339,7 +409,9 @@ namespace ngraph
                 case element::Type_t::u64:
                     write_buffer<uint64_t, T>(target, source, target_element_count);
                     break;
-                case element::Type_t::u1: throw std::runtime_error("unsupported type");
+                case element::Type_t::u1:
+                    write_u1_buffer<T>(target, source, target_element_count);
+                    break;
                 case element::Type_t::undefined: throw std::runtime_error("unsupported type");
                 case element::Type_t::dynamic: throw std::runtime_error("unsupported type");
                 }
@@ -348,13 +420,53 @@ namespace ngraph
 #endif
             }
 
+            // u1 data is bit-packed, most significant bit first, with values greater than zero
+            // stored as 1. This is the binarization reference::pack_u1 applies to the inputs
+            // of BinaryConvolution, so -1/+1 weights pack the same way in both places.
+            template <typename U>
+            void write_u1_buffer(void* target, const std::vector<U>& source, size_t count)
+            {
+                uint8_t* p = reinterpret_cast<uint8_t*>(target);
+                std::memset(p, 0, (count + 7) / 8);
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (source[i] > U(0))
+                    {
+                        p[i / 8] |= static_cast<uint8_t>(0x80 >> (i % 8));
+                    }
+                }
+            }
+
+            /// \return The number of bytes of data storage; element types narrower than a
+            ///         byte are bit-packed.
+            size_t mem_size() const
+            {
+                if (m_element_type.bitwidth() < 8)
+                {
+                    size_t bits = shape_size(m_shape) * m_element_type.bitwidth();
+                    return (bits + 7) / 8;
+                }
+                return shape_size(m_shape) * m_element_type.size();
+            }
+
             static constexpr size_t host_alignment() { return 64; }
             element::Type m_element_type;
             Shape m_shape{};
-            std::unique_ptr<runtime::AlignedBuffer> m_data;
-            bool m_all_elements_bitwise_identical;
+            mutable std::unique_ptr<runtime::AlignedBuffer> m_data;
+            mutable bool m_all_elements_bitwise_identical;
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
+
+        private:
+            void load_data() const;
+
+            const void* m_external_data{nullptr};
+            std::shared_ptr<const void> m_external_owner;
+            mutable std::function<void(void*)> m_loader;
+            bool m_lazy{false};
+            mutable std::atomic<bool> m_data_loaded{false};
+            mutable std::once_flag m_load_flag;
+            mutable std::once_flag m_identical_flag;
         };
 
         class ScalarConstantLikeBase : public Constant
@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ScaledDotProductAttention::type_info;
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                         const Output<Node>& key,
+                                                         const Output<Node>& value,
+                                                         double scale)
+    : FusedOp({query, key, value})
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                         const Output<Node>& key,
+                                                         const Output<Node>& value,
+                                                         const Output<Node>& mask,
+                                                         double scale)
+    : FusedOp({query, key, value, mask})
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ScaledDotProductAttention::validate_and_infer_types()
+{
+    element::Type result_et{element::dynamic};
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(
+            this,
+            element::Type::merge(result_et, result_et, get_input_element_type(i)),
+            "Arguments do not have the same element type (input ",
+            i,
+            " has type ",
+            get_input_element_type(i),
+            ").");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).rank().compatible(3),
+                              "Input ",
+                              i,
+                              " must have rank 3 (got shape ",
+                              get_input_partial_shape(i),
+                              ").");
+    }
+    NODE_VALIDATION_CHECK(this,
+                          result_et.is_dynamic() || result_et.is_real(),
+                          "Argument element type must be f16, bf16, f32, f64 or dynamic (got ",
+                          result_et,
+                          ").");
+
+    const PartialShape& query_shape = get_input_partial_shape(0);
+    const PartialShape& key_shape = get_input_partial_shape(1);
+    const PartialShape& value_shape = get_input_partial_shape(2);
+
+    Dimension batch = Dimension::dynamic();
+    Dimension query_length = Dimension::dynamic();
+    Dimension key_length = Dimension::dynamic();
+    Dimension depth = Dimension::dynamic();
+    Dimension value_depth = Dimension::dynamic();
+    if (query_shape.rank().is_static())
+    {
+        batch = query_shape[0];
+        query_length = query_shape[1];
+        depth = query_shape[2];
+    }
+    if (key_shape.rank().is_static())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              Dimension::merge(batch, batch, key_shape[0]) &&
+                                  Dimension::merge(depth, depth, key_shape[2]),
+                              "Key shape ",
+                              key_shape,
+                              " is not compatible with query shape ",
+                              query_shape,
+                              ".");
+        key_length = key_shape[1];
+    }
+    if (value_shape.rank().is_static())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              Dimension::merge(batch, batch, value_shape[0]) &&
+                                  Dimension::merge(key_length, key_length, value_shape[1]),
+                              "Value shape ",
+                              value_shape,
+                              " is not compatible with key shape ",
+                              key_shape,
+                              ".");
+        value_depth = value_shape[2];
+    }
+    if (get_has_mask() && get_input_partial_shape(3).rank().is_static())
+    {
+        const PartialShape& mask_shape = get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(this,
+                              mask_shape[2].compatible(key_length),
+                              "Mask shape ",
+                              mask_shape,
+                              " does not match the key length ",
+                              key_length,
+                              ".");
+        if (mask_shape[1].is_static() && query_length.is_static())
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  size_t(mask_shape[1]) == 1 ||
+                                      size_t(mask_shape[1]) == size_t(query_length),
+                                  "Mask shape ",
+                                  mask_shape,
+                                  " does not broadcast to the query length ",
+                                  query_length,
+                                  ".");
+        }
+        if (mask_shape[0].is_static() && batch.is_static())
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  size_t(mask_shape[0]) != 0 &&
+                                      size_t(batch) % size_t(mask_shape[0]) == 0,
+                                  "Mask shape ",
+                                  mask_shape,
+                                  " does not broadcast to the batch size ",
+                                  batch,
+                                  ".");
+        }
+    }
+
+    set_output_type(0, result_et, PartialShape{batch, query_length, value_depth});
+}
+
+NodeVector op::ScaledDotProductAttention::decompose_op() const
+{
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).is_static(),
+                              "Input ",
+                              i,
+                              " needs to have static shape to decompose, but got shape ",
+                              get_input_partial_shape(i));
+    }
+
+    const Shape& key_shape = get_input_shape(1);
+    const size_t batch = key_shape[0];
+    const size_t key_length = key_shape[1];
+    auto key_t = make_shared<op::Reshape>(
+        input_value(1), AxisVector{0, 2, 1}, Shape{batch, key_shape[2], key_length});
+
+    shared_ptr<Node> scores = make_shared<op::BatchMatMul>(input_value(0), key_t);
+    const Shape scores_shape = scores->get_shape();
+    if (m_scale != 1.0)
+    {
+        scores = scores * builder::make_constant(get_element_type(), scores_shape, m_scale);
+    }
+
+    if (get_has_mask())
+    {
+        Output<Node> mask = input_value(3);
+        const Shape& mask_shape = get_input_shape(3);
+        if (mask_shape != scores_shape)
+        {
+            // Replicate each mask slice over its group of batch entries and, for a
+            // [M, 1, S_k] mask, over the query positions.
+            const size_t mask_batch = mask_shape[0];
+            const Shape grouped_shape{
+                mask_batch, batch / mask_batch, scores_shape[1], key_length};
+            if (mask_shape[1] == 1)
+            {
+                mask = make_shared<op::Broadcast>(
+                    make_shared<op::Reshape>(
+                        mask, AxisVector{0, 1, 2}, Shape{mask_batch, key_length}),
+                    grouped_shape,
+                    AxisSet{1, 2});
+            }
+            else
+            {
+                mask = make_shared<op::Broadcast>(mask, grouped_shape, AxisSet{1});
+            }
+            mask = make_shared<op::Reshape>(mask, AxisVector{0, 1, 2, 3}, scores_shape);
+        }
+        scores = scores + mask;
+    }
+
+    auto probabilities = make_shared<op::Softmax>(scores, AxisSet{2});
+    return {make_shared<op::BatchMatMul>(probabilities, input_value(2))};
+}
+
+shared_ptr<Node>
+    op::ScaledDotProductAttention::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 4)
+    {
+        return make_shared<ScaledDotProductAttention>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale);
+    }
+    return make_shared<ScaledDotProductAttention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_scale);
+}
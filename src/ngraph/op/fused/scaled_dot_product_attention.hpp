@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Scaled dot-product attention, `softmax(scale * Q.K^T + mask).V`, computed
+        ///        for a batch of independent (query, key, value) triples.
+        ///
+        /// Multi-head attention is expressed by folding the heads into the batch
+        /// dimension, i.e. a `[B, H, S, D]` query is passed as `[B * H, S, D]`.
+        ///
+        /// The optional mask is added to the scaled scores before the softmax and
+        /// broadcasts over the first two dimensions: a mask of shape `[M, Q, S_k]`
+        /// requires `M` to divide the batch size and applies mask slice `n / (N / M)`
+        /// to batch entry `n` (so `[B, 1, S_k]` applies the same mask to all heads of
+        /// one sample), and `Q` must be either 1 or the query length.
+        class ScaledDotProductAttention : public ngraph::op::util::FusedOp
+        {
+        public:
+            NGRAPH_API
+            static constexpr NodeTypeInfo type_info{"ScaledDotProductAttention", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            ScaledDotProductAttention() = default;
+            /// \brief Constructs a ScaledDotProductAttention operation without a mask.
+            ///
+            /// \param query Queries, shape `[N, S_q, D]`.
+            /// \param key Keys, shape `[N, S_k, D]`.
+            /// \param value Values, shape `[N, S_k, D_v]`.
+            /// \param scale Factor applied to `Q.K^T` before the softmax.
+            ///
+            /// Output `[N, S_q, D_v]`
+            ScaledDotProductAttention(const Output<Node>& query,
+                                      const Output<Node>& key,
+                                      const Output<Node>& value,
+                                      double scale);
+            /// \brief Constructs a masked ScaledDotProductAttention operation.
+            ///
+            /// \param query Queries, shape `[N, S_q, D]`.
+            /// \param key Keys, shape `[N, S_k, D]`.
+            /// \param value Values, shape `[N, S_k, D_v]`.
+            /// \param mask Additive mask, shape `[M, 1 or S_q, S_k]` with `N % M == 0`.
+            /// \param scale Factor applied to `Q.K^T` before the softmax.
+            ///
+            /// Output `[N, S_q, D_v]`
+            ScaledDotProductAttention(const Output<Node>& query,
+                                      const Output<Node>& key,
+                                      const Output<Node>& value,
+                                      const Output<Node>& mask,
+                                      double scale);
+
+            double get_scale() const { return m_scale; }
+            bool get_has_mask() const { return get_input_size() == 4; }
+            virtual void validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            double m_scale{1.0};
+        };
+    }
+}
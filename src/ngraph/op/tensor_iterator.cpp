@@ -437,6 +437,7 @@ void op::TensorIterator::validate_and_infer_types()
 std::shared_ptr<Node> op::TensorIterator::copy_with_new_args(const NodeVector& new_args) const
 {
     auto op = make_shared<op::TensorIterator>(as_output_vector(new_args));
+    op->set_body(m_body);
     for (auto& input_description : m_input_descriptions)
     {
         op->m_input_descriptions.push_back(input_description->copy());
@@ -445,5 +446,9 @@ std::shared_ptr<Node> op::TensorIterator::copy_with_new_args(const NodeVector& n
     {
         op->m_output_descriptions.push_back(output_description->copy());
     }
+    // The number of iterations is recomputed from the new arguments, which may have a different
+    // extent along the sliced axis than the original ones.
+    op->set_output_size(m_output_descriptions.size());
+    op->validate_and_infer_types();
     return move(op);
 }
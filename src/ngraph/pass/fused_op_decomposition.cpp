@@ -23,6 +23,7 @@ using namespace ngraph;
 pass::FusedOpDecomposition::FusedOpDecomposition(op_query_t callback)
     : m_has_direct_support{callback}
 {
+    set_property(PassProperty::FUNCTION_LOCAL, true);
 }
 
 bool pass::FusedOpDecomposition::run_on_node(shared_ptr<Node> node)
@@ -29,5 +29,6 @@ namespace ngraph
 class ngraph::pass::GetOutputElementElimination : public NodePass
 {
 public:
+    GetOutputElementElimination() { set_property(PassProperty::FUNCTION_LOCAL, true); }
     bool run_on_node(std::shared_ptr<Node> node) override;
 };
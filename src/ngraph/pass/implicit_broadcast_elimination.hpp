@@ -31,5 +31,6 @@ namespace ngraph
 class ngraph::pass::ImplicitBroadcastElimination : public ngraph::pass::NodePass
 {
 public:
+    ImplicitBroadcastElimination() { set_property(PassProperty::FUNCTION_LOCAL, true); }
     bool run_on_node(std::shared_ptr<ngraph::Node> node) override;
 };
@@ -25,6 +25,7 @@ namespace ngraph
         class LikeReplacement : public FunctionPass
         {
         public:
+            LikeReplacement() { set_property(PassProperty::FUNCTION_LOCAL, true); }
             bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
         };
     }
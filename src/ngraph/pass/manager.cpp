@@ -22,10 +22,13 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -47,19 +50,188 @@ pass::Manager::Manager()
     {
         m_serialize = true;
     }
+    static const auto npt = std::getenv("NGRAPH_PASS_THREADS");
+    if (npt)
+    {
+        m_num_threads = std::strtoul(npt, nullptr, 10);
+    }
 }
 
 pass::Manager::~Manager()
 {
 }
 
+namespace
+{
+    // The ops of one function that belong to a group of independent nodes
+    struct FunctionPart
+    {
+        size_t function_index;
+        vector<shared_ptr<Node>> ops;
+    };
+
+    // Nodes that are connected, through data or control edges, in any of the functions
+    using IndependentGroup = vector<FunctionPart>;
+}
+
+// Splits the ops of the functions into groups that share no nodes, i.e. the weakly connected
+// components of the union of the function graphs. Ops keep their get_ops() order within a part.
+static vector<IndependentGroup>
+    find_independent_groups(const vector<pair<shared_ptr<Function>, bool>>& fs)
+{
+    unordered_map<Node*, size_t> node_index;
+    vector<size_t> parent;
+    auto index_of = [&](Node* node) {
+        auto it = node_index.find(node);
+        if (it != node_index.end())
+        {
+            return it->second;
+        }
+        node_index.emplace(node, parent.size());
+        parent.push_back(parent.size());
+        return parent.size() - 1;
+    };
+    auto find = [&](size_t i) {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto unite = [&](Node* a, Node* b) {
+        size_t index_a = index_of(a);
+        size_t index_b = index_of(b);
+        parent[find(index_a)] = find(index_b);
+    };
+
+    vector<list<shared_ptr<Node>>> function_ops;
+    for (auto& f_pair : fs)
+    {
+        function_ops.push_back(f_pair.first->get_ops());
+        for (auto& node : function_ops.back())
+        {
+            index_of(node.get());
+            for (auto& input : node->inputs())
+            {
+                unite(node.get(), input.get_source_output().get_node());
+            }
+            for (auto& control_dependency : node->get_control_dependencies())
+            {
+                unite(node.get(), control_dependency.get());
+            }
+        }
+    }
+
+    vector<IndependentGroup> groups;
+    unordered_map<size_t, size_t> group_of_root;
+    for (size_t i = 0; i < function_ops.size(); i++)
+    {
+        for (auto& node : function_ops[i])
+        {
+            size_t root = find(node_index.at(node.get()));
+            auto it = group_of_root.find(root);
+            if (it == group_of_root.end())
+            {
+                it = group_of_root.emplace(root, groups.size()).first;
+                groups.emplace_back();
+            }
+            IndependentGroup& group = groups[it->second];
+            if (group.empty() || group.back().function_index != i)
+            {
+                group.push_back(FunctionPart{i, {}});
+            }
+            group.back().ops.push_back(node);
+        }
+    }
+    return groups;
+}
+
+// Runs a FUNCTION_LOCAL function or node pass on each independent group concurrently. A function
+// that is split across several groups is presented to a function pass as one sub-function per
+// group, built from the results and parameters that fall into that group.
+static void run_function_local_pass(const shared_ptr<pass::PassBase>& pass,
+                                    const vector<pair<shared_ptr<Function>, bool>>& fs,
+                                    const vector<IndependentGroup>& groups,
+                                    size_t num_threads)
+{
+    auto function_pass = dynamic_pointer_cast<pass::FunctionPass>(pass);
+    auto node_pass = dynamic_pointer_cast<pass::NodePass>(pass);
+    bool require_static = pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE);
+
+    vector<size_t> function_groups(fs.size(), 0);
+    for (auto& group : groups)
+    {
+        for (auto& part : group)
+        {
+            function_groups[part.function_index]++;
+        }
+    }
+
+    parallel_for_each_index(
+        groups.size(),
+        [&](size_t g) {
+            for (const FunctionPart& part : groups[g])
+            {
+                const shared_ptr<Function>& f = fs[part.function_index].first;
+                if (require_static && fs[part.function_index].second)
+                {
+                    continue;
+                }
+                if (node_pass)
+                {
+                    for (auto& n : part.ops)
+                    {
+                        node_pass->run_on_node(n);
+                    }
+                }
+                else if (function_groups[part.function_index] == 1)
+                {
+                    function_pass->run_on_function(f);
+                }
+                else
+                {
+                    ResultVector results;
+                    ParameterVector parameters;
+                    for (auto& n : part.ops)
+                    {
+                        if (auto result = as_type_ptr<op::Result>(n))
+                        {
+                            results.push_back(result);
+                        }
+                        else if (auto parameter = as_type_ptr<op::Parameter>(n))
+                        {
+                            parameters.push_back(parameter);
+                        }
+                    }
+                    if (!results.empty())
+                    {
+                        function_pass->run_on_function(
+                            make_shared<Function>(results, parameters, f->get_name()));
+                    }
+                }
+            }
+        },
+        num_threads);
+}
+
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
+{
+    run_passes(vector<shared_ptr<Function>>{func});
+}
+
+void pass::Manager::run_passes(const vector<shared_ptr<Function>>& funcs)
 {
     static bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
 
-    get_state().set_function(func);
-    vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
-    vector<shared_ptr<Function>> f_array{func};
+    NGRAPH_CHECK(!funcs.empty(), "No functions to run passes on");
+    get_state().set_function(funcs.at(0));
+    vector<std::pair<shared_ptr<Function>, bool>> fs;
+    for (auto& func : funcs)
+    {
+        fs.push_back(std::make_pair(func, func->is_dynamic()));
+    }
+    vector<shared_ptr<Function>> f_array{funcs};
 
     size_t index = 0;
     stopwatch pass_timer;
@@ -73,7 +245,18 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
         auto node_pass = dynamic_pointer_cast<NodePass>(pass);
         auto call_graph_pass = dynamic_pointer_cast<CallGraphPass>(pass);
-        if (module_pass)
+        bool function_local = (function_pass || node_pass) && m_num_threads != 1 &&
+                              pass->get_property(PassProperty::FUNCTION_LOCAL);
+        vector<IndependentGroup> groups;
+        if (function_local)
+        {
+            groups = find_independent_groups(fs);
+        }
+        if (groups.size() > 1)
+        {
+            run_function_local_pass(pass, fs, groups, m_num_threads);
+        }
+        else if (module_pass)
         {
             if (auto vt_pass = dynamic_pointer_cast<pass::VisualizeTree>(module_pass))
             {
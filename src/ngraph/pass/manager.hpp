@@ -54,12 +54,21 @@ public:
 
     void run_passes(std::shared_ptr<Function>, bool transitive = true);
 
+    /// \brief Runs the registered passes over several functions. Passes with the
+    ///        FUNCTION_LOCAL property are run concurrently over groups of functions and
+    ///        connected components that share no nodes when more than one thread is allowed;
+    ///        all other passes run over the functions in order.
+    void run_passes(const std::vector<std::shared_ptr<Function>>& funcs);
+
     ManagerState& get_state();
     PassConfig& get_pass_config() { return m_pass_config; }
     void set_pass_config(const PassConfig& pass_config) { m_pass_config = pass_config; }
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Sets the number of threads FUNCTION_LOCAL passes may use. 0 selects one per
+    ///        hardware thread. Defaults to 1, or to NGRAPH_PASS_THREADS when it is set.
+    void set_num_threads(size_t num_threads) { m_num_threads = num_threads; }
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -91,4 +100,5 @@ private:
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    size_t m_num_threads = 1;
 };
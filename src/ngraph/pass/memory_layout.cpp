@@ -14,13 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <set>
 #include <sstream>
+#include <unordered_map>
 
-#include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
-#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -40,63 +43,273 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
     }
 }
 
+namespace
+{
+    // Tensors that occupy one buffer, each at an offset from its start. The buffer comes from
+    // the temporary pool unless it is the buffer of a function output.
+    struct BufferSet
+    {
+        size_t size;
+        vector<pair<descriptor::Tensor*, size_t>> members;
+        size_t live_count;
+        bool is_output;
+        size_t output_index;
+        size_t pool_offset;
+    };
+
+    class BufferSets
+    {
+    public:
+        bool contains(descriptor::Tensor* tensor) const { return m_set_of.count(tensor) != 0; }
+        BufferSet& set_of(descriptor::Tensor* tensor) { return m_sets.at(m_set_of.at(tensor)); }
+        size_t offset_of(descriptor::Tensor* tensor) const { return m_offset_of.at(tensor); }
+        // Returns true if `tensor` spans the whole of its buffer, so that the buffer can move
+        // into another one
+        bool is_whole_buffer(descriptor::Tensor* tensor)
+        {
+            return offset_of(tensor) == 0 && set_of(tensor).size == tensor->size();
+        }
+        bool same_set(descriptor::Tensor* a, descriptor::Tensor* b) const
+        {
+            return m_set_of.at(a) == m_set_of.at(b);
+        }
+
+        void create(descriptor::Tensor* tensor)
+        {
+            m_set_of[tensor] = m_sets.size();
+            m_offset_of[tensor] = 0;
+            m_sets.push_back(BufferSet{tensor->size(), {{tensor, 0}}, 0, false, 0, 0});
+        }
+
+        void join(descriptor::Tensor* tensor, descriptor::Tensor* existing, size_t offset)
+        {
+            m_set_of[tensor] = m_set_of.at(existing);
+            m_offset_of[tensor] = offset;
+            set_of(existing).members.push_back({tensor, offset});
+        }
+
+        // Moves every member of the set of `tensor` into the set of `target`, `offset` bytes
+        // from its start
+        void merge(descriptor::Tensor* tensor, descriptor::Tensor* target, size_t offset)
+        {
+            size_t target_id = m_set_of.at(target);
+            BufferSet& source = set_of(tensor);
+            BufferSet& destination = m_sets.at(target_id);
+            for (auto& member : source.members)
+            {
+                m_set_of[member.first] = target_id;
+                m_offset_of[member.first] += offset;
+                destination.members.push_back({member.first, m_offset_of[member.first]});
+            }
+            destination.live_count += source.live_count;
+            source.members.clear();
+            source.live_count = 0;
+        }
+
+        vector<BufferSet>& sets() { return m_sets; }
+    private:
+        vector<BufferSet> m_sets;
+        unordered_map<descriptor::Tensor*, size_t> m_set_of;
+        unordered_map<descriptor::Tensor*, size_t> m_offset_of;
+    };
+}
+
+// Returns the byte offset of a contiguous slice within its input
+static size_t slice_byte_offset(const op::Slice& slice)
+{
+    const Shape& in_shape = slice.get_input_shape(0);
+    const Coordinate& lower_bounds = slice.get_lower_bounds();
+    size_t start = 0;
+    size_t accumulated = 1;
+    for (size_t i = in_shape.size(); i > 0; i--)
+    {
+        start += lower_bounds[i - 1] * accumulated;
+        accumulated *= in_shape[i - 1];
+    }
+    return start * slice.get_element_type().size();
+}
+
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    const ResultVector& results = function->get_results();
+    BufferSets buffers;
+    unordered_map<descriptor::Tensor*, size_t> first_use;
+    unordered_map<descriptor::Tensor*, size_t> last_use;
+
+    // Group the temporaries into buffers following the in-place pairs, in execution order so
+    // that live counts tell whether an input may still be overwritten
+    size_t op_index = 0;
+    for (shared_ptr<Node> node : ops)
     {
-        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
-        std::set<const descriptor::Tensor*> reused_inputs;
+        for (auto& output : node->outputs())
+        {
+            m_output_aliases.erase(&output.get_tensor());
+        }
+
+        vector<op::util::oi_pair> in_place_oi_pairs;
+        if (auto op_annotations = node->get_op_annotations())
+        {
+            in_place_oi_pairs = op_annotations->get_in_place_oi_pairs();
+        }
+        bool is_concat = is_type<op::Concat>(node);
+        bool is_result = is_type<op::Result>(node);
 
-        if (node->is_op())
+        for (auto& oi_pair : in_place_oi_pairs)
         {
-            auto op = std::static_pointer_cast<op::Op>(node);
-            // concat and slice in_place_oi should be treated differently
-            if (!is_type<op::Concat>(node) && !is_type<op::Slice>(node))
+            if (is_concat || is_result)
+            {
+                // handled below, once the buffer of the output exists
+                break;
+            }
+            descriptor::Tensor* output = &node->output(oi_pair.output).get_tensor();
+            descriptor::Tensor* input = &node->input(oi_pair.input).get_tensor();
+            if (node->liveness_new_list.count(output) == 0 || !buffers.contains(input))
+            {
+                continue;
+            }
+
+            size_t offset = buffers.offset_of(input);
+            if (oi_pair.destructive)
+            {
+                // For a destructive kernel, this must be the last use of the whole buffer
+                BufferSet& input_set = buffers.set_of(input);
+                if (node->liveness_free_list.count(input) == 0 || input_set.live_count != 1 ||
+                    input_set.is_output || output->size() > input->size())
+                {
+                    continue;
+                }
+            }
+            else
             {
-                if (auto op_annotations = op->get_op_annotations())
+                if (auto slice = as_type_ptr<op::Slice>(node))
                 {
-                    for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
-                    {
-                        auto output = &node->output(oi_pair.output).get_tensor();
-                        auto input = &node->input(oi_pair.input).get_tensor();
-                        auto input_node = node->input(oi_pair.input).get_source_output().get_node();
-
-                        // For destructive kernel, this should be the last use
-                        // Non-destructive kernels can pass through if memory sharing is disabled
-                        if ((node->liveness_free_list.count(input) != 0 ||
-                             is_type<op::GetOutputElement>(node) ||
-                             (m_disable_memory_sharing && !oi_pair.destructive &&
-                              !input_node->is_parameter() && !input_node->is_constant())) &&
-                            node->liveness_new_list.count(output) != 0)
-
-                        {
-                            NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
-                                         << output->get_name();
-                            in_place_outputs.insert({output, input});
-                            reused_inputs.insert(input);
-                        }
-                    }
+                    offset += slice_byte_offset(*slice);
+                }
+                if (buffers.offset_of(input) + input->size() < offset + output->size())
+                {
+                    continue;
                 }
             }
+            NGRAPH_DEBUG << "Reusing " << input->get_name() << " for " << output->get_name();
+            buffers.join(output, input, offset);
         }
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
-            tensor->set_pool_offset(offset);
+            if (!buffers.contains(tensor))
+            {
+                buffers.create(tensor);
+            }
+            buffers.set_of(tensor).live_count++;
+            first_use[tensor] = op_index;
         }
 
-        if (!m_disable_memory_sharing)
+        if (is_concat && !in_place_oi_pairs.empty())
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            // Compute the arguments in place by moving their buffers into the output
+            descriptor::Tensor* output = &node->output(0).get_tensor();
+            set<descriptor::Tensor*> inputs;
+            size_t offset = 0;
+            for (auto& input : node->inputs())
             {
-                if (reused_inputs.count(tensor) == 0)
+                descriptor::Tensor* tensor = &input.get_tensor();
+                if (buffers.contains(output) && buffers.contains(tensor) &&
+                    inputs.insert(tensor).second && !buffers.same_set(tensor, output) &&
+                    !buffers.set_of(tensor).is_output && buffers.is_whole_buffer(tensor))
                 {
-                    mm.free(tensor->get_pool_offset());
+                    NGRAPH_DEBUG << "Computing " << tensor->get_name() << " in place in "
+                                 << output->get_name();
+                    buffers.merge(tensor, output, offset);
                 }
+                offset += tensor->size();
+            }
+        }
+        else if (is_result && !in_place_oi_pairs.empty())
+        {
+            // Compute the result in the output buffer
+            descriptor::Tensor* input = &node->input(0).get_tensor();
+            if (buffers.contains(input) && !buffers.set_of(input).is_output &&
+                buffers.is_whole_buffer(input))
+            {
+                BufferSet& input_set = buffers.set_of(input);
+                input_set.is_output = true;
+                input_set.output_index =
+                    find(results.begin(), results.end(), node) - results.begin();
+                NGRAPH_DEBUG << "Computing " << input->get_name() << " in output "
+                             << input_set.output_index;
+            }
+        }
+
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            if (buffers.contains(tensor))
+            {
+                buffers.set_of(tensor).live_count--;
+                last_use[tensor] = op_index;
+            }
+        }
+        op_index++;
+    }
+
+    // Each buffer taken from the pool lives from the first use of any member to the last
+    map<size_t, vector<BufferSet*>> allocations;
+    map<size_t, vector<BufferSet*>> frees;
+    for (BufferSet& buffer : buffers.sets())
+    {
+        if (buffer.members.empty())
+        {
+            continue;
+        }
+        if (buffer.is_output)
+        {
+            for (auto& member : buffer.members)
+            {
+                member.first->set_pool_offset(member.second);
+                m_output_aliases[member.first] = buffer.output_index;
+            }
+            continue;
+        }
+        size_t first = numeric_limits<size_t>::max();
+        size_t last = 0;
+        bool freed = true;
+        for (auto& member : buffer.members)
+        {
+            first = min(first, first_use.at(member.first));
+            auto it = last_use.find(member.first);
+            if (it == last_use.end())
+            {
+                freed = false;
+            }
+            else
+            {
+                last = max(last, it->second);
+            }
+        }
+        allocations[first].push_back(&buffer);
+        if (freed)
+        {
+            frees[last].push_back(&buffer);
+        }
+    }
+
+    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    for (size_t i = 0; i < op_index; i++)
+    {
+        for (BufferSet* buffer : allocations[i])
+        {
+            size_t offset = mm.allocate(buffer->size);
+            for (auto& member : buffer->members)
+            {
+                member.first->set_pool_offset(offset + member.second);
+            }
+            buffer->pool_offset = offset;
+        }
+        if (!m_disable_memory_sharing)
+        {
+            for (BufferSet* buffer : frees[i])
+            {
+                mm.free(buffer->pool_offset);
             }
         }
     }
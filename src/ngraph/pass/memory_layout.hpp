@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -32,15 +33,32 @@ namespace ngraph
     }
 }
 
+/// \brief Assigns pool offsets to the temporary tensors of a function, reusing the memory of
+///        tensors that are no longer live.
+///
+/// In-place pairs in the op annotations (see MemoryOptimization) place tensors in the same
+/// buffer: the output of a destructive pair overwrites its input when the input dies at that
+/// op, views such as Reshape and Slice get the offset of the data they view, the arguments of
+/// an in-place Concat are computed straight into its output, and the input of an in-place
+/// Result is computed into the function output instead of the pool.
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
     MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    /// \brief Tensors that live in the buffer of a function output rather than in the
+    ///        temporary pool, mapped to the index of that output. Their pool offset is
+    ///        relative to the start of the output buffer.
+    const std::unordered_map<const descriptor::Tensor*, size_t>& get_output_aliases() const
+    {
+        return m_output_aliases;
+    }
+
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    std::unordered_map<const descriptor::Tensor*, size_t> m_output_aliases;
 };
 
 class ngraph::pass::MemoryManager
@@ -0,0 +1,152 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/memory_optimization.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/slice.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Returns the input that the single output of an elementwise op can overwrite, if any.
+// Parameters and constants are never overwritten, so they are not candidates.
+static bool find_destructive_input(const Node& node, size_t& input_index)
+{
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        auto source = node.input_value(i).get_node();
+        if (!source->is_parameter() && !source->is_constant() &&
+            node.get_input_element_type(i) == node.get_output_element_type(0) &&
+            node.get_input_shape(i) == node.get_output_shape(0))
+        {
+            input_index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// A slice is a view if it covers a contiguous range of its input: every axis after the last
+// sliced one is taken whole and every axis before it has extent 1.
+static bool is_contiguous_slice(const op::Slice& slice)
+{
+    if (is_strided(slice.get_strides()))
+    {
+        return false;
+    }
+    const Shape& in_shape = slice.get_input_shape(0);
+    const Shape& out_shape = slice.get_output_shape(0);
+    size_t axis = 0;
+    for (size_t i = in_shape.size(); i > 0; i--)
+    {
+        if (in_shape[i - 1] != out_shape[i - 1])
+        {
+            axis = i - 1;
+            break;
+        }
+    }
+    for (size_t i = 0; i < axis; i++)
+    {
+        if (out_shape[i] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Concat arguments are adjacent in the output if every axis before the concatenation axis has
+// extent 1
+static bool is_contiguous_concat(const op::Concat& concat)
+{
+    const Shape& out_shape = concat.get_output_shape(0);
+    size_t axis = static_cast<size_t>(concat.get_concatenation_axis());
+    for (size_t i = 0; i < axis; i++)
+    {
+        if (out_shape[i] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pass::MemoryOptimization::run_on_function(shared_ptr<Function> function)
+{
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!node->is_op() || node->is_dynamic() || node->get_output_size() != 1)
+        {
+            continue;
+        }
+        auto op_annotations = node->get_op_annotations();
+        if (op_annotations && op_annotations->get_in_place_oi_pairs().size() > 0)
+        {
+            continue;
+        }
+
+        size_t input_index = 0;
+        bool destructive = false;
+        if (node->is_unary_elementwise_arithmetic() || node->is_binary_elementwise_arithmetic())
+        {
+            if (!find_destructive_input(*node, input_index))
+            {
+                continue;
+            }
+            destructive = true;
+        }
+        else if (auto reshape = as_type_ptr<op::Reshape>(node))
+        {
+            if (reshape->get_is_transpose())
+            {
+                continue;
+            }
+        }
+        else if (auto slice = as_type_ptr<op::Slice>(node))
+        {
+            if (!is_contiguous_slice(*slice))
+            {
+                continue;
+            }
+        }
+        else if (auto concat = as_type_ptr<op::Concat>(node))
+        {
+            if (!is_contiguous_concat(*concat))
+            {
+                continue;
+            }
+        }
+        else if (!is_type<op::GetOutputElement>(node) && !is_type<op::Result>(node))
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "memory_optimization: " << node->get_name() << " output 0 may share input "
+                     << input_index << (destructive ? " destructively" : "");
+        if (!op_annotations)
+        {
+            op_annotations = m_op_annotations_factory();
+            node->set_op_annotations(op_annotations);
+        }
+        op_annotations->add_in_place_oi_pair({0, input_index, destructive});
+    }
+    return false;
+}
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemoryOptimization;
+    }
+}
+
+/// \brief Marks the ops whose outputs can share memory with an input, for MemoryLayout to act
+///        on. Nodes that already carry in-place pairs are left alone, so a backend can annotate
+///        its own kernels first.
+///
+/// Elementwise arithmetic gets a destructive pair on an input of the output's type and shape.
+/// Non-transposing Reshape, GetOutputElement, contiguous Slice, Concat along the outermost
+/// non-unit axis and Result get non-destructive pairs: their output is a view of the input, or
+/// for Concat and Result, the inputs are computed straight into the output. The hints assume
+/// dense row-major layouts.
+class ngraph::pass::MemoryOptimization : public FunctionPass
+{
+public:
+    MemoryOptimization()
+        : FunctionPass()
+    {
+    }
+
+    MemoryOptimization(std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> func)
+        : FunctionPass()
+        , m_op_annotations_factory(func)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+private:
+    std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)>
+        m_op_annotations_factory = []() {
+            return std::make_shared<ngraph::op::util::OpAnnotations>();
+        };
+};
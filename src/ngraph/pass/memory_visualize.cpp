@@ -73,14 +73,13 @@ bool pass::MemoryVisualize::run_on_module(vector<shared_ptr<Function>>& function
                 temp_max_size += tensor->size();
             }
 
-            // file << "<table>\n";
-            // file << "<tr><td>Persistent Memory Footprint</td><td align=\"right\">";
-            // file << computation_decl.exop_block.persistent_size() << "</td></tr>\n";
-            // file << "<tr><td>Temporary Memory Footprint</td><td align=\"right\">";
-            // file << computation_decl.exop_block.memory_footprint() << "</td></tr>\n";
-            // file << "<tr><td>Max temporary Memory Footprint</td><td align=\"right\">";
-            // file << temp_max_size << "</td></tr>\n";
-            // file << "</table>\n";
+            // The pool size is set by MemoryLayout, after reuse and in-place placement
+            file << "<table>\n";
+            file << "<tr><td>Temporary Memory Footprint</td><td align=\"right\">";
+            file << f->get_temporary_pool_size() << "</td></tr>\n";
+            file << "<tr><td>Max temporary Memory Footprint</td><td align=\"right\">";
+            file << temp_max_size << "</td></tr>\n";
+            file << "</table>\n";
 
             file << "<hr>\n";
             draw_tensor_weight(file, nodes);
@@ -31,7 +31,7 @@ namespace ngraph
             /// \details  This transformation pass iterates over all nodes in a graph
             /// and updates opset version 0 ops to their opset version 1 equivalents.
             /// All ops in the final graph have opset version 1.
-            Opset1Upgrade() = default;
+            Opset1Upgrade() { set_property(PassProperty::FUNCTION_LOCAL, true); }
             bool run_on_node(std::shared_ptr<ngraph::Node> node) override;
         };
     }
@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/pack_binary_weights.hpp"
+#include "ngraph/op/binary_convolution.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+template <typename T>
+static shared_ptr<op::Constant> pack_constant(const op::Constant& constant)
+{
+    size_t count = shape_size(constant.get_shape());
+    vector<uint8_t> bits((count + 7) / 8);
+    runtime::reference::pack_u1<T>(constant.get_data_ptr<T>(), bits.data(), count);
+    return make_shared<op::Constant>(element::u1, constant.get_shape(), bits.data());
+}
+
+static shared_ptr<op::Constant> pack_constant(const op::Constant& constant)
+{
+    switch (constant.get_element_type())
+    {
+    case element::Type_t::f32: return pack_constant<float>(constant);
+    case element::Type_t::f64: return pack_constant<double>(constant);
+    case element::Type_t::i8: return pack_constant<int8_t>(constant);
+    case element::Type_t::i32: return pack_constant<int32_t>(constant);
+    case element::Type_t::i64: return pack_constant<int64_t>(constant);
+    case element::Type_t::u8: return pack_constant<uint8_t>(constant);
+    default: return nullptr;
+    }
+}
+
+bool pass::PackBinaryWeights::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (!is_type<op::v1::BinaryConvolution>(node))
+        {
+            continue;
+        }
+        auto filter = as_type_ptr<op::Constant>(node->input_value(1).get_node_shared_ptr());
+        if (!filter || filter->get_element_type() == element::u1)
+        {
+            continue;
+        }
+        if (auto packed = pack_constant(*filter))
+        {
+            node->input(1).replace_source_output(packed->output(0));
+            modified = true;
+        }
+    }
+    return modified;
+}
@@ -53,7 +53,10 @@ namespace ngraph
             // Pass requires node shapes to be static
             REQUIRE_STATIC_SHAPE = 0x1,
             // Pass transformation will change the function's dynamic state
-            CHANGE_DYNAMIC_STATE = 1 << 1
+            CHANGE_DYNAMIC_STATE = 1 << 1,
+            // Pass only reads and rewrites nodes connected to the nodes it is run on and keeps
+            // no state between runs, so it may run concurrently on graphs that share no nodes
+            FUNCTION_LOCAL = 1 << 2
         };
         typedef EnumMask<PassProperty> PassPropertyMask;
         constexpr PassPropertyMask all_pass_property_off;
@@ -28,6 +28,34 @@ namespace ngraph
     {
         class Allocator;
         class DefaultAllocator;
+
+        /// \brief Usage counters of an allocator
+        struct AllocatorStats
+        {
+            /// \brief Bytes requested by allocations that are not freed yet
+            size_t bytes_in_use = 0;
+            /// \brief Highest value `bytes_in_use` has reached
+            size_t peak_bytes_in_use = 0;
+            /// \brief Bytes obtained from the system or an upstream allocator, including memory
+            ///        that is cached for reuse
+            size_t bytes_reserved = 0;
+            size_t allocation_count = 0;
+            size_t free_count = 0;
+            /// \brief Allocations served from memory the allocator already held
+            size_t reuse_count = 0;
+            /// \brief Allocations per second since the allocator was created
+            double allocation_rate = 0;
+
+            /// \brief Fraction of the reserved bytes that is not in use, either cached or lost
+            ///        to rounding and splitting
+            double fragmentation() const
+            {
+                return bytes_reserved == 0
+                           ? 0.0
+                           : 1.0 - static_cast<double>(bytes_in_use) / bytes_reserved;
+            }
+        };
+
         /// \brief Create a default allocator that calls into system
         ///        allocation libraries
         ngraph::runtime::Allocator* get_default_allocator();
@@ -48,4 +76,8 @@ public:
     /// \brief deallocates the memory pointed by ptr
     /// \param ptr pointer to the aligned memory to be released
     virtual void free(void* ptr) = 0;
+
+    /// \brief Returns the usage counters of the allocator. Allocators that do not keep
+    ///        counters return all zeros.
+    virtual AllocatorStats get_stats() const { return AllocatorStats(); }
 };
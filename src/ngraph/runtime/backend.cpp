@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 #endif
 
+#include <cstdlib>
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
@@ -104,6 +105,42 @@ std::shared_ptr<runtime::Executable>
     return compile(func, enable_performance_data);
 }
 
+vector<shared_ptr<runtime::Executable>>
+    runtime::Backend::compile_many(const vector<shared_ptr<Function>>& funcs,
+                                   bool enable_performance_data)
+{
+    // NGRAPH_COMPILE_THREADS limits the number of functions compiled at once, 0 (the default)
+    // uses one thread per hardware thread
+    size_t max_threads = 1;
+    if (is_supported_property(Property::concurrent_compile))
+    {
+        const char* env = getenv("NGRAPH_COMPILE_THREADS");
+        max_threads = env ? strtoul(env, nullptr, 10) : 0;
+    }
+    if (max_threads != 1)
+    {
+        // Node and tensor names are assigned on first use. Functions may share nodes, and the
+        // compiles read those names, so assign them all before compiling concurrently.
+        for (const shared_ptr<Function>& func : funcs)
+        {
+            func->map_unordered_ops([](Node* node) {
+                node->get_name();
+                for (size_t i = 0; i < node->get_output_size(); i++)
+                {
+                    node->get_output_tensor(i).get_name();
+                }
+            });
+        }
+    }
+    vector<shared_ptr<Executable>> executables(funcs.size());
+    parallel_for_each_index(funcs.size(),
+                            [&](size_t i) {
+                                executables[i] = compile(funcs[i], enable_performance_data);
+                            },
+                            max_threads);
+    return executables;
+}
+
 bool runtime::Backend::is_supported(const Node& /* node */) const
 {
     // The default behavior is that a backend does not support any ops. If this is not the case
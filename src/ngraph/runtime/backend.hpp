@@ -112,6 +112,16 @@ public:
                                                 ngraph::pass::PassConfig& pass_config,
                                                 bool enable_performance_data = false);
 
+    /// \brief Compiles several Functions. Backends that support Property::concurrent_compile
+    ///        compile them concurrently, others one after another. May be called from several
+    ///        threads at once if `compile` may.
+    /// \param funcs The functions to compile
+    /// \param enable_performance_data Enables performance counters in every executable
+    /// \returns The compiled functions, in the order of `funcs`
+    virtual std::vector<std::shared_ptr<Executable>>
+        compile_many(const std::vector<std::shared_ptr<Function>>& funcs,
+                     bool enable_performance_data = false);
+
     /// \brief Loads a previously saved Executable object from a stream.
     /// \param input_stream the opened input stream containing the saved Executable
     /// \returns A compiled function or throws an exception on error
@@ -125,7 +135,8 @@ public:
     /// \brief A set of properties supported by a backend
     enum class Property
     {
-        memory_attach /// New tensor can use attached memory
+        memory_attach,     /// New tensor can use attached memory
+        concurrent_compile /// compile may be called concurrently from several threads
     };
 
     /// \brief Test if a backend particular property is supported
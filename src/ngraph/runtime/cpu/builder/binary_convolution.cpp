@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/binary_convolution.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/binary_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename T>
+            static CPUKernelFunctor
+                prepare_binary_convolution_functor(const Node* node,
+                                                   const vector<TensorViewWrapper>& args,
+                                                   const vector<TensorViewWrapper>& out,
+                                                   CPU_ExternalFunction* external_function)
+            {
+                auto bin_conv = static_cast<const ngraph::op::v1::BinaryConvolution*>(node);
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto strides = bin_conv->get_strides();
+                auto dilations = bin_conv->get_dilations();
+                auto pads_begin = bin_conv->get_pads_begin();
+                auto pad_value = bin_conv->get_pad_value();
+                // Constant filters are packed to u1 by PackBinaryWeights at compile time; any
+                // other filter is binarized once per call by the kernel.
+                bool filter_packed = args[1].get_element_type() == element::u1;
+
+                return [&,
+                        arg0_buffer_index,
+                        arg1_buffer_index,
+                        out_buffer_index,
+                        arg0_shape,
+                        arg1_shape,
+                        out_shape,
+                        strides,
+                        dilations,
+                        pads_begin,
+                        pad_value,
+                        filter_packed](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel::binary_convolution<T>(ctx->buffer_data[arg0_buffer_index],
+                                                  ctx->buffer_data[arg1_buffer_index],
+                                                  ctx->buffer_data[out_buffer_index],
+                                                  arg0_shape,
+                                                  arg1_shape,
+                                                  out_shape,
+                                                  strides,
+                                                  dilations,
+                                                  pads_begin,
+                                                  pad_value,
+                                                  filter_packed,
+                                                  ectx->arena);
+                };
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::BinaryConvolution)
+            {
+                auto& functors = external_function->get_functors();
+                CPUKernelFunctor functor;
+
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = prepare_binary_convolution_functor<float>(
+                        node, args, out, external_function);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = prepare_binary_convolution_functor<double>(
+                        node, args, out, external_function);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type in CPU Builder for "
+                                       "BinaryConvolution");
+                }
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_binary_convolution_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::BinaryConvolution);
+            }
+        }
+    }
+}
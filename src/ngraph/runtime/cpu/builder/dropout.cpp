@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/op/dropout.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/dropout.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -45,25 +46,12 @@ namespace ngraph
 
                 bool use_seed = drop->get_use_seed();
 
-                // Note: for performance optimization in addition to parallel RNG with multiple,
-                // threads, we create, initialize and advance each msr here in builder instead of
-                // in kernel. By doing so here, we saved 30% vs. kernel
-                // msr.discard() has the biggest impact on performance.
-                // But we need discard only when use_seed==true to generate same mask.
-                size_t nthr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                size_t chunk_size = (element_count + nthr - 1) / nthr;
-                std::vector<std::minstd_rand> vmsr(nthr);
-                if (use_seed)
-                {
-                    uint64_t seed = drop->get_seed();
-                    for (size_t i = 0; i < nthr; i++)
-                    {
-                        std::minstd_rand msr;
-                        msr.seed(seed);
-                        msr.discard(i * chunk_size);
-                        vmsr[i] = msr;
-                    }
-                }
+                // With a seed every call produces the same mask, otherwise each call draws the
+                // next blocks of a randomly keyed Philox stream.
+                auto index = external_function->add_state(
+                    use_seed ? new ngraph::PhiloxRNGState(drop->get_seed())
+                             : new ngraph::PhiloxRNGState());
+                uint64_t blocks = PhiloxRNGState::get_block_count(element_count, 4);
 
                 if (args[0].get_element_type() == element::f32)
                 {
@@ -74,12 +62,14 @@ namespace ngraph
                                arg4_buffer_index,
                                out0_buffer_index,
                                out1_buffer_index,
-                               vmsr,
+                               index,
+                               blocks,
                                use_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
                         bool training = static_cast<bool>(
                             static_cast<float*>(ctx->buffer_data[arg1_buffer_index])[0]);
                         double keep_prob =
                             static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                        auto state = static_cast<PhiloxRNGState*>(ctx->states[index]);
                         runtime::cpu::kernel::generate_dropout(
                             static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                             static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
@@ -87,8 +77,8 @@ namespace ngraph
                             element_count,
                             training,
                             keep_prob,
-                            vmsr,
-                            use_seed);
+                            state->get_key(),
+                            use_seed ? 0 : state->advance(blocks));
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
@@ -100,12 +90,14 @@ namespace ngraph
                                arg4_buffer_index,
                                out0_buffer_index,
                                out1_buffer_index,
-                               vmsr,
+                               index,
+                               blocks,
                                use_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
                         bool training = static_cast<bool>(
                             static_cast<double*>(ctx->buffer_data[arg1_buffer_index])[0]);
                         double keep_prob =
                             static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                        auto state = static_cast<PhiloxRNGState*>(ctx->states[index]);
                         runtime::cpu::kernel::generate_dropout(
                             static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                             static_cast<double*>(ctx->buffer_data[out0_buffer_index]),
@@ -113,8 +105,8 @@ namespace ngraph
                             element_count,
                             training,
                             keep_prob,
-                            vmsr,
-                            use_seed);
+                            state->get_key(),
+                            use_seed ? 0 : state->advance(blocks));
                     };
                 }
                 else
@@ -19,7 +19,7 @@
 
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -61,14 +61,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, float>(
+                            ngraph::runtime::cpu::kernel::embedding<float, float>(
                                 static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i32)
@@ -79,14 +80,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, int>(
+                            ngraph::runtime::cpu::kernel::embedding<float, int>(
                                 static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i64)
@@ -97,14 +99,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, int64_t>(
+                            ngraph::runtime::cpu::kernel::embedding<float, int64_t>(
                                 static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else
@@ -123,14 +126,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, float>(
+                            ngraph::runtime::cpu::kernel::embedding<double, float>(
                                 static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i32)
@@ -141,14 +145,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, int>(
+                            ngraph::runtime::cpu::kernel::embedding<double, int>(
                                 static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i64)
@@ -159,14 +164,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, int64_t>(
+                            ngraph::runtime::cpu::kernel::embedding<double, int64_t>(
                                 static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else
@@ -185,14 +191,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<int, float>(
+                            ngraph::runtime::cpu::kernel::embedding<int, float>(
                                 static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i32)
@@ -203,14 +210,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<int, int>(
+                            ngraph::runtime::cpu::kernel::embedding<int, int>(
                                 static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else if (index_element_type == element::i64)
@@ -221,14 +229,15 @@ namespace ngraph
                                    arg0_buffer_index,
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
+                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<int, int64_t>(
+                            ngraph::runtime::cpu::kernel::embedding<int, int64_t>(
                                 static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
                                 static_cast<int*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                in_shape);
+                                in_shape,
+                                ectx->arena);
                         };
                     }
                     else
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/cpu/kernel/gather_nd.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -47,7 +47,6 @@ namespace ngraph
                 bool is_int64 = args[1].get_element_type() == element::i64;
                 auto params_shape = args[0].get_shape();
                 auto indices_shape = args[1].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
@@ -56,18 +55,17 @@ namespace ngraph
                         functor = [&,
                                    params_shape,
                                    indices_shape,
-                                   out_shape,
                                    params_buffer_index,
                                    indices_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::gather_nd<float, int64_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::gather_nd<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[params_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 params_shape,
                                 indices_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                     else
@@ -75,18 +73,17 @@ namespace ngraph
                         functor = [&,
                                    params_shape,
                                    indices_shape,
-                                   out_shape,
                                    params_buffer_index,
                                    indices_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::gather_nd<float, int32_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::gather_nd<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[params_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 params_shape,
                                 indices_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                 }
@@ -97,18 +94,17 @@ namespace ngraph
                         functor = [&,
                                    params_shape,
                                    indices_shape,
-                                   out_shape,
                                    params_buffer_index,
                                    indices_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::gather_nd<double, int64_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::gather_nd<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[params_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 params_shape,
                                 indices_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                     else
@@ -116,18 +112,17 @@ namespace ngraph
                         functor = [&,
                                    params_shape,
                                    indices_shape,
-                                   out_shape,
                                    params_buffer_index,
                                    indices_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::gather_nd<double, int32_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::gather_nd<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[params_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 params_shape,
                                 indices_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                 }
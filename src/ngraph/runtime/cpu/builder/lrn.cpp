@@ -18,7 +18,7 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/lrn.hpp"
+#include "ngraph/runtime/cpu/kernel/lrn.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -83,53 +83,54 @@ namespace ngraph
                     double bias = lrn->get_bias();
                     double nsize = lrn->get_nsize();
                     Shape arg_shape = args[0].get_shape();
-                    Shape axes_shape = args[1].get_shape();
 
                     auto element_type = lrn->get_element_type();
                     if (element_type == element::f32)
                     {
                         functor = [&,
+                                   axes,
                                    alpha,
                                    beta,
                                    bias,
                                    arg_shape,
-                                   axes_shape,
                                    nsize,
                                    arg_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::lrn<float>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                axes,
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::lrn<float>(
+                                ctx->buffer_data[arg_buffer_index],
+                                ctx->buffer_data[out_buffer_index],
                                 arg_shape,
+                                axes,
                                 alpha,
                                 beta,
                                 bias,
-                                nsize);
+                                nsize,
+                                ectx->arena);
                         };
                     }
                     else if (element_type == element::f64)
                     {
                         functor = [&,
+                                   axes,
                                    alpha,
                                    beta,
                                    bias,
                                    arg_shape,
-                                   axes_shape,
                                    nsize,
                                    arg_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::lrn<double>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                axes,
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::lrn<double>(
+                                ctx->buffer_data[arg_buffer_index],
+                                ctx->buffer_data[out_buffer_index],
                                 arg_shape,
+                                axes,
                                 alpha,
                                 beta,
                                 bias,
-                                nsize);
+                                nsize,
+                                ectx->arena);
                         };
                     }
                     else
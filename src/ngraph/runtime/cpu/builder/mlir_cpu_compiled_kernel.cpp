@@ -21,6 +21,7 @@
 #include "contrib/mlir/runtime/cpu/cpu_runtime.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
 
 using namespace ngraph;
 using namespace ngraph::op;
@@ -71,6 +72,21 @@ namespace ngraph
                     CompiledKernel* compiled_kernel =
                         static_cast<CompiledKernel*>(const_cast<Node*>(node));
 
+                    // The tasks of the parallel stages of the JIT-compiled code run on the thread
+                    // pool of the executing arena.
+                    int arena = ectx->arena;
+                    auto dispatcher = [arena](size_t num_tasks,
+                                              const std::function<void(size_t)>& task) {
+                        // Every task is a chunk of a loop nest, expensive enough to run alone.
+                        Eigen::TensorOpCost cost(0, 0, 1e6);
+                        kernel::parallel_for(arena, num_tasks, cost, [&](size_t begin, size_t end) {
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                task(i);
+                            }
+                        });
+                    };
+
                     auto it = ctx->mlir_runtimes.find(compiled_kernel);
 
                     if (it == ctx->mlir_runtimes.end())
@@ -93,16 +109,19 @@ namespace ngraph
                         mlir_compiler.compile();
                         // Grab a context and initialize a CPU backend using same context
                         MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
+                        mlir_backend.set_num_tasks(kernel::get_num_threads(arena));
                         // Codegen to LLVM dialect
                         mlir_backend.codegen();
                         // Store module into runtime, and invoke.
                         mlir_runtime.set_module(mlir_backend.get_module());
+                        mlir_runtime.set_task_dispatcher(dispatcher);
                         mlir_runtime.run(&ptr_args);
                     }
                     else
                     {
                         // We have found a cached runtime, just invoke.
                         MLIRCPURuntime& mlir_runtime = it->second;
+                        mlir_runtime.set_task_dispatcher(dispatcher);
                         mlir_runtime.run(&ptr_args);
                     }
                 };
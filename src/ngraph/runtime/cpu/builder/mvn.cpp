@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/mvn.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/mvn.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MVN)
+            {
+                auto mvn = static_cast<const ngraph::op::MVN*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                runtime::cpu::kernel::AxisSplit split(args[0].get_shape(),
+                                                      mvn->get_reduction_axes());
+                bool normalize_variance = mvn->get_normalize_variance();
+                double eps = mvn->get_eps();
+
+                std::function<decltype(runtime::cpu::kernel::mvn<float>)> kernel;
+                SELECT_KERNEL(kernel, args[0].get_element_type(), runtime::cpu::kernel::mvn);
+
+                auto functor =
+                    [&, kernel, split, normalize_variance, eps, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               split,
+                               normalize_variance,
+                               eps,
+                               ectx->arena);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_mvn_cpp() { REGISTER_OP_BUILDER(MVN); }
+        }
+    }
+}
@@ -54,8 +54,6 @@ namespace ngraph
                     external_function->get_buffer_index(args[6].get_name()); // output scale
                 auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                auto scales_size = shape_size(args[2].get_shape());
-
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
@@ -122,15 +120,43 @@ namespace ngraph
                             scratchpad_size);
                     };
                     functors.emplace_back(functor);
+                    return;
                 }
-                else if (args[0].get_element_type() == element::u8 &&
-                         args[1].get_element_type() == element::u8 &&
-                         out[0].get_element_type() == element::u8)
+
+                // Without MKLDNN the integer kernels are used; constant filters are packed
+                // for them once, here.
+                shared_ptr<reference::QuantizedPackedWeights> packed;
+                auto filter = as_type_ptr<ngraph::op::Constant>(node->get_argument(1));
+                auto filter_zero_point = as_type_ptr<ngraph::op::Constant>(node->get_argument(5));
+                if (filter && filter_zero_point)
+                {
+                    packed = make_shared<reference::QuantizedPackedWeights>();
+                    if (args[1].get_element_type() == element::u8)
+                    {
+                        reference::pack_quantized_convolution_weights(
+                            filter->get_data_ptr<uint8_t>(),
+                            arg1_shape,
+                            filter_zero_point->get_data_ptr<uint8_t>()[0],
+                            *packed);
+                    }
+                    else
+                    {
+                        reference::pack_quantized_convolution_weights(
+                            filter->get_data_ptr<int8_t>(),
+                            arg1_shape,
+                            filter_zero_point->get_data_ptr<int8_t>()[0],
+                            *packed);
+                    }
+                }
+
+                if (args[0].get_element_type() == element::u8 &&
+                    args[1].get_element_type() == element::u8 &&
+                    out[0].get_element_type() == element::u8)
                 {
                     std::function<decltype(
-                        runtime::cpu::kernel::convolution<uint8_t, uint8_t, uint8_t, int32_t>)>
+                        runtime::cpu::kernel::quantized_convolution<uint8_t, uint8_t>)>
                         kernel;
-                    kernel = runtime::cpu::kernel::convolution<uint8_t, uint8_t, uint8_t, int32_t>;
+                    kernel = runtime::cpu::kernel::quantized_convolution<uint8_t, uint8_t>;
 
                     auto arg3_buffer_index =
                         external_function->get_buffer_index(args[3].get_name()); // input scale
@@ -142,7 +168,6 @@ namespace ngraph
                     auto window_movement_strides = qconvolution->get_window_movement_strides();
                     auto window_dilation_strides = qconvolution->get_window_dilation_strides();
                     auto padding_below = qconvolution->get_padding_below();
-                    auto padding_above = qconvolution->get_padding_above();
                     auto data_dilation_strides = qconvolution->get_data_dilation_strides();
 
                     auto functor = [&,
@@ -162,14 +187,9 @@ namespace ngraph
                                     window_movement_strides,
                                     window_dilation_strides,
                                     padding_below,
-                                    padding_above,
                                     data_dilation_strides,
-                                    scales_size](CPURuntimeContext* ctx,
-                                                 CPUExecutionContext* /* ectx */) {
-                        vector<float> dyn_scales;
-                        dyn_scales.assign(static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
-                                          static_cast<float*>(ctx->buffer_data[arg2_buffer_index]) +
-                                              scales_size);
+                                    packed](CPURuntimeContext* ctx,
+                                            CPUExecutionContext* /* ectx */) {
                         kernel(ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[arg1_buffer_index],
                                ctx->buffer_data[out0_buffer_index],
@@ -179,14 +199,14 @@ namespace ngraph
                                window_movement_strides,
                                window_dilation_strides,
                                padding_below,
-                               padding_above,
                                data_dilation_strides,
                                ctx->buffer_data[arg2_buffer_index],
                                ctx->buffer_data[arg3_buffer_index],
                                ctx->buffer_data[arg4_buffer_index],
                                ctx->buffer_data[arg5_buffer_index],
                                ctx->buffer_data[arg6_buffer_index],
-                               ctx->buffer_data[arg7_buffer_index]);
+                               ctx->buffer_data[arg7_buffer_index],
+                               packed.get());
                     };
                     functors.emplace_back(functor);
                 }
@@ -195,9 +215,9 @@ namespace ngraph
                          out[0].get_element_type() == element::i32)
                 {
                     std::function<decltype(
-                        runtime::cpu::kernel::convolution<uint8_t, uint8_t, int32_t, int32_t>)>
+                        runtime::cpu::kernel::quantized_convolution<uint8_t, int32_t>)>
                         kernel;
-                    kernel = runtime::cpu::kernel::convolution<uint8_t, uint8_t, int32_t, int32_t>;
+                    kernel = runtime::cpu::kernel::quantized_convolution<uint8_t, int32_t>;
 
                     auto arg3_buffer_index =
                         external_function->get_buffer_index(args[3].get_name()); // input scale
@@ -209,7 +229,6 @@ namespace ngraph
                     auto window_movement_strides = qconvolution->get_window_movement_strides();
                     auto window_dilation_strides = qconvolution->get_window_dilation_strides();
                     auto padding_below = qconvolution->get_padding_below();
-                    auto padding_above = qconvolution->get_padding_above();
                     auto data_dilation_strides = qconvolution->get_data_dilation_strides();
 
                     auto functor = [&,
@@ -229,14 +248,9 @@ namespace ngraph
                                     window_movement_strides,
                                     window_dilation_strides,
                                     padding_below,
-                                    padding_above,
                                     data_dilation_strides,
-                                    scales_size](CPURuntimeContext* ctx,
-                                                 CPUExecutionContext* /* ectx */) {
-                        vector<float> dyn_scales;
-                        dyn_scales.assign(static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
-                                          static_cast<float*>(ctx->buffer_data[arg2_buffer_index]) +
-                                              scales_size);
+                                    packed](CPURuntimeContext* ctx,
+                                            CPUExecutionContext* /* ectx */) {
                         kernel(ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[arg1_buffer_index],
                                ctx->buffer_data[out0_buffer_index],
@@ -246,14 +260,14 @@ namespace ngraph
                                window_movement_strides,
                                window_dilation_strides,
                                padding_below,
-                               padding_above,
                                data_dilation_strides,
                                ctx->buffer_data[arg2_buffer_index],
                                ctx->buffer_data[arg3_buffer_index],
                                ctx->buffer_data[arg4_buffer_index],
                                ctx->buffer_data[arg5_buffer_index],
                                ctx->buffer_data[arg6_buffer_index],
-                               ctx->buffer_data[arg7_buffer_index]);
+                               ctx->buffer_data[arg7_buffer_index],
+                               packed.get());
                     };
                     functors.emplace_back(functor);
                 }
@@ -262,9 +276,9 @@ namespace ngraph
                          out[0].get_element_type() == element::i32)
                 {
                     std::function<decltype(
-                        runtime::cpu::kernel::convolution<uint8_t, int8_t, int32_t, int32_t>)>
+                        runtime::cpu::kernel::quantized_convolution<int8_t, int32_t>)>
                         kernel;
-                    kernel = runtime::cpu::kernel::convolution<uint8_t, int8_t, int32_t, int32_t>;
+                    kernel = runtime::cpu::kernel::quantized_convolution<int8_t, int32_t>;
 
                     auto arg3_buffer_index =
                         external_function->get_buffer_index(args[3].get_name()); // input scale
@@ -276,7 +290,6 @@ namespace ngraph
                     auto window_movement_strides = qconvolution->get_window_movement_strides();
                     auto window_dilation_strides = qconvolution->get_window_dilation_strides();
                     auto padding_below = qconvolution->get_padding_below();
-                    auto padding_above = qconvolution->get_padding_above();
                     auto data_dilation_strides = qconvolution->get_data_dilation_strides();
 
                     auto functor = [&,
@@ -296,14 +309,9 @@ namespace ngraph
                                     window_movement_strides,
                                     window_dilation_strides,
                                     padding_below,
-                                    padding_above,
                                     data_dilation_strides,
-                                    scales_size](CPURuntimeContext* ctx,
-                                                 CPUExecutionContext* /* ectx */) {
-                        vector<float> dyn_scales;
-                        dyn_scales.assign(static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
-                                          static_cast<float*>(ctx->buffer_data[arg2_buffer_index]) +
-                                              scales_size);
+                                    packed](CPURuntimeContext* ctx,
+                                            CPUExecutionContext* /* ectx */) {
                         kernel(ctx->buffer_data[arg0_buffer_index],
                                ctx->buffer_data[arg1_buffer_index],
                                ctx->buffer_data[out0_buffer_index],
@@ -313,14 +321,14 @@ namespace ngraph
                                window_movement_strides,
                                window_dilation_strides,
                                padding_below,
-                               padding_above,
                                data_dilation_strides,
                                ctx->buffer_data[arg2_buffer_index],
                                ctx->buffer_data[arg3_buffer_index],
                                ctx->buffer_data[arg4_buffer_index],
                                ctx->buffer_data[arg5_buffer_index],
                                ctx->buffer_data[arg6_buffer_index],
-                               ctx->buffer_data[arg7_buffer_index]);
+                               ctx->buffer_data[arg7_buffer_index],
+                               packed.get());
                     };
                     functors.emplace_back(functor);
                 }
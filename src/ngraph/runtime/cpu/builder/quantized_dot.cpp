@@ -126,12 +126,12 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::QuantizedDot)
             {
-                (void)node;
+                auto qd = static_cast<const ngraph::op::QuantizedDot*>(node);
                 auto& functors = external_function->get_functors();
 
                 auto arg0_shape = args[0].get_shape();
                 auto arg1_shape = args[1].get_shape();
-                auto result_shape = out[0].get_shape();
+                auto reduction_axes_count = qd->get_reduction_axes_count();
 
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
@@ -143,132 +143,96 @@ namespace ngraph
                 auto arg7_buffer_index = external_function->get_buffer_index(args[7].get_name());
                 auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
+                // Constant weights are packed for the integer kernels once, here.
+                shared_ptr<reference::QuantizedPackedWeights> packed;
+                auto weights = as_type_ptr<ngraph::op::Constant>(node->get_argument(1));
+                auto zero_point = as_type_ptr<ngraph::op::Constant>(node->get_argument(5));
+                if (weights && zero_point)
+                {
+                    packed = make_shared<reference::QuantizedPackedWeights>();
+                    if (args[1].get_element_type() == element::u8)
+                    {
+                        reference::pack_quantized_dot_weights(
+                            weights->get_data_ptr<uint8_t>(),
+                            arg1_shape,
+                            reduction_axes_count,
+                            zero_point->get_data_ptr<uint8_t>()[0],
+                            *packed);
+                    }
+                    else
+                    {
+                        reference::pack_quantized_dot_weights(
+                            weights->get_data_ptr<int8_t>(),
+                            arg1_shape,
+                            reduction_axes_count,
+                            zero_point->get_data_ptr<int8_t>()[0],
+                            *packed);
+                    }
+                }
+
+                std::function<decltype(runtime::cpu::kernel::quantized_dot<uint8_t, uint8_t>)>
+                    kernel;
                 if (args[0].get_element_type() == element::u8 &&
                     args[1].get_element_type() == element::u8 &&
                     out[0].get_element_type() == element::u8)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::dot_ref<uint8_t, uint8_t, uint8_t, int32_t>)>
-                        kernel;
-
-                    kernel = runtime::cpu::kernel::dot_ref<uint8_t, uint8_t, uint8_t, int32_t>;
-
-                    auto functor = [&,
-                                    kernel,
-                                    arg0_shape,
-                                    arg1_shape,
-                                    result_shape,
-                                    arg0_buffer_index,
-                                    arg1_buffer_index,
-                                    arg2_buffer_index,
-                                    arg3_buffer_index,
-                                    arg4_buffer_index,
-                                    arg5_buffer_index,
-                                    arg6_buffer_index,
-                                    arg7_buffer_index,
-                                    out0_buffer_index](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* /* ectx */) {
-
-                        kernel(ctx->buffer_data[arg0_buffer_index],
-                               ctx->buffer_data[arg1_buffer_index],
-                               ctx->buffer_data[out0_buffer_index],
-                               arg0_shape,
-                               arg1_shape,
-                               result_shape,
-                               1,
-                               ctx->buffer_data[arg2_buffer_index],
-                               ctx->buffer_data[arg3_buffer_index],
-                               ctx->buffer_data[arg4_buffer_index],
-                               ctx->buffer_data[arg5_buffer_index],
-                               ctx->buffer_data[arg6_buffer_index],
-                               ctx->buffer_data[arg7_buffer_index]);
-                    };
-                    functors.emplace_back(functor);
+                    kernel = runtime::cpu::kernel::quantized_dot<uint8_t, uint8_t>;
                 }
                 else if (args[0].get_element_type() == element::u8 &&
                          args[1].get_element_type() == element::i8 &&
                          out[0].get_element_type() == element::i8)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::dot_ref<uint8_t, int8_t, int8_t, int32_t>)>
-                        kernel;
-
-                    kernel = runtime::cpu::kernel::dot_ref<uint8_t, int8_t, int8_t, int32_t>;
-
-                    auto functor = [&,
-                                    kernel,
-                                    arg0_shape,
-                                    arg1_shape,
-                                    result_shape,
-                                    arg0_buffer_index,
-                                    arg1_buffer_index,
-                                    arg2_buffer_index,
-                                    arg3_buffer_index,
-                                    arg4_buffer_index,
-                                    arg5_buffer_index,
-                                    arg6_buffer_index,
-                                    arg7_buffer_index,
-                                    out0_buffer_index](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* /* ectx */) {
-
-                        kernel(ctx->buffer_data[arg0_buffer_index],
-                               ctx->buffer_data[arg1_buffer_index],
-                               ctx->buffer_data[out0_buffer_index],
-                               arg0_shape,
-                               arg1_shape,
-                               result_shape,
-                               1,
-                               ctx->buffer_data[arg2_buffer_index],
-                               ctx->buffer_data[arg3_buffer_index],
-                               ctx->buffer_data[arg4_buffer_index],
-                               ctx->buffer_data[arg5_buffer_index],
-                               ctx->buffer_data[arg6_buffer_index],
-                               ctx->buffer_data[arg7_buffer_index]);
-                    };
-                    functors.emplace_back(functor);
+                    kernel = runtime::cpu::kernel::quantized_dot<int8_t, int8_t>;
                 }
                 else if (args[0].get_element_type() == element::u8 &&
                          args[1].get_element_type() == element::u8 &&
                          out[0].get_element_type() == element::i32)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::dot_ref<uint8_t, uint8_t, int32_t, int32_t>)>
-                        kernel;
-
-                    kernel = runtime::cpu::kernel::dot_ref<uint8_t, uint8_t, int32_t, int32_t>;
-
-                    auto functor = [&,
-                                    kernel,
-                                    arg0_shape,
-                                    arg1_shape,
-                                    result_shape,
-                                    arg0_buffer_index,
-                                    arg1_buffer_index,
-                                    arg2_buffer_index,
-                                    arg3_buffer_index,
-                                    arg4_buffer_index,
-                                    arg5_buffer_index,
-                                    arg6_buffer_index,
-                                    arg7_buffer_index,
-                                    out0_buffer_index](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* /* ectx */) {
-
-                        kernel(ctx->buffer_data[arg0_buffer_index],
-                               ctx->buffer_data[arg1_buffer_index],
-                               ctx->buffer_data[out0_buffer_index],
-                               arg0_shape,
-                               arg1_shape,
-                               result_shape,
-                               1,
-                               ctx->buffer_data[arg2_buffer_index],
-                               ctx->buffer_data[arg3_buffer_index],
-                               ctx->buffer_data[arg4_buffer_index],
-                               ctx->buffer_data[arg5_buffer_index],
-                               ctx->buffer_data[arg6_buffer_index],
-                               ctx->buffer_data[arg7_buffer_index]);
-                    };
-                    functors.emplace_back(functor);
+                    kernel = runtime::cpu::kernel::quantized_dot<uint8_t, int32_t>;
+                }
+                else if (args[0].get_element_type() == element::u8 &&
+                         args[1].get_element_type() == element::i8 &&
+                         out[0].get_element_type() == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::quantized_dot<int8_t, int32_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported data types for QuantizedDot");
                 }
+
+                auto functor = [&,
+                                kernel,
+                                packed,
+                                arg0_shape,
+                                arg1_shape,
+                                reduction_axes_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                arg3_buffer_index,
+                                arg4_buffer_index,
+                                arg5_buffer_index,
+                                arg6_buffer_index,
+                                arg7_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx,
+                                                   CPUExecutionContext* /* ectx */) {
+
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out0_buffer_index],
+                           arg0_shape,
+                           arg1_shape,
+                           reduction_axes_count,
+                           ctx->buffer_data[arg2_buffer_index],
+                           ctx->buffer_data[arg3_buffer_index],
+                           ctx->buffer_data[arg4_buffer_index],
+                           ctx->buffer_data[arg5_buffer_index],
+                           ctx->buffer_data[arg6_buffer_index],
+                           ctx->buffer_data[arg7_buffer_index],
+                           packed.get());
+                };
+                functors.emplace_back(functor);
             }
 
             void register_builders_quantized_dot_cpp()
@@ -16,8 +16,8 @@
 
 #include "ngraph/op/experimental/random_uniform.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/random_uniform.hpp"
-#include "ngraph/state/uniform_rng_state.hpp"
+#include "ngraph/runtime/cpu/kernel/random.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -47,7 +47,7 @@ namespace ngraph
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 size_t element_count = out[0].get_size();
 
-                auto index = external_function->add_state(new ngraph::UniformRNGState());
+                auto index = external_function->add_state(new ngraph::PhiloxRNGState());
                 auto fixed_seed = ru->get_fixed_seed();
 
                 functor = [&,
@@ -67,21 +67,24 @@ namespace ngraph
 
                     if (!use_fixed_seed)
                     {
-                        reference::random_uniform<T>(
+                        auto state = static_cast<PhiloxRNGState*>(ctx->states[index]);
+                        kernel::random_uniform<T>(
                             static_cast<T*>(ctx->buffer_data[out_buffer_index]),
                             min_val,
                             max_val,
                             element_count,
-                            static_cast<UniformRNGState*>(ctx->states[index]));
+                            state->get_key(),
+                            state->advance(PhiloxRNGState::get_block_count(element_count, 2)));
                     }
                     else
                     {
-                        reference::random_uniform_with_fixed_seed<T>(
+                        kernel::random_uniform<T>(
                             static_cast<T*>(ctx->buffer_data[out_buffer_index]),
                             min_val,
                             max_val,
                             element_count,
-                            fixed_seed);
+                            fixed_seed,
+                            0);
                     }
                 };
                 return functor;
@@ -16,6 +16,7 @@
 
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/gru.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -31,14 +32,88 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Rnn)
             {
+                auto& functors = external_function->get_functors();
+
                 if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
-                    throw ngraph_error(
-                        "Rnn is supported only through MKLDNN and doesnt have reference "
-                        "INTERPRETER implementation");
-                }
+                    auto rnn_node = static_cast<const ngraph::op::Rnn*>(node);
+                    if (rnn_node->get_rnn_type() != rnn_utils::rnntype::vanilla_gru)
+                    {
+                        throw ngraph_error(
+                            "Rnn is supported only through MKLDNN and doesnt have reference "
+                            "INTERPRETER implementation");
+                    }
 
-                auto& functors = external_function->get_functors();
+#if MKLDNN_VERSION_MAJOR < 1
+                    const size_t weights_arg = 2;
+#else
+                    const size_t weights_arg = 3;
+#endif
+                    auto src_layer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto src_iter_index = external_function->get_buffer_index(args[1].get_name());
+                    auto weights_layer_index =
+                        external_function->get_buffer_index(args[weights_arg].get_name());
+                    auto weights_iter_index =
+                        external_function->get_buffer_index(args[weights_arg + 1].get_name());
+                    auto bias_index =
+                        external_function->get_buffer_index(args[weights_arg + 2].get_name());
+                    auto dst_layer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto dst_iter_index = external_function->get_buffer_index(out[1].get_name());
+
+                    auto seq_length = rnn_node->get_src_sequence_length();
+                    auto batch = rnn_node->get_batch_size();
+                    auto src_feature_size = rnn_node->get_src_layer_feature_size();
+                    auto hidden_size = rnn_node->get_src_iter_feature_size();
+                    auto direction = rnn_node->get_direction();
+                    auto layers = rnn_node->get_num_fused_layers();
+#if MKLDNN_VERSION_MAJOR >= 1
+                    // GRU has no cell state, dst_iter_c mirrors dst_iter
+                    auto dst_iter_c_index = external_function->get_buffer_index(out[2].get_name());
+                    auto dst_iter_size = out[1].get_size() * out[1].get_element_type().size();
+#endif
+
+                    auto functor = [&,
+                                    src_layer_index,
+                                    src_iter_index,
+                                    weights_layer_index,
+                                    weights_iter_index,
+                                    bias_index,
+                                    dst_layer_index,
+                                    dst_iter_index,
+#if MKLDNN_VERSION_MAJOR >= 1
+                                    dst_iter_c_index,
+                                    dst_iter_size,
+#endif
+                                    seq_length,
+                                    batch,
+                                    src_feature_size,
+                                    hidden_size,
+                                    direction,
+                                    layers](CPURuntimeContext* ctx,
+                                            CPUExecutionContext* /* ectx */) {
+                        runtime::cpu::kernel::gru_forward(
+                            static_cast<float*>(ctx->buffer_data[src_layer_index]),
+                            static_cast<float*>(ctx->buffer_data[src_iter_index]),
+                            static_cast<float*>(ctx->buffer_data[weights_layer_index]),
+                            static_cast<float*>(ctx->buffer_data[weights_iter_index]),
+                            static_cast<float*>(ctx->buffer_data[bias_index]),
+                            static_cast<float*>(ctx->buffer_data[dst_layer_index]),
+                            static_cast<float*>(ctx->buffer_data[dst_iter_index]),
+                            seq_length,
+                            batch,
+                            src_feature_size,
+                            hidden_size,
+                            direction,
+                            layers);
+#if MKLDNN_VERSION_MAJOR >= 1
+                        memcpy(ctx->buffer_data[dst_iter_c_index],
+                               ctx->buffer_data[dst_iter_index],
+                               dst_iter_size);
+#endif
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
 
                 auto src_layer_buffer_index =
                     external_function->get_buffer_index(args[0].get_name());
@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/scaled_dot_product_attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                auto attention = static_cast<const ngraph::op::ScaledDotProductAttention*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                const Shape& query_shape = args[0].get_shape();
+                const Shape& key_shape = args[1].get_shape();
+                const Shape& value_shape = args[2].get_shape();
+                size_t batch = query_shape[0];
+                size_t query_length = query_shape[1];
+                size_t depth = query_shape[2];
+                size_t key_length = key_shape[1];
+                size_t value_depth = value_shape[2];
+                double scale = attention->get_scale();
+
+                bool has_mask = attention->get_has_mask();
+                size_t mask_batch = has_mask ? args[3].get_shape()[0] : 0;
+                size_t mask_rows = has_mask ? args[3].get_shape()[1] : 0;
+
+                auto query_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto key_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto value_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto mask_buffer_index =
+                    has_mask ? external_function->get_buffer_index(args[3].get_name()) : 0;
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                std::function<decltype(runtime::cpu::kernel::scaled_dot_product_attention<float>)>
+                    kernel;
+                SELECT_KERNEL(kernel,
+                              args[0].get_element_type(),
+                              runtime::cpu::kernel::scaled_dot_product_attention);
+
+                auto functor = [&,
+                                kernel,
+                                batch,
+                                query_length,
+                                key_length,
+                                depth,
+                                value_depth,
+                                mask_batch,
+                                mask_rows,
+                                scale,
+                                has_mask,
+                                query_buffer_index,
+                                key_buffer_index,
+                                value_buffer_index,
+                                mask_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[query_buffer_index],
+                           ctx->buffer_data[key_buffer_index],
+                           ctx->buffer_data[value_buffer_index],
+                           has_mask ? ctx->buffer_data[mask_buffer_index] : nullptr,
+                           ctx->buffer_data[out_buffer_index],
+                           batch,
+                           query_length,
+                           key_length,
+                           depth,
+                           value_depth,
+                           mask_batch,
+                           mask_rows,
+                           scale,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_scaled_dot_product_attention_cpp()
+            {
+                REGISTER_OP_BUILDER(ScaledDotProductAttention);
+            }
+        }
+    }
+}
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/scatter_nd_add.hpp"
+#include "ngraph/runtime/cpu/kernel/scatter_nd_add.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -48,8 +48,6 @@ namespace ngraph
                 bool is_int64 = args[1].get_element_type() == element::i64;
                 auto inputs_shape = args[0].get_shape();
                 auto indices_shape = args[1].get_shape();
-                auto updates_shape = args[2].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
@@ -58,22 +56,19 @@ namespace ngraph
                         functor = [&,
                                    inputs_shape,
                                    indices_shape,
-                                   updates_shape,
-                                   out_shape,
                                    inputs_buffer_index,
                                    indices_buffer_index,
                                    updates_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<float, int64_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::scatter_nd_add<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[inputs_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[updates_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 inputs_shape,
                                 indices_shape,
-                                updates_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                     else
@@ -81,22 +76,19 @@ namespace ngraph
                         functor = [&,
                                    inputs_shape,
                                    indices_shape,
-                                   updates_shape,
-                                   out_shape,
                                    inputs_buffer_index,
                                    indices_buffer_index,
                                    updates_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<float, int32_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::scatter_nd_add<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[inputs_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[updates_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 inputs_shape,
                                 indices_shape,
-                                updates_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                 }
@@ -107,22 +99,19 @@ namespace ngraph
                         functor = [&,
                                    inputs_shape,
                                    indices_shape,
-                                   updates_shape,
-                                   out_shape,
                                    inputs_buffer_index,
                                    indices_buffer_index,
                                    updates_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<double, int64_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::scatter_nd_add<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[inputs_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[updates_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 inputs_shape,
                                 indices_shape,
-                                updates_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                     else
@@ -130,22 +119,19 @@ namespace ngraph
                         functor = [&,
                                    inputs_shape,
                                    indices_shape,
-                                   updates_shape,
-                                   out_shape,
                                    inputs_buffer_index,
                                    indices_buffer_index,
                                    updates_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::scatter_nd_add<double, int32_t>(
+                                                     CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::scatter_nd_add<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[inputs_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[updates_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 inputs_shape,
                                 indices_shape,
-                                updates_shape,
-                                out_shape);
+                                ectx->arena);
                         };
                     }
                 }
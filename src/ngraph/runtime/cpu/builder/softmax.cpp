@@ -14,12 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/op/fused/log_softmax.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/validation_util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -85,74 +86,33 @@ namespace ngraph
                     functors.emplace_back(functor);
                     return;
                 }
-                else if (is_optimized_et(args[0].get_element_type()))
+
+                // Groups of adjacent elements, the common case of normalizing over the innermost
+                // axes, take the streaming kernel; the Eigen kernels handle strided groups.
+                runtime::cpu::kernel::AxisSplit split(arg_shape, axes);
+                if (!split.contiguous && is_optimized_et(args[0].get_element_type()))
                 {
-                    if (axes.size() == arg_shape.size())
+                    if (axes.size() == 1)
                     {
-                        std::function<decltype(runtime::cpu::kernel::softmax_all<float, 1>)> kernel;
+                        std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)> kernel;
 
                         SELECT_ETS_AND_RANK7(kernel,
                                              args[0].get_element_type(),
                                              args[0].get_shape().size(),
-                                             runtime::cpu::kernel::softmax_all);
-
-                        auto functor = [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   arg_shape,
-                                   ectx->arena);
-                        };
+                                             runtime::cpu::kernel::softmax_1rd);
+
+                        auto functor =
+                            [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
+                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
+                                       arg_shape,
+                                       axes,
+                                       ectx->arena);
+                            };
                         functors.emplace_back(functor);
                         return;
                     }
-                    else if (axes.size() == 1)
-                    {
-                        if (*axes.begin() == (arg_shape.size() - 1))
-                        {
-                            std::function<decltype(
-                                runtime::cpu::kernel::softmax_innermost_1rd<float, 1>)>
-                                kernel;
-
-                            SELECT_ETS_AND_RANK7(kernel,
-                                                 args[0].get_element_type(),
-                                                 args[0].get_shape().size(),
-                                                 runtime::cpu::kernel::softmax_innermost_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                            return;
-                        }
-                        else
-                        {
-                            std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)>
-                                kernel;
-
-                            SELECT_ETS_AND_RANK7(kernel,
-                                                 args[0].get_element_type(),
-                                                 args[0].get_shape().size(),
-                                                 runtime::cpu::kernel::softmax_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           axes,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                            return;
-                        }
-                    }
                     else if (arg_shape.size() == 3 && axes.size() == 2)
                     {
                         std::function<decltype(runtime::cpu::kernel::softmax_3d_2rd<float>)> kernel;
@@ -194,22 +154,56 @@ namespace ngraph
                         return;
                     }
                 }
-                NGRAPH_WARN << "Falling back to refernce kernel for softmax " << arg_shape
-                            << " over " << axes;
-                std::function<decltype(runtime::cpu::kernel::ref_softmax<float>)> kernel;
+                std::function<decltype(runtime::cpu::kernel::softmax_generic<float>)> kernel;
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::softmax_generic);
+                auto functor = [&, kernel, split, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           split,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LogSoftmax)
+            {
+                auto log_softmax = static_cast<const ngraph::op::LogSoftmax*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                auto arg_shape = args[0].get_shape();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t axis = normalize_axis(node, log_softmax->get_axis(), arg_shape.size());
+                AxisSet axes;
+                for (size_t i = axis; i < arg_shape.size(); i++)
+                {
+                    axes.insert(i);
+                }
+
+                std::function<decltype(runtime::cpu::kernel::log_softmax<float>)> kernel;
                 SELECT_KERNEL(
-                    kernel, args[0].get_element_type(), runtime::cpu::kernel::ref_softmax);
-                auto functor = [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                    CPURuntimeContext* ctx, CPUExecutionContext* /*ectx*/) {
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::log_softmax);
+                runtime::cpu::kernel::AxisSplit split(arg_shape, axes);
+                auto functor = [&, kernel, split, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                     kernel(ctx->buffer_data[arg_buffer_index],
                            ctx->buffer_data[out_buffer_index],
-                           arg_shape,
-                           axes);
+                           split,
+                           ectx->arena);
                 };
                 functors.emplace_back(functor);
             }
 
-            void register_builders_softmax_cpp() { REGISTER_OP_BUILDER(Softmax); }
+            void register_builders_softmax_cpp()
+            {
+                REGISTER_OP_BUILDER(Softmax);
+                REGISTER_OP_BUILDER(LogSoftmax);
+            }
         }
     }
 }
@@ -16,8 +16,8 @@
 
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/generate_mask.hpp"
-#include "ngraph/state/bernoulli_rng_state.hpp"
+#include "ngraph/runtime/cpu/kernel/random.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -49,8 +49,8 @@ namespace ngraph
                     external_function->get_buffer_index(args[4].get_name()); // prob
 
                 auto seed_attr = gm->get_use_seed() ? gm->get_seed() : 0;
-                auto index = external_function->add_state(
-                    new ngraph::BernoulliRNGState(seed_attr, gm->get_probability()));
+                auto index = external_function->add_state(new ngraph::PhiloxRNGState(seed_attr));
+                double probability = gm->get_probability();
 
                 if (args[0].get_element_type() == element::f32)
                 {
@@ -61,8 +61,9 @@ namespace ngraph
                                out_buffer_index,
                                arg2_buffer_index,
                                arg3_buffer_index,
-                               arg4_buffer_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* /* ectx */) {
+                               arg4_buffer_index,
+                               probability](CPURuntimeContext* ctx,
+                                            CPUExecutionContext* /* ectx */) {
                         bool training = static_cast<bool>(
                             static_cast<float*>(ctx->buffer_data[arg_buffer_index])[0]);
                         // TODO: get shape when required
@@ -74,20 +75,24 @@ namespace ngraph
 
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
+                            auto state = static_cast<PhiloxRNGState*>(ctx->states[index]);
+                            runtime::cpu::kernel::generate_mask(
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                static_cast<BernoulliRNGState*>(ctx->states[index]),
-                                training);
+                                training,
+                                probability,
+                                state->get_key(),
+                                state->advance(PhiloxRNGState::get_block_count(element_count, 4)));
                         }
                         else
                         {
-                            reference::generate_mask_no_state(
+                            runtime::cpu::kernel::generate_mask(
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 training,
+                                prob,
                                 seed,
-                                prob);
+                                0);
                         }
                     };
                 }
@@ -100,8 +105,9 @@ namespace ngraph
                                out_buffer_index,
                                arg2_buffer_index,
                                arg3_buffer_index,
-                               arg4_buffer_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* /* ectx */) {
+                               arg4_buffer_index,
+                               probability](CPURuntimeContext* ctx,
+                                            CPUExecutionContext* /* ectx */) {
                         bool training = static_cast<bool>(
                             static_cast<double*>(ctx->buffer_data[arg_buffer_index])[0]);
                         // TODO: get shape when required
@@ -113,20 +119,24 @@ namespace ngraph
 
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
+                            auto state = static_cast<PhiloxRNGState*>(ctx->states[index]);
+                            runtime::cpu::kernel::generate_mask(
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
-                                static_cast<BernoulliRNGState*>(ctx->states[index]),
-                                training);
+                                training,
+                                probability,
+                                state->get_key(),
+                                state->advance(PhiloxRNGState::get_block_count(element_count, 4)));
                         }
                         else
                         {
-                            reference::generate_mask_no_state(
+                            runtime::cpu::kernel::generate_mask(
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 training,
+                                prob,
                                 seed,
-                                prob);
+                                0);
                         }
                     };
                 }
@@ -0,0 +1,370 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <array>
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/reference/tensor_iterator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::TensorIterator)
+            {
+                using SliceInput = ngraph::op::TensorIterator::SliceInputDescription;
+                using MergedInput = ngraph::op::TensorIterator::MergedInputDescription;
+                using ConcatOutput = ngraph::op::TensorIterator::ConcatOutputDescription;
+                using BodyOutput = ngraph::op::TensorIterator::BodyOutputDescription;
+
+                auto& functors = external_function->get_functors();
+                auto ti = static_cast<const ngraph::op::TensorIterator*>(node);
+
+                // The body is compiled once into a call frame of its own that every iteration
+                // reuses. It is compiled from a copy, since the CPU passes rewrite the graph.
+                auto body = ti->get_body();
+                auto body_function =
+                    clone_function(Function(body->get_results(), body->get_parameters()));
+                auto body_external_function = make_shared<CPU_ExternalFunction>(body_function);
+                ngraph::pass::PassConfig pass_config;
+                auto body_call_frame = body_external_function->make_call_frame(
+                    pass_config, runtime::get_default_allocator());
+
+                struct TensorSpec
+                {
+                    element::Type element_type;
+                    Shape shape;
+                };
+                vector<TensorSpec> parameters;
+                for (auto& parameter : body->get_parameters())
+                {
+                    parameters.push_back(
+                        TensorSpec{parameter->get_element_type(), parameter->get_shape()});
+                }
+                vector<TensorSpec> results;
+                for (auto& result : body->get_results())
+                {
+                    results.push_back(TensorSpec{result->get_element_type(), result->get_shape()});
+                }
+
+                int64_t num_iterations = -1;
+                for (auto& description : ti->get_input_descriptions())
+                {
+                    if (auto slice = as_type_ptr<SliceInput>(description))
+                    {
+                        size_t dim_size = args[slice->m_input_index].get_shape().at(slice->m_axis);
+                        int64_t count = reference::iteration_count(
+                            slice->m_start, slice->m_end, slice->m_part_size, dim_size);
+                        NGRAPH_CHECK(
+                            num_iterations == -1 || num_iterations == count,
+                            "TensorIterator sliced inputs disagree on the number of iterations");
+                        num_iterations = count;
+                    }
+                }
+                if (num_iterations == -1)
+                {
+                    num_iterations = ti->get_num_iterations();
+                }
+                NGRAPH_CHECK(num_iterations > 0, "TensorIterator requires at least one iteration");
+
+                struct SlicedInput
+                {
+                    size_t buffer_index;
+                    size_t parameter_index;
+                    reference::AxisExtent extent;
+                    int64_t start;
+                    int64_t stride;
+                    int64_t part_size;
+                };
+                struct BackEdge
+                {
+                    size_t buffer_index;
+                    size_t parameter_index;
+                    size_t result_index;
+                    size_t size;
+                };
+                struct InvariantInput
+                {
+                    size_t buffer_index;
+                    size_t parameter_index;
+                };
+                vector<SlicedInput> sliced_inputs;
+                vector<BackEdge> back_edges;
+                vector<InvariantInput> invariant_inputs;
+                vector<bool> result_assigned(results.size(), false);
+
+                for (auto& description : ti->get_input_descriptions())
+                {
+                    const TensorViewWrapper& arg = args[description->m_input_index];
+                    size_t buffer_index = external_function->get_buffer_index(arg.get_name());
+                    size_t parameter_index = description->m_body_parameter_index;
+                    if (auto slice = as_type_ptr<SliceInput>(description))
+                    {
+                        reference::AxisExtent extent(
+                            arg.get_shape(), slice->m_axis, arg.get_element_type().size());
+                        sliced_inputs.push_back(SlicedInput{buffer_index,
+                                                            parameter_index,
+                                                            extent,
+                                                            slice->m_start,
+                                                            slice->m_stride,
+                                                            slice->m_part_size});
+                    }
+                    else if (auto merged = as_type_ptr<MergedInput>(description))
+                    {
+                        back_edges.push_back(BackEdge{buffer_index,
+                                                      parameter_index,
+                                                      merged->m_body_value_index,
+                                                      arg.get_size() *
+                                                          arg.get_element_type().size()});
+                        result_assigned.at(merged->m_body_value_index) = true;
+                    }
+                    else
+                    {
+                        invariant_inputs.push_back(InvariantInput{buffer_index, parameter_index});
+                    }
+                }
+
+                struct ConcatenatedOutput
+                {
+                    size_t buffer_index;
+                    size_t result_index;
+                    reference::AxisExtent extent;
+                    int64_t start;
+                    int64_t stride;
+                    int64_t part_size;
+                    bool in_place;
+                };
+                struct IterationOutput
+                {
+                    size_t buffer_index;
+                    size_t result_index;
+                    size_t iteration;
+                    size_t size;
+                };
+                vector<ConcatenatedOutput> concat_outputs;
+                vector<IterationOutput> iteration_outputs;
+                for (auto& description : ti->get_output_descriptions())
+                {
+                    const TensorViewWrapper& output = out[description->m_output_index];
+                    size_t buffer_index = external_function->get_buffer_index(output.get_name());
+                    if (auto concat = as_type_ptr<ConcatOutput>(description))
+                    {
+                        reference::AxisExtent extent(
+                            output.get_shape(), concat->m_axis, output.get_element_type().size());
+                        // Contiguous slices are written by the body directly into the output
+                        size_t result_index = concat->m_body_value_index;
+                        bool in_place = extent.is_contiguous() && !result_assigned.at(result_index);
+                        if (in_place)
+                        {
+                            result_assigned.at(result_index) = true;
+                        }
+                        concat_outputs.push_back(ConcatenatedOutput{buffer_index,
+                                                                    result_index,
+                                                                    extent,
+                                                                    concat->m_start,
+                                                                    concat->m_stride,
+                                                                    concat->m_part_size,
+                                                                    in_place});
+                    }
+                    else if (auto body_output = as_type_ptr<BodyOutput>(description))
+                    {
+                        int64_t iteration = body_output->m_iteration < 0
+                                                ? num_iterations + body_output->m_iteration
+                                                : body_output->m_iteration;
+                        iteration_outputs.push_back(
+                            IterationOutput{buffer_index,
+                                            body_output->m_body_value_index,
+                                            static_cast<size_t>(iteration),
+                                            output.get_size() * output.get_element_type().size()});
+                    }
+                }
+
+                auto functor = [&,
+                                body_call_frame,
+                                parameters,
+                                results,
+                                num_iterations,
+                                sliced_inputs,
+                                back_edges,
+                                invariant_inputs,
+                                result_assigned,
+                                concat_outputs,
+                                iteration_outputs](CPURuntimeContext* ctx,
+                                                   CPUExecutionContext* /* ectx */) {
+                    // Views of the buffers of this call; the body reads and writes them in place
+                    auto view = [](const TensorSpec& spec, void* data) {
+                        return make_shared<CPUTensorView>(spec.element_type, spec.shape, data);
+                    };
+
+                    vector<shared_ptr<runtime::Tensor>> body_inputs(parameters.size());
+                    vector<shared_ptr<runtime::Tensor>> body_outputs(results.size());
+
+                    for (auto& input : invariant_inputs)
+                    {
+                        body_inputs[input.parameter_index] =
+                            view(parameters[input.parameter_index],
+                                 ctx->buffer_data[input.buffer_index]);
+                    }
+
+                    // Non-contiguous slices are gathered into one buffer per input
+                    vector<shared_ptr<CPUTensorView>> slice_buffers;
+                    for (auto& input : sliced_inputs)
+                    {
+                        const TensorSpec& spec = parameters[input.parameter_index];
+                        slice_buffers.push_back(input.extent.is_contiguous()
+                                                    ? nullptr
+                                                    : make_shared<CPUTensorView>(
+                                                          spec.element_type, spec.shape));
+                    }
+
+                    // Double-buffered: iteration i reads buffers[i % 2] and its body writes the
+                    // successive value into buffers[(i + 1) % 2]
+                    vector<array<shared_ptr<CPUTensorView>, 2>> edge_buffers;
+                    for (auto& edge : back_edges)
+                    {
+                        const TensorSpec& spec = parameters[edge.parameter_index];
+                        array<shared_ptr<CPUTensorView>, 2> buffers;
+                        for (auto& buffer : buffers)
+                        {
+                            buffer = make_shared<CPUTensorView>(spec.element_type, spec.shape);
+                        }
+                        memcpy(buffers[0]->get_data_ptr(),
+                               ctx->buffer_data[edge.buffer_index],
+                               edge.size);
+                        edge_buffers.push_back(buffers);
+                    }
+
+                    for (size_t i = 0; i < results.size(); i++)
+                    {
+                        if (!result_assigned[i])
+                        {
+                            body_outputs[i] = make_shared<CPUTensorView>(results[i].element_type,
+                                                                         results[i].shape);
+                        }
+                    }
+
+                    for (size_t iteration = 0; iteration < static_cast<size_t>(num_iterations);
+                         iteration++)
+                    {
+                        for (size_t i = 0; i < sliced_inputs.size(); i++)
+                        {
+                            const SlicedInput& input = sliced_inputs[i];
+                            char* arg = static_cast<char*>(ctx->buffer_data[input.buffer_index]);
+                            size_t offset = reference::slice_offset(input.start,
+                                                                    input.stride,
+                                                                    input.part_size,
+                                                                    input.extent.axis_size,
+                                                                    iteration);
+                            if (slice_buffers[i])
+                            {
+                                reference::gather_slice(slice_buffers[i]->get_data_ptr(),
+                                                        arg,
+                                                        input.extent,
+                                                        offset,
+                                                        input.part_size);
+                                body_inputs[input.parameter_index] = slice_buffers[i];
+                            }
+                            else
+                            {
+                                body_inputs[input.parameter_index] =
+                                    view(parameters[input.parameter_index],
+                                         arg + offset * input.extent.inner_bytes);
+                            }
+                        }
+                        for (size_t i = 0; i < back_edges.size(); i++)
+                        {
+                            body_inputs[back_edges[i].parameter_index] =
+                                edge_buffers[i][iteration % 2];
+                            body_outputs[back_edges[i].result_index] =
+                                edge_buffers[i][(iteration + 1) % 2];
+                        }
+                        for (auto& output : concat_outputs)
+                        {
+                            if (output.in_place)
+                            {
+                                size_t offset = reference::slice_offset(output.start,
+                                                                        output.stride,
+                                                                        output.part_size,
+                                                                        output.extent.axis_size,
+                                                                        iteration);
+                                body_outputs[output.result_index] =
+                                    view(results[output.result_index],
+                                         static_cast<char*>(ctx->buffer_data[output.buffer_index]) +
+                                             offset * output.extent.inner_bytes);
+                            }
+                        }
+                        // Every input holds new data in each iteration
+                        for (auto& input : body_inputs)
+                        {
+                            input->set_stale(true);
+                        }
+
+                        body_call_frame->call(body_outputs, body_inputs);
+
+                        for (auto& output : concat_outputs)
+                        {
+                            if (!output.in_place)
+                            {
+                                auto value = static_pointer_cast<CPUTensorView>(
+                                    body_outputs[output.result_index]);
+                                size_t offset = reference::slice_offset(output.start,
+                                                                        output.stride,
+                                                                        output.part_size,
+                                                                        output.extent.axis_size,
+                                                                        iteration);
+                                reference::scatter_slice(
+                                    static_cast<char*>(ctx->buffer_data[output.buffer_index]),
+                                    value->get_data_ptr(),
+                                    output.extent,
+                                    offset,
+                                    output.part_size);
+                            }
+                        }
+                        for (auto& output : iteration_outputs)
+                        {
+                            if (output.iteration == iteration)
+                            {
+                                auto value = static_pointer_cast<CPUTensorView>(
+                                    body_outputs[output.result_index]);
+                                memcpy(ctx->buffer_data[output.buffer_index],
+                                       value->get_data_ptr(),
+                                       output.size);
+                            }
+                        }
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_tensor_iterator_cpp()
+            {
+                REGISTER_OP_BUILDER(TensorIterator);
+            }
+        }
+    }
+}
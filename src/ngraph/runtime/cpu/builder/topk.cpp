@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -50,7 +50,6 @@ namespace ngraph
                 auto axis = topk->get_top_k_axis();
                 auto in_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
-                auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
                 auto sort = topk->get_sort();
 
@@ -63,23 +62,22 @@ namespace ngraph
                                    in_shape,
                                    out_shape,
                                    axis,
-                                   k,
                                    compute_max,
                                    sort,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
+                                                            CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::topk<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis,
-                                k,
                                 compute_max,
-                                sort);
+                                sort,
+                                ectx->arena);
                         };
                     }
                     else
@@ -88,23 +86,22 @@ namespace ngraph
                                    in_shape,
                                    out_shape,
                                    axis,
-                                   k,
                                    compute_max,
                                    sort,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
+                                                            CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::topk<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis,
-                                k,
                                 compute_max,
-                                sort);
+                                sort,
+                                ectx->arena);
                         };
                     }
                 }
@@ -116,23 +113,22 @@ namespace ngraph
                                    in_shape,
                                    out_shape,
                                    axis,
-                                   k,
                                    compute_max,
                                    sort,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
+                                                            CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::topk<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis,
-                                k,
                                 compute_max,
-                                sort);
+                                sort,
+                                ectx->arena);
                         };
                     }
                     else
@@ -141,23 +137,22 @@ namespace ngraph
                                    in_shape,
                                    out_shape,
                                    axis,
-                                   k,
                                    compute_max,
                                    sort,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
+                                                            CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::topk<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis,
-                                k,
                                 compute_max,
-                                sort);
+                                sort,
+                                ectx->arena);
                         };
                     }
                 }
@@ -169,23 +164,22 @@ namespace ngraph
                                    in_shape,
                                    out_shape,
                                    axis,
-                                   k,
                                    compute_max,
                                    sort,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int64_t>(
+                                                            CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::topk<int32_t, int64_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis,
-                                k,
                                 compute_max,
-                                sort);
+                                sort,
+                                ectx->arena);
                         };
                     }
                     else
@@ -194,23 +188,22 @@ namespace ngraph
                                    in_shape,
                                    out_shape,
                                    axis,
-                                   k,
                                    compute_max,
                                    sort,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int32_t>(
+                                                            CPUExecutionContext* ectx) {
+                            ngraph::runtime::cpu::kernel::topk<int32_t, int32_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
                                 out_shape,
                                 axis,
-                                k,
                                 compute_max,
-                                sort);
+                                sort,
+                                ectx->arena);
                         };
                     }
                 }
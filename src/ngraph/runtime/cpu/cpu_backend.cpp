@@ -210,6 +210,26 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     return rc;
 }
 
+runtime::cpu::ReorderStats runtime::cpu::CPU_Executable::get_reorder_stats() const
+{
+    const FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function != nullptr)
+    {
+        return instance.m_external_function->get_reorder_stats();
+    }
+    return ReorderStats();
+}
+
+runtime::cpu::ReorderStats runtime::cpu::CPU_Executable::get_estimated_local_reorder_stats() const
+{
+    const FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function != nullptr)
+    {
+        return instance.m_external_function->get_estimated_local_reorder_stats();
+    }
+    return ReorderStats();
+}
+
 shared_ptr<ngraph::op::Parameter> runtime::cpu::CPU_Executable::get_parameter(size_t index) const
 {
     const ParameterVector& parameters = get_parameters();
@@ -34,6 +34,15 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+
+            /// \brief Layout conversions (ConvertLayout ops) in a compiled function and the
+            ///        number of bytes they move per execution
+            struct ReorderStats
+            {
+                size_t count = 0;
+                size_t bytes = 0;
+            };
+
             BackendConstructor CPU_BACKEND_API get_backend_constructor_pointer();
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
@@ -94,6 +103,14 @@ namespace ngraph
 
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief ConvertLayout reorders in the compiled function and the bytes they
+                ///        move per call
+                ReorderStats get_reorder_stats() const;
+                /// \brief The global layout cost model's estimate of the reorders op-by-op
+                ///        layout selection would have left. Zero unless
+                ///        NGRAPH_PASS_CPU_LAYOUT_GLOBAL is set.
+                ReorderStats get_estimated_local_reorder_stats() const;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) override;
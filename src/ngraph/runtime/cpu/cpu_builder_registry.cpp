@@ -29,6 +29,7 @@ namespace ngraph
                 register_builders_argmin_cpp();
                 register_builders_avg_pool_cpp();
                 register_builders_batch_norm_cpp();
+                register_builders_binary_convolution_cpp();
                 register_builders_bounded_relu_cpp();
                 register_builders_broadcast_cpp();
                 register_builders_broadcast_distributed_cpp();
@@ -40,10 +41,12 @@ namespace ngraph
                 register_builders_dropout_cpp();
                 register_builders_embedding_lookup_cpp();
                 register_builders_erf_cpp();
+                register_builders_fused_elementwise_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
                 register_builders_get_output_element_cpp();
+                register_builders_layer_norm_cpp();
                 register_builders_leaky_relu_cpp();
                 register_builders_lrn_cpp();
                 register_builders_lstm_cpp();
@@ -51,6 +54,7 @@ namespace ngraph
                 register_builders_max_cpp();
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
+                register_builders_mvn_cpp();
                 register_builders_one_hot_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
@@ -66,6 +70,7 @@ namespace ngraph
                 register_builders_reverse_cpp();
                 register_builders_reverse_sequence_cpp();
                 register_builders_rnn_cpp();
+                register_builders_scaled_dot_product_attention_cpp();
                 register_builders_scatter_add_cpp();
                 register_builders_scatter_nd_add_cpp();
                 register_builders_select_cpp();
@@ -74,6 +79,7 @@ namespace ngraph
                 register_builders_slice_cpp();
                 register_builders_softmax_cpp();
                 register_builders_sum_cpp();
+                register_builders_tensor_iterator_cpp();
                 register_builders_tile_cpp();
                 register_builders_topk_cpp();
                 register_builders_update_slice_cpp();
@@ -28,6 +28,7 @@ namespace ngraph
             void register_builders_argmin_cpp();
             void register_builders_avg_pool_cpp();
             void register_builders_batch_norm_cpp();
+            void register_builders_binary_convolution_cpp();
             void register_builders_bounded_relu_cpp();
             void register_builders_broadcast_cpp();
             void register_builders_broadcast_distributed_cpp();
@@ -39,10 +40,12 @@ namespace ngraph
             void register_builders_dropout_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
+            void register_builders_fused_elementwise_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
             void register_builders_gelu_cpp();
             void register_builders_get_output_element_cpp();
+            void register_builders_layer_norm_cpp();
             void register_builders_leaky_relu_cpp();
             void register_builders_lrn_cpp();
             void register_builders_lstm_cpp();
@@ -50,6 +53,7 @@ namespace ngraph
             void register_builders_max_cpp();
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
+            void register_builders_mvn_cpp();
             void register_builders_one_hot_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
@@ -65,6 +69,7 @@ namespace ngraph
             void register_builders_reverse_cpp();
             void register_builders_reverse_sequence_cpp();
             void register_builders_rnn_cpp();
+            void register_builders_scaled_dot_product_attention_cpp();
             void register_builders_scatter_add_cpp();
             void register_builders_scatter_nd_add_cpp();
             void register_builders_select_cpp();
@@ -73,6 +78,7 @@ namespace ngraph
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
             void register_builders_sum_cpp();
+            void register_builders_tensor_iterator_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
             void register_builders_update_slice_cpp();
@@ -17,8 +17,10 @@
 #include <algorithm>
 #include <thread>
 
+#include "ngraph/op/constant.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
@@ -181,12 +183,18 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
+    auto& cpu_executor = executor::GetCPUExecutor();
     for (size_t i = 0; i < m_num_ctx; i++)
     {
         m_id_pool[i] = true;
         auto ctx = new CPURuntimeContext;
         m_ctx_vec.push_back(ctx);
 
+        // When the thread pools are bound to NUMA nodes, concurrent contexts are spread over
+        // the pools and so over the nodes. Otherwise every context runs on pool 0.
+        ctx->arena = cpu_executor.is_numa_aware()
+                         ? static_cast<int>(i % cpu_executor.get_num_thread_pools())
+                         : 0;
         ctx->pc = 0;
         ctx->op_durations = nullptr;
         if (runtime::cpu::IsTracingEnabled())
@@ -205,6 +213,10 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         {
             auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
             ctx->memory_buffers.push_back(buffer);
+            if (cpu_executor.is_numa_aware())
+            {
+                cpu_executor.first_touch(ctx->arena, buffer->get_ptr(), buffer_size);
+            }
         }
         const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
         // Create scratchpad
@@ -220,11 +232,23 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
             if (scratchpad_size > 0)
             {
                 ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
+                if (cpu_executor.is_numa_aware())
+                {
+                    cpu_executor.first_touch(
+                        ctx->arena, ctx->scratchpad_buffer->get_ptr(), scratchpad_size);
+                }
             }
             else
             {
                 ctx->scratchpad_buffer = nullptr;
             }
+            // Only the DEX functors look up ctx->weight_replicas, generated code reads the
+            // constants in place
+            if (cpu_executor.is_numa_aware() &&
+                std::getenv("NGRAPH_CPU_NUMA_REPLICATE_WEIGHTS") != nullptr)
+            {
+                ctx->weight_replicas = replicate_weights(ctx->arena, allocator);
+            }
         }
         else
         {
@@ -250,6 +274,40 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
     m_num_ctx_available = m_num_ctx;
 }
 
+const std::unordered_map<const void*, void*>&
+    runtime::cpu::CPU_CallFrame::replicate_weights(int arena, Allocator* allocator)
+{
+    auto& cpu_executor = executor::GetCPUExecutor();
+    int numa_node = cpu_executor.get_numa_node(arena);
+    auto it = m_weight_replicas.find(numa_node);
+    if (it != m_weight_replicas.end())
+    {
+        return it->second.data;
+    }
+
+    WeightReplicas& replicas = m_weight_replicas[numa_node];
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    for (auto& node : m_external_function->get_function()->get_ordered_ops())
+    {
+        auto constant = as_type_ptr<op::Constant>(node);
+        if (!constant)
+        {
+            continue;
+        }
+        size_t size = constant->get_output_tensor().size();
+        if (size == 0 || replicas.data.count(constant->get_data_ptr()) != 0)
+        {
+            continue;
+        }
+        // The copy is the first write to the replica, done by the threads of the node.
+        std::unique_ptr<AlignedBuffer> buffer(new AlignedBuffer(size, alignment, allocator));
+        cpu_executor.first_touch(arena, buffer->get_ptr(), size, constant->get_data_ptr());
+        replicas.data[constant->get_data_ptr()] = buffer->get_ptr();
+        replicas.buffers.push_back(std::move(buffer));
+    }
+    return replicas.data;
+}
+
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
     for (size_t i = 0; i < m_num_ctx; i++)
@@ -20,7 +20,9 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -77,6 +79,12 @@ namespace ngraph
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
+                /// \brief Returns the copies of the Constant op data placed on the NUMA node of
+                ///        thread pool `arena`, creating them if this node has none yet. Only
+                ///        used in direct execution mode.
+                const std::unordered_map<const void*, void*>&
+                    replicate_weights(int arena, runtime::Allocator* allocator);
+
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
@@ -97,6 +105,14 @@ namespace ngraph
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                struct WeightReplicas
+                {
+                    std::vector<std::unique_ptr<AlignedBuffer>> buffers;
+                    std::unordered_map<const void*, void*> data;
+                };
+                // Constant data replicas for each NUMA node, shared by the contexts on the node
+                std::map<int, WeightReplicas> m_weight_replicas;
+
                 // Codegen specific
 
                 /// Function that initializes the context used in codegen mode.
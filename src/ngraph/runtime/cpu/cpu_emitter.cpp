@@ -17,6 +17,8 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -65,6 +67,7 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -129,8 +132,7 @@
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
-#include "ngraph/state/bernoulli_rng_state.hpp"
-#include "ngraph/state/uniform_rng_state.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -650,6 +652,49 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Rnn)
             {
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto rnn_node = static_cast<const ngraph::op::Rnn*>(node);
+                    if (rnn_node->get_rnn_type() != rnn_utils::rnntype::vanilla_gru)
+                    {
+                        throw ngraph_error(
+                            "Rnn is supported only through MKLDNN and doesnt have reference "
+                            "INTERPRETER implementation");
+                    }
+
+#if MKLDNN_VERSION_MAJOR < 1
+                    const size_t weights_arg = 2;
+#else
+                    const size_t weights_arg = 3;
+#endif
+                    writer << "cpu::kernel::gru_forward(" << args[0].get_name() << ",\n";
+                    writer << "                         " << args[1].get_name() << ",\n";
+                    writer << "                         " << args[weights_arg].get_name()
+                           << ",\n";
+                    writer << "                         " << args[weights_arg + 1].get_name()
+                           << ",\n";
+                    writer << "                         " << args[weights_arg + 2].get_name()
+                           << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         " << out[1].get_name() << ",\n";
+                    writer << "                         " << rnn_node->get_src_sequence_length()
+                           << ",\n";
+                    writer << "                         " << rnn_node->get_batch_size() << ",\n";
+                    writer << "                         "
+                           << rnn_node->get_src_layer_feature_size() << ",\n";
+                    writer << "                         "
+                           << rnn_node->get_src_iter_feature_size() << ",\n";
+                    writer << "                         " << rnn_node->get_direction() << ",\n";
+                    writer << "                         " << rnn_node->get_num_fused_layers()
+                           << ");\n";
+#if MKLDNN_VERSION_MAJOR >= 1
+                    // GRU has no cell state, dst_iter_c mirrors dst_iter
+                    writer << "memcpy(" << out[2].get_name() << ", " << out[1].get_name() << ", "
+                           << out[1].get_size() * out[1].get_element_type().size() << ");\n";
+#endif
+                    return;
+                }
+
                 size_t rnn_index;
                 std::vector<std::size_t> deps;
                 size_t scratchpad_size;
@@ -2040,6 +2085,30 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                (void)external_function;
+                auto attention = static_cast<const ngraph::op::ScaledDotProductAttention*>(node);
+                bool has_mask = attention->get_has_mask();
+
+                writer.block_begin();
+                writer << "reference::scaled_dot_product_attention<" << args[0].get_type()
+                       << ">(" << args[0].get_name() << ",\n";
+                writer << "                   " << args[1].get_name() << ",\n";
+                writer << "                   " << args[2].get_name() << ",\n";
+                writer << "                   " << (has_mask ? args[3].get_name() : "nullptr")
+                       << ",\n";
+                writer << "                   " << out[0].get_name() << ",\n";
+                writer << "                   {" << join(args[0].get_shape()) << "},\n";
+                writer << "                   {" << join(args[1].get_shape()) << "},\n";
+                writer << "                   {" << join(args[2].get_shape()) << "},\n";
+                writer << "                   {"
+                       << (has_mask ? join(args[3].get_shape()) : std::string()) << "},\n";
+                writer << "                   " << attention->get_scale() << ");\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ScatterAdd)
             {
@@ -2413,9 +2482,8 @@ namespace ngraph
                     auto arg1_shape = args[1].get_shape();
                     auto result_shape = out[0].get_shape();
 
-                    writer << "reference::convolution<" << args[0].get_type() << " , "
-                           << args[1].get_type() << " , " << out[0].get_type() << ", int32_t>("
-                           << args[0].get_name() << ",\n";
+                    writer << "reference::quantized_convolution<" << args[1].get_type() << " , "
+                           << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
                     writer << "                         " << args[1].get_name() << ",\n";
                     writer << "                         " << out[0].get_name() << ",\n";
                     writer << "                         {" << join(arg0_shape) << "},\n";
@@ -2427,8 +2495,6 @@ namespace ngraph
                            << join(convolution->get_window_dilation_strides()) << "},\n";
                     writer << "                         {" << join(convolution->get_padding_below())
                            << "},\n";
-                    writer << "                         {" << join(convolution->get_padding_above())
-                           << "},\n";
                     writer << "                         {"
                            << join(convolution->get_data_dilation_strides()) << "}, \n";
                     writer << "                         " << args[2].get_name() << ",\n";
@@ -2546,8 +2612,6 @@ namespace ngraph
                            << join(convolution->get_window_dilation_strides()) << "},\n";
                     writer << "                         {" << join(convolution->get_padding_below())
                            << "},\n";
-                    writer << "                         {" << join(convolution->get_padding_above())
-                           << "},\n";
                     writer << "                         {"
                            << join(convolution->get_data_dilation_strides()) << "});\n";
                 }
@@ -2835,16 +2899,14 @@ namespace ngraph
             void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedDot)
             {
                 (void)external_function;
-                (void)node;
-                writer << "reference::dot<" << args[0].get_type() << " , " << args[1].get_type()
-                       << " , " << out[0].get_type() << ", int32_t>(" << args[0].get_name()
-                       << ",\n";
+                auto qd = static_cast<const ngraph::op::QuantizedDot*>(node);
+                writer << "reference::quantized_dot<" << args[1].get_type() << " , "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
                 writer << "            " << args[1].get_name() << ",\n";
                 writer << "            " << out[0].get_name() << ",\n";
                 writer << "            {" << join(args[0].get_shape()) << "},\n";
                 writer << "            {" << join(args[1].get_shape()) << "},\n";
-                writer << "            {" << join(out[0].get_shape()) << "},\n";
-                writer << "            1,\n";
+                writer << "            " << qd->get_reduction_axes_count() << ",\n";
                 writer << "            " << args[2].get_name() << ",\n";
                 writer << "            " << args[3].get_name() << ",\n";
                 writer << "            " << args[4].get_name() << ",\n";
@@ -4361,11 +4423,16 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::GenerateMask)
             {
+                // Same Philox stream and fill kernel as the DEX builder, so codegen, DEX and the
+                // interpreter produce the same mask for any number of threads
                 auto gm = static_cast<const ngraph::op::GenerateMask*>(node);
                 writer.block_begin();
-                auto index = external_function->add_state(
-                    new ngraph::BernoulliRNGState(gm->get_seed(), gm->get_probability()));
-                writer << "auto state = static_cast<ngraph::BernoulliRNGState*>(ctx->states["
+                auto seed_attr = gm->get_use_seed() ? gm->get_seed() : 0;
+                auto index = external_function->add_state(new ngraph::PhiloxRNGState(seed_attr));
+                std::stringstream probability;
+                probability << std::setprecision(std::numeric_limits<double>::max_digits10)
+                            << gm->get_probability();
+                writer << "auto state = static_cast<ngraph::PhiloxRNGState*>(ctx->states["
                        << index << "]);\n";
                 writer << "bool training = static_cast<bool>(" << args[0].get_name() << "[0]);\n";
                 writer << "bool use_seed = static_cast<bool>(" << args[2].get_name() << "[0]);\n";
@@ -4376,16 +4443,20 @@ namespace ngraph
                        << "[0]);\n";
                 writer << "if (use_seed == false) \n";
                 writer << "{\n";
-                writer << "    reference::generate_mask(\n";
+                writer << "    cpu::kernel::generate_mask(\n";
                 writer << "                " << out[0].get_name() << ",\n";
                 writer << "                " << out[0].get_size() << ",\n";
-                writer << "                state, training);\n";
+                writer << "                training,\n";
+                writer << "                " << probability.str() << ",\n";
+                writer << "                state->get_key(),\n";
+                writer << "                state->advance("
+                       << PhiloxRNGState::get_block_count(out[0].get_size(), 4) << "ULL));\n";
                 writer << "}\n";
                 writer << "else {\n";
-                writer << "       reference::generate_mask_no_state(\n";
+                writer << "       cpu::kernel::generate_mask(\n";
                 writer << "           " << out[0].get_name() << ",\n";
                 writer << "           " << out[0].get_size() << ",\n";
-                writer << "           training, seed, keep_prob);\n";
+                writer << "           training, keep_prob, seed, 0);\n";
                 writer << "}\n";
                 writer.block_end();
             }
@@ -4400,31 +4471,33 @@ namespace ngraph
                 }
 
                 writer.block_begin();
-                auto index = external_function->add_state(new UniformRNGState());
+                auto index = external_function->add_state(new ngraph::PhiloxRNGState());
                 auto fixed_seed = ru->get_fixed_seed();
 
-                writer << "auto state = static_cast<ngraph::RandomUniformRNGState*>(ctx->states["
+                writer << "auto state = static_cast<ngraph::PhiloxRNGState*>(ctx->states["
                        << index << "]);\n";
                 writer << "bool use_fixed_seed = static_cast<bool>(" << args[3].get_name()
                        << "[0]);\n";
 
                 writer << "if (use_fixed_seed == false) \n";
                 writer << "{\n";
-                writer << "    reference::random_uniform<" << args[0].get_type() << ">(\n";
+                writer << "    cpu::kernel::random_uniform<" << args[0].get_type() << ">(\n";
                 writer << "                   " << out[0].get_name() << ",\n";
-                writer << "                   " << args[0].get_name() << ",\n";
-                writer << "                   " << args[1].get_name() << ",\n";
+                writer << "                   " << args[0].get_name() << "[0],\n";
+                writer << "                   " << args[1].get_name() << "[0],\n";
                 writer << "                   " << out[0].get_size() << ",\n";
-                writer << "                   state);\n";
+                writer << "                   state->get_key(),\n";
+                writer << "                   state->advance("
+                       << PhiloxRNGState::get_block_count(out[0].get_size(), 2) << "ULL));\n";
                 writer << "}\n";
                 writer << "else {\n";
-                writer << "    reference::random_uniform_with_fixed_seed<" << args[0].get_type()
-                       << ">(\n";
+                writer << "    cpu::kernel::random_uniform<" << args[0].get_type() << ">(\n";
                 writer << "                   " << out[0].get_name() << ",\n";
-                writer << "                   " << args[0].get_name() << ",\n";
-                writer << "                   " << args[1].get_name() << ",\n";
+                writer << "                   " << args[0].get_name() << "[0],\n";
+                writer << "                   " << args[1].get_name() << "[0],\n";
                 writer << "                   " << out[0].get_size() << ",\n";
-                writer << "                   " << fixed_seed << ");\n";
+                writer << "                   " << fixed_seed << "ULL,\n";
+                writer << "                   0);\n";
                 writer << "}\n";
                 writer.block_end();
             }
@@ -4432,59 +4505,29 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Dropout)
             {
-                (void)external_function;
                 auto dropout = static_cast<const ngraph::op::Dropout*>(node);
-                size_t ncr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
+                bool use_seed = dropout->get_use_seed();
+                auto index = external_function->add_state(
+                    use_seed ? new ngraph::PhiloxRNGState(dropout->get_seed())
+                             : new ngraph::PhiloxRNGState());
+                uint64_t blocks = PhiloxRNGState::get_block_count(args[0].get_size(), 4);
 
                 writer.block_begin();
+                writer << "auto state = static_cast<ngraph::PhiloxRNGState*>(ctx->states["
+                       << index << "]);\n";
                 writer << "bool training = static_cast<bool>(" << args[1].get_name() << "[0]);\n";
-                writer << "bool use_seed = " << to_string(dropout->get_use_seed()) << ";\n";
-                writer << "int32_t seed = use_seed ? " << to_string(dropout->get_seed())
-                       << " : rand();\n";
                 writer << "double keep_prob = static_cast<double>(" << args[4].get_name()
                        << "[0]);\n";
-                writer << "size_t count = " << args[0].get_size() << ";\n";
-                writer << "size_t nthr = " << to_string(ncr) << ";\n";
-                // writer << "size_t nthr = "
-                //        << to_string(
-                //               ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores())
-                //        << ";\n";
-                writer << "size_t chunk_size = (count + nthr - 1) / nthr;\n";
-                writer << "std::vector<std::minstd_rand> vmsr(nthr);\n";
-                writer << "for (size_t i = 0; i < nthr; i++)\n\
-                {\n\
-                    std::minstd_rand msr;\n\
-                    msr.seed(seed+i);\n\
-                    vmsr[i] = msr;\n\
-                }\n";
-
-                writer << "double dropout_prob = 1 - keep_prob;\n";
-                writer << "std::uniform_real_distribution<> gen(0, 1);\n";
-                writer << "#pragma omp parallel num_threads(nthr)\n";
-                writer << "{\n";
-                writer << "size_t tid = omp_get_thread_num();\n";
-                writer << "std::minstd_rand msr;\n msr.seed(seed+tid);\n";
-                writer << "size_t idx_start = tid * chunk_size;\n";
-                writer << "size_t idx_end = std::min(idx_start + chunk_size, count);\n";
-                writer << "for (size_t i = idx_start; i < idx_end; i++)\n";
-                writer << "{\n";
-                writer << "    //out[i] = training ? static_cast<T>(bd(gen)) : "
-                          "static_cast<float>(1);\n";
-                writer << "    //out0[i] = training ? input[i] : static_cast<float>(1);\n";
-                writer << "    if (static_cast<float>(gen(msr)) < dropout_prob)\n";
-                writer << "    {\n";
-                writer << "        " << out[0].get_name() << "[i] = 0;\n";
-                writer << "        " << out[1].get_name() << "[i] = 0;\n";
-                writer << "    }\n";
-                writer << "    else\n";
-                writer << "    {\n";
-                writer << "        " << out[1].get_name() << "[i] = 1;\n";
-                writer << "        " << out[0].get_name() << "[i] = " << args[0].get_name()
-                       << "[i] / static_cast<float>(keep_prob);\n";
-                writer << "    }\n";
-                writer << "}\n"; // for loop ends
-                writer << "}\n"; //#pragma ends
-
+                writer << "cpu::kernel::generate_dropout(" << args[0].get_name() << ",\n";
+                writer << "                              " << out[0].get_name() << ",\n";
+                writer << "                              " << out[1].get_name() << ",\n";
+                writer << "                              " << args[0].get_size() << ",\n";
+                writer << "                              training,\n";
+                writer << "                              keep_prob,\n";
+                writer << "                              state->get_key(),\n";
+                writer << "                              "
+                       << (use_seed ? "0" : "state->advance(" + to_string(blocks) + "ULL)")
+                       << ");\n";
                 writer.block_end();
             }
 
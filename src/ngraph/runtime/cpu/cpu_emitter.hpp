@@ -107,6 +107,7 @@ namespace ngraph
         class ArgMin;
         class ArgMax;
         class GatherND;
+        class ScaledDotProductAttention;
         class ScatterAdd;
         class ScatterNDAdd;
         class UpdateSlice;
@@ -320,6 +321,8 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::GatherND);
             template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ScaledDotProductAttention);
+            template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ScatterAdd);
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ScatterNDAdd);
@@ -14,7 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <thread>
+#include <unistd.h>
 
 #include "cpu_executor.hpp"
 
@@ -67,6 +71,26 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+// Eigen thread environment whose threads only run on a given set of CPUs.
+struct NumaThreadEnvironment : public Eigen::StlThreadEnvironment
+{
+    explicit NumaThreadEnvironment(const std::vector<int>& cpus)
+        : m_cpus(cpus)
+    {
+    }
+
+    EnvThread* CreateThread(std::function<void()> f)
+    {
+        std::vector<int> cpus = m_cpus;
+        return new EnvThread([cpus, f]() {
+            ngraph::runtime::cpu::numa::bind_current_thread(cpus);
+            f();
+        });
+    }
+
+    std::vector<int> m_cpus;
+};
+
 namespace ngraph
 {
     namespace runtime
@@ -79,7 +103,16 @@ namespace ngraph
                     : m_num_thread_pools(num_thread_pools)
                 {
                     m_num_cores = GetNumCores();
-                    for (int i = 0; i < num_thread_pools; i++)
+
+                    std::vector<numa::Node> numa_nodes;
+                    if (std::getenv("NGRAPH_CPU_NUMA") != nullptr)
+                    {
+                        numa_nodes = numa::get_topology();
+                        m_num_thread_pools =
+                            std::max(m_num_thread_pools, static_cast<int>(numa_nodes.size()));
+                    }
+
+                    for (int i = 0; i < m_num_thread_pools; i++)
                     {
                         int num_threads_per_pool;
 
@@ -104,8 +137,28 @@ namespace ngraph
                             num_threads_per_pool = tp_count;
                         }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
+                        if (!numa_nodes.empty())
+                        {
+                            // Pools are spread over the nodes round-robin. By default a pool
+                            // uses one thread per physical core of its node, assuming two
+                            // hardware threads per core like GetNumCores.
+                            const numa::Node& node = numa_nodes[i % numa_nodes.size()];
+                            if (eigen_tp_count == nullptr)
+                            {
+                                num_threads_per_pool =
+                                    std::min(num_threads_per_pool,
+                                             std::max(1, static_cast<int>(node.cpus.size()) / 2));
+                            }
+                            m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                                new Eigen::ThreadPoolTempl<NumaThreadEnvironment>(
+                                    num_threads_per_pool, NumaThreadEnvironment(node.cpus))));
+                            m_numa_nodes.push_back(node.id);
+                        }
+                        else
+                        {
+                            m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                                new Eigen::ThreadPool(num_threads_per_pool)));
+                        }
                         m_thread_pool_devices.push_back(
                             std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
                                 m_thread_pools[i].get(), num_threads_per_pool)));
@@ -115,6 +168,52 @@ namespace ngraph
                     }
                 }
 
+                void CPUExecutor::first_touch(int id, void* ptr, size_t size, const void* init)
+                {
+                    // Every range is scheduled on the pool and the caller only waits. A
+                    // parallelFor would run a share of the work, or all of it for small sizes,
+                    // on the calling thread and so place those pages on the caller's node.
+                    // Buffers are only aligned to a cache line, so ranges are split on page
+                    // boundaries of the address space to keep each page inside one range.
+                    static const uintptr_t page_size =
+                        static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+                    if (size == 0)
+                    {
+                        return;
+                    }
+                    char* dst = static_cast<char*>(ptr);
+                    const char* src = static_cast<const char*>(init);
+                    uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+                    uintptr_t end = begin + size;
+                    uintptr_t first_page = begin & ~(page_size - 1);
+                    size_t num_pages = (end - first_page + page_size - 1) / page_size;
+
+                    Eigen::ThreadPoolInterface* pool = m_thread_pools[id].get();
+                    size_t num_threads = static_cast<size_t>(std::max(pool->NumThreads(), 1));
+                    size_t pages_per_range = (num_pages + num_threads - 1) / num_threads;
+                    size_t num_ranges = (num_pages + pages_per_range - 1) / pages_per_range;
+                    Eigen::Barrier barrier(static_cast<unsigned int>(num_ranges));
+                    for (size_t range = 0; range < num_ranges; range++)
+                    {
+                        uintptr_t range_begin = first_page + range * pages_per_range * page_size;
+                        uintptr_t range_end = range_begin + pages_per_range * page_size;
+                        size_t first = std::max(range_begin, begin) - begin;
+                        size_t last = std::min(range_end, end) - begin;
+                        pool->Schedule([dst, src, first, last, &barrier]() {
+                            if (src)
+                            {
+                                std::memcpy(dst + first, src + first, last - first);
+                            }
+                            else
+                            {
+                                std::memset(dst + first, 0, last - first);
+                            }
+                            barrier.Notify();
+                        });
+                    }
+                    barrier.Wait();
+                }
+
 #if defined(NGRAPH_TBB_ENABLE)
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
@@ -21,6 +21,7 @@
 
 #include <mkldnn.hpp>
 
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
 #define EIGEN_USE_THREADS
@@ -41,6 +42,9 @@ namespace ngraph
                 extern mkldnn::engine global_cpu_engine;
 
                 // CPUExecutor owns the resources for executing a graph.
+                //
+                // With NGRAPH_CPU_NUMA set on a host with NUMA nodes, there is at least one thread
+                // pool per node and the threads of each pool are bound to the CPUs of one node.
                 class CPUExecutor
                 {
                 public:
@@ -63,12 +67,29 @@ namespace ngraph
 #endif
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    /// \brief Returns true if the thread pools are bound to NUMA nodes.
+                    bool is_numa_aware() const { return !m_numa_nodes.empty(); }
+                    /// \brief Returns the NUMA node the threads of pool `id` are bound to, or -1.
+                    int get_numa_node(int id) const
+                    {
+                        return m_numa_nodes.empty() ? -1 : m_numa_nodes[id];
+                    }
+
+                    /// \brief Initializes `size` bytes at `ptr` with a copy of `init`, or with
+                    ///        zeros if `init` is null, from the threads of pool `id`. Under the
+                    ///        first-touch policy of the OS, pages of memory that were never
+                    ///        written before are then placed on the NUMA node of the pool. Must
+                    ///        not be called from a thread of pool `id`.
+                    void first_touch(int id, void* ptr, size_t size, const void* init = nullptr);
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolInterface>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
 #endif
+                    // NUMA node of each thread pool, empty if the pools are not bound to nodes.
+                    std::vector<int> m_numa_nodes;
                     int m_num_thread_pools;
                     int m_num_cores;
                 };
@@ -88,7 +88,9 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/gru_cell.hpp"
 #include "ngraph/op/fused/lstm_cell.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
 #include "ngraph/op/fused/softmax_crossentropy.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
@@ -156,6 +158,7 @@
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
+#include "ngraph/pass/pack_binary_weights.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
@@ -194,6 +197,7 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
@@ -205,6 +209,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/runtime/cpu/pass/halide_subgraph_extraction.hpp"
+#include "ngraph/runtime/weight_store.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -333,6 +338,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Erf), &runtime::cpu::CPU_Emitter::emit<op::Erf>},
     {TI(ngraph::op::Gather), &runtime::cpu::CPU_Emitter::emit<op::Gather>},
     {TI(ngraph::op::GatherND), &runtime::cpu::CPU_Emitter::emit<op::GatherND>},
+    {TI(ngraph::op::ScaledDotProductAttention),
+     &runtime::cpu::CPU_Emitter::emit<op::ScaledDotProductAttention>},
     {TI(ngraph::op::ScatterAdd), &runtime::cpu::CPU_Emitter::emit<op::ScatterAdd>},
     {TI(ngraph::op::ScatterNDAdd), &runtime::cpu::CPU_Emitter::emit<op::ScatterNDAdd>},
     {TI(ngraph::op::GetOutputElement), &runtime::cpu::CPU_Emitter::emit<op::GetOutputElement>},
@@ -472,6 +479,28 @@ static void
     writer << "}\n";
 }
 
+// With NGRAPH_CPU_SHARED_WEIGHTS set, constants, including weights folded into MKLDNN layouts,
+// are deduplicated across executables through the process-wide weight store. A store published
+// at NGRAPH_CPU_SHARED_WEIGHTS_FILE is attached first, so its weights are mapped rather than
+// copied.
+static runtime::WeightStore* get_shared_weight_store()
+{
+    static runtime::WeightStore* store = []() -> runtime::WeightStore* {
+        if (std::getenv("NGRAPH_CPU_SHARED_WEIGHTS") == nullptr)
+        {
+            return nullptr;
+        }
+        auto weight_store = runtime::get_weight_store();
+        const char* path = std::getenv("NGRAPH_CPU_SHARED_WEIGHTS_FILE");
+        if (path && file_util::exists(path))
+        {
+            weight_store->attach(path);
+        }
+        return weight_store;
+    }();
+    return store;
+}
+
 static void generate_class_declarations(CodeWriter& writer)
 {
     writer << "// Declare all classes\n";
@@ -541,6 +570,8 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/kernel/dropout.hpp"
+#include "ngraph/runtime/cpu/kernel/gru.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/reference/all.hpp"
@@ -569,12 +600,15 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/scaled_dot_product_attention.hpp"
 #include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
@@ -582,7 +616,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/shape.hpp"
-#include "ngraph/state/bernoulli_rng_state.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/util.hpp"
 
@@ -657,6 +691,10 @@ using namespace ngraph::runtime;
         ngraph::op::Constant* c = as_type<ngraph::op::Constant>(node.get());
         if (c)
         {
+            if (auto weight_store = get_shared_weight_store())
+            {
+                weight_store->share(*c);
+            }
             m_active_constants.push_back(node);
             shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
             string type = tv->get_element_type().c_type_string();
@@ -1207,6 +1245,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
                 return false;
             }
         }
+        else if (typeid(ngraph::op::GRUCell) == typeid(node))
+        {
+            // GRUFusion maps these cells to the Rnn CPU op. Cells it leaves in place, because
+            // the pass is disabled or the chain could not be fused, are decomposed after it.
+            return runtime::cpu::pass::GRUFusion::is_fusable_cell(node);
+        }
         else if (typeid(ngraph::op::GeluBackpropFactor) == typeid(node))
         {
 #if MKLDNN_VERSION_MAJOR < 1
@@ -1251,14 +1295,26 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         return true;
     };
 
+    auto is_supported_after_gru_fusion = [is_supported](const Node& node) {
+        return typeid(ngraph::op::GRUCell) != typeid(node) && is_supported(node);
+    };
+
     REGISTER_KNOBBED_PASS(LikeReplacement, true, ngraph::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(Opset0Downgrade, true, ngraph::pass)
+    REGISTER_KNOBBED_PASS(PackBinaryWeights, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ImplicitBroadcastElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(GRUFusion, true, runtime::cpu::pass)
+    // The first decomposition keeps the GRUCells GRUFusion can map to Rnn. Any that are still
+    // left have no CPU kernel, so they are decomposed now.
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        FusedOpDecomposition, true, ngraph::pass, is_supported_after_gru_fusion)
+    REGISTER_KNOBBED_PASS(Opset0Downgrade, true, ngraph::pass)
+    REGISTER_KNOBBED_PASS(ImplicitBroadcastElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(BiDirectionalRnn, true, runtime::cpu::pass)
@@ -1280,6 +1336,11 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    // FusedElementwise only has a DEX builder. Core ops are preserved for MLIR.
+    if (dex && std::getenv("NGRAPH_MLIR") == nullptr)
+    {
+        REGISTER_KNOBBED_PASS(CPUElementwiseFusion, true, runtime::cpu::pass)
+    }
 #if defined(NGRAPH_HALIDE)
     REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass)
 #endif
@@ -1515,11 +1576,15 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     {
         if (node->is_constant())
         {
+            auto constant = static_pointer_cast<ngraph::op::Constant>(node);
+            if (auto weight_store = get_shared_weight_store())
+            {
+                weight_store->share(*constant);
+            }
             auto output_tensor = &node->get_output_tensor();
             m_buffer_indices[output_tensor->get_name()] = buffer_index;
-            constant_tensor_data.emplace_back(
-                buffer_index,
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+            constant_tensor_data.emplace_back(buffer_index,
+                                              const_cast<void*>(constant->get_data_ptr()));
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1777,7 +1842,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
             for (auto& p : constant_tensor_data)
             {
-                ctx->buffer_data[p.first] = p.second;
+                auto replica = ctx->weight_replicas.find(p.second);
+                ctx->buffer_data[p.first] =
+                    replica == ctx->weight_replicas.end() ? p.second : replica->second;
             }
         }
 
@@ -1818,7 +1885,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{ctx->arena};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
@@ -1946,7 +2013,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         start_ts = cpu::Clock::now();
                     }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{ctx->arena};
 
                     if (debug_tracer.tracing_is_enabled())
                     {
@@ -43,6 +43,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
@@ -184,6 +185,20 @@ namespace ngraph
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
 
+                /// \brief Reorders CPULayout left in the compiled function
+                const ReorderStats& get_reorder_stats() const { return m_reorder_stats; }
+                /// \brief Reorders op-by-op layout selection would have left, as estimated by
+                ///        the global layout cost model. Zero unless global layout mode is on.
+                const ReorderStats& get_estimated_local_reorder_stats() const
+                {
+                    return m_estimated_local_reorder_stats;
+                }
+                void set_reorder_stats(const ReorderStats& stats, const ReorderStats& local_stats)
+                {
+                    m_reorder_stats = stats;
+                    m_estimated_local_reorder_stats = local_stats;
+                }
+
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func>& get_halide_functions()
                 {
@@ -262,6 +277,8 @@ namespace ngraph
                     get_tensor_set(descriptor::Tensor* output_tensor);
 
                 std::shared_ptr<ngraph::Function> m_function;
+                ReorderStats m_reorder_stats;
+                ReorderStats m_estimated_local_reorder_stats;
                 bool m_release_function;
                 bool m_emit_timing;
 
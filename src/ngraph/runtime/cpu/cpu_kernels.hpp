@@ -270,11 +270,11 @@ namespace ngraph
                 void generate_dropout(T* input,
                                       T* out0,
                                       T* out1_mask,
-                                      size_t nelems,
-                                      bool training,
-                                      const double value,
-                                      const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed);
+                                      const size_t nelems,
+                                      const bool training,
+                                      const double keep_prob,
+                                      uint64_t key,
+                                      uint64_t counter);
             }
         }
     }
@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <sstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+vector<int> runtime::cpu::numa::parse_cpu_list(const string& cpu_list)
+{
+    vector<int> cpus;
+    stringstream ss(cpu_list);
+    string range;
+    while (getline(ss, range, ','))
+    {
+        range.erase(remove_if(range.begin(), range.end(), ::isspace), range.end());
+        if (range.empty())
+        {
+            continue;
+        }
+        auto dash = range.find('-');
+        int first = stoi(range.substr(0, dash));
+        int last = dash == string::npos ? first : stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    sort(cpus.begin(), cpus.end());
+    cpus.erase(unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+vector<runtime::cpu::numa::Node> runtime::cpu::numa::get_topology(const string& sysfs_node_dir)
+{
+    vector<Node> nodes;
+    if (!file_util::exists(sysfs_node_dir))
+    {
+        return nodes;
+    }
+
+    file_util::iterate_files(sysfs_node_dir, [&nodes](const string& path, bool is_dir) {
+        string name = file_util::get_file_name(path);
+        if (!is_dir || name.compare(0, 4, "node") != 0 || name.size() == 4 ||
+            !all_of(name.begin() + 4, name.end(), ::isdigit))
+        {
+            return;
+        }
+        string cpulist = file_util::path_join(path, "cpulist");
+        if (!file_util::exists(cpulist))
+        {
+            return;
+        }
+        Node node{stoi(name.substr(4)), parse_cpu_list(file_util::read_file_to_string(cpulist))};
+        if (!node.cpus.empty())
+        {
+            nodes.push_back(node);
+        }
+    });
+
+    sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b) { return a.id < b.id; });
+    return nodes;
+}
+
+bool runtime::cpu::numa::bind_current_thread(const vector<int>& cpus)
+{
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    return !cpus.empty() && pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+    return false;
+#endif
+}
+
+vector<int> runtime::cpu::numa::get_current_thread_cpus()
+{
+    vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpu_set))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+int runtime::cpu::numa::get_memory_node(const void* ptr)
+{
+#if defined(__linux__) && defined(SYS_move_pages)
+    // move_pages without target nodes only reports the node of each page
+    uintptr_t page_mask = ~static_cast<uintptr_t>(sysconf(_SC_PAGESIZE) - 1);
+    void* page = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr) & page_mask);
+    int status = -1;
+    if (syscall(SYS_move_pages, 0, 1, &page, nullptr, &status, 0) == 0 && status >= 0)
+    {
+        return status;
+    }
+#endif
+    return -1;
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace numa
+            {
+                /// \brief A NUMA node and the logical CPUs that belong to it.
+                struct Node
+                {
+                    int id;
+                    std::vector<int> cpus;
+                };
+
+                /// \brief Parses a Linux CPU list such as "0-3,8,10-11" into sorted CPU ids.
+                CPU_BACKEND_API std::vector<int> parse_cpu_list(const std::string& cpu_list);
+
+                /// \brief Reads the NUMA nodes of the host, ordered by id, from the `nodeN/cpulist`
+                ///        files of `sysfs_node_dir`. Nodes without CPUs are skipped. The result is
+                ///        empty when the topology is not available, e.g. on non-Linux hosts.
+                CPU_BACKEND_API std::vector<Node>
+                    get_topology(const std::string& sysfs_node_dir = "/sys/devices/system/node");
+
+                /// \brief Restricts the calling thread to run on `cpus`.
+                /// \return false if thread affinity is not supported or could not be set.
+                CPU_BACKEND_API bool bind_current_thread(const std::vector<int>& cpus);
+
+                /// \brief Returns the CPUs the calling thread may run on, empty if thread
+                ///        affinity is not supported.
+                CPU_BACKEND_API std::vector<int> get_current_thread_cpus();
+
+                /// \brief Returns the NUMA node holding the page at `ptr`, or -1 if the page is
+                ///        not backed by memory yet or the query is not supported.
+                CPU_BACKEND_API int get_memory_node(const void* ptr);
+            }
+        }
+    }
+}
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <cstdint>
 #include <set>
+#include <unordered_map>
 
 #if defined(NGRAPH_TBB_ENABLE)
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
@@ -79,6 +80,10 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // Thread pool of the CPUExecutor that runs the kernels of this context
+                int arena;
+                // Maps the data of Constant ops to their replica on the NUMA node of the arena
+                std::unordered_map<const void*, void*> weight_replicas;
 #ifdef NGRAPH_MLIR_ENABLE
                 /// Maps CompiledKernel nodes to their MLIR compiler
                 /// The MLIR compiler caches the compiled code on the first invocation,
@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief XNOR-popcount binary convolution, see reference::binary_convolution.
+                ///        The filter is packed once per call, directly from T values unless it
+                ///        is already in u1 storage (`filter_packed`); packing and the
+                ///        convolution itself are parallel over output channels and positions.
+                template <typename T>
+                void binary_convolution(void* input,
+                                        void* filter,
+                                        void* output,
+                                        const Shape& in_shape,
+                                        const Shape& filter_shape,
+                                        const Shape& out_shape,
+                                        const Strides& strides,
+                                        const Strides& dilations,
+                                        const CoordinateDiff& pads_begin,
+                                        float pad_value,
+                                        bool filter_packed,
+                                        int arena)
+                {
+                    const T* in = static_cast<const T*>(input);
+                    T* out = static_cast<T*>(output);
+
+                    const size_t batch_size = in_shape[0];
+                    const size_t channels = in_shape[1];
+                    const size_t out_channels = filter_shape[0];
+                    const size_t words = (channels + 63) / 64;
+                    const size_t in_spatial = reference::spatial_size(in_shape);
+                    const size_t filter_spatial = reference::spatial_size(filter_shape);
+                    const size_t out_spatial = reference::spatial_size(out_shape);
+                    const size_t filter_size = channels * filter_spatial;
+
+                    std::vector<uint64_t> filter_bits(out_channels * filter_spatial * words, 0);
+                    std::vector<float> filter_sums(out_channels * filter_spatial, 0);
+                    Eigen::TensorOpCost filter_cost(filter_size * sizeof(T),
+                                                    filter_spatial * (words * 8 + sizeof(float)),
+                                                    filter_size * 2.0);
+                    if (filter_packed)
+                    {
+                        const uint8_t* packed = static_cast<const uint8_t*>(filter);
+                        parallel_for(arena,
+                                     out_channels,
+                                     filter_cost,
+                                     [&](size_t begin, size_t end) {
+                                         reference::pack_binary_filter(
+                                             [packed](size_t i) {
+                                                 return ((packed[i / 8] >> (7 - i % 8)) & 1) != 0;
+                                             },
+                                             filter_bits.data(),
+                                             filter_sums.data(),
+                                             channels,
+                                             filter_spatial,
+                                             begin,
+                                             end);
+                                     });
+                    }
+                    else
+                    {
+                        const T* weights = static_cast<const T*>(filter);
+                        parallel_for(arena,
+                                     out_channels,
+                                     filter_cost,
+                                     [&](size_t begin, size_t end) {
+                                         reference::pack_binary_filter(
+                                             [weights](size_t i) { return weights[i] > T(0); },
+                                             filter_bits.data(),
+                                             filter_sums.data(),
+                                             channels,
+                                             filter_spatial,
+                                             begin,
+                                             end);
+                                     });
+                    }
+
+                    // Each spatial position owns its words of data_bits, so ranges of positions
+                    // can be packed concurrently.
+                    std::vector<uint64_t> data_bits(batch_size * in_spatial * words, 0);
+                    parallel_for(arena,
+                                 batch_size * in_spatial,
+                                 Eigen::TensorOpCost(channels * sizeof(T), words * 8, channels),
+                                 [&](size_t begin, size_t end) {
+                                     reference::pack_binary_data(
+                                         in, data_bits.data(), channels, in_spatial, begin, end);
+                                 });
+
+                    const reference::xor_popcount_kernel popcount_kernel =
+                        reference::get_xor_popcount_kernel();
+                    parallel_for(
+                        arena,
+                        batch_size * out_channels,
+                        Eigen::TensorOpCost(out_spatial * filter_spatial * words * 16,
+                                            out_spatial * sizeof(T),
+                                            out_spatial * filter_spatial * (words * 4.0 + 4.0)),
+                        [&](size_t begin, size_t end) {
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                reference::binary_convolution_channel(data_bits.data(),
+                                                                      filter_bits.data(),
+                                                                      filter_sums.data(),
+                                                                      out,
+                                                                      i / out_channels,
+                                                                      i % out_channels,
+                                                                      in_shape,
+                                                                      filter_shape,
+                                                                      out_shape,
+                                                                      strides,
+                                                                      dilations,
+                                                                      pads_begin,
+                                                                      pad_value,
+                                                                      popcount_kernel);
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -70,6 +71,45 @@ namespace ngraph
                         static_cast<const OUTPUT*>(output_zero_point));
                 }
 
+                template <typename FILTER, typename OUTPUT>
+                void quantized_convolution(void* input0,
+                                           void* input1,
+                                           void* output,
+                                           const Shape& arg0_shape,
+                                           const Shape& arg1_shape,
+                                           const Shape& result_shape,
+                                           const Strides& window_movement_strides,
+                                           const Strides& window_dilation_strides,
+                                           const CoordinateDiff& padding_below,
+                                           const Strides& data_dilation_strides,
+                                           void* input_scale,
+                                           void* input_zero_point,
+                                           void* filter_scale,
+                                           void* filter_zero_point,
+                                           void* output_scale,
+                                           void* output_zero_point,
+                                           const reference::QuantizedPackedWeights* packed)
+                {
+                    reference::quantized_convolution<FILTER, OUTPUT>(
+                        static_cast<const uint8_t*>(input0),
+                        static_cast<const FILTER*>(input1),
+                        static_cast<OUTPUT*>(output),
+                        arg0_shape,
+                        arg1_shape,
+                        result_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        data_dilation_strides,
+                        static_cast<const float*>(input_scale),
+                        static_cast<const uint8_t*>(input_zero_point),
+                        static_cast<const float*>(filter_scale),
+                        static_cast<const FILTER*>(filter_zero_point),
+                        static_cast<const float*>(output_scale),
+                        static_cast<const OUTPUT*>(output_zero_point),
+                        packed);
+                }
+
                 template <typename ElementType>
                 void convolution_backprop_filter(void* input0,
                                                  void* input1,
@@ -22,6 +22,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -202,6 +203,37 @@ namespace ngraph
                         static_cast<const float*>(output_scale),
                         static_cast<const OUTPUT*>(output_zero_point));
                 }
+
+                template <typename INPUT1, typename OUTPUT>
+                void quantized_dot(void* arg0,
+                                   void* arg1,
+                                   void* out,
+                                   const Shape& arg0_shape,
+                                   const Shape& arg1_shape,
+                                   size_t reduction_axes_count,
+                                   void* input0_scale,
+                                   void* input0_zero_point,
+                                   void* input1_scale,
+                                   void* input1_zero_point,
+                                   void* output_scale,
+                                   void* output_zero_point,
+                                   const reference::QuantizedPackedWeights* packed)
+                {
+                    reference::quantized_dot<INPUT1, OUTPUT>(
+                        static_cast<const uint8_t*>(arg0),
+                        static_cast<const INPUT1*>(arg1),
+                        static_cast<OUTPUT*>(out),
+                        arg0_shape,
+                        arg1_shape,
+                        reduction_axes_count,
+                        static_cast<const float*>(input0_scale),
+                        static_cast<const uint8_t*>(input0_zero_point),
+                        static_cast<const float*>(input1_scale),
+                        static_cast<const INPUT1*>(input1_zero_point),
+                        static_cast<const float*>(output_scale),
+                        static_cast<const OUTPUT*>(output_zero_point),
+                        packed);
+                }
             }
         }
     }
@@ -16,8 +16,7 @@
 
 #pragma once
 
-#include <random>
-
+#include "ngraph/runtime/cpu/kernel/random.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -29,66 +28,32 @@ namespace ngraph
             namespace kernel
             {
                 // Note: this kernel is for doing upscale in train
-                template <typename T, typename M>
+                //
+                // The mask is the same Philox stream GenerateMask produces for
+                // (key, counter, keep_prob), so a fused Dropout matches the unfused graph for a
+                // given seed, independent of the number of threads.
+                template <typename T>
                 void generate_dropout(T* input,
                                       T* out0,
-                                      M* out1_mask,
+                                      T* out1_mask,
                                       const size_t nelems,
                                       const bool training,
                                       const double keep_prob,
-                                      const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed)
+                                      uint64_t key,
+                                      uint64_t counter)
                 {
                     if (training)
-
                     {
-                        int32_t rnd_seed = rand();
-                        M dropout_prob = 1 - static_cast<M>(keep_prob);
-#ifdef _OPENMP
-                        size_t nthr =
-                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                        size_t chunk_size = (nelems + nthr - 1) / nthr;
-
-#pragma omp parallel num_threads(nthr)
-                        {
-                            size_t tid = omp_get_thread_num();
-#else
-                        size_t chunk_size = nelems;
-                        {
-                            size_t tid = 0;
-#endif
-                            // Note :
-                            // In this implementation of dropout, we are trying to be same as PDPD
-                            // native implementation (and other frameworks).
-                            // https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
-                            // So, if framework passes same seed, then we will get same mask.
-                            std::minstd_rand msr;
-                            if (use_seed)
+                        random_detail::parallel_fill(nelems, [&](size_t begin, size_t end) {
+                            reference::generate_mask_range(
+                                out1_mask, begin, end, true, keep_prob, key, counter);
+                            for (size_t idx = begin; idx < end; ++idx)
                             {
-                                msr = vmsr[tid];
+                                out0[idx] = out1_mask[idx] == 0
+                                                ? static_cast<T>(0)
+                                                : input[idx] / static_cast<T>(keep_prob);
                             }
-                            else
-                            {
-                                msr.seed(rnd_seed + tid);
-                            }
-                            std::uniform_real_distribution<> gen(0, 1);
-
-                            size_t idx_start = tid * chunk_size;
-                            size_t idx_end = std::min(idx_start + chunk_size, nelems);
-                            for (size_t idx = idx_start; idx < idx_end; ++idx)
-                            {
-                                if (static_cast<M>(gen(msr)) < dropout_prob)
-                                {
-                                    out1_mask[idx] = 0;
-                                    out0[idx] = 0;
-                                }
-                                else
-                                {
-                                    out1_mask[idx] = 1;
-                                    out0[idx] = input[idx] / static_cast<T>(keep_prob);
-                                }
-                            }
-                        }
+                        });
                     }
                     else
                     {
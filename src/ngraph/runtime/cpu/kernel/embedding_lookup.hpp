@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Row gather for EmbeddingLookup, parallel over the indices. Rows a few
+                ///        lookups ahead are prefetched, since the indices of recommendation
+                ///        models rarely touch neighbouring rows of a large table.
+                template <typename T, typename U>
+                void embedding(void* indices,
+                               void* weights,
+                               void* out,
+                               size_t indices_count,
+                               const Shape& weights_shape,
+                               int arena)
+                {
+                    const U* index = static_cast<const U*>(indices);
+                    const T* table = static_cast<const T*>(weights);
+                    T* output = static_cast<T*>(out);
+                    const size_t row_size = weights_shape.at(1);
+                    const size_t row_bytes = row_size * sizeof(T);
+                    const size_t prefetch_distance = 4;
+
+                    parallel_for(arena,
+                                 indices_count,
+                                 Eigen::TensorOpCost(row_bytes, row_bytes, 0),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         if (i + prefetch_distance < end)
+                                         {
+                                             const char* next = reinterpret_cast<const char*>(
+                                                 table +
+                                                 row_size * static_cast<size_t>(
+                                                                index[i + prefetch_distance]));
+                                             for (size_t b = 0; b < row_bytes; b += 64)
+                                             {
+                                                 __builtin_prefetch(next + b);
+                                             }
+                                         }
+                                         const T* row =
+                                             table + row_size * static_cast<size_t>(index[i]);
+                                         std::memcpy(output + row_size * i, row, row_bytes);
+                                     }
+                                 });
+                }
+            }
+        }
+    }
+}
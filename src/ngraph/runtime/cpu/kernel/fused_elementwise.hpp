@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace fused_elementwise_detail
+                {
+                    // Bytes of tile data the chain keeps live at once; sized to stay in L1
+                    constexpr size_t tile_bytes = 32 * 1024;
+
+                    // Copies elements [start, start + count) of an input that repeats every
+                    // `period` elements into `dst`
+                    template <typename ElementType>
+                    void load_repeated(ElementType* dst,
+                                       const ElementType* src,
+                                       size_t period,
+                                       size_t start,
+                                       size_t count)
+                    {
+                        if (period == 1)
+                        {
+                            std::fill(dst, dst + count, src[0]);
+                            return;
+                        }
+                        size_t offset = start % period;
+                        while (count > 0)
+                        {
+                            size_t chunk = std::min(count, period - offset);
+                            std::memcpy(dst, src + offset, chunk * sizeof(ElementType));
+                            dst += chunk;
+                            count -= chunk;
+                            offset = 0;
+                        }
+                    }
+
+                    template <typename ElementType>
+                    void apply(const op::FusedElementwise::Instruction& instruction,
+                               ElementType* const* registers,
+                               ElementType* dst,
+                               size_t count)
+                    {
+                        using OpCode = op::FusedElementwise::OpCode;
+                        using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                        Eigen::Map<Array> out(dst, count);
+                        Eigen::Map<const Array> a(registers[instruction.arg0], count);
+                        switch (instruction.opcode)
+                        {
+                        case OpCode::Abs: out = a.abs(); break;
+                        case OpCode::Exp: out = a.exp(); break;
+                        case OpCode::Log: out = a.log(); break;
+                        case OpCode::Negative: out = -a; break;
+                        case OpCode::Relu: out = a.max(ElementType(0)); break;
+                        case OpCode::Sigmoid:
+                            out = ElementType(1) / (ElementType(1) + (-a).exp());
+                            break;
+                        case OpCode::Sqrt: out = a.sqrt(); break;
+                        case OpCode::Tanh: out = a.tanh(); break;
+                        default:
+                        {
+                            Eigen::Map<const Array> b(registers[instruction.arg1], count);
+                            switch (instruction.opcode)
+                            {
+                            case OpCode::Add: out = a + b; break;
+                            case OpCode::Divide: out = a / b; break;
+                            case OpCode::Maximum: out = a.max(b); break;
+                            case OpCode::Minimum: out = a.min(b); break;
+                            case OpCode::Multiply: out = a * b; break;
+                            case OpCode::Subtract: out = a - b; break;
+                            default: break;
+                            }
+                        }
+                        }
+                    }
+                }
+
+                /// \brief Evaluates a FusedElementwise program tile by tile.
+                ///
+                /// Every value of the chain lives in a tile-sized scratch buffer, so the
+                /// intermediate results of a tile stay in L1 instead of being written out as full
+                /// tensors. Each instruction is one vectorized pass over the tile.
+                template <typename ElementType>
+                void fused_elementwise(
+                    const std::vector<void*>& inputs,
+                    const std::vector<size_t>& input_sizes,
+                    void* output,
+                    size_t count,
+                    const std::vector<op::FusedElementwise::Instruction>& program)
+                {
+                    using namespace fused_elementwise_detail;
+
+                    const size_t num_inputs = inputs.size();
+                    const size_t num_registers = num_inputs + program.size();
+                    size_t tile = tile_bytes / (sizeof(ElementType) * num_registers);
+                    tile = std::max<size_t>(64, tile - tile % 16);
+                    const size_t num_tiles = (count + tile - 1) / tile;
+                    ElementType* out = static_cast<ElementType*>(output);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+                    {
+                        std::vector<ElementType> scratch(num_registers * tile);
+                        std::vector<ElementType*> registers(num_registers);
+                        // omp requires signed iterator
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                        for (int64_t t = 0; t < static_cast<int64_t>(num_tiles); t++)
+                        {
+                            size_t start = static_cast<size_t>(t) * tile;
+                            size_t length = std::min(tile, count - start);
+                            for (size_t i = 0; i < num_inputs; i++)
+                            {
+                                const ElementType* input =
+                                    static_cast<const ElementType*>(inputs[i]);
+                                if (input_sizes[i] == count)
+                                {
+                                    registers[i] = const_cast<ElementType*>(input) + start;
+                                }
+                                else
+                                {
+                                    registers[i] = scratch.data() + i * tile;
+                                    load_repeated(
+                                        registers[i], input, input_sizes[i], start, length);
+                                }
+                            }
+                            for (size_t i = 0; i < program.size(); i++)
+                            {
+                                size_t r = num_inputs + i;
+                                registers[r] = i + 1 == program.size()
+                                                   ? out + start
+                                                   : scratch.data() + r * tile;
+                                apply(program[i], registers.data(), registers[r], length);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief GatherND, parallel over the index vectors. Each index vector selects a
+                ///        contiguous slice of `params`, copied with a single memcpy.
+                template <typename T, typename U>
+                void gather_nd(void* params,
+                               void* indices,
+                               void* out,
+                               const Shape& params_shape,
+                               const Shape& indices_shape,
+                               int arena)
+                {
+                    const T* in = static_cast<const T*>(params);
+                    const U* index = static_cast<const U*>(indices);
+                    T* output = static_cast<T*>(out);
+
+                    const size_t slice_rank = indices_shape.back();
+                    const size_t leaves = shape_size(indices_shape) / slice_rank;
+                    auto strides = row_major_strides(params_shape);
+                    size_t slice_size = 1;
+                    for (size_t i = slice_rank; i < params_shape.size(); i++)
+                    {
+                        slice_size *= params_shape[i];
+                    }
+
+                    parallel_for(arena,
+                                 leaves,
+                                 Eigen::TensorOpCost(slice_size * sizeof(T),
+                                                     slice_size * sizeof(T),
+                                                     slice_rank * 2.0),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t leaf = begin; leaf < end; leaf++)
+                                     {
+                                         const U* vector = index + leaf * slice_rank;
+                                         size_t offset = 0;
+                                         for (size_t i = 0; i < slice_rank; i++)
+                                         {
+                                             // take care of negative indices
+                                             int64_t position = static_cast<int64_t>(vector[i]);
+                                             if (position < 0)
+                                             {
+                                                 position +=
+                                                     static_cast<int64_t>(params_shape[i]);
+                                             }
+                                             offset += static_cast<size_t>(position) * strides[i];
+                                         }
+                                         std::memcpy(output + leaf * slice_size,
+                                                     in + offset,
+                                                     slice_size * sizeof(T));
+                                     }
+                                 });
+                }
+            }
+        }
+    }
+}
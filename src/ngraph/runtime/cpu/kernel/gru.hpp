@@ -0,0 +1,195 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief GRU over a whole sequence for op::Rnn when the MKLDNN primitive is not
+                ///        used. Tensors follow the MKLDNN rnn_forward layouts of op::Rnn: tnc
+                ///        input, ldsnc states, ldigo weights and ldgo bias, with the gates in
+                ///        update, reset, candidate order and the reset applied before the
+                ///        recurrent projection of the candidate.
+                ///
+                /// For every layer and direction the input projections of all time steps are
+                /// computed by one [T * N, C] x [C, 3 * H] GEMM ahead of the recurrence, which
+                /// leaves two [N, H] GEMMs per time step. Layers after the first take the
+                /// output of the previous layer as input, which requires
+                /// `src_feature_size == direction * hidden_size`.
+                inline void gru_forward(const float* src_layer,
+                                        const float* src_iter,
+                                        const float* weights_layer,
+                                        const float* weights_iter,
+                                        const float* bias,
+                                        float* dst_layer,
+                                        float* dst_iter,
+                                        size_t seq_length,
+                                        size_t batch,
+                                        size_t src_feature_size,
+                                        size_t hidden_size,
+                                        size_t direction,
+                                        size_t layers)
+                {
+                    const size_t gates_size = 3 * hidden_size;
+                    const size_t rows = seq_length * batch;
+                    const size_t dst_feature_size = direction * hidden_size;
+
+                    std::vector<float> gates_layer(rows * gates_size);
+                    std::vector<float> gates_iter(batch * 2 * hidden_size);
+                    std::vector<float> reset_state(batch * hidden_size);
+                    std::vector<float> candidate(batch * hidden_size);
+                    std::vector<float> intermediate[2];
+
+                    const float* layer_input = src_layer;
+                    size_t input_feature_size = src_feature_size;
+                    for (size_t l = 0; l < layers; l++)
+                    {
+                        float* layer_output = dst_layer;
+                        if (l + 1 < layers)
+                        {
+                            intermediate[l % 2].resize(rows * dst_feature_size);
+                            layer_output = intermediate[l % 2].data();
+                        }
+
+                        for (size_t d = 0; d < direction; d++)
+                        {
+                            const size_t ld = l * direction + d;
+                            const float* w_layer =
+                                weights_layer + ld * src_feature_size * gates_size;
+                            const float* w_iter = weights_iter + ld * hidden_size * gates_size;
+                            const float* b = bias + ld * gates_size;
+
+                            cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                               cblas::Transpose::None,
+                                               cblas::Transpose::None,
+                                               rows,
+                                               gates_size,
+                                               input_feature_size,
+                                               1.0f,
+                                               layer_input,
+                                               input_feature_size,
+                                               w_layer,
+                                               gates_size,
+                                               0.0f,
+                                               gates_layer.data(),
+                                               gates_size);
+                            for (size_t r = 0; r < rows; r++)
+                            {
+                                float* g = gates_layer.data() + r * gates_size;
+                                for (size_t j = 0; j < gates_size; j++)
+                                {
+                                    g[j] += b[j];
+                                }
+                            }
+
+                            const float* h_prev = src_iter + ld * batch * hidden_size;
+                            size_t h_prev_stride = hidden_size;
+                            for (size_t s = 0; s < seq_length; s++)
+                            {
+                                const size_t t = d == 0 ? s : seq_length - 1 - s;
+                                const float* g_layer = gates_layer.data() + t * batch * gates_size;
+                                float* h = layer_output + t * batch * dst_feature_size +
+                                           d * hidden_size;
+
+                                // Update and reset gates share one recurrent GEMM
+                                cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                                   cblas::Transpose::None,
+                                                   cblas::Transpose::None,
+                                                   batch,
+                                                   2 * hidden_size,
+                                                   hidden_size,
+                                                   1.0f,
+                                                   h_prev,
+                                                   h_prev_stride,
+                                                   w_iter,
+                                                   gates_size,
+                                                   0.0f,
+                                                   gates_iter.data(),
+                                                   2 * hidden_size);
+                                for (size_t n = 0; n < batch; n++)
+                                {
+                                    const float* gl = g_layer + n * gates_size;
+                                    float* gi = gates_iter.data() + n * 2 * hidden_size;
+                                    const float* hp = h_prev + n * h_prev_stride;
+                                    for (size_t j = 0; j < hidden_size; j++)
+                                    {
+                                        gi[j] = 1.0f / (1.0f + std::exp(-(gl[j] + gi[j])));
+                                        float reset =
+                                            1.0f / (1.0f + std::exp(-(gl[hidden_size + j] +
+                                                                      gi[hidden_size + j])));
+                                        reset_state[n * hidden_size + j] = reset * hp[j];
+                                    }
+                                }
+
+                                cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                                   cblas::Transpose::None,
+                                                   cblas::Transpose::None,
+                                                   batch,
+                                                   hidden_size,
+                                                   hidden_size,
+                                                   1.0f,
+                                                   reset_state.data(),
+                                                   hidden_size,
+                                                   w_iter + 2 * hidden_size,
+                                                   gates_size,
+                                                   0.0f,
+                                                   candidate.data(),
+                                                   hidden_size);
+                                for (size_t n = 0; n < batch; n++)
+                                {
+                                    const float* gl = g_layer + n * gates_size + 2 * hidden_size;
+                                    const float* update = gates_iter.data() + n * 2 * hidden_size;
+                                    const float* hp = h_prev + n * h_prev_stride;
+                                    const float* c = candidate.data() + n * hidden_size;
+                                    float* hn = h + n * dst_feature_size;
+                                    for (size_t j = 0; j < hidden_size; j++)
+                                    {
+                                        float u = update[j];
+                                        hn[j] = u * hp[j] + (1.0f - u) * std::tanh(gl[j] + c[j]);
+                                    }
+                                }
+                                h_prev = h;
+                                h_prev_stride = dst_feature_size;
+                            }
+
+                            float* h_last = dst_iter + ld * batch * hidden_size;
+                            for (size_t n = 0; n < batch; n++)
+                            {
+                                std::copy(h_prev + n * h_prev_stride,
+                                          h_prev + n * h_prev_stride + hidden_size,
+                                          h_last + n * hidden_size);
+                            }
+                        }
+                        layer_input = layer_output;
+                        input_feature_size = dst_feature_size;
+                    }
+                }
+            }
+        }
+    }
+}
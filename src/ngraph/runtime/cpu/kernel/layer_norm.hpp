@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Mean and population variance of `count` adjacent elements in one pass
+                ///        over memory. Blocks small enough to stay in L1 are reduced with two
+                ///        vectorizable loops and merged with Chan's update, which avoids the
+                ///        per-element division of Welford's algorithm.
+                template <typename T>
+                void block_mean_variance(const T* in, size_t count, T& mean, T& variance)
+                {
+                    constexpr size_t block_size = 256;
+                    T m2 = 0;
+                    mean = 0;
+                    for (size_t start = 0; start < count; start += block_size)
+                    {
+                        const size_t n = std::min(block_size, count - start);
+                        const T* block = in + start;
+                        T sum = 0;
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            sum += block[i];
+                        }
+                        const T block_mean = sum / n;
+                        T block_m2 = 0;
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            T d = block[i] - block_mean;
+                            block_m2 += d * d;
+                        }
+                        const T delta = block_mean - mean;
+                        const T total = static_cast<T>(start + n);
+                        mean += delta * n / total;
+                        m2 += block_m2 + delta * delta * start * n / total;
+                    }
+                    variance = count > 0 ? m2 / count : T(0);
+                }
+
+                /// \brief Layer normalization of `groups` groups of `group_size` adjacent
+                ///        elements, parallel over the groups. `scale` and `bias` may be null, as
+                ///        may `mean` and `variance` when the statistics are not needed.
+                template <typename T>
+                void layer_norm(void* input,
+                                void* scale,
+                                void* bias,
+                                void* output,
+                                void* mean,
+                                void* variance,
+                                size_t groups,
+                                size_t group_size,
+                                double epsilon,
+                                int arena)
+                {
+                    const T* in = static_cast<const T*>(input);
+                    const T* gamma = static_cast<const T*>(scale);
+                    const T* beta = static_cast<const T*>(bias);
+                    T* out = static_cast<T*>(output);
+                    T* out_mean = static_cast<T*>(mean);
+                    T* out_variance = static_cast<T*>(variance);
+                    const T eps = static_cast<T>(epsilon);
+
+                    parallel_for(
+                        arena,
+                        groups,
+                        Eigen::TensorOpCost(2 * group_size * sizeof(T),
+                                            group_size * sizeof(T),
+                                            group_size * 6.0),
+                        [&](size_t begin, size_t end) {
+                            for (size_t g = begin; g < end; g++)
+                            {
+                                const T* group_in = in + g * group_size;
+                                T* group_out = out + g * group_size;
+                                T group_mean;
+                                T group_variance;
+                                block_mean_variance(
+                                    group_in, group_size, group_mean, group_variance);
+                                const T inv_stddev = T(1) / std::sqrt(group_variance + eps);
+                                if (gamma)
+                                {
+                                    for (size_t i = 0; i < group_size; i++)
+                                    {
+                                        group_out[i] =
+                                            (group_in[i] - group_mean) * inv_stddev * gamma[i] +
+                                            beta[i];
+                                    }
+                                }
+                                else
+                                {
+                                    for (size_t i = 0; i < group_size; i++)
+                                    {
+                                        group_out[i] = (group_in[i] - group_mean) * inv_stddev;
+                                    }
+                                }
+                                if (out_mean)
+                                {
+                                    out_mean[g] = group_mean;
+                                    out_variance[g] = group_variance;
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
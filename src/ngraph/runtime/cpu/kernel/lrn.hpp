@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief LRN over arbitrary axes, parallel over the output elements. The squares
+                ///        of each window are summed in the same order as reference::lrn.
+                template <typename T>
+                void lrn(void* arg,
+                         void* out,
+                         const Shape& arg_shape,
+                         const AxisSet& axes,
+                         double dalpha,
+                         double dbeta,
+                         double dbias,
+                         size_t size,
+                         int arena)
+                {
+                    const T* in = static_cast<const T*>(arg);
+                    T* output = static_cast<T*>(out);
+                    const T alpha = static_cast<T>(dalpha);
+                    const T beta = static_cast<T>(dbeta);
+                    const T bias = static_cast<T>(dbias);
+                    const T scale = alpha / static_cast<T>(size);
+
+                    const size_t rank = arg_shape.size();
+                    const size_t count = shape_size(arg_shape);
+                    const std::vector<size_t> axes_vec(axes.begin(), axes.end());
+                    const auto strides = row_major_strides(arg_shape);
+                    const size_t half = (size - 1) / 2;
+                    size_t window = 1;
+                    for (auto axis : axes_vec)
+                    {
+                        window *= std::min(arg_shape[axis], 2 * half + 1);
+                    }
+
+                    parallel_for(
+                        arena,
+                        count,
+                        Eigen::TensorOpCost(window * sizeof(T), sizeof(T), window * 2.0 + 20),
+                        [&](size_t begin, size_t end) {
+                            std::vector<size_t> coord(rank);
+                            std::vector<size_t> first(axes_vec.size());
+                            std::vector<size_t> last(axes_vec.size());
+                            std::vector<size_t> sum_coord(axes_vec.size());
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                size_t remainder = i;
+                                for (size_t d = 0; d < rank; d++)
+                                {
+                                    coord[d] = remainder / strides[d];
+                                    remainder %= strides[d];
+                                }
+
+                                // The window starts at offset `base` and visits the axes in
+                                // ascending order, innermost axis fastest.
+                                size_t base = i;
+                                bool empty = false;
+                                for (size_t a = 0; a < axes_vec.size(); a++)
+                                {
+                                    size_t axis = axes_vec[a];
+                                    first[a] = coord[axis] > half ? coord[axis] - half : 0;
+                                    last[a] = std::min(arg_shape[axis], coord[axis] + half + 1);
+                                    base -= (coord[axis] - first[a]) * strides[axis];
+                                    sum_coord[a] = first[a];
+                                    empty = empty || first[a] >= last[a];
+                                }
+
+                                T square_sum = 0;
+                                size_t offset = base;
+                                while (!empty)
+                                {
+                                    square_sum += in[offset] * in[offset];
+                                    size_t a = axes_vec.size();
+                                    for (; a-- > 0;)
+                                    {
+                                        size_t axis = axes_vec[a];
+                                        offset += strides[axis];
+                                        if (++sum_coord[a] < last[a])
+                                        {
+                                            break;
+                                        }
+                                        offset -= (last[a] - first[a]) * strides[axis];
+                                        sum_coord[a] = first[a];
+                                    }
+                                    empty = a == static_cast<size_t>(-1);
+                                }
+
+                                output[i] = in[i] / std::pow(bias + scale * square_sum, beta);
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
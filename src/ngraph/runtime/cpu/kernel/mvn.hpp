@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/runtime/cpu/kernel/layer_norm.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/normalization.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Mean variance normalization over the groups of `split`, parallel over
+                ///        the groups. Statistics take one pass over each group.
+                template <typename T>
+                void mvn(void* input,
+                         void* output,
+                         const AxisSplit& split,
+                         bool normalize_variance,
+                         double eps,
+                         int arena)
+                {
+                    const T* in = static_cast<const T*>(input);
+                    T* out = static_cast<T*>(output);
+                    const size_t inner = split.inner.size();
+                    const size_t* offsets = split.inner.data();
+
+                    parallel_for(
+                        arena,
+                        split.outer.size(),
+                        Eigen::TensorOpCost(
+                            2 * inner * sizeof(T), inner * sizeof(T), inner * 6.0),
+                        [&](size_t begin, size_t end) {
+                            for (size_t g = begin; g < end; g++)
+                            {
+                                const T* group_in = in + split.outer[g];
+                                T* group_out = out + split.outer[g];
+                                T mean;
+                                T variance;
+                                if (split.contiguous)
+                                {
+                                    block_mean_variance(group_in, inner, mean, variance);
+                                }
+                                else
+                                {
+                                    reference::mean_variance(
+                                        group_in,
+                                        inner,
+                                        [offsets](size_t i) { return offsets[i]; },
+                                        mean,
+                                        variance);
+                                }
+                                const T scale = normalize_variance
+                                                    ? T(1) / (std::sqrt(variance) + T(eps))
+                                                    : T(1);
+                                if (split.contiguous)
+                                {
+                                    for (size_t i = 0; i < inner; i++)
+                                    {
+                                        group_out[i] = (group_in[i] - mean) * scale;
+                                    }
+                                }
+                                else
+                                {
+                                    for (size_t i = 0; i < inner; i++)
+                                    {
+                                        group_out[offsets[i]] =
+                                            (group_in[offsets[i]] - mean) * scale;
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
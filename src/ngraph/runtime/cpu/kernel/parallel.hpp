@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/axis_split.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Calls fn(begin, end) over disjoint sub-ranges of [0, count) on the
+                ///        thread pool of `arena`. `cost` is the cost of a single item; Eigen uses
+                ///        it to decide how finely to split the range.
+                template <typename F>
+                void parallel_for(int arena, size_t count, const Eigen::TensorOpCost& cost, F fn)
+                {
+                    if (count == 0)
+                    {
+                        return;
+                    }
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(static_cast<Eigen::Index>(count),
+                                       cost,
+                                       [&fn](Eigen::Index begin, Eigen::Index end) {
+                                           fn(static_cast<size_t>(begin),
+                                              static_cast<size_t>(end));
+                                       });
+                }
+
+                inline size_t get_num_threads(int arena)
+                {
+                    return static_cast<size_t>(
+                        executor::GetCPUExecutor().get_device(arena).numThreads());
+                }
+
+                using reference::axis_offsets;
+                using reference::AxisSplit;
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/random_uniform.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace random_detail
+                {
+                    // Elements per task; a multiple of the elements in a Philox block for every
+                    // fill so tiles never share a block
+                    constexpr size_t tile_elements = 16 * 1024;
+
+                    // Calls fill(begin, end) over [0, count) in parallel. Each element's value
+                    // only depends on its index, so the output is the same for any number of
+                    // threads.
+                    template <typename F>
+                    void parallel_fill(size_t count, F fill)
+                    {
+                        const size_t num_tiles = (count + tile_elements - 1) / tile_elements;
+                        // omp requires signed iterator
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                        for (int64_t t = 0; t < static_cast<int64_t>(num_tiles); t++)
+                        {
+                            size_t begin = static_cast<size_t>(t) * tile_elements;
+                            fill(begin, std::min(begin + tile_elements, count));
+                        }
+                    }
+                }
+
+                template <typename T>
+                void random_uniform(T* out,
+                                    T min_val,
+                                    T max_val,
+                                    size_t count,
+                                    uint64_t key,
+                                    uint64_t counter)
+                {
+                    random_detail::parallel_fill(count, [&](size_t begin, size_t end) {
+                        reference::random_uniform_range(
+                            out, min_val, max_val, begin, end, key, counter);
+                    });
+                }
+
+                template <typename T>
+                void generate_mask(T* out,
+                                   size_t count,
+                                   bool training,
+                                   double prob,
+                                   uint64_t key,
+                                   uint64_t counter)
+                {
+                    random_detail::parallel_fill(count, [&](size_t begin, size_t end) {
+                        reference::generate_mask_range(
+                            out, begin, end, training, prob, key, counter);
+                    });
+                }
+            }
+        }
+    }
+}
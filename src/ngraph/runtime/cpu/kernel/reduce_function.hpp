@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Any (`stop_value` 1) or All (`stop_value` 0) over the groups of
+                ///        `split`. Each group stops at the first element equal to `stop_value`;
+                ///        a full reduction is split across threads that share the early exit.
+                inline void reduce_logical(const char* arg,
+                                           char* out,
+                                           const AxisSplit& split,
+                                           bool stop_value,
+                                           int arena)
+                {
+                    const size_t groups = split.outer.size();
+                    const size_t inner = split.inner.size();
+                    auto scan = [&](size_t group, size_t begin, size_t end) {
+                        const char* base = arg + split.outer[group];
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            if ((base[split.inner[i]] != 0) == stop_value)
+                            {
+                                return true;
+                            }
+                        }
+                        return false;
+                    };
+
+                    if (groups == 1 && inner > 1)
+                    {
+                        const size_t block = 4096;
+                        std::atomic<bool> found(false);
+                        parallel_for(arena,
+                                     (inner + block - 1) / block,
+                                     Eigen::TensorOpCost(block, 0, block),
+                                     [&](size_t begin, size_t end) {
+                                         for (size_t b = begin; b < end && !found.load(); b++)
+                                         {
+                                             size_t last = std::min(inner, (b + 1) * block);
+                                             if (scan(0, b * block, last))
+                                             {
+                                                 found.store(true);
+                                             }
+                                         }
+                                     });
+                        out[0] = found.load() == stop_value;
+                        return;
+                    }
+
+                    parallel_for(arena,
+                                 groups,
+                                 Eigen::TensorOpCost(inner, 1, inner),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t g = begin; g < end; g++)
+                                     {
+                                         out[g] = scan(g, 0, inner) == stop_value;
+                                     }
+                                 });
+                }
+
+                inline void any(void* arg, void* out, const AxisSplit& split, int arena)
+                {
+                    reduce_logical(static_cast<const char*>(arg),
+                                   static_cast<char*>(out),
+                                   split,
+                                   true,
+                                   arena);
+                }
+
+                inline void all(void* arg, void* out, const AxisSplit& split, int arena)
+                {
+                    reduce_logical(static_cast<const char*>(arg),
+                                   static_cast<char*>(out),
+                                   split,
+                                   false,
+                                   arena);
+                }
+            }
+        }
+    }
+}
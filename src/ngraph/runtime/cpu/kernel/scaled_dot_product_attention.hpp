@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief softmax(scale * Q.K^T + mask).V without materializing the score
+                ///        matrix.
+                ///
+                /// Work is split into tiles of `query_block` query rows of one batch entry,
+                /// run in parallel. Each tile walks the keys in blocks of `key_block`, so the
+                /// key and value rows of a block are reused by all rows of the tile while
+                /// they are still in cache. Per row, the softmax is computed online: the
+                /// block's scores are exponentiated relative to the running maximum, and the
+                /// partial sum and output accumulator are rescaled when the maximum grows.
+                /// Scratch memory is `query_block * (key_block + D_v)` elements per thread.
+                template <typename T>
+                void scaled_dot_product_attention(void* query,
+                                                  void* key,
+                                                  void* value,
+                                                  void* mask,
+                                                  void* output,
+                                                  size_t batch,
+                                                  size_t query_length,
+                                                  size_t key_length,
+                                                  size_t depth,
+                                                  size_t value_depth,
+                                                  size_t mask_batch,
+                                                  size_t mask_rows,
+                                                  double scale,
+                                                  int arena)
+                {
+                    constexpr size_t query_block = 32;
+                    constexpr size_t key_block = 128;
+
+                    const T* in_query = static_cast<const T*>(query);
+                    const T* in_key = static_cast<const T*>(key);
+                    const T* in_value = static_cast<const T*>(value);
+                    const T* in_mask = static_cast<const T*>(mask);
+                    T* out = static_cast<T*>(output);
+                    const T alpha = static_cast<T>(scale);
+                    const T neg_inf = -std::numeric_limits<T>::infinity();
+                    const size_t mask_group = in_mask ? batch / mask_batch : 1;
+                    const size_t query_tiles = (query_length + query_block - 1) / query_block;
+
+                    parallel_for(
+                        arena,
+                        batch * query_tiles,
+                        Eigen::TensorOpCost(
+                            (query_block * depth + key_length * (depth + value_depth)) *
+                                sizeof(T),
+                            query_block * value_depth * sizeof(T),
+                            query_block * key_length * (2.0 * depth + 2.0 * value_depth + 4)),
+                        [&](size_t begin, size_t end) {
+                            std::vector<T> scores(query_block * key_block);
+                            std::vector<T> acc(query_block * value_depth);
+                            std::vector<T> row_max(query_block);
+                            std::vector<T> row_sum(query_block);
+                            for (size_t tile = begin; tile < end; tile++)
+                            {
+                                const size_t n = tile / query_tiles;
+                                const size_t first_row = (tile % query_tiles) * query_block;
+                                const size_t rows = std::min(query_block, query_length - first_row);
+                                const T* q = in_query + (n * query_length + first_row) * depth;
+                                const T* k = in_key + n * key_length * depth;
+                                const T* v = in_value + n * key_length * value_depth;
+                                const T* m =
+                                    in_mask ? in_mask + (n / mask_group) * mask_rows * key_length
+                                            : nullptr;
+
+                                std::fill(acc.begin(), acc.end(), T(0));
+                                std::fill(row_max.begin(), row_max.end(), neg_inf);
+                                std::fill(row_sum.begin(), row_sum.end(), T(0));
+                                for (size_t first_key = 0; first_key < key_length;
+                                     first_key += key_block)
+                                {
+                                    const size_t keys = std::min(key_block, key_length - first_key);
+                                    const T* k_block = k + first_key * depth;
+                                    const T* v_block = v + first_key * value_depth;
+                                    for (size_t i = 0; i < rows; i++)
+                                    {
+                                        const T* q_row = q + i * depth;
+                                        T* s_row = scores.data() + i * key_block;
+                                        for (size_t j = 0; j < keys; j++)
+                                        {
+                                            const T* k_row = k_block + j * depth;
+                                            T dot = 0;
+                                            for (size_t d = 0; d < depth; d++)
+                                            {
+                                                dot += q_row[d] * k_row[d];
+                                            }
+                                            s_row[j] = dot * alpha;
+                                        }
+                                        if (m)
+                                        {
+                                            const T* m_row =
+                                                m +
+                                                (mask_rows == 1 ? 0 : first_row + i) * key_length +
+                                                first_key;
+                                            for (size_t j = 0; j < keys; j++)
+                                            {
+                                                s_row[j] += m_row[j];
+                                            }
+                                        }
+
+                                        T block_max = neg_inf;
+                                        for (size_t j = 0; j < keys; j++)
+                                        {
+                                            block_max = std::max(block_max, s_row[j]);
+                                        }
+                                        if (block_max == neg_inf)
+                                        {
+                                            // Every key of the block is masked out
+                                            continue;
+                                        }
+                                        T* acc_row = acc.data() + i * value_depth;
+                                        if (block_max > row_max[i])
+                                        {
+                                            const T correction = std::exp(row_max[i] - block_max);
+                                            row_sum[i] *= correction;
+                                            for (size_t d = 0; d < value_depth; d++)
+                                            {
+                                                acc_row[d] *= correction;
+                                            }
+                                            row_max[i] = block_max;
+                                        }
+                                        T block_sum = 0;
+                                        for (size_t j = 0; j < keys; j++)
+                                        {
+                                            s_row[j] = std::exp(s_row[j] - row_max[i]);
+                                            block_sum += s_row[j];
+                                        }
+                                        row_sum[i] += block_sum;
+                                        for (size_t j = 0; j < keys; j++)
+                                        {
+                                            const T p = s_row[j];
+                                            const T* v_row = v_block + j * value_depth;
+                                            for (size_t d = 0; d < value_depth; d++)
+                                            {
+                                                acc_row[d] += p * v_row[d];
+                                            }
+                                        }
+                                    }
+                                }
+
+                                T* o = out + (n * query_length + first_row) * value_depth;
+                                for (size_t i = 0; i < rows; i++)
+                                {
+                                    for (size_t d = 0; d < value_depth; d++)
+                                    {
+                                        o[i * value_depth + d] =
+                                            acc[i * value_depth + d] / row_sum[i];
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
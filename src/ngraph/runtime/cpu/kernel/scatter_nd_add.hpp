@@ -0,0 +1,158 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief ScatterNDAdd without write conflicts between threads. Wide slices are
+                ///        split by column, so every thread applies all updates to its own
+                ///        columns. Narrow slices are grouped by destination instead and each
+                ///        group is applied by a single thread. Either way every element receives
+                ///        its updates in index order, as in the reference kernel.
+                template <typename T, typename U>
+                void scatter_nd_add(void* inputs,
+                                    void* indices,
+                                    void* updates,
+                                    void* out,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    int arena)
+                {
+                    const T* in = static_cast<const T*>(inputs);
+                    const U* index = static_cast<const U*>(indices);
+                    const T* update = static_cast<const T*>(updates);
+                    T* output = static_cast<T*>(out);
+
+                    const size_t count = shape_size(inputs_shape);
+                    if (in != output)
+                    {
+                        const size_t block = 64 * 1024 / sizeof(T);
+                        parallel_for(arena,
+                                     (count + block - 1) / block,
+                                     Eigen::TensorOpCost(block * sizeof(T), block * sizeof(T), 0),
+                                     [&](size_t begin, size_t end) {
+                                         size_t first = begin * block;
+                                         size_t last = std::min(count, end * block);
+                                         std::memcpy(output + first,
+                                                     in + first,
+                                                     (last - first) * sizeof(T));
+                                     });
+                    }
+
+                    const size_t slice_rank = indices_shape.back();
+                    const size_t leaves = shape_size(indices_shape) / slice_rank;
+                    auto strides = row_major_strides(inputs_shape);
+                    size_t slice_size = 1;
+                    for (size_t i = slice_rank; i < inputs_shape.size(); i++)
+                    {
+                        slice_size *= inputs_shape[i];
+                    }
+                    if (leaves == 0 || slice_size == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<size_t> offsets(leaves);
+                    for (size_t leaf = 0; leaf < leaves; leaf++)
+                    {
+                        size_t offset = 0;
+                        for (size_t i = 0; i < slice_rank; i++)
+                        {
+                            offset +=
+                                static_cast<size_t>(index[leaf * slice_rank + i]) * strides[i];
+                        }
+                        offsets[leaf] = offset;
+                    }
+
+                    const size_t threads = get_num_threads(arena);
+                    if (slice_size >= 16 * threads)
+                    {
+                        parallel_for(arena,
+                                     slice_size,
+                                     Eigen::TensorOpCost(2 * leaves * sizeof(T),
+                                                         leaves * sizeof(T),
+                                                         static_cast<double>(leaves)),
+                                     [&](size_t begin, size_t end) {
+                                         for (size_t leaf = 0; leaf < leaves; leaf++)
+                                         {
+                                             T* dst = output + offsets[leaf];
+                                             const T* src = update + leaf * slice_size;
+                                             for (size_t j = begin; j < end; j++)
+                                             {
+                                                 dst[j] += src[j];
+                                             }
+                                         }
+                                     });
+                        return;
+                    }
+
+                    // Group the leaves by destination; the stable sort keeps duplicate
+                    // destinations in index order.
+                    std::vector<size_t> order(leaves);
+                    std::iota(order.begin(), order.end(), 0);
+                    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                        return offsets[a] < offsets[b];
+                    });
+                    std::vector<size_t> groups;
+                    for (size_t i = 0; i < leaves; i++)
+                    {
+                        if (i == 0 || offsets[order[i]] != offsets[order[i - 1]])
+                        {
+                            groups.push_back(i);
+                        }
+                    }
+                    groups.push_back(leaves);
+
+                    const double average = static_cast<double>(leaves) / (groups.size() - 1);
+                    parallel_for(arena,
+                                 groups.size() - 1,
+                                 Eigen::TensorOpCost(2 * average * slice_size * sizeof(T),
+                                                     average * slice_size * sizeof(T),
+                                                     average * slice_size),
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t g = begin; g < end; g++)
+                                     {
+                                         T* dst = output + offsets[order[groups[g]]];
+                                         for (size_t i = groups[g]; i < groups[g + 1]; i++)
+                                         {
+                                             const T* src = update + order[i] * slice_size;
+                                             for (size_t j = 0; j < slice_size; j++)
+                                             {
+                                                 dst[j] += src[j];
+                                             }
+                                         }
+                                     }
+                                 });
+                }
+            }
+        }
+    }
+}
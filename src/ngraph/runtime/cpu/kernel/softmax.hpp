@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/axis_set.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/normalization.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -32,27 +36,6 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename ElementType, unsigned int Rank>
-                void softmax_all(void* input, void* output, const Shape& input_shape, int arena)
-                {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims;
-                    rdims.fill(1);
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType *>(output), in_dims),
-                        in(static_cast<ElementType *>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum().eval().reshape(rdims).broadcast(in_dims)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum().inverse().eval().reshape(rdims).broadcast(in_dims);
-                }
-
                 template <typename ElementType, unsigned int Rank, unsigned int AxisCount>
                 void softmax(void* input,
                              void* output,
@@ -101,41 +84,6 @@ namespace ngraph
                         out * out.sum(axes).inverse().eval().reshape(rdims).broadcast(bcast);
                 }
 
-                template <typename ElementType, unsigned int Rank>
-                void softmax_innermost_1rd(void* input,
-                                           void* output,
-                                           const Shape& input_shape,
-                                           int arena)
-                {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
-                    Eigen::IndexList<Eigen::type2index<Rank - 1>> axis;
-                    rdims.fill(1);
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
-
-                    for (size_t i = 0; i < Rank - 1; i++)
-                    {
-                        rdims[i] = in_dims[i];
-                    }
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        bcast[i] = in_dims[i] / rdims[i];
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType *>(output), in_dims),
-                        in(static_cast<ElementType *>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum(axis).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum(axis).inverse().eval().reshape(rdims).broadcast(bcast);
-                }
-
                 template <typename ElementType, unsigned int Rank>
                 void softmax_1rd(void* input,
                                  void* output,
@@ -166,13 +114,60 @@ namespace ngraph
                     softmax<ElementType, 4, 3>(input, output, input_shape, softmax_axes, arena);
                 }
 
+                /// \brief Streaming softmax, or log-softmax, over any set of axes, parallel over
+                ///        the groups of elements that are normalized together. Each group is read
+                ///        twice: once for its running maximum and sum, once to write the output.
+                ///        Eigen still schedules the groups; the per-group loops are written out
+                ///        because Eigen tensor reductions cannot rescale the running sum when the
+                ///        maximum changes, so they would need a separate pass for each.
+                template <typename ElementType>
+                void softmax_streaming(
+                    void* input, void* output, const AxisSplit& split, bool log, int arena)
+                {
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    ElementType* out = static_cast<ElementType*>(output);
+                    const size_t inner = split.inner.size();
+                    const size_t* offsets = split.inner.data();
+                    parallel_for(
+                        arena,
+                        split.outer.size(),
+                        Eigen::TensorOpCost(2 * inner * sizeof(ElementType),
+                                            inner * sizeof(ElementType),
+                                            inner * 20.0),
+                        [&](size_t begin, size_t end) {
+                            for (size_t g = begin; g < end; g++)
+                            {
+                                if (split.contiguous)
+                                {
+                                    reference::softmax_group(in + split.outer[g],
+                                                             out + split.outer[g],
+                                                             inner,
+                                                             [](size_t i) { return i; },
+                                                             log);
+                                }
+                                else
+                                {
+                                    reference::softmax_group(
+                                        in + split.outer[g],
+                                        out + split.outer[g],
+                                        inner,
+                                        [offsets](size_t i) { return offsets[i]; },
+                                        log);
+                                }
+                            }
+                        });
+                }
+
+                template <typename ElementType>
+                void softmax_generic(void* input, void* output, const AxisSplit& split, int arena)
+                {
+                    softmax_streaming<ElementType>(input, output, split, false, arena);
+                }
+
                 template <typename ElementType>
-                void ref_softmax(void* input, void* output, const Shape& shape, const AxisSet& axes)
+                void log_softmax(void* input, void* output, const AxisSplit& split, int arena)
                 {
-                    reference::softmax<ElementType>(static_cast<const ElementType*>(input),
-                                                    static_cast<ElementType*>(output),
-                                                    shape,
-                                                    axes);
+                    softmax_streaming<ElementType>(input, output, split, true, arena);
                 }
             }
         }
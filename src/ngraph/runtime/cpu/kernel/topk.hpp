@@ -0,0 +1,226 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "ngraph/op/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace topk_detail
+                {
+                    template <typename T, typename U>
+                    using Entry = std::tuple<T, U>;
+
+                    template <typename T, typename U>
+                    using Compare = bool (*)(const Entry<T, U>&, const Entry<T, U>&);
+
+                    // Keeps the best k entries of `entries` at its front, ordered as `sort`
+                    // asks, and drops the rest.
+                    template <typename T, typename U>
+                    void select(std::vector<Entry<T, U>>& entries,
+                                size_t k,
+                                bool compute_max,
+                                op::TopK::SortType sort)
+                    {
+                        Compare<T, U> better = compute_max ? reference::compare_max<T, U>
+                                                           : reference::compare_min<T, U>;
+                        k = std::min(k, entries.size());
+                        std::nth_element(
+                            entries.begin(), entries.begin() + k, entries.end(), better);
+                        entries.resize(k);
+                        switch (sort)
+                        {
+                        case op::TopK::SortType::NONE: break;
+                        case op::TopK::SortType::SORT_INDICES:
+                            std::sort(entries.begin(),
+                                      entries.end(),
+                                      compute_max ? reference::sort_indices_descending<T, U>
+                                                  : reference::sort_indices_ascending<T, U>);
+                            break;
+                        case op::TopK::SortType::SORT_VALUES:
+                            std::sort(entries.begin(), entries.end(), better);
+                            break;
+                        }
+                    }
+
+                    // Collects the best k of the `count` values data[i * stride], i in
+                    // [begin, end), into `heap`. While fewer than a small fraction of the values
+                    // are kept, a bounded heap whose front is the worst kept entry avoids
+                    // materializing and partitioning the whole row.
+                    template <typename T, typename U>
+                    void collect(const T* data,
+                                 size_t stride,
+                                 size_t begin,
+                                 size_t end,
+                                 size_t k,
+                                 bool compute_max,
+                                 std::vector<Entry<T, U>>& heap)
+                    {
+                        heap.clear();
+                        const size_t count = end - begin;
+                        if (k == 0)
+                        {
+                            return;
+                        }
+                        if (k * 8 > count)
+                        {
+                            heap.reserve(count);
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                heap.emplace_back(data[i * stride], static_cast<U>(i));
+                            }
+                            return;
+                        }
+                        Compare<T, U> better = compute_max ? reference::compare_max<T, U>
+                                                           : reference::compare_min<T, U>;
+                        heap.reserve(k);
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            Entry<T, U> entry(data[i * stride], static_cast<U>(i));
+                            if (heap.size() < k)
+                            {
+                                heap.push_back(entry);
+                                std::push_heap(heap.begin(), heap.end(), better);
+                            }
+                            else if (better(entry, heap.front()))
+                            {
+                                std::pop_heap(heap.begin(), heap.end(), better);
+                                heap.back() = entry;
+                                std::push_heap(heap.begin(), heap.end(), better);
+                            }
+                        }
+                    }
+                }
+
+                /// \brief TopK over `axis`, parallel over the rows along `axis`. Large rows with
+                ///        too few of them to occupy every thread are also split: each part keeps
+                ///        its own best k and the candidates are merged.
+                template <typename T, typename U>
+                void topk(void* arg,
+                          void* out_indices,
+                          void* out_values,
+                          const Shape& in_shape,
+                          const Shape& out_shape,
+                          size_t axis,
+                          bool compute_max,
+                          op::TopK::SortType sort,
+                          int arena)
+                {
+                    using Entry = topk_detail::Entry<T, U>;
+
+                    const T* in = static_cast<const T*>(arg);
+                    U* indices = static_cast<U*>(out_indices);
+                    T* values = static_cast<T*>(out_values);
+
+                    const size_t n = in_shape[axis];
+                    const size_t k = out_shape[axis];
+                    size_t outer = 1;
+                    size_t inner = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= in_shape[i];
+                    }
+                    for (size_t i = axis + 1; i < in_shape.size(); i++)
+                    {
+                        inner *= in_shape[i];
+                    }
+                    const size_t rows = outer * inner;
+
+                    auto write = [&](size_t row, const std::vector<Entry>& entries) {
+                        size_t out_index = (row / inner) * k * inner + row % inner;
+                        for (const Entry& entry : entries)
+                        {
+                            values[out_index] = std::get<0>(entry);
+                            indices[out_index] = std::get<1>(entry);
+                            out_index += inner;
+                        }
+                    };
+
+                    const size_t threads = get_num_threads(arena);
+                    const size_t min_part = 16 * 1024;
+                    const size_t parts =
+                        rows >= threads ? 1 : std::min(threads / rows, n / min_part);
+                    if (parts <= 1)
+                    {
+                        parallel_for(arena,
+                                     rows,
+                                     Eigen::TensorOpCost(n * sizeof(T), k * sizeof(T), n * 4.0),
+                                     [&](size_t begin, size_t end) {
+                                         std::vector<Entry> entries;
+                                         for (size_t row = begin; row < end; row++)
+                                         {
+                                             const T* data =
+                                                 in + (row / inner) * n * inner + row % inner;
+                                             topk_detail::collect<T, U>(
+                                                 data, inner, 0, n, k, compute_max, entries);
+                                             topk_detail::select<T, U>(
+                                                 entries, k, compute_max, sort);
+                                             write(row, entries);
+                                         }
+                                     });
+                        return;
+                    }
+
+                    const size_t part_size = (n + parts - 1) / parts;
+                    for (size_t row = 0; row < rows; row++)
+                    {
+                        const T* data = in + (row / inner) * n * inner + row % inner;
+                        std::vector<std::vector<Entry>> candidates(parts);
+                        parallel_for(arena,
+                                     parts,
+                                     Eigen::TensorOpCost(part_size * sizeof(T),
+                                                         k * sizeof(Entry),
+                                                         part_size * 4.0),
+                                     [&](size_t begin, size_t end) {
+                                         for (size_t p = begin; p < end; p++)
+                                         {
+                                             topk_detail::collect<T, U>(
+                                                 data,
+                                                 inner,
+                                                 p * part_size,
+                                                 std::min(n, (p + 1) * part_size),
+                                                 k,
+                                                 compute_max,
+                                                 candidates[p]);
+                                         }
+                                     });
+                        std::vector<Entry> merged;
+                        for (auto& part : candidates)
+                        {
+                            merged.insert(merged.end(), part.begin(), part.end());
+                        }
+                        topk_detail::select<T, U>(merged, k, compute_max, sort);
+                        write(row, merged);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo runtime::cpu::op::FusedElementwise::type_info;
+
+runtime::cpu::op::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                                     const vector<Instruction>& program,
+                                                     const element::Type& out_type,
+                                                     const Shape& out_shape)
+    : Op(args)
+    , m_program(program)
+    , m_output_type(out_type)
+    , m_output_shape(out_shape)
+{
+    constructor_validate_and_infer_types();
+}
+
+bool runtime::cpu::op::FusedElementwise::is_binary(OpCode opcode)
+{
+    switch (opcode)
+    {
+    case OpCode::Add:
+    case OpCode::Divide:
+    case OpCode::Maximum:
+    case OpCode::Minimum:
+    case OpCode::Multiply:
+    case OpCode::Subtract: return true;
+    case OpCode::Abs:
+    case OpCode::Exp:
+    case OpCode::Log:
+    case OpCode::Negative:
+    case OpCode::Relu:
+    case OpCode::Sigmoid:
+    case OpCode::Sqrt:
+    case OpCode::Tanh: return false;
+    }
+    return false;
+}
+
+void runtime::cpu::op::FusedElementwise::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, !m_program.empty(), "Program must not be empty");
+
+    size_t rank = m_output_shape.size();
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == m_output_type,
+                              "Input ",
+                              i,
+                              " element type must match the output element type");
+        const Shape& input_shape = get_input_shape(i);
+        bool is_trailing = input_shape.size() <= rank &&
+                           equal(input_shape.rbegin(), input_shape.rend(), m_output_shape.rbegin());
+        NODE_VALIDATION_CHECK(this,
+                              is_trailing,
+                              "Input ",
+                              i,
+                              " shape ",
+                              input_shape,
+                              " must be a trailing part of the output shape ",
+                              m_output_shape);
+    }
+
+    for (size_t i = 0; i < m_program.size(); i++)
+    {
+        size_t available = get_input_size() + i;
+        const Instruction& instruction = m_program[i];
+        NODE_VALIDATION_CHECK(this,
+                              instruction.arg0 < available &&
+                                  (!is_binary(instruction.opcode) || instruction.arg1 < available),
+                              "Instruction ",
+                              i,
+                              " refers to a value that is not computed yet");
+    }
+
+    set_output_type(0, m_output_type, m_output_shape);
+}
+
+shared_ptr<Node>
+    runtime::cpu::op::FusedElementwise::copy_with_new_args(const NodeVector& new_args) const
+{
+    return make_shared<FusedElementwise>(
+        as_output_vector(new_args), m_program, m_output_type, m_output_shape);
+}
@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace op
+            {
+                /// \brief A chain of elementwise operations evaluated by a single kernel.
+                ///
+                /// The chain is stored as a straight-line program. Operand indices of an
+                /// instruction refer to the op inputs first and then to the results of earlier
+                /// instructions; the result of the last instruction is the output. An input whose
+                /// shape is a trailing part of the output shape is repeated along the leading
+                /// axes, which covers broadcasts of scalars and biases.
+                class FusedElementwise : public ngraph::op::Op
+                {
+                public:
+                    CPU_BACKEND_API
+                    static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+                    const NodeTypeInfo& get_type_info() const override { return type_info; }
+                    enum class OpCode
+                    {
+                        Abs,
+                        Add,
+                        Divide,
+                        Exp,
+                        Log,
+                        Maximum,
+                        Minimum,
+                        Multiply,
+                        Negative,
+                        Relu,
+                        Sigmoid,
+                        Sqrt,
+                        Subtract,
+                        Tanh
+                    };
+
+                    struct Instruction
+                    {
+                        OpCode opcode;
+                        size_t arg0;
+                        size_t arg1;
+                    };
+
+                    FusedElementwise(const OutputVector& args,
+                                     const std::vector<Instruction>& program,
+                                     const element::Type& out_type,
+                                     const Shape& out_shape);
+
+                    virtual void validate_and_infer_types() override;
+
+                    virtual std::shared_ptr<Node>
+                        copy_with_new_args(const NodeVector& new_args) const override;
+
+                    const std::vector<Instruction>& get_program() const { return m_program; }
+                    /// \return true if the operation of `opcode` takes two operands
+                    static bool is_binary(OpCode opcode);
+
+                private:
+                    std::vector<Instruction> m_program;
+                    element::Type m_output_type;
+                    Shape m_output_shape;
+                };
+            }
+        }
+    }
+}
@@ -676,10 +676,14 @@ namespace ngraph
                     auto weights_layer_rank = node->get_input_shape(3).size();
                     auto weights_iter_rank = node->get_input_shape(4).size();
                     auto bias_rank = node->get_input_shape(5).size();
+                    // The MKLDNN v1 integration builds LSTM primitives only, GRU layers run
+                    // on the native kernel
+                    auto rnn_node = static_cast<const ngraph::op::Rnn*>(node);
                     if ((src_layer_rank == 2 && src_iter_rank == 2 && src_iter_c_rank == 2 &&
                          weights_layer_rank == 2 && weights_iter_rank == 2 && bias_rank == 1 &&
                          node->get_input_element_type(0) == element::f32 &&
-                         node->get_input_element_type(1) == element::f32))
+                         node->get_input_element_type(1) == element::f32 &&
+                         rnn_node->get_rnn_type() == rnn_utils::rnntype::vanilla_lstm))
                     {
                         runtime::cpu::mkldnn_utils::assign_mkldnn_kernel(node);
                     }
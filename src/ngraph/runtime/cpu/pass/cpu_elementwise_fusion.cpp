@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <deque>
+#include <map>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+using FusedElementwise = runtime::cpu::op::FusedElementwise;
+
+static const unordered_map<type_index, FusedElementwise::OpCode>& get_fusible_ops()
+{
+    static const unordered_map<type_index, FusedElementwise::OpCode> fusible_ops{
+        {TI(op::Abs), FusedElementwise::OpCode::Abs},
+        {TI(op::Add), FusedElementwise::OpCode::Add},
+        {TI(op::Divide), FusedElementwise::OpCode::Divide},
+        {TI(op::Exp), FusedElementwise::OpCode::Exp},
+        {TI(op::Log), FusedElementwise::OpCode::Log},
+        {TI(op::Maximum), FusedElementwise::OpCode::Maximum},
+        {TI(op::Minimum), FusedElementwise::OpCode::Minimum},
+        {TI(op::Multiply), FusedElementwise::OpCode::Multiply},
+        {TI(op::Negative), FusedElementwise::OpCode::Negative},
+        {TI(op::Relu), FusedElementwise::OpCode::Relu},
+        {TI(op::Sigmoid), FusedElementwise::OpCode::Sigmoid},
+        {TI(op::Sqrt), FusedElementwise::OpCode::Sqrt},
+        {TI(op::Subtract), FusedElementwise::OpCode::Subtract},
+        {TI(op::Tanh), FusedElementwise::OpCode::Tanh}};
+    return fusible_ops;
+}
+
+static bool is_fusible(const Node& node)
+{
+    if (get_fusible_ops().count(TI(node)) == 0 || node.get_output_size() != 1)
+    {
+        return false;
+    }
+    const element::Type& element_type = node.get_output_element_type(0);
+    if (element_type != element::f32 && element_type != element::f64)
+    {
+        return false;
+    }
+    // Chains that only read constants are left to ConstantFolding
+    bool reads_constants_only = true;
+    for (auto& input : node.inputs())
+    {
+        if (input.get_shape() != node.get_output_shape(0) ||
+            input.get_element_type() != element_type)
+        {
+            return false;
+        }
+        if (!input.get_source_output().get_node()->is_constant())
+        {
+            reads_constants_only = false;
+        }
+    }
+    return !reads_constants_only;
+}
+
+// A broadcast along leading axes repeats its argument with a fixed period, which the fused
+// kernel handles without materializing the broadcast tensor.
+static Output<Node> skip_leading_broadcast(const Output<Node>& value)
+{
+    if (auto broadcast = as_type_ptr<op::Broadcast>(value.get_node_shared_ptr()))
+    {
+        size_t leading =
+            broadcast->get_output_shape(0).size() - broadcast->get_input_shape(0).size();
+        const AxisSet& axes = broadcast->get_broadcast_axes();
+        if (axes.size() == leading && (axes.empty() || *axes.rbegin() < leading))
+        {
+            return broadcast->input_value(0);
+        }
+    }
+    return value;
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    auto ordered_ops = function->get_ordered_ops();
+    unordered_set<Node*> fused;
+
+    for (auto it = ordered_ops.rbegin(); it != ordered_ops.rend(); ++it)
+    {
+        const shared_ptr<Node>& root = *it;
+        if (fused.count(root.get()) || !is_fusible(*root))
+        {
+            continue;
+        }
+
+        // Grow the chain towards the producers. A producer joins once all of its users are in
+        // the chain; producers shared with a not yet visited member are revisited through it.
+        unordered_set<Node*> chain{root.get()};
+        deque<Node*> worklist{root.get()};
+        while (!worklist.empty())
+        {
+            Node* node = worklist.front();
+            worklist.pop_front();
+            for (auto& value : node->input_values())
+            {
+                Node* producer = value.get_node();
+                if (chain.count(producer) || fused.count(producer) || !is_fusible(*producer))
+                {
+                    continue;
+                }
+                bool all_users_in_chain = true;
+                for (auto& user : producer->get_users())
+                {
+                    if (chain.count(user.get()) == 0)
+                    {
+                        all_users_in_chain = false;
+                        break;
+                    }
+                }
+                if (all_users_in_chain)
+                {
+                    chain.insert(producer);
+                    worklist.push_back(producer);
+                }
+            }
+        }
+
+        if (chain.size() < 2)
+        {
+            continue;
+        }
+
+        // Values computed outside of the chain become the inputs of the fused op
+        OutputVector inputs;
+        map<pair<Node*, size_t>, size_t> input_registers;
+        vector<shared_ptr<Node>> members;
+        for (auto& node : ordered_ops)
+        {
+            if (chain.count(node.get()) == 0)
+            {
+                continue;
+            }
+            members.push_back(node);
+            for (auto& value : node->input_values())
+            {
+                if (chain.count(value.get_node()) == 0)
+                {
+                    Output<Node> source = skip_leading_broadcast(value);
+                    auto key = make_pair(value.get_node(), value.get_index());
+                    if (input_registers.count(key) == 0)
+                    {
+                        input_registers[key] = inputs.size();
+                        inputs.push_back(source);
+                    }
+                }
+            }
+        }
+
+        vector<FusedElementwise::Instruction> program;
+        unordered_map<Node*, size_t> registers;
+        for (auto& node : members)
+        {
+            vector<size_t> operands;
+            for (auto& value : node->input_values())
+            {
+                auto reg = registers.find(value.get_node());
+                operands.push_back(reg != registers.end()
+                                       ? reg->second
+                                       : input_registers.at({value.get_node(), value.get_index()}));
+            }
+            FusedElementwise::Instruction instruction{
+                get_fusible_ops().at(TI(*node)), operands.at(0), 0};
+            if (operands.size() > 1)
+            {
+                instruction.arg1 = operands.at(1);
+            }
+            registers[node.get()] = inputs.size() + program.size();
+            program.push_back(instruction);
+        }
+
+        NGRAPH_CHECK(members.back() == root, "Fused elementwise chain must end at its root");
+        auto fused_op = make_shared<FusedElementwise>(
+            inputs, program, root->get_output_element_type(0), root->get_output_shape(0));
+        replace_node(root, fused_op);
+        fused.insert(chain.begin(), chain.end());
+        modified = true;
+    }
+    return modified;
+}
@@ -40,12 +40,15 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/op/fused/batch_mat_mul_transpose.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
@@ -62,6 +65,7 @@
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -2125,6 +2129,335 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
     this->add_matcher(m, callback);
 }
 
+// Matched pieces of a softmax(scale * Q.K^T + mask).V chain, collected walking up from
+// the Softmax towards the Q.K^T product.
+struct AttentionChain
+{
+    std::shared_ptr<ngraph::Node> query;
+    std::shared_ptr<ngraph::Node> key;
+    std::shared_ptr<ngraph::Node> key_transposed;
+    std::shared_ptr<ngraph::Node> mask;
+    double scale = 1.0;
+};
+
+// A Reshape that keeps the element order and the last two dimensions, i.e. one that only
+// regroups the batch dimensions, such as [B * H, S, S] <-> [B, H, S, S].
+static bool is_batch_regroup(const std::shared_ptr<ngraph::Node>& node)
+{
+    auto reshape = ngraph::as_type_ptr<ngraph::op::Reshape>(node);
+    if (!reshape || reshape->get_is_transpose())
+    {
+        return false;
+    }
+    const Shape& in_shape = reshape->get_input_shape(0);
+    const Shape& out_shape = reshape->get_shape();
+    return in_shape.size() >= 2 && out_shape.size() >= 2 &&
+           in_shape[in_shape.size() - 1] == out_shape[out_shape.size() - 1] &&
+           in_shape[in_shape.size() - 2] == out_shape[out_shape.size() - 2];
+}
+
+// A Reshape that swaps the last two dimensions and keeps the others in place.
+static bool is_matrix_transpose(const std::shared_ptr<ngraph::Node>& node)
+{
+    auto reshape = ngraph::as_type_ptr<ngraph::op::Reshape>(node);
+    if (!reshape)
+    {
+        return false;
+    }
+    const AxisVector& order = reshape->get_input_order();
+    const size_t rank = order.size();
+    if (rank < 2 || order[rank - 1] != rank - 2 || order[rank - 2] != rank - 1)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < rank - 2; i++)
+    {
+        if (order[i] != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Value of a Constant, possibly broadcast, whose elements are all equal
+static bool get_uniform_constant(std::shared_ptr<ngraph::Node> node, double& value)
+{
+    if (ngraph::is_type<ngraph::op::Broadcast>(node))
+    {
+        node = node->get_argument(0);
+    }
+    auto constant = ngraph::as_type_ptr<ngraph::op::Constant>(node);
+    if (!constant || shape_size(constant->get_shape()) == 0)
+    {
+        return false;
+    }
+    if (shape_size(constant->get_shape()) > 1 &&
+        !constant->get_all_data_elements_bitwise_identical())
+    {
+        return false;
+    }
+    if (constant->get_element_type() == element::f32)
+    {
+        value = constant->get_vector<float>().at(0);
+    }
+    else if (constant->get_element_type() == element::f64)
+    {
+        value = constant->get_vector<double>().at(0);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// Walks from the input of the Softmax to the Q.K^T product. Reshapes that regroup the
+// batch dimensions may appear anywhere; the mask, if any, must be added after scaling.
+static bool match_attention_scores(const std::shared_ptr<ngraph::Node>& node,
+                                   AttentionChain& chain,
+                                   bool allow_mask,
+                                   bool allow_scale)
+{
+    if (node->get_users().size() > 1)
+    {
+        NGRAPH_DEBUG << "Attention scores " << node->get_name() << " have other users";
+        return false;
+    }
+
+    if (is_batch_regroup(node))
+    {
+        return match_attention_scores(node->get_argument(0), chain, allow_mask, allow_scale);
+    }
+
+    if (allow_mask && ngraph::is_type<ngraph::op::Add>(node))
+    {
+        for (size_t i = 0; i < 2; i++)
+        {
+            if (node->get_argument(1 - i)->get_shape() != node->get_shape())
+            {
+                continue;
+            }
+            AttentionChain candidate = chain;
+            if (match_attention_scores(node->get_argument(i), candidate, false, allow_scale))
+            {
+                chain = candidate;
+                chain.mask = node->get_argument(1 - i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (allow_scale && (ngraph::is_type<ngraph::op::Multiply>(node) ||
+                        ngraph::is_type<ngraph::op::Divide>(node)))
+    {
+        bool divide = ngraph::is_type<ngraph::op::Divide>(node);
+        // x / c only; c / x is not a scaling
+        for (size_t i = 0; i < (divide ? 1 : 2); i++)
+        {
+            double factor;
+            if (!get_uniform_constant(node->get_argument(1 - i), factor) ||
+                (divide && factor == 0))
+            {
+                continue;
+            }
+            AttentionChain candidate = chain;
+            if (match_attention_scores(node->get_argument(i), candidate, false, false))
+            {
+                chain = candidate;
+                chain.scale = divide ? 1.0 / factor : factor;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::shared_ptr<ngraph::Node> key;
+    if (auto bmmt = ngraph::as_type_ptr<ngraph::op::BatchMatMulTranspose>(node))
+    {
+        if (bmmt->get_transpose_arg0())
+        {
+            return false;
+        }
+        chain.query = node->get_argument(0);
+        if (bmmt->get_transpose_arg1())
+        {
+            chain.key = node->get_argument(1);
+            return true;
+        }
+        key = node->get_argument(1);
+    }
+    else if (ngraph::is_type<ngraph::op::BatchMatMul>(node))
+    {
+        chain.query = node->get_argument(0);
+        key = node->get_argument(1);
+    }
+    else
+    {
+        return false;
+    }
+
+    // key is K^T, shape [N, D, S_k]. Look through the transpose that produced it, which may
+    // be done before the heads were folded into the batch dimension.
+    if (is_matrix_transpose(key) && key->get_shape().size() == 3)
+    {
+        chain.key = key->get_argument(0);
+    }
+    else if (is_batch_regroup(key) && is_matrix_transpose(key->get_argument(0)))
+    {
+        const Shape& key_shape = key->get_shape();
+        chain.key = std::make_shared<ngraph::op::Reshape>(
+            key->get_argument(0)->get_argument(0),
+            ngraph::get_default_order(key->get_argument(0)->get_shape()),
+            Shape{key_shape[0], key_shape[2], key_shape[1]});
+    }
+    else
+    {
+        chain.key_transposed = key;
+    }
+    return true;
+}
+
+// Expresses an additive mask of `shape` ([..., S_q, S_k], leading dimensions flattening to
+// the batch N) in the [M, 1 or S_q, S_k] form taken by ScaledDotProductAttention. When the
+// mask is broadcast over the heads and/or query positions, the broadcast is dropped so the
+// full mask is never materialized.
+static std::shared_ptr<ngraph::Node> compact_attention_mask(std::shared_ptr<ngraph::Node> mask)
+{
+    const Shape shape = mask->get_shape();
+    const size_t rank = shape.size();
+    const size_t query_length = shape[rank - 2];
+    const size_t key_length = shape[rank - 1];
+    const size_t batch = shape_size(shape) / (query_length * key_length);
+
+    if (auto broadcast = ngraph::as_type_ptr<ngraph::op::Broadcast>(mask))
+    {
+        const AxisSet& axes = broadcast->get_broadcast_axes();
+        // The batch entries sharing a mask slice must be contiguous, i.e. the broadcast
+        // leading axes must be trailing among the leading axes.
+        size_t kept_leading = 0;
+        while (kept_leading < rank - 2 && axes.count(kept_leading) == 0)
+        {
+            kept_leading++;
+        }
+        bool contiguous = axes.count(rank - 1) == 0;
+        for (size_t i = kept_leading; i < rank - 2; i++)
+        {
+            contiguous = contiguous && axes.count(i) != 0;
+        }
+        if (contiguous)
+        {
+            size_t mask_batch = 1;
+            for (size_t i = 0; i < kept_leading; i++)
+            {
+                mask_batch *= shape[i];
+            }
+            size_t mask_rows = axes.count(rank - 2) ? 1 : query_length;
+            auto source = broadcast->get_argument(0);
+            return std::make_shared<ngraph::op::Reshape>(
+                source,
+                ngraph::get_default_order(source->get_shape()),
+                Shape{mask_batch, mask_rows, key_length});
+        }
+    }
+
+    if (rank == 3)
+    {
+        return mask;
+    }
+    return std::make_shared<ngraph::op::Reshape>(
+        mask, ngraph::get_default_order(shape), Shape{batch, query_length, key_length});
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_scaled_dot_product_attention()
+{
+    auto probabilities = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 4, 4});
+    auto value = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 4, 3});
+    auto bmm = std::make_shared<ngraph::op::BatchMatMul>(probabilities, value);
+    auto bmmt = std::make_shared<ngraph::op::BatchMatMulTranspose>(probabilities, value);
+
+    auto callback = [probabilities, value](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_scaled_dot_product_attention against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto root = m.get_match_root();
+
+        if (!root->get_element_type().is_real())
+        {
+            NGRAPH_DEBUG << "Attention is only fused for floating point types";
+            return false;
+        }
+        if (auto bmmt_m = as_type_ptr<ngraph::op::BatchMatMulTranspose>(root))
+        {
+            if (bmmt_m->get_transpose_arg0() || bmmt_m->get_transpose_arg1())
+            {
+                return false;
+            }
+        }
+
+        // probabilities = softmax over the last axis, possibly regrouped
+        auto node = pattern_map[probabilities];
+        while (is_batch_regroup(node) && node->get_users().size() == 1)
+        {
+            node = node->get_argument(0);
+        }
+        auto softmax = as_type_ptr<ngraph::op::Softmax>(node);
+        if (!softmax || softmax->get_users().size() > 1 || !softmax->are_axes_constant() ||
+            softmax->get_axes() != AxisSet{softmax->get_shape().size() - 1})
+        {
+            NGRAPH_DEBUG << "Probabilities are not a softmax over the keys";
+            return false;
+        }
+
+        AttentionChain chain;
+        if (!match_attention_scores(softmax->get_argument(0), chain, true, true))
+        {
+            return false;
+        }
+
+        const Shape& probabilities_shape = pattern_map[probabilities]->get_shape();
+        const Shape& query_shape = chain.query->get_shape();
+        const Shape& value_shape = pattern_map[value]->get_shape();
+        if (query_shape.size() != 3 || query_shape[0] != probabilities_shape[0] ||
+            query_shape[1] != probabilities_shape[1] ||
+            value_shape[1] != probabilities_shape[2])
+        {
+            NGRAPH_DEBUG << "Attention operand shapes do not line up";
+            return false;
+        }
+        if (chain.key_transposed)
+        {
+            const Shape& shape = chain.key_transposed->get_shape();
+            chain.key = std::make_shared<ngraph::op::Reshape>(
+                chain.key_transposed, AxisVector{0, 2, 1}, Shape{shape[0], shape[2], shape[1]});
+        }
+
+        std::shared_ptr<Node> attention;
+        if (chain.mask)
+        {
+            attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(
+                chain.query,
+                chain.key,
+                pattern_map[value],
+                compact_attention_mask(chain.mask),
+                chain.scale);
+        }
+        else
+        {
+            attention = std::make_shared<ngraph::op::ScaledDotProductAttention>(
+                chain.query, chain.key, pattern_map[value], chain.scale);
+        }
+        ngraph::replace_node(root, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(bmm, "CPUFusion.ScaledDotProductAttention");
+    this->add_matcher(m, callback);
+    auto mt = std::make_shared<pattern::Matcher>(bmmt, "CPUFusion.ScaledDotProductAttention");
+    this->add_matcher(mt, callback);
+}
+
 // QuantizedConvolution + Dequantize + Relu -> QuantizedConvolutionRelu + Dequantize
 void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconv_relu(bool with_bias)
 {
@@ -96,6 +96,7 @@ public:
             }
             construct_dropout();
             construct_batch_norm_infer_relu_with_multiply_add();
+            construct_scaled_dot_product_attention();
 #if MKLDNN_VERSION_MAJOR < 1
             construct_gelubackprop();
 #endif
@@ -131,6 +132,7 @@ private:
     void construct_deconvolution_affine_folding();
     void construct_deconvolution_affine_folding_relu();
     void construct_dropout();
+    void construct_scaled_dot_product_attention();
 #if MKLDNN_VERSION_MAJOR < 1
     void construct_gelubackprop();
 #endif
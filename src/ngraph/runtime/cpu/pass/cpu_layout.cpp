@@ -15,10 +15,12 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <mkldnn.hpp>
 
@@ -287,8 +289,175 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
     }
 }
 
+static bool has_layout_handler(const Node& node);
+
+namespace
+{
+    enum LayoutClass
+    {
+        NATIVE_LAYOUT = 0,
+        MKLDNN_LAYOUT = 1
+    };
+
+    // Cost of a set of reorders, ordered by bytes moved and then by number of reorders
+    struct ReorderCost
+    {
+        size_t count;
+        size_t bytes;
+
+        ReorderCost(size_t c = 0, size_t b = 0)
+            : count(c)
+            , bytes(b)
+        {
+        }
+        ReorderCost operator+(const ReorderCost& other) const
+        {
+            return ReorderCost(count + other.count, bytes + other.bytes);
+        }
+        bool operator<(const ReorderCost& other) const
+        {
+            return bytes < other.bytes || (bytes == other.bytes && count < other.count);
+        }
+    };
+
+    size_t tensor_bytes(const Output<Node>& output)
+    {
+        return shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+
+    // Elementwise ops without a dedicated layout handler run in whatever layout they are given,
+    // so their output layout is a free choice for the global assignment
+    bool is_layout_transparent(const Node& node)
+    {
+        return !has_layout_handler(node) && (node.is_unary_elementwise_arithmetic() ||
+                                             node.is_binary_elementwise_arithmetic());
+    }
+
+    // Ops that reorder any MKLDNN layout on their inputs back to the native one
+    bool requires_native_layout(const Node& node)
+    {
+        if (auto result = dynamic_cast<const ngraph::op::Result*>(&node))
+        {
+            return result->needs_default_layout();
+        }
+        if (is_type<ngraph::op::Reshape>(&node) || is_type<ngraph::op::Slice>(&node) ||
+            is_type<ngraph::op::Concat>(&node) || is_type<ngraph::op::Convert>(&node) ||
+            is_type<ngraph::op::GetOutputElement>(&node))
+        {
+            return false;
+        }
+        if (has_layout_handler(node))
+        {
+            return !mkldnn_utils::use_mkldnn_kernel(&node);
+        }
+        return !is_layout_transparent(node);
+    }
+
+    // Ops running an MKLDNN kernel, which want their inputs in an MKLDNN layout
+    bool uses_mkldnn_layout(const Node& node)
+    {
+        return has_layout_handler(node) && mkldnn_utils::use_mkldnn_kernel(&node);
+    }
+
+    bool is_native_layout(const Output<Node>& output)
+    {
+        auto tv = output.get_tensor_ptr();
+        auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tv->get_tensor_layout().get());
+        if (!cpu_tvl || !cpu_tvl->is_mkldnn_layout())
+        {
+            return true;
+        }
+        auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
+            tv->get_shape(), cpu_tvl->get_strides(), tv->get_element_type());
+        return mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md);
+    }
+
+    // Reorder cost model for the global layout assignment.
+    //
+    // For every layout-transparent node, the cost of the reorders its output will cause
+    // downstream is computed for both layout classes by a backward pass over the graph. A
+    // transparent consumer may either keep the layout it receives or reorder its input to the
+    // native layout, whichever is cheaper, so this is a shortest path over the layout choices of
+    // the elementwise regions between MKLDNN ops and native-only ops.
+    class LayoutCostModel
+    {
+    public:
+        LayoutCostModel(const list<shared_ptr<Node>>& nodes)
+        {
+            for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+            {
+                const shared_ptr<Node>& node = *it;
+                if (!is_layout_transparent(*node))
+                {
+                    continue;
+                }
+                auto& cost = m_downstream_cost[node.get()];
+                Output<Node> output = node->output(0);
+                for (const Input<Node>& input : output.get_target_inputs())
+                {
+                    for (auto layout_class : {NATIVE_LAYOUT, MKLDNN_LAYOUT})
+                    {
+                        cost[layout_class] =
+                            cost[layout_class] +
+                            consumer_cost(*input.get_node(), layout_class, tensor_bytes(output));
+                    }
+                }
+            }
+        }
+
+        // Reorders caused downstream of transparent node `node` if its output has the given
+        // layout class
+        ReorderCost downstream_cost(const Node& node, LayoutClass layout_class) const
+        {
+            auto it = m_downstream_cost.find(&node);
+            return it == m_downstream_cost.end() ? ReorderCost() : it->second[layout_class];
+        }
+
+        // Records the cost of the op-by-op choice and of the chosen layout at a decision point
+        void record_decision(const ReorderCost& local, const ReorderCost& chosen)
+        {
+            m_local_cost = m_local_cost + local;
+            m_chosen_cost = m_chosen_cost + chosen;
+        }
+        const ReorderCost& get_local_cost() const { return m_local_cost; }
+        const ReorderCost& get_chosen_cost() const { return m_chosen_cost; }
+
+    private:
+        ReorderCost consumer_cost(const Node& consumer, LayoutClass layout_class, size_t bytes)
+        {
+            if (is_layout_transparent(consumer))
+            {
+                // A transparent consumer can only stay native once it is fed a native input
+                ReorderCost keep = downstream_cost(consumer, layout_class);
+                if (layout_class == NATIVE_LAYOUT)
+                {
+                    return keep;
+                }
+                ReorderCost reorder =
+                    ReorderCost(1, bytes) + downstream_cost(consumer, NATIVE_LAYOUT);
+                return reorder < keep ? reorder : keep;
+            }
+            if (layout_class == MKLDNN_LAYOUT && requires_native_layout(consumer))
+            {
+                return ReorderCost(1, bytes);
+            }
+            if (layout_class == NATIVE_LAYOUT && uses_mkldnn_layout(consumer))
+            {
+                // insert_input_conversions reorders a native input to the kernel's layout
+                return ReorderCost(1, bytes);
+            }
+            return ReorderCost();
+        }
+
+        unordered_map<const Node*, array<ReorderCost, 2>> m_downstream_cost;
+        ReorderCost m_local_cost;
+        ReorderCost m_chosen_cost;
+    };
+}
+
 static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                                     std::shared_ptr<ngraph::Node> node)
+                                     std::shared_ptr<ngraph::Node> node,
+                                     LayoutCostModel* cost_model = nullptr)
 {
     auto input_md = mkldnn_utils::get_input_mkldnn_md(node.get(), 0);
     // Non MKLDNN kernels can handle MKLDNN layouts as long as there are not padded
@@ -305,6 +474,22 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
 #endif
     if (mkldnn_utils::use_mkldnn_kernel(node.get()) || md_check)
     {
+        Output<Node> input = node->input_value(0);
+        if (cost_model && !is_native_layout(input))
+        {
+            // Reordering the input here instead of at every native consumer of the output
+            // pays off when the output fans out
+            ReorderCost keep = cost_model->downstream_cost(*node, MKLDNN_LAYOUT);
+            ReorderCost reorder = ReorderCost(1, tensor_bytes(input)) +
+                                  cost_model->downstream_cost(*node, NATIVE_LAYOUT);
+            bool use_native = reorder < keep;
+            cost_model->record_decision(keep, use_native ? reorder : keep);
+            if (use_native)
+            {
+                set_native_layouts(external_function, node);
+                return;
+            }
+        }
         vector<memory::desc> o_mds;
         o_mds.push_back(input_md);
         set_output_layouts(node, o_mds);
@@ -316,7 +501,8 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
 }
 
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+                               std::shared_ptr<ngraph::Node> node,
+                               LayoutCostModel* cost_model = nullptr)
 {
     std::vector<mkldnn::memory::desc> arg_mds{mkldnn_utils::get_input_mkldnn_md(node.get(), 0),
                                               mkldnn_utils::get_input_mkldnn_md(node.get(), 1)};
@@ -349,6 +535,46 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
             const int user_select = std::atoi(ngraph_pass_cpu_layout_eltwise);
             select = (user_select == 0 || user_select == 1) ? user_select : select;
         }
+        if (cost_model)
+        {
+            // Candidates are either argument's layout or the native one. Each costs the
+            // reorders of the arguments that do not already match it plus what it causes
+            // downstream.
+            auto input_cost = [&](size_t index, bool matches) {
+                return matches ? ReorderCost()
+                               : ReorderCost(1, tensor_bytes(node->input_value(index)));
+            };
+            array<ReorderCost, 3> costs;
+            for (size_t candidate = 0; candidate < 2; candidate++)
+            {
+                const memory::desc& md = arg_mds[candidate];
+                bool native = is_native_layout(node->input_value(candidate));
+                costs[candidate] =
+                    input_cost(0, mkldnn_utils::compare_mkldnn_mds(arg_mds[0], md)) +
+                    input_cost(1, mkldnn_utils::compare_mkldnn_mds(arg_mds[1], md)) +
+                    cost_model->downstream_cost(*node, native ? NATIVE_LAYOUT : MKLDNN_LAYOUT);
+            }
+            costs[2] = input_cost(0, is_native_layout(node->input_value(0))) +
+                       input_cost(1, is_native_layout(node->input_value(1))) +
+                       cost_model->downstream_cost(*node, NATIVE_LAYOUT);
+
+            // Ties keep the op-by-op choice
+            size_t best = select;
+            for (size_t candidate = 0; candidate < costs.size(); candidate++)
+            {
+                if (costs[candidate] < costs[best])
+                {
+                    best = candidate;
+                }
+            }
+            cost_model->record_decision(costs[select], costs[best]);
+            if (best == 2)
+            {
+                set_native_layouts(external_function, node);
+                return;
+            }
+            select = static_cast<int>(best);
+        }
         i_mds.push_back(arg_mds[select]);
         i_mds.push_back(arg_mds[select]);
         o_mds.push_back(arg_mds[select]);
@@ -2541,6 +2767,11 @@ namespace ngraph
                         // a case to insert convert Op's if the format doesn't matches.
                         set_native_layouts(external_function, node, false);
                     }
+                    else if (static_cast<const ngraph::op::Rnn*>(node.get())->get_rnn_type() ==
+                             rnn_utils::rnntype::vanilla_gru)
+                    {
+                        set_native_layouts(external_function, node);
+                    }
                     else
                     {
                         throw ngraph_error("RNN fused op is only supported in MKLDNN for now.");
@@ -2690,8 +2921,42 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedMatmul>},
 };
 
+static bool has_layout_handler(const Node& node)
+{
+    return s_dispatcher.find(TI(node)) != s_dispatcher.end();
+}
+
+// Returns value + added - removed. The model's estimates need not bound the reorders actually
+// counted, so the difference is taken in signed arithmetic and clamped at zero.
+static size_t apply_delta(size_t value, size_t added, size_t removed)
+{
+    int64_t result = static_cast<int64_t>(value) + static_cast<int64_t>(added) -
+                     static_cast<int64_t>(removed);
+    return result > 0 ? static_cast<size_t>(result) : 0;
+}
+
+static runtime::cpu::pass::ReorderStats count_reorders(const Function& function)
+{
+    runtime::cpu::pass::ReorderStats stats;
+    for (auto& node : function.get_ops())
+    {
+        if (is_type<runtime::cpu::op::ConvertLayout>(node))
+        {
+            stats.count++;
+            stats.bytes += tensor_bytes(node->output(0));
+        }
+    }
+    return stats;
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    unique_ptr<LayoutCostModel> cost_model;
+    if (m_global_assignment || std::getenv("NGRAPH_PASS_CPU_LAYOUT_GLOBAL") != nullptr)
+    {
+        cost_model.reset(new LayoutCostModel(nodes));
+    }
+
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2702,11 +2967,11 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         }
         else if (node->is_unary_elementwise_arithmetic())
         {
-            set_layouts_unaryeltwise(m_external_function, node);
+            set_layouts_unaryeltwise(m_external_function, node, cost_model.get());
         }
         else if (node->is_binary_elementwise_arithmetic())
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(m_external_function, node, cost_model.get());
         }
         else
         {
@@ -2714,5 +2979,28 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         }
     }
 
+    m_reorder_stats = count_reorders(*m_external_function->get_function());
+    if (cost_model)
+    {
+        // Not a count: the reorders on the graph, adjusted by the model's estimate of what the
+        // op-by-op choices would have added at each decision point
+        const ReorderCost& local = cost_model->get_local_cost();
+        const ReorderCost& chosen = cost_model->get_chosen_cost();
+        m_estimated_local_reorder_stats.count =
+            apply_delta(m_reorder_stats.count, local.count, chosen.count);
+        m_estimated_local_reorder_stats.bytes =
+            apply_delta(m_reorder_stats.bytes, local.bytes, chosen.bytes);
+        NGRAPH_DEBUG << "CPULayout: global assignment, " << m_reorder_stats.count
+                     << " reorders (" << m_reorder_stats.bytes << " bytes); op-by-op selection "
+                     << "estimated at " << m_estimated_local_reorder_stats.count << " reorders ("
+                     << m_estimated_local_reorder_stats.bytes << " bytes)";
+    }
+    else
+    {
+        NGRAPH_DEBUG << "CPULayout: " << m_reorder_stats.count << " reorders ("
+                     << m_reorder_stats.bytes << " bytes)";
+    }
+    m_external_function->set_reorder_stats(m_reorder_stats, m_estimated_local_reorder_stats);
+
     return false;
 }
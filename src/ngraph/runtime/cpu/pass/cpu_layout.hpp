@@ -36,11 +36,23 @@ namespace ngraph
 
                 using LayoutOpMap = std::unordered_map<std::type_index, LayoutFunction>;
 
+                using ReorderStats = runtime::cpu::ReorderStats;
+
+                /// \brief Assigns tensor layouts and inserts the ConvertLayout reorders needed
+                ///        wherever a producer and a consumer disagree.
+                ///
+                /// By default layouts are picked op by op. In global mode (enabled with
+                /// `global_assignment` or NGRAPH_PASS_CPU_LAYOUT_GLOBAL) a reorder cost model is
+                /// solved backwards over the graph first, and elementwise ops, which can run
+                /// in either their inputs' MKLDNN layout or the native one, pick the layout that
+                /// minimizes the bytes reordered downstream rather than inheriting their input's.
                 class CPULayout : public ngraph::pass::CallGraphPass
                 {
                 public:
-                    CPULayout(CPU_ExternalFunction* external_function)
+                    CPULayout(CPU_ExternalFunction* external_function,
+                              bool global_assignment = false)
                         : m_external_function(external_function)
+                        , m_global_assignment(global_assignment)
                     {
                     }
                     virtual bool
@@ -51,8 +63,20 @@ namespace ngraph
                         layout(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
                                std::shared_ptr<ngraph::Node> node);
 
+                    /// \brief Model estimate, not a count, of the reorders op-by-op layout
+                    ///        selection would have left. Only set in global mode.
+                    const ReorderStats& get_estimated_local_reorder_stats() const
+                    {
+                        return m_estimated_local_reorder_stats;
+                    }
+                    /// \brief ConvertLayout reorders counted on the graph once the pass has run
+                    const ReorderStats& get_reorder_stats() const { return m_reorder_stats; }
+
                 private:
                     CPU_ExternalFunction* m_external_function;
+                    bool m_global_assignment;
+                    ReorderStats m_estimated_local_reorder_stats;
+                    ReorderStats m_reorder_stats;
                 };
             }
         }
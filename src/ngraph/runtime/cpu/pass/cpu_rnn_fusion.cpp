@@ -32,6 +32,7 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/fused/gru_cell.hpp"
 #include "ngraph/op/fused/lstm_cell.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/multiply.hpp"
@@ -945,6 +946,165 @@ void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_lstm_fprop()
     this->add_matcher(m, callback);
 }
 
+bool ngraph::runtime::cpu::pass::GRUFusion::is_fusable_cell(const Node& node)
+{
+    auto gru_cell = as_type<const ngraph::op::GRUCell>(&node);
+    if (!gru_cell || gru_cell->get_output_partial_shape(0).is_dynamic())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < gru_cell->get_input_size(); i++)
+    {
+        if (gru_cell->get_input_element_type(i) != element::f32)
+        {
+            return false;
+        }
+    }
+    // MKLDNN vanilla_gru applies the reset gate before the recurrent projection of the candidate
+    // gate and uses the default activations without clipping
+    return !gru_cell->get_linear_before_reset() && gru_cell->get_clip() == 0.f &&
+           gru_cell->get_activations() == std::vector<std::string>{"sigmoid", "tanh"};
+}
+
+void ngraph::runtime::cpu::pass::GRUFusion::construct_gru_fprop()
+{
+    // Captures the GRU cells of one layer, the hidden state of each cell being the recurrent
+    // input of the next one. Weights and bias are shared across the timesteps.
+    const size_t ref_batch_size = 2;
+    const size_t ref_input_size = 3;
+    const size_t ref_hidden_size = 3;
+    const size_t ref_gates_count = 3;
+
+    auto X =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_input_size});
+    auto W = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{ref_gates_count * ref_hidden_size, ref_input_size});
+    auto R = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{ref_gates_count * ref_hidden_size, ref_hidden_size});
+    auto H_t =
+        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_hidden_size});
+    auto B = std::make_shared<pattern::op::Label>(element::f32,
+                                                  Shape{2 * ref_gates_count * ref_hidden_size});
+    auto ref_gru_cell = std::make_shared<op::GRUCell>(X, W, R, H_t, ref_hidden_size, B);
+
+    auto callback = [X, H_t](pattern::RecurrentMatcher& m) {
+        NGRAPH_DEBUG << " In recurrent GRU fusion callback";
+
+        const auto sequence_len = m.get_number_of_recurrent_matches();
+        auto gru_root = m.get_match_root();
+
+        // The recurrent label binds the previous cell of every matched cell, and the initial
+        // hidden state for the first one. Cells are captured in the reverse order.
+        auto hidden_states = m.get_bound_nodes_for_pattern(H_t);
+        NodeVector gru_cells{gru_root};
+        gru_cells.insert(gru_cells.end(), hidden_states.begin(), hidden_states.end() - 1);
+        std::reverse(gru_cells.begin(), gru_cells.end());
+
+        for (auto& gru_cell : gru_cells)
+        {
+            if (!is_fusable_cell(*gru_cell))
+            {
+                NGRAPH_DEBUG << "GRUCell " << gru_cell->get_name() << " can't be mapped to Rnn";
+                return false;
+            }
+        }
+
+        // Only fuse once the matcher starts from the last timestep of the layer, a later cell
+        // sharing the weights will capture this chain
+        for (auto& user : gru_root->get_users())
+        {
+            if (is_type<ngraph::op::GRUCell>(user) && user->get_argument(3) == gru_root &&
+                user->get_argument(1) == gru_root->get_argument(1) &&
+                user->get_argument(2) == gru_root->get_argument(2) &&
+                user->get_argument(4) == gru_root->get_argument(4) && is_fusable_cell(*user))
+            {
+                NGRAPH_DEBUG << "GRUCell " << gru_root->get_name() << " is not the last timestep";
+                return false;
+            }
+        }
+
+        std::shared_ptr<Node> rnn_src_layer = gru_cells[0]->get_argument(0);
+        if (sequence_len > 1)
+        {
+            auto src_layers = m.get_bound_nodes_for_pattern(X);
+            std::reverse(src_layers.begin(), src_layers.end());
+            rnn_src_layer = std::make_shared<ngraph::op::Concat>(src_layers, 0);
+        }
+        auto rnn_src_iter = hidden_states[sequence_len - 1];
+
+        auto W_zrh = gru_root->get_argument(1);
+        auto R_zrh = gru_root->get_argument(2);
+        auto B_zrh = gru_root->get_argument(4);
+        const size_t gru_n_gates = 3;
+        const size_t batch_size = gru_root->get_shape()[0];
+        const size_t hidden_size = gru_root->get_shape()[1];
+        const size_t gates_size = gru_n_gates * hidden_size;
+        const size_t num_cell_states = 1;
+        const size_t direction = 1;
+        const size_t num_fused_rnn_layers = 1;
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
+            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+
+        // GRUCell gates are ordered update, reset, hidden, the same as the MKLDNN GRU gates.
+        // The weights are transposed to the ldigo layout. Without linear_before_reset the
+        // input and recurrent biases of a gate are always added together.
+        auto rnn_weights_layer = std::make_shared<ngraph::op::Reshape>(
+            W_zrh, AxisVector{1, 0}, Shape{W_zrh->get_shape()[1], gates_size});
+        auto rnn_weights_iter = std::make_shared<ngraph::op::Reshape>(
+            R_zrh, AxisVector{1, 0}, Shape{hidden_size, gates_size});
+        auto rnn_bias = std::make_shared<ngraph::op::Add>(
+            std::make_shared<ngraph::op::Slice>(B_zrh, Coordinate{0}, Coordinate{gates_size}),
+            std::make_shared<ngraph::op::Slice>(
+                B_zrh, Coordinate{gates_size}, Coordinate{2 * gates_size}));
+
+        NGRAPH_DEBUG << "src_layer: " << join(rnn_src_layer->get_shape());
+        NGRAPH_DEBUG << "src_iter: " << join(rnn_src_iter->get_shape());
+        NGRAPH_DEBUG << "weights_layer: " << join(rnn_weights_layer->get_shape());
+        NGRAPH_DEBUG << "weights_iter: " << join(rnn_weights_iter->get_shape());
+        NGRAPH_DEBUG << "bias: " << join(rnn_bias->get_shape());
+        NGRAPH_DEBUG << "src_seq_len: " << sequence_len;
+        NGRAPH_DEBUG << "batch_size: " << batch_size;
+
+        auto rnn = std::make_shared<ngraph::op::Rnn>(rnn_src_layer,
+                                                     rnn_src_iter,
+#if MKLDNN_VERSION_MAJOR >= 1
+                                                     // GRU has no cell state
+                                                     rnn_src_iter,
+#endif
+                                                     rnn_weights_layer,
+                                                     rnn_weights_iter,
+                                                     rnn_bias,
+                                                     sequence_len,
+                                                     gru_n_gates,
+                                                     sequence_len,
+                                                     num_cell_states,
+                                                     direction,
+                                                     num_fused_rnn_layers,
+                                                     rnn_type);
+
+        // dst_layer holds the hidden state of every timestep, each GRUCell is replaced with its
+        // slice. Consumers of the last hidden state also use dst_layer, which keeps the
+        // layer outputs contiguous for MultiLayerRNNFusion.
+        auto rnn_ht_goe = std::make_shared<ngraph::op::GetOutputElement>(rnn, 0);
+        for (size_t i = 0, start_index = 0; i < sequence_len; i++, start_index += batch_size)
+        {
+            auto ht_slice = std::make_shared<ngraph::op::Slice>(
+                rnn_ht_goe,
+                Coordinate{start_index, 0},
+                Coordinate{start_index + batch_size, hidden_size});
+            ngraph::replace_node(gru_cells[i], ht_slice);
+        }
+
+        NGRAPH_DEBUG << "End of recurrent GRU fusion call back "
+                     << "matched_node: " << gru_root->get_name();
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::RecurrentMatcher>(
+        ref_gru_cell, H_t, std::set<std::shared_ptr<pattern::op::Label>>{W, R, B});
+    this->add_matcher(m, callback);
+}
+
 static std::shared_ptr<Node> stack_rnn_inputs(NodeVector rnn_input_nodes)
 {
     std::reverse(rnn_input_nodes.begin(), rnn_input_nodes.end());
@@ -1046,7 +1206,8 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
                 (rnn_node->get_src_sequence_length() != sequence_len) ||
                 (rnn_node->get_src_iter_feature_size() != src_iter_feature_size) ||
                 (rnn_node->get_num_cell_states() != num_rnn_cell_states) ||
-                (rnn_node->get_direction() != rnn_direction))
+                (rnn_node->get_direction() != rnn_direction) ||
+                (rnn_node->get_rnn_type() != rnn_type))
             {
                 NGRAPH_DEBUG << "RNN attributes dont match";
                 return false;
@@ -1118,10 +1279,10 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
             // multi layerd fused rnn second output {GOE1} holds the recurrent output state tensors
             // for the last cell of all the layers, {{ht_1 | ct_1} || {ht2 |ct2} || ....{htn | ctn}}
             // we will slice the cell state output tensor {ct_*} from the fused RNN kerenel output
-            // and feeds {ct_*} consumer if any
+            // and feeds {ct_*} consumer if any. The last state of a layer is {ht} for GRU.
             auto ct_slice = std::make_shared<ngraph::op::Slice>(
                 mrnn_ht_ct,
-                Coordinate{((layer - 1) * batch_size * num_rnn_cell_states) + batch_size, 0},
+                Coordinate{(layer * num_rnn_cell_states - 1) * batch_size, 0},
                 Coordinate{layer * batch_size * num_rnn_cell_states, src_iter_feature_size});
 
             replace_collapse_node_user(rnn_ct_goe1, ct_slice->output(0));
@@ -1280,6 +1441,12 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
             return false;
         }
 
+        if (rnn_ltor_node->get_rnn_type() != rnn_rtol_node->get_rnn_type())
+        {
+            NGRAPH_DEBUG << " Not fusing, rnn's in both direction should have the same cell type";
+            return false;
+        }
+
         if (rnn_ltor_node->get_batch_size() != rnn_rtol_node->get_batch_size())
         {
             NGRAPH_DEBUG << " Not fusing, feature_size of rnn's in both direction should match";
@@ -1298,8 +1465,7 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
         size_t num_rnn_cell_states = rnn_ltor_node->get_num_cell_states();
         size_t rnn_direction = 2;
         size_t num_fused_rnn_layers = 1;
-        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
-            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type = rnn_ltor_node->get_rnn_type();
 
         auto construct_birnn_inputs = [&](int index) {
             auto nodes =
@@ -30,6 +30,7 @@ namespace ngraph
             {
                 class LSTMFusion;
                 class RNNFusion;
+                class GRUFusion;
                 class BiDirectionalRnn;
                 class MultiLayerRNNFusion;
             }
@@ -68,6 +69,26 @@ private:
     void construct_rnn_lstm_fprop();
 };
 
+// Captures chains of GRUCell across the timesteps of a layer and replaces each chain with a
+// single Rnn op of type vanilla_gru. Single cells become an Rnn with one timestep.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::GRUFusion
+    : public ngraph::pass::RecurrentGraphRewrite
+{
+public:
+    GRUFusion()
+        : RecurrentGraphRewrite()
+    {
+        construct_gru_fprop();
+    }
+
+    // Returns true for GRUCells this pass maps to Rnn, which must therefore be kept away from
+    // FusedOpDecomposition.
+    static bool is_fusable_cell(const ngraph::Node& node);
+
+private:
+    void construct_gru_fprop();
+};
+
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::MultiLayerRNNFusion
     : public ngraph::pass::RecurrentGraphRewrite
 {
@@ -0,0 +1,328 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/dynamic/batching_executable.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/specialize_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+double runtime::dynamic::BatchingExecutable::Metrics::get_batch_fill(size_t max_batch_size) const
+{
+    if (batch_count == 0 || max_batch_size == 0)
+    {
+        return 0;
+    }
+    return static_cast<double>(sample_count) / (batch_count * max_batch_size);
+}
+
+chrono::microseconds runtime::dynamic::BatchingExecutable::Metrics::get_average_queue_time() const
+{
+    if (request_count == 0)
+    {
+        return chrono::microseconds{0};
+    }
+    return total_queue_time / request_count;
+}
+
+runtime::dynamic::BatchingExecutable::BatchingExecutable(shared_ptr<Function> function,
+                                                         shared_ptr<runtime::Backend> backend,
+                                                         size_t max_batch_size,
+                                                         chrono::microseconds max_queue_delay,
+                                                         bool enable_performance_collection)
+    : m_function(function)
+    , m_backend(backend)
+    , m_max_batch_size(max_batch_size)
+    , m_max_queue_delay(max_queue_delay)
+    , m_enable_performance_collection(enable_performance_collection)
+{
+    NGRAPH_CHECK(m_max_batch_size > 0, "Maximum batch size must be positive");
+    for (auto& parameter : m_function->get_parameters())
+    {
+        const PartialShape& shape = parameter->get_partial_shape();
+        NGRAPH_CHECK(shape.rank().is_static() && static_cast<size_t>(shape.rank()) > 0,
+                     "Parameter ",
+                     parameter->get_name(),
+                     " has no batch dimension");
+        NGRAPH_CHECK(parameter->get_element_type().is_static(),
+                     "Parameter ",
+                     parameter->get_name(),
+                     " has a dynamic element type");
+    }
+    set_parameters_and_results(*m_function);
+    m_thread = thread(&BatchingExecutable::run, this);
+}
+
+runtime::dynamic::BatchingExecutable::~BatchingExecutable()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_queue_changed.notify_all();
+    m_thread.join();
+}
+
+bool runtime::dynamic::BatchingExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Expected ",
+                 get_parameters().size(),
+                 " inputs, got ",
+                 inputs.size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Expected ",
+                 get_results().size(),
+                 " outputs, got ",
+                 outputs.size());
+
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        NGRAPH_CHECK(inputs[i]->get_shape().size() > 0,
+                     "Input ",
+                     i,
+                     " of a request has no batch dimension");
+    }
+    size_t batch_size = inputs.empty() ? 1 : inputs[0]->get_shape()[0];
+    for (auto& input : inputs)
+    {
+        NGRAPH_CHECK(input->get_shape()[0] == batch_size,
+                     "All inputs of a request must have the same batch size");
+    }
+    NGRAPH_CHECK(batch_size > 0 && batch_size <= m_max_batch_size,
+                 "Request batch size ",
+                 batch_size,
+                 " is outside of [1, ",
+                 m_max_batch_size,
+                 "]");
+
+    auto request = make_shared<Request>();
+    request->outputs = outputs;
+    request->inputs = inputs;
+    request->batch_size = batch_size;
+    request->enqueue_time = chrono::steady_clock::now();
+    future<void> done = request->done.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(request);
+        m_queued_samples += batch_size;
+    }
+    m_queue_changed.notify_all();
+
+    // Rethrows any error raised while compiling or executing the batch
+    done.get();
+    return true;
+}
+
+runtime::dynamic::BatchingExecutable::Metrics
+    runtime::dynamic::BatchingExecutable::get_metrics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    Metrics metrics = m_metrics;
+    metrics.queued_requests = m_queue.size();
+    return metrics;
+}
+
+void runtime::dynamic::BatchingExecutable::run()
+{
+    while (true)
+    {
+        vector<shared_ptr<Request>> requests;
+        size_t batch_size = 0;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_queue_changed.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                return;
+            }
+
+            // Wait for a full batch, but keep the oldest request no longer than the maximum
+            // queue delay
+            auto deadline = m_queue.front()->enqueue_time + m_max_queue_delay;
+            m_queue_changed.wait_until(lock, deadline, [this] {
+                return m_stop || m_queued_samples >= m_max_batch_size;
+            });
+
+            auto now = chrono::steady_clock::now();
+            while (!m_queue.empty() && batch_size + m_queue.front()->batch_size <= m_max_batch_size)
+            {
+                shared_ptr<Request> request = m_queue.front();
+                m_queue.pop_front();
+                m_queued_samples -= request->batch_size;
+                batch_size += request->batch_size;
+                requests.push_back(request);
+
+                auto queue_time =
+                    chrono::duration_cast<chrono::microseconds>(now - request->enqueue_time);
+                m_metrics.total_queue_time += queue_time;
+                m_metrics.max_queue_time = max(m_metrics.max_queue_time, queue_time);
+            }
+            m_metrics.request_count += requests.size();
+            m_metrics.sample_count += batch_size;
+            m_metrics.batch_count++;
+        }
+
+        exception_ptr error;
+        try
+        {
+            execute_batch(requests, batch_size);
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        for (auto& request : requests)
+        {
+            if (error)
+            {
+                request->done.set_exception(error);
+            }
+            else
+            {
+                request->done.set_value();
+            }
+        }
+    }
+}
+
+runtime::dynamic::BatchingExecutable::BatchExecutable&
+    runtime::dynamic::BatchingExecutable::get_batch_executable(size_t batch_size)
+{
+    auto it = m_batch_executables.find(batch_size);
+    if (it != m_batch_executables.end())
+    {
+        return it->second;
+    }
+
+    vector<element::Type> element_types;
+    vector<PartialShape> shapes;
+    for (auto& parameter : m_function->get_parameters())
+    {
+        PartialShape shape = parameter->get_partial_shape();
+        shape[0] = batch_size;
+        NGRAPH_CHECK(shape.is_static(),
+                     "Parameter ",
+                     parameter->get_name(),
+                     " may only have a dynamic batch dimension");
+        element_types.push_back(parameter->get_element_type());
+        shapes.push_back(shape);
+    }
+    auto specialized = specialize_function(
+        m_function, element_types, shapes, vector<void*>(shapes.size(), nullptr));
+
+    BatchExecutable batch;
+    batch.executable = m_backend->compile(specialized, m_enable_performance_collection);
+    bool attach = m_backend->is_supported_property(runtime::Backend::Property::memory_attach);
+    auto create_tensor = [&](const Output<Node>& output, vector<AlignedBuffer>& buffers) {
+        const element::Type& type = output.get_element_type();
+        const Shape& shape = output.get_shape();
+        if (!attach)
+        {
+            return m_backend->create_tensor(type, shape);
+        }
+        buffers.emplace_back(output.get_tensor().size(), 64);
+        return m_backend->create_tensor(type, shape, buffers.back().get_ptr());
+    };
+    for (auto& parameter : specialized->get_parameters())
+    {
+        batch.inputs.push_back(create_tensor(parameter->output(0), batch.input_buffers));
+    }
+    for (auto& result : specialized->get_results())
+    {
+        NGRAPH_CHECK(result->get_shape().size() > 0 && result->get_shape()[0] == batch_size,
+                     "Result ",
+                     result->get_name(),
+                     " does not carry the batch along its leading dimension");
+        batch.outputs.push_back(create_tensor(result->output(0), batch.output_buffers));
+    }
+    return m_batch_executables.emplace(batch_size, move(batch)).first->second;
+}
+
+void runtime::dynamic::BatchingExecutable::execute_batch(
+    const vector<shared_ptr<Request>>& requests, size_t batch_size)
+{
+    BatchExecutable& batch = get_batch_executable(batch_size);
+    if (requests.size() == 1)
+    {
+        // Nothing to coalesce, the request's own tensors are used directly
+        batch.executable->call(requests[0]->outputs, requests[0]->inputs);
+        return;
+    }
+
+    // Concatenate the requests' inputs along the batch axis, directly in the batch tensor's
+    // memory when it is attached
+    for (size_t i = 0; i < batch.inputs.size(); i++)
+    {
+        size_t total = batch.inputs[i]->get_size_in_bytes();
+        char* data = nullptr;
+        if (batch.input_buffers.empty())
+        {
+            m_staging.resize(max(m_staging.size(), total));
+            data = m_staging.data();
+        }
+        else
+        {
+            data = static_cast<char*>(batch.input_buffers[i].get_ptr());
+        }
+        size_t offset = 0;
+        for (auto& request : requests)
+        {
+            const shared_ptr<runtime::Tensor>& input = request->inputs.at(i);
+            size_t size = input->get_size_in_bytes();
+            NGRAPH_CHECK(offset + size <= total, "Request input ", i, " has an unexpected shape");
+            input->read(data + offset, size);
+            offset += size;
+        }
+        NGRAPH_CHECK(offset == total, "Request input ", i, " has an unexpected shape");
+        if (batch.input_buffers.empty())
+        {
+            batch.inputs[i]->write(data, total);
+        }
+    }
+
+    batch.executable->call(batch.outputs, batch.inputs);
+
+    // Scatter the batched results back to the requests
+    for (size_t i = 0; i < batch.outputs.size(); i++)
+    {
+        size_t total = batch.outputs[i]->get_size_in_bytes();
+        const char* data = nullptr;
+        if (batch.output_buffers.empty())
+        {
+            m_staging.resize(max(m_staging.size(), total));
+            batch.outputs[i]->read(m_staging.data(), total);
+            data = m_staging.data();
+        }
+        else
+        {
+            data = static_cast<const char*>(batch.output_buffers[i].get_ptr());
+        }
+        size_t offset = 0;
+        for (auto& request : requests)
+        {
+            const shared_ptr<runtime::Tensor>& output = request->outputs.at(i);
+            size_t size = output->get_size_in_bytes();
+            NGRAPH_CHECK(offset + size <= total, "Request output ", i, " has an unexpected shape");
+            output->write(data + offset, size);
+            offset += size;
+        }
+    }
+}
@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace dynamic
+        {
+            class BatchingExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that coalesces concurrent requests along the batch axis.
+///
+/// The wrapped function must have a dynamic leading (batch) dimension on every parameter, and
+/// every result must carry the batch along its leading dimension. Each `call` submits one
+/// request whose inputs hold one or more samples along axis 0 and blocks until the request has
+/// been executed.
+///
+/// A background thread collects queued requests until either `max_batch_size` samples are
+/// queued or the oldest request has waited `max_queue_delay`. The collected requests are
+/// concatenated, executed with an executable compiled for that exact batch size (specialized
+/// with `specialize_function` and cached), and the results are scattered back to the callers'
+/// output tensors.
+///
+class ngraph::runtime::dynamic::BatchingExecutable : public ngraph::runtime::Executable
+{
+public:
+    /// \brief Queueing and batch-fill statistics accumulated since construction.
+    struct Metrics
+    {
+        /// Number of requests that were executed
+        size_t request_count = 0;
+        /// Number of batches that were executed
+        size_t batch_count = 0;
+        /// Number of samples that were executed
+        size_t sample_count = 0;
+        /// Number of requests currently waiting in the queue
+        size_t queued_requests = 0;
+        /// Total time requests spent queued before their batch started
+        std::chrono::microseconds total_queue_time{0};
+        /// Longest time a request spent queued before its batch started
+        std::chrono::microseconds max_queue_time{0};
+
+        /// \return the average number of samples per batch divided by the maximum batch size
+        double get_batch_fill(size_t max_batch_size) const;
+        /// \return the average time a request spent queued
+        std::chrono::microseconds get_average_queue_time() const;
+    };
+
+    /// \param function Function with a dynamic leading dimension on its parameters
+    /// \param backend Backend used to compile one executable per batch size
+    /// \param max_batch_size Maximum number of samples executed together
+    /// \param max_queue_delay Longest time the oldest queued request waits for more requests
+    /// \param enable_performance_collection Passed on to the compiled executables
+    BatchingExecutable(std::shared_ptr<Function> function,
+                       std::shared_ptr<runtime::Backend> backend,
+                       size_t max_batch_size,
+                       std::chrono::microseconds max_queue_delay,
+                       bool enable_performance_collection = false);
+    ~BatchingExecutable() override;
+
+    /// \brief Submits one request and waits for its batch to complete. Safe to call from
+    ///        multiple threads at once.
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    Metrics get_metrics() const;
+    size_t get_max_batch_size() const { return m_max_batch_size; }
+private:
+    /// \brief Shared by the caller and the queue, so the promise outlives `call` returning
+    ///        while the batching thread is still completing it
+    struct Request
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        size_t batch_size;
+        std::chrono::steady_clock::time_point enqueue_time;
+        std::promise<void> done;
+    };
+
+    /// \brief Executable and batch tensors compiled for one batch size. When the backend
+    ///        supports memory_attach the tensors wrap host buffers, so requests are gathered
+    ///        into and scattered from the batch tensors without a staging copy.
+    struct BatchExecutable
+    {
+        std::shared_ptr<runtime::Executable> executable;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<AlignedBuffer> input_buffers;
+        std::vector<AlignedBuffer> output_buffers;
+    };
+
+    void run();
+    void execute_batch(const std::vector<std::shared_ptr<Request>>& requests, size_t batch_size);
+    BatchExecutable& get_batch_executable(size_t batch_size);
+
+    std::shared_ptr<Function> m_function;
+    std::shared_ptr<runtime::Backend> m_backend;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_max_queue_delay;
+    bool m_enable_performance_collection;
+
+    // Only accessed by the batching thread
+    std::unordered_map<size_t, BatchExecutable> m_batch_executables;
+    std::vector<char> m_staging;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_queue_changed;
+    std::deque<std::shared_ptr<Request>> m_queue;
+    size_t m_queued_samples = 0;
+    bool m_stop = false;
+    Metrics m_metrics;
+    std::thread m_thread;
+};
@@ -59,10 +59,47 @@ shared_ptr<runtime::Executable>
     runtime::gcpu::GCPUBackend::compile(shared_ptr<Function> function,
                                         bool enable_performance_collection)
 {
-    return make_shared<GCPUExecutable>(function, enable_performance_collection);
+    return make_shared<GCPUExecutable>(
+        function, enable_performance_collection, m_incremental_execution, m_allocator);
 }
 
 bool runtime::gcpu::GCPUBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
+
+bool runtime::gcpu::GCPUBackend::is_supported_property(const Property prop) const
+{
+    // Compilation works on a private clone of the function and tensors are HostTensors, which
+    // may wrap memory of the caller
+    return prop == Property::concurrent_compile || prop == Property::memory_attach;
+}
+
+bool runtime::gcpu::GCPUBackend::set_config(const map<string, string>& config, string& error)
+{
+    bool rc = false;
+    error = "";
+    auto it = config.find("incremental_execution");
+    if (it != config.end())
+    {
+        m_incremental_execution = it->second == "true";
+        rc = true;
+    }
+    return rc;
+}
+
+runtime::Allocator* runtime::gcpu::GCPUBackend::get_host_memory_allocator()
+{
+    return m_allocator ? m_allocator : runtime::get_default_allocator();
+}
+
+void runtime::gcpu::GCPUBackend::set_host_memory_allocator(Allocator* allocator)
+{
+    if (m_allocator)
+    {
+        // Executables compiled with the existing allocator still free their memory through it
+        throw ngraph_error(
+            "Allocator already exists. Changing allocators mid-execution is not permitted.");
+    }
+    m_allocator = allocator;
+}
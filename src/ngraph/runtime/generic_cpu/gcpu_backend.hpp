@@ -56,6 +56,21 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    bool is_supported_property(const Property prop) const override;
+
+    /// \brief Accepts "incremental_execution": with "true", executables compiled afterwards
+    ///        keep their temporaries between calls and skip the nodes whose inputs are not
+    ///        stale. By default every call places its temporaries in one pool laid out by
+    ///        MemoryLayout and releases it on return.
+    bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
+
+    Allocator* get_host_memory_allocator() override;
+    /// \brief Sets the allocator of the temporaries of executables compiled afterwards.
+    ///        The allocator must outlive those executables.
+    void set_host_memory_allocator(Allocator* allocator) override;
+
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    bool m_incremental_execution = false;
+    Allocator* m_allocator = nullptr;
 };
@@ -40,7 +40,9 @@ using namespace ngraph;
 using descriptor::layout::DenseTensorLayout;
 
 runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& function,
-                                              bool enable_performance_collection)
+                                              bool enable_performance_collection,
+                                              bool incremental_execution,
+                                              Allocator* allocator)
     : m_is_compiled{true}
     , m_performance_counters_enabled{enable_performance_collection}
 {
@@ -53,19 +55,32 @@ runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& functi
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
     pass_manager.run_passes(m_function);
+    m_memory_plan.reset(new HostMemoryPlan(m_function, get_alignment(), allocator));
 
+    vector<shared_ptr<Node>> nodes;
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
+        nodes.push_back(node);
+    }
+    if (incremental_execution)
+    {
+        m_incremental.reset(new IncrementalExecution(nodes, get_alignment(), allocator));
     }
     set_parameters_and_results(*m_function);
 }
 
-runtime::gcpu::GCPUExecutable::GCPUExecutable(const std::string& model_string)
+runtime::gcpu::GCPUExecutable::GCPUExecutable(const std::string& model_string,
+                                              Allocator* allocator)
     : m_is_compiled{true}
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(m_function);
+    m_memory_plan.reset(new HostMemoryPlan(m_function, get_alignment(), allocator));
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
@@ -96,6 +111,27 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         func_outputs.push_back(host_tensor);
     }
 
+    // With incremental execution, intermediate tensors are kept between calls so that nodes
+    // whose inputs did not change can be skipped. A concurrent call finds the cache in use and
+    // runs without it.
+    unique_lock<mutex> cache_lock;
+    if (m_incremental)
+    {
+        cache_lock = unique_lock<mutex>(m_incremental->get_mutex(), try_to_lock);
+    }
+    IncrementalExecution* incremental = cache_lock.owns_lock() ? m_incremental.get() : nullptr;
+    if (incremental)
+    {
+        incremental->begin_call(get_parameters(), func_inputs);
+    }
+    // Calls without the cache place their temporaries in the planned memory, which is
+    // released when the call returns
+    unique_ptr<HostMemoryPlan::Allocation> memory;
+    if (!incremental && m_memory_plan && m_memory_plan->is_planned())
+    {
+        memory = m_memory_plan->allocate(func_outputs, func_inputs);
+    }
+
     // map function params -> HostTensor
     unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
     size_t input_count = 0;
@@ -150,7 +186,18 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
                 const Shape& shape = op->get_output_shape(i);
                 const element::Type& type = op->get_output_element_type(i);
                 string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                if (incremental)
+                {
+                    host_tensor = incremental->get_tensor(tensor, type, shape, name);
+                }
+                else
+                {
+                    host_tensor = memory ? memory->get_tensor(tensor) : nullptr;
+                    if (!host_tensor)
+                    {
+                        host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                    }
+                }
                 tensor_map.insert({tensor, host_tensor});
             }
             else
@@ -160,6 +207,12 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
             op_outputs.push_back(host_tensor);
         }
 
+        // skip the node if none of its inputs changed since the previous call
+        if (incremental && !incremental->needs_execution(*op))
+        {
+            continue;
+        }
+
         // get op type
         element::Type type;
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
@@ -206,6 +259,15 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         }
     }
 
+    for (auto& output : func_outputs)
+    {
+        output->set_stale(true);
+    }
+    if (incremental)
+    {
+        incremental->end_call();
+    }
+
     return true;
 }
 
@@ -75,7 +75,9 @@
 #include "ngraph/runtime/generic_cpu/kernel/dot.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/reshape.hpp"
 #include "ngraph/runtime/generic_cpu/node_wrapper.hpp"
+#include "ngraph/runtime/host_memory_plan.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/incremental_execution.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
@@ -133,6 +135,8 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/recv.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
@@ -178,8 +182,14 @@ class ngraph::runtime::gcpu::GCPUExecutable : public Executable
     friend class GCPUBackend;
 
 public:
+    /// \param incremental_execution Keep the temporaries between calls and skip the nodes
+    ///        whose inputs are not stale, instead of running every call on the memory planned
+    ///        by HostMemoryPlan
+    /// \param allocator Allocator of the temporaries, ngraph_malloc if null
     GCPUExecutable(const std::shared_ptr<Function>& function,
-                   bool enable_performance_collection = false);
+                   bool enable_performance_collection = false,
+                   bool incremental_execution = false,
+                   Allocator* allocator = nullptr);
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
@@ -191,7 +201,7 @@ public:
     std::vector<PerformanceCounter> get_performance_data() const override;
 
 private:
-    GCPUExecutable(const std::string& model_string);
+    GCPUExecutable(const std::string& model_string, Allocator* allocator = nullptr);
 
     int get_alignment() const { return 64; }
     bool m_is_compiled = false;
@@ -200,6 +210,8 @@ private:
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
+    std::unique_ptr<IncrementalExecution> m_incremental;
+    std::unique_ptr<HostMemoryPlan> m_memory_plan;
     std::unordered_map<const Node*, std::shared_ptr<ngraph::State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
@@ -417,7 +429,10 @@ private:
             size_t n = get_output_element->get_n();
             size_t element_count = shape_size(node.get_output_shape(0));
             size_t num_bytes = element_count * node.get_output_element_type(0).size();
-            std::memcpy(out[0]->get_data_ptr<T>(), args[n]->get_data_ptr<T>(), num_bytes);
+            if (out[0]->get_data_ptr() != args[n]->get_data_ptr())
+            {
+                std::memcpy(out[0]->get_data_ptr<T>(), args[n]->get_data_ptr<T>(), num_bytes);
+            }
             break;
         }
         case OP_TYPEID::BatchMatMul:
@@ -1197,7 +1212,7 @@ private:
             if (input_element_type == element::u8 && filter_element_type == element::i8 &&
                 output_element_type == element::i8)
             {
-                reference::convolution<uint8_t, int8_t, int8_t, int32_t>(
+                reference::quantized_convolution<int8_t, int8_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const int8_t>(),
                     out[0]->get_data_ptr<int8_t>(),
@@ -1207,7 +1222,6 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
@@ -1219,7 +1233,7 @@ private:
             else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
                      output_element_type == element::u8)
             {
-                reference::convolution<uint8_t, uint8_t, uint8_t, int32_t>(
+                reference::quantized_convolution<uint8_t, uint8_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const uint8_t>(),
                     out[0]->get_data_ptr<uint8_t>(),
@@ -1229,7 +1243,6 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
@@ -1241,7 +1254,7 @@ private:
             else if (input_element_type == element::u8 && filter_element_type == element::i8 &&
                      output_element_type == element::i32)
             {
-                reference::convolution<uint8_t, int8_t, int32_t, int32_t>(
+                reference::quantized_convolution<int8_t, int32_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const int8_t>(),
                     out[0]->get_data_ptr<int32_t>(),
@@ -1251,7 +1264,6 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
@@ -1263,7 +1275,7 @@ private:
             else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
                      output_element_type == element::i32)
             {
-                reference::convolution<uint8_t, uint8_t, int32_t, int32_t>(
+                reference::quantized_convolution<uint8_t, int32_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const uint8_t>(),
                     out[0]->get_data_ptr<int32_t>(),
@@ -1273,7 +1285,6 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
@@ -1297,11 +1308,95 @@ private:
         case OP_TYPEID::QuantizedConvolutionBiasSignedAdd:
         case OP_TYPEID::QuantizedConvolutionRelu:
         case OP_TYPEID::QuantizedDotBias:
-        case OP_TYPEID::QuantizedDot:
         {
             throw unsupported_op("Unsupported op '" + node.description() +
                                  "' in Interpreter back end.");
         }
+        case OP_TYPEID::QuantizedDot:
+        {
+            const op::QuantizedDot* qd = static_cast<const op::QuantizedDot*>(&node);
+
+            auto input0_element_type = qd->get_input_element_type(0);
+            auto input1_element_type = qd->get_input_element_type(1);
+            auto output_element_type = qd->get_output_element_type(0);
+
+            if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
+                output_element_type == element::i8)
+            {
+                reference::quantized_dot<int8_t, int8_t>(
+                    args[0]->get_data_ptr<const uint8_t>(),
+                    args[1]->get_data_ptr<const int8_t>(),
+                    out[0]->get_data_ptr<int8_t>(),
+                    node.get_input_shape(0),
+                    node.get_input_shape(1),
+                    qd->get_reduction_axes_count(),
+                    args[2]->get_data_ptr<const float>(),
+                    args[3]->get_data_ptr<const uint8_t>(),
+                    args[4]->get_data_ptr<const float>(),
+                    args[5]->get_data_ptr<const int8_t>(),
+                    args[6]->get_data_ptr<const float>(),
+                    args[7]->get_data_ptr<const int8_t>());
+            }
+            else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
+                     output_element_type == element::u8)
+            {
+                reference::quantized_dot<uint8_t, uint8_t>(
+                    args[0]->get_data_ptr<const uint8_t>(),
+                    args[1]->get_data_ptr<const uint8_t>(),
+                    out[0]->get_data_ptr<uint8_t>(),
+                    node.get_input_shape(0),
+                    node.get_input_shape(1),
+                    qd->get_reduction_axes_count(),
+                    args[2]->get_data_ptr<const float>(),
+                    args[3]->get_data_ptr<const uint8_t>(),
+                    args[4]->get_data_ptr<const float>(),
+                    args[5]->get_data_ptr<const uint8_t>(),
+                    args[6]->get_data_ptr<const float>(),
+                    args[7]->get_data_ptr<const uint8_t>());
+            }
+            else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
+                     output_element_type == element::i32)
+            {
+                reference::quantized_dot<uint8_t, int32_t>(
+                    args[0]->get_data_ptr<const uint8_t>(),
+                    args[1]->get_data_ptr<const uint8_t>(),
+                    out[0]->get_data_ptr<int32_t>(),
+                    node.get_input_shape(0),
+                    node.get_input_shape(1),
+                    qd->get_reduction_axes_count(),
+                    args[2]->get_data_ptr<const float>(),
+                    args[3]->get_data_ptr<const uint8_t>(),
+                    args[4]->get_data_ptr<const float>(),
+                    args[5]->get_data_ptr<const uint8_t>(),
+                    args[6]->get_data_ptr<const float>(),
+                    args[7]->get_data_ptr<const int32_t>());
+            }
+            else if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
+                     output_element_type == element::i32)
+            {
+                reference::quantized_dot<int8_t, int32_t>(
+                    args[0]->get_data_ptr<const uint8_t>(),
+                    args[1]->get_data_ptr<const int8_t>(),
+                    out[0]->get_data_ptr<int32_t>(),
+                    node.get_input_shape(0),
+                    node.get_input_shape(1),
+                    qd->get_reduction_axes_count(),
+                    args[2]->get_data_ptr<const float>(),
+                    args[3]->get_data_ptr<const uint8_t>(),
+                    args[4]->get_data_ptr<const float>(),
+                    args[5]->get_data_ptr<const int8_t>(),
+                    args[6]->get_data_ptr<const float>(),
+                    args[7]->get_data_ptr<const int32_t>());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element type";
+                throw std::runtime_error(ss.str());
+            }
+
+            break;
+        }
         case OP_TYPEID::Recv:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
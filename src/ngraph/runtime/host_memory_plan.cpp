@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_optimization.hpp"
+#include "ngraph/runtime/host_memory_plan.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::HostMemoryPlan::HostMemoryPlan(const shared_ptr<Function>& function,
+                                        size_t alignment,
+                                        Allocator* allocator)
+    : m_alignment(alignment)
+    , m_allocator(allocator)
+{
+    if (function->is_dynamic())
+    {
+        return;
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    auto memory_layout = pass_manager.register_pass<pass::MemoryLayout>(alignment);
+    pass_manager.run_passes(function, false);
+
+    for (auto& node : function->get_ordered_ops())
+    {
+        m_pool_tensors.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
+    }
+    m_output_aliases = memory_layout->get_output_aliases();
+    m_pool_size = function->get_temporary_pool_size();
+    m_planned = true;
+}
+
+unique_ptr<runtime::HostMemoryPlan::Allocation>
+    runtime::HostMemoryPlan::allocate(const vector<shared_ptr<HostTensor>>& outputs,
+                                      const vector<shared_ptr<HostTensor>>& inputs) const
+{
+    NGRAPH_CHECK(m_planned, "Memory of a dynamic function is not planned");
+    return unique_ptr<Allocation>(new Allocation(*this, outputs, inputs));
+}
+
+runtime::HostMemoryPlan::Allocation::Allocation(const HostMemoryPlan& plan,
+                                                const vector<shared_ptr<HostTensor>>& outputs,
+                                                const vector<shared_ptr<HostTensor>>& inputs)
+    : m_plan(plan)
+    , m_pool(plan.m_pool_size, plan.m_alignment, plan.m_allocator)
+{
+    set<const char*> buffers;
+    for (auto& input : inputs)
+    {
+        buffers.insert(input->get_data_ptr());
+    }
+    bool distinct = true;
+    for (auto& output : outputs)
+    {
+        distinct = buffers.insert(output->get_data_ptr()).second && distinct;
+    }
+    if (distinct)
+    {
+        for (auto& output : outputs)
+        {
+            m_outputs.push_back(output->get_data_ptr());
+        }
+    }
+}
+
+shared_ptr<runtime::HostTensor>
+    runtime::HostMemoryPlan::Allocation::get_tensor(const descriptor::Tensor* tensor) const
+{
+    if (m_plan.m_pool_tensors.count(tensor) == 0)
+    {
+        return nullptr;
+    }
+
+    char* memory = nullptr;
+    auto alias = m_plan.m_output_aliases.find(tensor);
+    if (alias == m_plan.m_output_aliases.end())
+    {
+        memory = static_cast<char*>(m_pool.get_ptr(tensor->get_pool_offset()));
+    }
+    else if (alias->second < m_outputs.size())
+    {
+        memory = m_outputs[alias->second] + tensor->get_pool_offset();
+    }
+    else
+    {
+        return nullptr;
+    }
+    return make_shared<HostTensor>(
+        tensor->get_element_type(), tensor->get_shape(), memory, tensor->get_name());
+}
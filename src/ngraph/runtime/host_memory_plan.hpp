@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HostMemoryPlan;
+    }
+}
+
+/// \brief Places the temporaries of an executable that runs a function node by node on
+///        HostTensors in one buffer laid out by MemoryOptimization and MemoryLayout, instead of
+///        allocating a HostTensor per temporary.
+///
+/// Tensors that MemoryLayout computed in place share memory, so the kernels of views such as
+/// Reshape, Slice and Concat copy data onto itself. Kernels that copy with memcpy must skip
+/// the copy when source and destination coincide.
+class ngraph::runtime::HostMemoryPlan
+{
+public:
+    /// \brief Memory for the temporaries of one call
+    class Allocation
+    {
+    public:
+        /// \brief Returns a HostTensor over the planned memory of `tensor`, or nullptr if
+        ///        `tensor` is not planned for this call.
+        std::shared_ptr<HostTensor> get_tensor(const descriptor::Tensor* tensor) const;
+
+    private:
+        friend class HostMemoryPlan;
+        Allocation(const HostMemoryPlan& plan,
+                   const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                   const std::vector<std::shared_ptr<HostTensor>>& inputs);
+
+        const HostMemoryPlan& m_plan;
+        AlignedBuffer m_pool;
+        std::vector<char*> m_outputs;
+    };
+
+    /// \brief Lays out the temporaries of `function`, which must have been through Liveness.
+    ///        Functions with dynamic shapes are not planned.
+    /// \param allocator Allocator of the memory for each call, ngraph_malloc if null
+    HostMemoryPlan(const std::shared_ptr<Function>& function,
+                   size_t alignment,
+                   Allocator* allocator = nullptr);
+
+    bool is_planned() const { return m_planned; }
+    size_t get_pool_size() const { return m_pool_size; }
+    /// \brief Allocates the temporaries for one call. Tensors that MemoryLayout placed in a
+    ///        function output are computed in the caller's tensor unless the output tensors
+    ///        share memory with an input or with each other.
+    std::unique_ptr<Allocation>
+        allocate(const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                 const std::vector<std::shared_ptr<HostTensor>>& inputs) const;
+
+private:
+    bool m_planned = false;
+    size_t m_alignment;
+    Allocator* m_allocator;
+    size_t m_pool_size = 0;
+    std::unordered_set<const descriptor::Tensor*> m_pool_tensors;
+    std::unordered_map<const descriptor::Tensor*, size_t> m_output_aliases;
+};
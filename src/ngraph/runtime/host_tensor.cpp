@@ -39,7 +39,7 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
     m_descriptor->set_tensor_layout(
         std::make_shared<ngraph::descriptor::layout::DenseTensorLayout>(*m_descriptor));
 
-    m_buffer_size = m_descriptor->get_tensor_layout()->get_size() * element_type.size();
+    m_buffer_size = m_descriptor->get_tensor_layout()->get_allocated_size();
 
     if (memory_pointer != nullptr)
     {
@@ -105,6 +105,7 @@ void runtime::HostTensor::write(const void* source, size_t n)
     }
     char* target = get_data_ptr();
     memcpy(target, source, n);
+    set_stale(true);
 }
 
 void runtime::HostTensor::read(void* target, size_t n) const
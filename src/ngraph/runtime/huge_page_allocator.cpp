@@ -0,0 +1,252 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "ngraph/check.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::HugePageAllocator::page_size;
+
+// Allocations are rounded to cache lines, which keeps every free range cache line aligned
+static const size_t s_granularity = 64;
+
+runtime::HugePageAllocator::HugePageAllocator(Mode mode, size_t chunk_size)
+    : m_mode(mode)
+    , m_chunk_size(round_up(max<size_t>(chunk_size, 1), page_size))
+    , m_created(chrono::steady_clock::now())
+{
+}
+
+runtime::HugePageAllocator::~HugePageAllocator()
+{
+    for (auto& chunk : m_chunks)
+    {
+        unmap_chunk(chunk.second);
+    }
+}
+
+runtime::HugePageAllocator::Chunk runtime::HugePageAllocator::map_chunk(size_t size)
+{
+#ifdef __linux__
+    if (m_mode == Mode::Explicit && !m_explicit_failed)
+    {
+        void* ptr = mmap(nullptr,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                         -1,
+                         0);
+        if (ptr != MAP_FAILED)
+        {
+            return Chunk{static_cast<char*>(ptr), size, true, nullptr};
+        }
+        m_explicit_failed = true;
+        NGRAPH_WARN << "No reserved huge pages are available, falling back to transparent "
+                       "huge pages";
+    }
+
+    // Over-map by one page and trim the ends so the chunk starts on a huge page boundary
+    size_t mapped_size = size + page_size;
+    void* ptr =
+        mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw ngraph_error("mmap failed to map memory of size " + to_string(mapped_size));
+    }
+    char* mapped = static_cast<char*>(ptr);
+    char* base = reinterpret_cast<char*>(round_up(reinterpret_cast<size_t>(mapped), page_size));
+    size_t head = base - mapped;
+    size_t tail = mapped_size - head - size;
+    if (head > 0)
+    {
+        munmap(mapped, head);
+    }
+    if (tail > 0)
+    {
+        munmap(base + size, tail);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(base, size, MADV_HUGEPAGE);
+#endif
+    return Chunk{base, size, false, nullptr};
+#else
+    void* allocation = ngraph_malloc(size + page_size);
+    char* base =
+        reinterpret_cast<char*>(round_up(reinterpret_cast<size_t>(allocation), page_size));
+    return Chunk{base, size, false, allocation};
+#endif
+}
+
+void runtime::HugePageAllocator::unmap_chunk(const Chunk& chunk)
+{
+#ifdef __linux__
+    munmap(chunk.base, chunk.size);
+#else
+    ngraph_free(chunk.allocation);
+#endif
+}
+
+void* runtime::HugePageAllocator::allocate_from_free_ranges(size_t size,
+                                                            size_t requested,
+                                                            size_t alignment)
+{
+    for (auto it = m_free_ranges.begin(); it != m_free_ranges.end(); ++it)
+    {
+        char* begin = it->first;
+        size_t range_size = it->second;
+        char* aligned =
+            reinterpret_cast<char*>(round_up(reinterpret_cast<size_t>(begin), alignment));
+        size_t padding = aligned - begin;
+        if (padding + size > range_size)
+        {
+            continue;
+        }
+
+        m_free_ranges.erase(it);
+        if (padding > 0)
+        {
+            m_free_ranges.insert({begin, padding});
+        }
+        if (padding + size < range_size)
+        {
+            m_free_ranges.insert({aligned + size, range_size - padding - size});
+        }
+        m_live_ranges.insert({aligned, Range{aligned, size, requested}});
+        return aligned;
+    }
+    return nullptr;
+}
+
+void* runtime::HugePageAllocator::malloc(size_t size, size_t alignment)
+{
+    NGRAPH_CHECK(alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= page_size,
+                 "Alignment ",
+                 alignment,
+                 " is not a power of two up to the huge page size");
+    alignment = max(alignment, s_granularity);
+    size_t rounded_size = round_up(max<size_t>(size, 1), s_granularity);
+
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.allocation_count++;
+    void* ptr = allocate_from_free_ranges(rounded_size, size, alignment);
+    if (ptr)
+    {
+        m_stats.reuse_count++;
+    }
+    else
+    {
+        // Chunks start on a huge page boundary, so any alignment up to a page fits
+        Chunk chunk = map_chunk(max(m_chunk_size, round_up(rounded_size, page_size)));
+        m_chunks.insert({chunk.base, chunk});
+        m_free_ranges.insert({chunk.base, chunk.size});
+        m_stats.bytes_reserved += chunk.size;
+        ptr = allocate_from_free_ranges(rounded_size, size, alignment);
+    }
+    m_stats.bytes_in_use += size;
+    m_stats.peak_bytes_in_use = max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    return ptr;
+}
+
+void runtime::HugePageAllocator::free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    auto live = m_live_ranges.find(ptr);
+    NGRAPH_CHECK(live != m_live_ranges.end(), "Pointer was not allocated by this allocator");
+    Range range = live->second;
+    m_live_ranges.erase(live);
+    m_stats.free_count++;
+    m_stats.bytes_in_use -= range.requested;
+
+    // Merge with the free neighbours that belong to the same chunk
+    char* begin = range.begin;
+    size_t size = range.size;
+    auto next = m_free_ranges.find(begin + size);
+    if (next != m_free_ranges.end() && m_chunks.count(next->first) == 0)
+    {
+        size += next->second;
+        m_free_ranges.erase(next);
+    }
+    auto prev = m_free_ranges.lower_bound(begin);
+    if (prev != m_free_ranges.begin() && m_chunks.count(begin) == 0)
+    {
+        --prev;
+        if (prev->first + prev->second == begin)
+        {
+            begin = prev->first;
+            size += prev->second;
+            m_free_ranges.erase(prev);
+        }
+    }
+    m_free_ranges.insert({begin, size});
+}
+
+void runtime::HugePageAllocator::release()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto it = m_chunks.begin(); it != m_chunks.end();)
+    {
+        auto free_range = m_free_ranges.find(it->first);
+        if (free_range != m_free_ranges.end() && free_range->second == it->second.size)
+        {
+            m_free_ranges.erase(free_range);
+            m_stats.bytes_reserved -= it->second.size;
+            unmap_chunk(it->second);
+            it = m_chunks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+size_t runtime::HugePageAllocator::get_explicit_bytes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t bytes = 0;
+    for (auto& chunk : m_chunks)
+    {
+        if (chunk.second.explicit_pages)
+        {
+            bytes += chunk.second.size;
+        }
+    }
+    return bytes;
+}
+
+runtime::AllocatorStats runtime::HugePageAllocator::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    AllocatorStats stats = m_stats;
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - m_created;
+    if (elapsed.count() > 0)
+    {
+        stats.allocation_rate = stats.allocation_count / elapsed.count();
+    }
+    return stats;
+}
@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HugePageAllocator;
+    }
+}
+
+/// \brief Arena allocator that carves allocations out of chunks backed by 2 MB pages, so
+///        large tensors and memory pools span few TLB entries.
+///
+/// Chunks are mapped with MAP_HUGETLB in explicit mode, which needs pages reserved through
+/// /proc/sys/vm/nr_hugepages; if that fails, or in transparent mode, chunks are 2 MB aligned
+/// anonymous mappings advised with MADV_HUGEPAGE. Allocations are placed first fit and freed
+/// ranges are merged with their free neighbours within a chunk. Chunks stay mapped until
+/// `release` finds them unused or the allocator is destroyed. The allocator is thread safe and
+/// must outlive the memory it hands out.
+class ngraph::runtime::HugePageAllocator : public ngraph::runtime::Allocator
+{
+public:
+    enum class Mode
+    {
+        Transparent,
+        Explicit
+    };
+
+    /// \param mode Whether chunks are backed by reserved huge pages or by transparent huge
+    ///        pages
+    /// \param chunk_size Minimum size of a chunk, rounded up to a multiple of `page_size`
+    HugePageAllocator(Mode mode = Mode::Transparent, size_t chunk_size = 32 * 1024 * 1024);
+    HugePageAllocator(const HugePageAllocator&) = delete;
+    HugePageAllocator& operator=(const HugePageAllocator&) = delete;
+    ~HugePageAllocator() override;
+
+    /// \param alignment Power of two no larger than `page_size`
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+    AllocatorStats get_stats() const override;
+
+    /// \brief Unmaps the chunks that hold no allocation
+    void release();
+
+    /// \brief Returns the number of bytes mapped from reserved huge pages
+    size_t get_explicit_bytes() const;
+
+    static constexpr size_t page_size = 2 * 1024 * 1024;
+
+private:
+    struct Chunk
+    {
+        char* base;
+        size_t size;
+        bool explicit_pages;
+        /// Memory to free where chunks are not mapped with mmap
+        void* allocation;
+    };
+    struct Range
+    {
+        char* begin;
+        size_t size;
+        size_t requested;
+    };
+
+    Chunk map_chunk(size_t size);
+    void unmap_chunk(const Chunk& chunk);
+    void* allocate_from_free_ranges(size_t size, size_t requested, size_t alignment);
+
+    Mode m_mode;
+    size_t m_chunk_size;
+    bool m_explicit_failed = false;
+    std::map<char*, Chunk> m_chunks;
+    /// Free ranges by start address
+    std::map<char*, size_t> m_free_ranges;
+    /// Live allocations and the range they were carved from
+    std::unordered_map<void*, Range> m_live_ranges;
+    AllocatorStats m_stats;
+    std::chrono::steady_clock::time_point m_created;
+    mutable std::mutex m_mutex;
+};
@@ -0,0 +1,247 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/hybrid/pass/assign_placement.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::hybrid::HybridBackend::HybridBackend(
+    const vector<shared_ptr<runtime::Backend>>& backend_list)
+    : m_backend_list(backend_list)
+{
+    NGRAPH_CHECK(!m_backend_list.empty(), "HybridBackend needs at least one backend");
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::hybrid::HybridBackend::create_tensor(const element::Type& type, const Shape& shape)
+{
+    return make_shared<runtime::HostTensor>(type, shape);
+}
+
+shared_ptr<runtime::Tensor> runtime::hybrid::HybridBackend::create_tensor(
+    const element::Type& type, const Shape& shape, void* memory_pointer)
+{
+    return make_shared<runtime::HostTensor>(type, shape, memory_pointer);
+}
+
+shared_ptr<runtime::Executable>
+    runtime::hybrid::HybridBackend::compile(shared_ptr<Function> function,
+                                            bool enable_performance_collection)
+{
+    return make_shared<HybridExecutable>(m_backend_list, function, enable_performance_collection);
+}
+
+bool runtime::hybrid::HybridBackend::is_supported(const Node& node) const
+{
+    for (auto& backend : m_backend_list)
+    {
+        if (backend->is_supported(node))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool runtime::hybrid::HybridBackend::is_supported_property(const Property prop) const
+{
+    return prop == Property::memory_attach;
+}
+
+runtime::hybrid::HybridExecutable::HybridExecutable(
+    const vector<shared_ptr<runtime::Backend>>& backend_list,
+    const shared_ptr<Function>& function,
+    bool enable_performance_collection)
+    : m_backend_list(backend_list)
+{
+    set_parameters_and_results(*function);
+
+    // Placement is assigned on a clone so that the caller's function is left alone
+    auto placed_function = clone_function(*function);
+    ngraph::pass::Manager pass_manager;
+    pass_manager.register_pass<hybrid::pass::AssignPlacement>(m_backend_list);
+    pass_manager.run_passes(placed_function);
+    m_split = split_function_by_placement(placed_function);
+
+    // Values crossing between pieces are allocated once for the executable
+    m_crossing_values.resize(m_split.functions.size());
+    for (size_t piece = 0; piece < m_split.functions.size(); piece++)
+    {
+        for (auto& result : m_split.functions[piece]->get_results())
+        {
+            m_crossing_values[piece].push_back(make_shared<runtime::HostTensor>(
+                result->get_element_type(), result->get_shape()));
+        }
+    }
+    for (auto& source : m_split.result_sources)
+    {
+        m_crossing_values.at(source.function).at(source.index) = nullptr;
+    }
+
+    // The pieces of one backend are compiled together
+    m_executables.resize(m_split.functions.size());
+    for (size_t placement = 0; placement < m_backend_list.size(); placement++)
+    {
+        vector<shared_ptr<Function>> functions;
+        vector<size_t> pieces;
+        for (size_t piece = 0; piece < m_split.functions.size(); piece++)
+        {
+            if (m_split.placements[piece] == placement)
+            {
+                functions.push_back(m_split.functions[piece]);
+                pieces.push_back(piece);
+            }
+        }
+        if (!functions.empty())
+        {
+            auto executables = m_backend_list[placement]->compile_many(
+                functions, enable_performance_collection);
+            for (size_t i = 0; i < pieces.size(); i++)
+            {
+                m_executables[pieces[i]] = executables[i];
+            }
+        }
+    }
+}
+
+bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    // Tensors of other backends are staged through host memory
+    auto to_host = [](const shared_ptr<runtime::Tensor>& tensor, bool read) {
+        auto host = dynamic_pointer_cast<runtime::HostTensor>(tensor);
+        if (!host)
+        {
+            host =
+                make_shared<runtime::HostTensor>(tensor->get_element_type(), tensor->get_shape());
+            if (read)
+            {
+                tensor->read(host->get_data_ptr(), host->get_size_in_bytes());
+            }
+        }
+        return host;
+    };
+    vector<shared_ptr<runtime::HostTensor>> host_inputs;
+    for (auto& input : inputs)
+    {
+        host_inputs.push_back(to_host(input, true));
+    }
+    vector<shared_ptr<runtime::HostTensor>> host_outputs;
+    for (auto& output : outputs)
+    {
+        host_outputs.push_back(to_host(output, false));
+    }
+
+    // Results of the function are computed in place, the other results of a piece in the
+    // crossing values of the executable. A concurrent call finds them in use and allocates its
+    // own when the piece runs.
+    unique_lock<mutex> crossing_values_lock(m_crossing_values_mutex, try_to_lock);
+    vector<vector<shared_ptr<runtime::HostTensor>>> piece_results;
+    if (crossing_values_lock.owns_lock())
+    {
+        piece_results = m_crossing_values;
+    }
+    else
+    {
+        for (auto& function : m_split.functions)
+        {
+            piece_results.emplace_back(function->get_results().size());
+        }
+    }
+    for (size_t i = 0; i < m_split.result_sources.size(); i++)
+    {
+        auto& source = m_split.result_sources[i];
+        piece_results.at(source.function).at(source.index) = host_outputs.at(i);
+    }
+
+    for (size_t piece = 0; piece < m_split.functions.size(); piece++)
+    {
+        auto& function = m_split.functions[piece];
+        auto& backend = m_backend_list.at(m_split.placements[piece]);
+        bool attach = backend->is_supported_property(runtime::Backend::Property::memory_attach);
+        auto to_backend = [&](const shared_ptr<runtime::HostTensor>& host, bool write) {
+            if (attach)
+            {
+                return backend->create_tensor(
+                    host->get_element_type(), host->get_shape(), host->get_data_ptr());
+            }
+            auto tensor = backend->create_tensor(host->get_element_type(), host->get_shape());
+            if (write)
+            {
+                tensor->write(host->get_data_ptr(), host->get_size_in_bytes());
+            }
+            return tensor;
+        };
+
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (auto& source : m_split.parameter_sources[piece])
+        {
+            args.push_back(to_backend(source.function == FunctionSplit::input
+                                          ? host_inputs.at(source.index)
+                                          : piece_results.at(source.function).at(source.index),
+                                      true));
+        }
+        vector<shared_ptr<runtime::Tensor>> results;
+        for (size_t i = 0; i < piece_results[piece].size(); i++)
+        {
+            auto& host = piece_results[piece][i];
+            if (!host)
+            {
+                auto& result = function->get_results()[i];
+                host = make_shared<runtime::HostTensor>(result->get_element_type(),
+                                                        result->get_shape());
+            }
+            results.push_back(to_backend(host, false));
+        }
+
+        if (!m_executables[piece]->call(results, args))
+        {
+            return false;
+        }
+        if (!attach)
+        {
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                auto& host = piece_results[piece][i];
+                results[i]->read(host->get_data_ptr(), host->get_size_in_bytes());
+            }
+        }
+    }
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (host_outputs[i] != outputs[i])
+        {
+            outputs[i]->write(host_outputs[i]->get_data_ptr(),
+                              host_outputs[i]->get_size_in_bytes());
+        }
+    }
+    return true;
+}
+
+vector<runtime::PerformanceCounter> runtime::hybrid::HybridExecutable::get_performance_data() const
+{
+    vector<runtime::PerformanceCounter> performance_data;
+    for (auto& executable : m_executables)
+    {
+        auto data = executable->get_performance_data();
+        performance_data.insert(performance_data.end(), data.begin(), data.end());
+    }
+    return performance_data;
+}
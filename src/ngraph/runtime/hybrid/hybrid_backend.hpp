@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class HybridBackend;
+            class HybridExecutable;
+        }
+    }
+}
+
+///
+/// \brief Backend that runs every op of a function on the first of several backends that
+///        supports it, so that a few unsupported ops do not move a whole function onto a
+///        slower backend.
+///
+/// `compile` places the ops with `hybrid::pass::AssignPlacement`, cuts the function into
+/// colocated pieces with `split_function_by_placement` and compiles every piece on its
+/// backend. Tensors of this backend are HostTensors, and so are the values that cross pieces.
+/// They are handed to the backend of a piece without a copy when that backend supports
+/// `Property::memory_attach`, and copied in and out otherwise.
+///
+class ngraph::runtime::hybrid::HybridBackend : public Backend
+{
+public:
+    /// \param backend_list Backends in order of preference. The last one is the fallback and
+    ///        runs the ops that no backend supports.
+    HybridBackend(const std::vector<std::shared_ptr<runtime::Backend>>& backend_list);
+
+    std::shared_ptr<Tensor>
+        create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
+
+    std::shared_ptr<Tensor> create_tensor(const element::Type& type, const Shape& shape) override;
+
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
+                                        bool enable_performance_data = false) override;
+
+    bool is_supported(const Node& node) const override;
+
+    bool is_supported_property(const Property prop) const override;
+
+    const std::vector<std::shared_ptr<runtime::Backend>>& get_backend_list() const
+    {
+        return m_backend_list;
+    }
+
+private:
+    std::vector<std::shared_ptr<runtime::Backend>> m_backend_list;
+};
+
+class ngraph::runtime::hybrid::HybridExecutable : public runtime::Executable
+{
+public:
+    HybridExecutable(const std::vector<std::shared_ptr<runtime::Backend>>& backend_list,
+                     const std::shared_ptr<Function>& function,
+                     bool enable_performance_collection = false);
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    std::vector<PerformanceCounter> get_performance_data() const override;
+
+    /// \returns The colocated pieces of the function, in execution order
+    const FunctionSplit& get_split() const { return m_split; }
+    /// \returns The executable of every piece
+    const std::vector<std::shared_ptr<Executable>>& get_executables() const
+    {
+        return m_executables;
+    }
+
+private:
+    std::vector<std::shared_ptr<runtime::Backend>> m_backend_list;
+    FunctionSplit m_split;
+    std::vector<std::shared_ptr<Executable>> m_executables;
+    /// The values crossing between pieces, indexed like the pieces' results. Slots of function
+    /// results are null, they are computed in the caller's tensors.
+    std::vector<std::vector<std::shared_ptr<runtime::HostTensor>>> m_crossing_values;
+    /// Held by the call that uses m_crossing_values. Concurrent calls allocate their own.
+    std::mutex m_crossing_values_mutex;
+};
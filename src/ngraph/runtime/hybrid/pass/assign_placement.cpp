@@ -0,0 +1,277 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <functional>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include "ngraph/runtime/hybrid/pass/assign_placement.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/get_output_element.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::hybrid::pass::AssignPlacement::AssignPlacement(
+    const vector<shared_ptr<runtime::Backend>>& placement_backends)
+    : m_placement_backends(placement_backends)
+{
+    NGRAPH_CHECK(!m_placement_backends.empty(), "AssignPlacement needs at least one backend");
+}
+
+static bool follows_argument(const Node* node)
+{
+    return node->is_output() || is_type<op::GetOutputElement>(node);
+}
+
+static bool is_placed(const Node* node)
+{
+    return !node->is_parameter() && !node->is_constant();
+}
+
+namespace
+{
+    // Output `second` of the op `first`
+    using PlacedValue = pair<Node*, size_t>;
+
+    // The placed ops of a function and the computed values that flow between them, with
+    // GetOutputElements looked through and Results left out
+    struct PlacementGraph
+    {
+        vector<Node*> ops;
+        unordered_map<Node*, vector<PlacedValue>> producers;
+        map<PlacedValue, vector<Node*>> consumers;
+    };
+}
+
+static PlacementGraph build_placement_graph(const list<shared_ptr<Node>>& ops)
+{
+    PlacementGraph graph;
+    for (auto& op : ops)
+    {
+        if (!is_placed(op.get()) || follows_argument(op.get()))
+        {
+            continue;
+        }
+        graph.ops.push_back(op.get());
+        for (auto& input_value : op->input_values())
+        {
+            PlacedValue value{input_value.get_node(), input_value.get_index()};
+            if (auto goe = as_type<op::GetOutputElement>(value.first))
+            {
+                value = PlacedValue{goe->input_value(0).get_node(), goe->get_n()};
+            }
+            if (is_placed(value.first) && !follows_argument(value.first))
+            {
+                graph.producers[op.get()].push_back(value);
+                graph.consumers[value].push_back(op.get());
+            }
+        }
+    }
+    return graph;
+}
+
+// Groups the ops into maximal connected sets of one placement, in topological order of their
+// first op
+static vector<vector<Node*>> find_pieces(const PlacementGraph& graph)
+{
+    unordered_map<Node*, Node*> parent;
+    function<Node*(Node*)> find_root = [&](Node* node) {
+        Node*& up = parent[node];
+        if (up == nullptr || up == node)
+        {
+            up = node;
+            return node;
+        }
+        up = find_root(up);
+        return up;
+    };
+    for (Node* op : graph.ops)
+    {
+        auto it = graph.producers.find(op);
+        if (it == graph.producers.end())
+        {
+            continue;
+        }
+        for (const PlacedValue& value : it->second)
+        {
+            if (value.first->get_placement_index() == op->get_placement_index())
+            {
+                parent[find_root(op)] = find_root(value.first);
+            }
+        }
+    }
+
+    vector<vector<Node*>> pieces;
+    unordered_map<Node*, size_t> piece_of_root;
+    for (Node* op : graph.ops)
+    {
+        Node* root = find_root(op);
+        auto it = piece_of_root.find(root);
+        if (it == piece_of_root.end())
+        {
+            it = piece_of_root.emplace(root, pieces.size()).first;
+            pieces.emplace_back();
+        }
+        pieces[it->second].push_back(op);
+    }
+    return pieces;
+}
+
+bool runtime::hybrid::pass::AssignPlacement::run_on_function(shared_ptr<Function> f)
+{
+    auto ops = f->get_ordered_ops();
+    set<const Node*> pinned;
+    for (auto& op : ops)
+    {
+        if (!is_placed(op.get()) || follows_argument(op.get()))
+        {
+            continue;
+        }
+        if (op->get_placement_index() < m_placement_backends.size())
+        {
+            pinned.insert(op.get());
+            continue;
+        }
+        size_t placement = m_placement_backends.size() - 1;
+        for (size_t i = 0; i < m_placement_backends.size(); i++)
+        {
+            if (m_placement_backends[i]->is_supported(*op))
+            {
+                placement = i;
+                break;
+            }
+        }
+        op->set_placement_index(placement);
+    }
+
+    // Move whole pieces while that lowers the number of boundary tensors, best move first.
+    // Every move strictly lowers the count, so this ends.
+    PlacementGraph graph = build_placement_graph(ops);
+    while (true)
+    {
+        vector<Node*>* best_piece = nullptr;
+        size_t best_placement = 0;
+        size_t best_gain = 0;
+        vector<vector<Node*>> pieces = find_pieces(graph);
+        for (auto& piece : pieces)
+        {
+            set<Node*> members(piece.begin(), piece.end());
+            bool movable = true;
+            bool has_producers = false;
+            bool has_consumers = false;
+            set<PlacedValue> values;
+            set<size_t> neighbour_placements;
+            for (Node* op : piece)
+            {
+                movable = movable && pinned.count(op) == 0;
+                for (const PlacedValue& value : graph.producers[op])
+                {
+                    if (members.count(value.first) == 0)
+                    {
+                        has_producers = true;
+                        neighbour_placements.insert(value.first->get_placement_index());
+                        values.insert(value);
+                    }
+                }
+                for (size_t i = 0; i < op->get_output_size(); i++)
+                {
+                    auto it = graph.consumers.find(PlacedValue{op, i});
+                    if (it == graph.consumers.end())
+                    {
+                        continue;
+                    }
+                    values.insert(it->first);
+                    for (Node* consumer : it->second)
+                    {
+                        if (members.count(consumer) == 0)
+                        {
+                            has_consumers = true;
+                            neighbour_placements.insert(consumer->get_placement_index());
+                        }
+                    }
+                }
+            }
+            // Pieces at the edge of the function stay on their preferred backend
+            if (!movable || !has_producers || !has_consumers)
+            {
+                continue;
+            }
+
+            auto count_boundaries = [&](size_t piece_placement) {
+                auto placement = [&](Node* node) {
+                    return members.count(node) ? piece_placement : node->get_placement_index();
+                };
+                size_t count = 0;
+                for (const PlacedValue& value : values)
+                {
+                    for (Node* consumer : graph.consumers[value])
+                    {
+                        if (placement(consumer) != placement(value.first))
+                        {
+                            count++;
+                            break;
+                        }
+                    }
+                }
+                return count;
+            };
+            size_t boundaries = count_boundaries(piece.front()->get_placement_index());
+            for (size_t placement : neighbour_placements)
+            {
+                size_t moved_boundaries = count_boundaries(placement);
+                if (moved_boundaries >= boundaries || boundaries - moved_boundaries <= best_gain)
+                {
+                    continue;
+                }
+                auto& backend = m_placement_backends.at(placement);
+                bool supported = true;
+                for (Node* op : piece)
+                {
+                    supported = supported && backend->is_supported(*op);
+                }
+                if (supported)
+                {
+                    best_piece = &piece;
+                    best_placement = placement;
+                    best_gain = boundaries - moved_boundaries;
+                }
+            }
+        }
+        if (best_piece == nullptr)
+        {
+            break;
+        }
+        for (Node* op : *best_piece)
+        {
+            NGRAPH_DEBUG << "Moving " << op->get_name() << " to placement " << best_placement
+                         << " with its neighbours";
+            op->set_placement_index(best_placement);
+        }
+    }
+
+    for (auto& op : ops)
+    {
+        if (follows_argument(op.get()))
+        {
+            Node* argument = op->input_value(0).get_node();
+            op->set_placement_index(is_placed(argument) ? argument->get_placement_index() : 0);
+        }
+    }
+    return false;
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            namespace pass
+            {
+                class AssignPlacement;
+            }
+        }
+    }
+}
+
+/// \brief Sets the placement index of every op to the first backend in `placement_backends`
+///        that supports it, or to the last backend, the fallback, if none does.
+///
+/// The pass then lowers the number of boundary tensors, the computed values that are used on
+/// another placement than the one computing them. It repeatedly moves a whole piece, a maximal
+/// connected set of ops with one placement, to a neighbouring backend that supports all of its
+/// ops, taking the move that removes the most boundary tensors. This is a local search rather
+/// than an exact minimum cut: it stops once no single piece move lowers the count. Pieces at
+/// the edge of the function, which take no computed value from another piece or pass none to
+/// one, are not moved, since otherwise the minimum is usually the whole function on the
+/// fallback.
+///
+/// Results and GetOutputElements follow their argument; parameters and constants keep no
+/// placement. Ops that already have a valid placement index are left where they are.
+class ngraph::runtime::hybrid::pass::AssignPlacement : public ngraph::pass::FunctionPass
+{
+public:
+    AssignPlacement(const std::vector<std::shared_ptr<runtime::Backend>>& placement_backends);
+
+    bool run_on_function(std::shared_ptr<Function> f) override;
+
+private:
+    std::vector<std::shared_ptr<runtime::Backend>> m_placement_backends;
+};
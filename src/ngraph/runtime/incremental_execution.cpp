@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/incremental_execution.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/send.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::IncrementalExecution::IncrementalExecution(const vector<shared_ptr<Node>>& nodes,
+                                                   size_t alignment,
+                                                   Allocator* allocator)
+    : m_alignment(alignment)
+    , m_allocator(allocator)
+{
+    for (auto& node : nodes)
+    {
+        if (node->is_output() || node->has_state() || is_type<op::AllReduce>(node) ||
+            is_type<op::BroadcastDistributed>(node) || is_type<op::Send>(node) ||
+            is_type<op::Recv>(node))
+        {
+            m_always_execute.insert(node.get());
+        }
+    }
+}
+
+void runtime::IncrementalExecution::begin_call(const ParameterVector& parameters,
+                                               const vector<shared_ptr<HostTensor>>& inputs)
+{
+    m_reuse = m_valid && m_previous_inputs.size() == inputs.size();
+    m_valid = false;
+
+    m_previous_inputs.resize(inputs.size());
+    size_t input_count = 0;
+    for (auto& parameter : parameters)
+    {
+        for (size_t i = 0; i < parameter->get_output_size(); ++i)
+        {
+            auto& input = inputs.at(input_count);
+            auto& previous = m_previous_inputs[input_count];
+            bool stale = !m_reuse || input->get_stale() || previous.lock() != input;
+            m_stale[&parameter->output(i).get_tensor()] = stale;
+            previous = input;
+            input_count++;
+        }
+    }
+}
+
+void runtime::IncrementalExecution::end_call()
+{
+    m_valid = true;
+}
+
+bool runtime::IncrementalExecution::needs_execution(const Node& node)
+{
+    bool execute = !m_reuse || m_always_execute.count(&node) != 0;
+    for (auto& input : node.inputs())
+    {
+        if (execute)
+        {
+            break;
+        }
+        auto it = m_stale.find(&input.get_tensor());
+        execute = it == m_stale.end() || it->second;
+    }
+    for (size_t i = 0; i < node.get_output_size(); ++i)
+    {
+        m_stale[&node.get_output_tensor(i)] = execute;
+    }
+    return execute;
+}
+
+shared_ptr<runtime::HostTensor>
+    runtime::IncrementalExecution::get_tensor(descriptor::Tensor* tensor,
+                                              const element::Type& element_type,
+                                              const Shape& shape,
+                                              const string& name)
+{
+    auto& host_tensor = m_tensors[tensor];
+    if (!host_tensor)
+    {
+        m_buffers.emplace_back(tensor->size(), m_alignment, m_allocator);
+        host_tensor =
+            make_shared<HostTensor>(element_type, shape, m_buffers.back().get_ptr(), name);
+    }
+    return host_tensor;
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class IncrementalExecution;
+    }
+}
+
+/// \brief Dependency-driven re-execution for executables that run a function node by node on
+///        HostTensors.
+///
+/// Intermediate tensors are kept between calls. A node runs again only if one of its inputs is
+/// stale: a parameter whose tensor reports get_stale(), or was swapped for another tensor since
+/// the previous call, or the output of a node that ran in this call. Results, nodes with state
+/// and communication ops always run. A call that does not complete invalidates the cache, so
+/// the next call runs every node.
+class ngraph::runtime::IncrementalExecution
+{
+public:
+    /// \brief Keeps the temporaries of `nodes` between calls. They are allocated with
+    ///        `allocator`, ngraph_malloc if null, and held until the cache is destroyed.
+    IncrementalExecution(const std::vector<std::shared_ptr<Node>>& nodes,
+                         size_t alignment,
+                         Allocator* allocator = nullptr);
+
+    /// \brief Held for the duration of a call that uses the cache. Calls that find it locked
+    ///        run without the cache.
+    std::mutex& get_mutex() { return m_mutex; }
+    /// \brief Records the staleness of the parameters for the call that is starting.
+    void begin_call(const ParameterVector& parameters,
+                    const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    /// \brief Marks the cache valid again after every node of a call ran.
+    void end_call();
+    /// \brief Returns true if `node` has to run in this call and marks its outputs stale or
+    ///        fresh accordingly. Every node other than the parameters must be queried, in
+    ///        topological order.
+    bool needs_execution(const Node& node);
+    /// \brief Returns the HostTensor that holds `tensor` across calls, creating it if needed.
+    std::shared_ptr<HostTensor> get_tensor(descriptor::Tensor* tensor,
+                                           const element::Type& element_type,
+                                           const Shape& shape,
+                                           const std::string& name);
+
+private:
+    std::unordered_set<const Node*> m_always_execute;
+    std::unordered_map<const descriptor::Tensor*, bool> m_stale;
+    std::vector<AlignedBuffer> m_buffers;
+    std::unordered_map<const descriptor::Tensor*, std::shared_ptr<HostTensor>> m_tensors;
+    size_t m_alignment;
+    Allocator* m_allocator;
+    std::vector<std::weak_ptr<HostTensor>> m_previous_inputs;
+    bool m_valid = false;
+    bool m_reuse = false;
+    std::mutex m_mutex;
+};
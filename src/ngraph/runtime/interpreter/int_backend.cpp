@@ -61,7 +61,8 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    return make_shared<INTExecutable>(
+        function, enable_performance_collection, m_incremental_execution, m_allocator);
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -69,6 +70,13 @@ bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
 
+bool runtime::interpreter::INTBackend::is_supported_property(const Property prop) const
+{
+    // Compilation works on a private clone of the function and tensors are HostTensors, which
+    // may wrap memory of the caller
+    return prop == Property::concurrent_compile || prop == Property::memory_attach;
+}
+
 std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istream& in)
 {
     shared_ptr<Executable> exec;
@@ -92,7 +100,7 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string, m_allocator));
                 break;
             }
         }
@@ -110,5 +118,27 @@ bool runtime::interpreter::INTBackend::set_config(const map<string, string>& con
         error = it->second;
         rc = true;
     }
+    it = config.find("incremental_execution");
+    if (it != config.end())
+    {
+        m_incremental_execution = it->second == "true";
+        rc = true;
+    }
     return rc;
 }
+
+runtime::Allocator* runtime::interpreter::INTBackend::get_host_memory_allocator()
+{
+    return m_allocator ? m_allocator : runtime::get_default_allocator();
+}
+
+void runtime::interpreter::INTBackend::set_host_memory_allocator(Allocator* allocator)
+{
+    if (m_allocator)
+    {
+        // Executables compiled with the existing allocator still free their memory through it
+        throw ngraph_error(
+            "Allocator already exists. Changing allocators mid-execution is not permitted.");
+    }
+    m_allocator = allocator;
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
@@ -27,8 +29,10 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
+#include "ngraph/pass/pack_binary_weights.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/chrome_trace.hpp"
+#include "ngraph/runtime/reference/tensor_iterator.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -36,6 +40,11 @@ using namespace std;
 using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
+using runtime::reference::AxisExtent;
+using runtime::reference::gather_slice;
+using runtime::reference::iteration_count;
+using runtime::reference::scatter_slice;
+using runtime::reference::slice_offset;
 
 runtime::interpreter::OP_TYPEID
     runtime::interpreter::INTExecutable::get_typeid(const NodeTypeInfo& type_info)
@@ -63,34 +72,58 @@ runtime::interpreter::OP_TYPEID
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
-                                                   bool enable_performance_collection)
+                                                   bool enable_performance_collection,
+                                                   bool incremental_execution,
+                                                   Allocator* allocator)
     : m_is_compiled{true}
     , m_performance_counters_enabled{enable_performance_collection}
 {
     m_function = clone_function(*function);
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::LikeReplacement>();
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    // TensorIterator is executed natively by iterating its compiled body, and the
+    // normalizations and attention by fused kernels
+    pass_manager.register_pass<pass::FusedOpDecomposition>([](const Node& node) {
+        return is_type<op::TensorIterator>(&node) || is_type<op::LayerNorm>(&node) ||
+               is_type<op::LogSoftmax>(&node) || is_type<op::MVN>(&node) ||
+               is_type<op::ScaledDotProductAttention>(&node);
+    });
     pass_manager.register_pass<pass::Opset0Downgrade>();
+    pass_manager.register_pass<pass::PackBinaryWeights>();
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
     pass_manager.run_passes(m_function);
+    m_memory_plan.reset(new HostMemoryPlan(m_function, get_alignment(), allocator));
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
     }
+    if (incremental_execution)
+    {
+        m_incremental.reset(new IncrementalExecution(m_nodes, get_alignment(), allocator));
+    }
+    compile_tensor_iterator_bodies();
+    pack_quantized_weights();
     set_parameters_and_results(*m_function);
 }
 
-runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
+runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string,
+                                                   Allocator* allocator)
     : m_is_compiled{true}
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(m_function);
+    m_memory_plan.reset(new HostMemoryPlan(m_function, get_alignment(), allocator));
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
     }
+    compile_tensor_iterator_bodies();
+    pack_quantized_weights();
     set_parameters_and_results(*m_function);
 }
 
@@ -119,6 +152,27 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         func_outputs.push_back(host_tensor);
     }
 
+    // With incremental execution, intermediate tensors are kept between calls so that nodes
+    // whose inputs did not change can be skipped. A concurrent call finds the cache in use and
+    // runs without it.
+    unique_lock<mutex> cache_lock;
+    if (m_incremental)
+    {
+        cache_lock = unique_lock<mutex>(m_incremental->get_mutex(), try_to_lock);
+    }
+    IncrementalExecution* incremental = cache_lock.owns_lock() ? m_incremental.get() : nullptr;
+    if (incremental)
+    {
+        incremental->begin_call(get_parameters(), func_inputs);
+    }
+    // Calls without the cache place their temporaries in the planned memory, which is
+    // released when the call returns
+    unique_ptr<HostMemoryPlan::Allocation> memory;
+    if (!incremental && m_memory_plan && m_memory_plan->is_planned())
+    {
+        memory = m_memory_plan->allocate(func_outputs, func_inputs);
+    }
+
     // map function params -> HostTensor
     unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
     size_t input_count = 0;
@@ -172,7 +226,18 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
                 const Shape& shape = op->get_output_shape(i);
                 const element::Type& type = op->get_output_element_type(i);
                 string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                if (incremental)
+                {
+                    host_tensor = incremental->get_tensor(tensor, type, shape, name);
+                }
+                else
+                {
+                    host_tensor = memory ? memory->get_tensor(tensor) : nullptr;
+                    if (!host_tensor)
+                    {
+                        host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                    }
+                }
                 tensor_map.insert({tensor, host_tensor});
             }
             else
@@ -182,6 +247,12 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             op_outputs.push_back(host_tensor);
         }
 
+        // skip the node if none of its inputs changed since the previous call
+        if (incremental && !incremental->needs_execution(*op))
+        {
+            continue;
+        }
+
         // get op type
         element::Type type;
         if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
@@ -201,6 +272,11 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             type = op->get_output_element_type(1);
         }
+        else if (is_type<op::Constant>(op) && op->get_output_element_type(0) == element::u1)
+        {
+            // Packed u1 constants are copied byte-wise
+            type = element::u8;
+        }
         else
         {
             type = op->get_output_element_type(0);
@@ -221,6 +297,15 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         }
     }
 
+    for (auto& output : func_outputs)
+    {
+        output->set_stale(true);
+    }
+    if (incremental)
+    {
+        incremental->end_call();
+    }
+
     return true;
 }
 
@@ -253,6 +338,298 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     }
 }
 
+void runtime::interpreter::INTExecutable::compile_tensor_iterator_bodies()
+{
+    for (auto node : m_nodes)
+    {
+        if (auto ti = as_type_ptr<op::TensorIterator>(node))
+        {
+            auto body = ti->get_body();
+            auto body_function =
+                make_shared<Function>(body->get_results(), body->get_parameters());
+            m_body_executables[node.get()] =
+                make_shared<INTExecutable>(body_function, m_performance_counters_enabled);
+        }
+    }
+}
+
+void runtime::interpreter::INTExecutable::pack_quantized_weights()
+{
+    for (auto node : m_nodes)
+    {
+        auto qd = as_type_ptr<op::QuantizedDot>(node);
+        auto qc = as_type_ptr<op::QuantizedConvolution>(node);
+        if (!qd && !qc)
+        {
+            continue;
+        }
+        auto weights = as_type_ptr<op::Constant>(node->get_argument(1));
+        auto zero_point = as_type_ptr<op::Constant>(node->get_argument(5));
+        if (!weights || !zero_point || node->get_input_element_type(0) != element::u8)
+        {
+            continue;
+        }
+
+        auto packed = make_shared<reference::QuantizedPackedWeights>();
+        const Shape& shape = weights->get_shape();
+        if (weights->get_element_type() == element::u8)
+        {
+            auto data = weights->get_data_ptr<uint8_t>();
+            auto zp = zero_point->get_data_ptr<uint8_t>()[0];
+            if (qd)
+            {
+                reference::pack_quantized_dot_weights(
+                    data, shape, qd->get_reduction_axes_count(), zp, *packed);
+            }
+            else
+            {
+                reference::pack_quantized_convolution_weights(data, shape, zp, *packed);
+            }
+        }
+        else if (weights->get_element_type() == element::i8)
+        {
+            auto data = weights->get_data_ptr<int8_t>();
+            auto zp = zero_point->get_data_ptr<int8_t>()[0];
+            if (qd)
+            {
+                reference::pack_quantized_dot_weights(
+                    data, shape, qd->get_reduction_axes_count(), zp, *packed);
+            }
+            else
+            {
+                reference::pack_quantized_convolution_weights(data, shape, zp, *packed);
+            }
+        }
+        else
+        {
+            continue;
+        }
+        m_quantized_weights[node.get()] = packed;
+    }
+}
+
+void runtime::interpreter::INTExecutable::tensor_iterator(
+    const Node& node,
+    const vector<shared_ptr<HostTensor>>& out,
+    const vector<shared_ptr<HostTensor>>& args)
+{
+    using SliceInput = op::TensorIterator::SliceInputDescription;
+    using MergedInput = op::TensorIterator::MergedInputDescription;
+    using ConcatOutput = op::TensorIterator::ConcatOutputDescription;
+    using BodyOutput = op::TensorIterator::BodyOutputDescription;
+
+    const op::TensorIterator& ti = static_cast<const op::TensorIterator&>(node);
+    shared_ptr<INTExecutable> body = m_body_executables.at(&node);
+    body->set_nan_check(m_nan_check_enabled);
+    const ParameterVector& body_parameters = body->get_parameters();
+    const ResultVector& body_results = body->get_results();
+
+    // The trip count follows the actual extent of the sliced inputs rather than the value
+    // inferred at validation time
+    int64_t num_iterations = -1;
+    for (auto& description : ti.get_input_descriptions())
+    {
+        if (auto slice = as_type_ptr<SliceInput>(description))
+        {
+            size_t dim_size = args[slice->m_input_index]->get_shape().at(slice->m_axis);
+            int64_t count =
+                iteration_count(slice->m_start, slice->m_end, slice->m_part_size, dim_size);
+            NGRAPH_CHECK(num_iterations == -1 || num_iterations == count,
+                         "TensorIterator sliced inputs disagree on the number of iterations");
+            num_iterations = count;
+        }
+    }
+    if (num_iterations == -1)
+    {
+        num_iterations = ti.get_num_iterations();
+    }
+    NGRAPH_CHECK(num_iterations > 0, "TensorIterator requires at least one iteration");
+
+    vector<shared_ptr<runtime::Tensor>> body_inputs(body_parameters.size());
+    vector<shared_ptr<runtime::Tensor>> body_outputs(body_results.size());
+
+    struct SlicedInput
+    {
+        shared_ptr<SliceInput> description;
+        AxisExtent extent;
+        shared_ptr<HostTensor> scratch;
+    };
+    struct BackEdge
+    {
+        size_t parameter_index;
+        size_t result_index;
+        shared_ptr<HostTensor> buffers[2];
+    };
+    vector<SlicedInput> sliced_inputs;
+    vector<BackEdge> back_edges;
+    vector<bool> result_assigned(body_results.size(), false);
+
+    for (auto& description : ti.get_input_descriptions())
+    {
+        const shared_ptr<HostTensor>& arg = args[description->m_input_index];
+        size_t parameter_index = description->m_body_parameter_index;
+        if (auto slice = as_type_ptr<SliceInput>(description))
+        {
+            AxisExtent extent(arg->get_shape(), slice->m_axis, arg->get_element_type().size());
+            shared_ptr<HostTensor> scratch;
+            if (!extent.is_contiguous())
+            {
+                const auto& parameter = body_parameters.at(parameter_index);
+                scratch = make_shared<HostTensor>(parameter->get_element_type(),
+                                                  parameter->get_shape());
+            }
+            sliced_inputs.push_back(SlicedInput{slice, extent, scratch});
+        }
+        else if (auto merged = as_type_ptr<MergedInput>(description))
+        {
+            // Double-buffered: iteration i reads buffers[i % 2] and its body writes the
+            // successive value into buffers[(i + 1) % 2]
+            BackEdge edge;
+            edge.parameter_index = parameter_index;
+            edge.result_index = merged->m_body_value_index;
+            for (auto& buffer : edge.buffers)
+            {
+                buffer = make_shared<HostTensor>(arg->get_element_type(), arg->get_shape());
+            }
+            memcpy(edge.buffers[0]->get_data_ptr(), arg->get_data_ptr(), arg->get_size_in_bytes());
+            result_assigned.at(edge.result_index) = true;
+            back_edges.push_back(edge);
+        }
+        else
+        {
+            body_inputs.at(parameter_index) = arg;
+        }
+    }
+
+    // Contiguous concatenated outputs are written by the body directly into the output
+    struct ConcatenatedOutput
+    {
+        shared_ptr<ConcatOutput> description;
+        AxisExtent extent;
+        bool in_place;
+    };
+    vector<ConcatenatedOutput> concat_outputs;
+    vector<shared_ptr<BodyOutput>> iteration_outputs;
+    for (auto& description : ti.get_output_descriptions())
+    {
+        if (auto concat = as_type_ptr<ConcatOutput>(description))
+        {
+            const shared_ptr<HostTensor>& output = out[concat->m_output_index];
+            AxisExtent extent(
+                output->get_shape(), concat->m_axis, output->get_element_type().size());
+            bool in_place =
+                extent.is_contiguous() && !result_assigned.at(concat->m_body_value_index);
+            if (in_place)
+            {
+                result_assigned.at(concat->m_body_value_index) = true;
+            }
+            concat_outputs.push_back(ConcatenatedOutput{concat, extent, in_place});
+        }
+        else if (auto body_output = as_type_ptr<BodyOutput>(description))
+        {
+            iteration_outputs.push_back(body_output);
+        }
+    }
+
+    for (size_t i = 0; i < body_results.size(); i++)
+    {
+        if (!result_assigned[i])
+        {
+            body_outputs[i] = make_shared<HostTensor>(body_results[i]->get_element_type(),
+                                                      body_results[i]->get_shape());
+        }
+    }
+
+    for (size_t iteration = 0; iteration < static_cast<size_t>(num_iterations); iteration++)
+    {
+        for (auto& input : sliced_inputs)
+        {
+            const shared_ptr<SliceInput>& slice = input.description;
+            const shared_ptr<HostTensor>& arg = args[slice->m_input_index];
+            size_t offset = slice_offset(slice->m_start,
+                                         slice->m_stride,
+                                         slice->m_part_size,
+                                         input.extent.axis_size,
+                                         iteration);
+            if (input.scratch)
+            {
+                gather_slice(input.scratch->get_data_ptr(),
+                             arg->get_data_ptr(),
+                             input.extent,
+                             offset,
+                             slice->m_part_size);
+                body_inputs[slice->m_body_parameter_index] = input.scratch;
+            }
+            else
+            {
+                const auto& parameter = body_parameters.at(slice->m_body_parameter_index);
+                body_inputs[slice->m_body_parameter_index] = make_shared<HostTensor>(
+                    parameter->get_element_type(),
+                    parameter->get_shape(),
+                    arg->get_data_ptr() + offset * input.extent.inner_bytes);
+            }
+        }
+        for (auto& edge : back_edges)
+        {
+            body_inputs[edge.parameter_index] = edge.buffers[iteration % 2];
+            body_outputs[edge.result_index] = edge.buffers[(iteration + 1) % 2];
+        }
+        for (auto& output : concat_outputs)
+        {
+            if (output.in_place)
+            {
+                const shared_ptr<ConcatOutput>& concat = output.description;
+                const auto& result = body_results.at(concat->m_body_value_index);
+                size_t offset = slice_offset(concat->m_start,
+                                             concat->m_stride,
+                                             concat->m_part_size,
+                                             output.extent.axis_size,
+                                             iteration);
+                body_outputs[concat->m_body_value_index] = make_shared<HostTensor>(
+                    result->get_element_type(),
+                    result->get_shape(),
+                    out[concat->m_output_index]->get_data_ptr() +
+                        offset * output.extent.inner_bytes);
+            }
+        }
+
+        body->call(body_outputs, body_inputs);
+
+        for (auto& output : concat_outputs)
+        {
+            if (!output.in_place)
+            {
+                const shared_ptr<ConcatOutput>& concat = output.description;
+                auto value = static_pointer_cast<HostTensor>(
+                    body_outputs[concat->m_body_value_index]);
+                size_t offset = slice_offset(concat->m_start,
+                                             concat->m_stride,
+                                             concat->m_part_size,
+                                             output.extent.axis_size,
+                                             iteration);
+                scatter_slice(out[concat->m_output_index]->get_data_ptr(),
+                              value->get_data_ptr(),
+                              output.extent,
+                              offset,
+                              concat->m_part_size);
+            }
+        }
+        for (auto& body_output : iteration_outputs)
+        {
+            int64_t wanted = body_output->m_iteration < 0
+                                 ? num_iterations + body_output->m_iteration
+                                 : body_output->m_iteration;
+            if (wanted == static_cast<int64_t>(iteration))
+            {
+                auto value = static_pointer_cast<HostTensor>(
+                    body_outputs[body_output->m_body_value_index]);
+                const shared_ptr<HostTensor>& output = out[body_output->m_output_index];
+                memcpy(output->get_data_ptr(), value->get_data_ptr(), output->get_size_in_bytes());
+            }
+        }
+    }
+}
+
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
 {
     m_nan_check_enabled = enable;
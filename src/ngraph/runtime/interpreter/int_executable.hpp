@@ -26,7 +26,9 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_memory_plan.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/incremental_execution.hpp"
 #ifdef INTERPRETER_USE_HYBRID
 #include "ngraph/runtime/hybrid/op/function_call.hpp"
 #endif
@@ -45,6 +47,7 @@
 #include "ngraph/runtime/reference/avg_pool.hpp"
 #include "ngraph/runtime/reference/batch_mat_mul.hpp"
 #include "ngraph/runtime/reference/batch_norm.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/broadcast_distributed.hpp"
 #include "ngraph/runtime/reference/ceiling.hpp"
@@ -69,8 +72,10 @@
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_eq.hpp"
 #include "ngraph/runtime/reference/less.hpp"
+#include "ngraph/runtime/reference/layer_norm.hpp"
 #include "ngraph/runtime/reference/less_eq.hpp"
 #include "ngraph/runtime/reference/log.hpp"
+#include "ngraph/runtime/reference/log_softmax.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
@@ -78,6 +83,7 @@
 #include "ngraph/runtime/reference/min.hpp"
 #include "ngraph/runtime/reference/minimum.hpp"
 #include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/mvn.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
 #include "ngraph/runtime/reference/not.hpp"
 #include "ngraph/runtime/reference/not_equal.hpp"
@@ -87,6 +93,8 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/random_uniform.hpp"
 #include "ngraph/runtime/reference/recv.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -95,6 +103,7 @@
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/scaled_dot_product_attention.hpp"
 #include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
 #include "ngraph/runtime/reference/select.hpp"
@@ -114,8 +123,8 @@
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/runtime/tensor.hpp"
-#include "ngraph/state/bernoulli_rng_state.hpp"
-#include "ngraph/state/uniform_rng_state.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
+#include "ngraph/validation_util.hpp"
 
 namespace ngraph
 {
@@ -157,8 +166,14 @@ class ngraph::runtime::interpreter::INTExecutable : public Executable
     friend class INTBackend;
 
 public:
+    /// \param incremental_execution Keep the temporaries between calls and skip the nodes
+    ///        whose inputs are not stale, instead of running every call on the memory planned
+    ///        by HostMemoryPlan
+    /// \param allocator Allocator of the temporaries, ngraph_malloc if null
     INTExecutable(const std::shared_ptr<Function>& function,
-                  bool enable_performance_collection = false);
+                  bool enable_performance_collection = false,
+                  bool incremental_execution = false,
+                  Allocator* allocator = nullptr);
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& inputs) override;
@@ -180,7 +195,7 @@ public:
         create_output_tensor(size_t output_index, size_t pipeline_depth) override;
 
 private:
-    INTExecutable(const std::string& model_string);
+    INTExecutable(const std::string& model_string, Allocator* allocator = nullptr);
 
     std::shared_ptr<ngraph::op::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::Result> get_result(size_t index) const;
@@ -191,7 +206,12 @@ private:
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    std::unique_ptr<IncrementalExecution> m_incremental;
+    std::unique_ptr<HostMemoryPlan> m_memory_plan;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    std::unordered_map<const Node*, std::shared_ptr<INTExecutable>> m_body_executables;
+    std::unordered_map<const Node*, std::shared_ptr<reference::QuantizedPackedWeights>>
+        m_quantized_weights;
     std::set<std::string> m_unsupported_op_name_list;
 
     static OP_TYPEID get_typeid(const NodeTypeInfo& type_info);
@@ -199,6 +219,19 @@ private:
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
+    /// \brief Compiles the body of every TensorIterator in the function once, so that
+    ///        iterations run the body without unrolling it into the outer graph.
+    void compile_tensor_iterator_bodies();
+
+    /// \brief Repacks the weights of every QuantizedDot and QuantizedConvolution whose
+    ///        weights and weight zero point are constants, so the integer kernels do not
+    ///        repack them on every call.
+    void pack_quantized_weights();
+
+    void tensor_iterator(const Node& node,
+                         const std::vector<std::shared_ptr<HostTensor>>& out,
+                         const std::vector<std::shared_ptr<HostTensor>>& args);
+
     void generate_calls(const element::Type& type,
                         const Node& op,
                         const std::vector<std::shared_ptr<HostTensor>>& outputs,
@@ -379,7 +412,28 @@ private:
         }
         case OP_TYPEID::BinaryConvolution_v1:
         {
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
+            const op::v1::BinaryConvolution* bin_conv =
+                static_cast<const op::v1::BinaryConvolution*>(&node);
+            const uint8_t* packed_filter = args[1]->get_data_ptr<const uint8_t>();
+            std::vector<uint8_t> filter_bits;
+            if (node.get_input_element_type(1) != element::u1)
+            {
+                size_t filter_count = shape_size(node.get_input_shape(1));
+                filter_bits.resize((filter_count + 7) / 8);
+                reference::pack_u1<T>(
+                    args[1]->get_data_ptr<const T>(), filter_bits.data(), filter_count);
+                packed_filter = filter_bits.data();
+            }
+            reference::binary_convolution<T>(args[0]->get_data_ptr<const T>(),
+                                              packed_filter,
+                                              out[0]->get_data_ptr<T>(),
+                                              node.get_input_shape(0),
+                                              node.get_input_shape(1),
+                                              node.get_output_shape(0),
+                                              bin_conv->get_strides(),
+                                              bin_conv->get_dilations(),
+                                              bin_conv->get_pads_begin(),
+                                              bin_conv->get_pad_value());
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -389,17 +443,20 @@ private:
             {
                 const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
                 auto seed = use_seed ? gm->get_seed() : 0;
-                m_states[&node] =
-                    std::unique_ptr<State>(new BernoulliRNGState(seed, gm->get_probability()));
+                m_states[&node] = std::unique_ptr<State>(new PhiloxRNGState(seed));
             }
 
             bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
-            auto state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
+            auto state = static_cast<PhiloxRNGState*>(m_states.at(&node).get());
             size_t element_count = shape_size(node.get_output_shape(0));
             if (!use_seed)
             {
-                reference::generate_mask<T>(
-                    out[0]->get_data_ptr<T>(), element_count, state, training);
+                const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
+                reference::generate_mask<T>(out[0]->get_data_ptr<T>(),
+                                            element_count,
+                                            state,
+                                            training,
+                                            gm->get_probability());
             }
             else
             {
@@ -414,7 +471,10 @@ private:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
             size_t num_bytes = element_count * node.get_output_element_type(0).size();
-            std::memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), num_bytes);
+            if (out[0]->get_data_ptr() != args[0]->get_data_ptr())
+            {
+                std::memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), num_bytes);
+            }
             break;
         }
         case OP_TYPEID::BatchMatMul:
@@ -555,7 +615,7 @@ private:
         case OP_TYPEID::Constant:
         {
             const op::Constant* c = static_cast<const op::Constant*>(&node);
-            size_t element_count = shape_size(node.get_output_shape(0));
+            size_t element_count = out[0]->get_size_in_bytes() / sizeof(T);
             reference::constant<T>(c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
@@ -951,6 +1011,28 @@ private:
                                      greater_eq->get_autob());
             break;
         }
+        case OP_TYPEID::LayerNorm:
+        {
+            const op::LayerNorm* layer_norm = static_cast<const op::LayerNorm*>(&node);
+            const Shape& shape = node.get_input_shape(0);
+            int64_t begin_norm_axis = layer_norm->get_begin_norm_axis();
+            if (begin_norm_axis < 0)
+            {
+                begin_norm_axis += shape.size();
+            }
+            bool use_affine = layer_norm->get_use_affine();
+            bool keep_stats = layer_norm->get_keep_stats();
+            reference::layer_norm<T>(args[0]->get_data_ptr<const T>(),
+                                     use_affine ? args[1]->get_data_ptr<const T>() : nullptr,
+                                     use_affine ? args[2]->get_data_ptr<const T>() : nullptr,
+                                     out[0]->get_data_ptr<T>(),
+                                     keep_stats ? out[1]->get_data_ptr<T>() : nullptr,
+                                     keep_stats ? out[2]->get_data_ptr<T>() : nullptr,
+                                     shape,
+                                     static_cast<size_t>(begin_norm_axis),
+                                     layer_norm->get_epsilon());
+            break;
+        }
         case OP_TYPEID::Less:
         {
             auto less = static_cast<const op::Less*>(&node);
@@ -991,6 +1073,20 @@ private:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::LogSoftmax:
+        {
+            const op::LogSoftmax* log_softmax = static_cast<const op::LogSoftmax*>(&node);
+            const Shape& shape = node.get_input_shape(0);
+            size_t axis = normalize_axis(&node, log_softmax->get_axis(), shape.size());
+            AxisSet axes;
+            for (size_t i = axis; i < shape.size(); i++)
+            {
+                axes.insert(i);
+            }
+            reference::log_softmax<T>(
+                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), shape, axes);
+            break;
+        }
         case OP_TYPEID::LogicalAnd_v1:
         {
             auto logical_and = static_cast<const op::v1::LogicalAnd*>(&node);
@@ -1109,6 +1205,17 @@ private:
                                   minimum->get_autob());
             break;
         }
+        case OP_TYPEID::MVN:
+        {
+            const op::MVN* mvn = static_cast<const op::MVN*>(&node);
+            reference::mvn<T>(args[0]->get_data_ptr<const T>(),
+                              out[0]->get_data_ptr<T>(),
+                              node.get_input_shape(0),
+                              mvn->get_reduction_axes(),
+                              mvn->get_normalize_variance(),
+                              mvn->get_eps());
+            break;
+        }
         case OP_TYPEID::Multiply:
         {
             auto multiply = static_cast<const op::Multiply*>(&node);
@@ -1264,11 +1371,14 @@ private:
             auto input_element_type = qc->get_input_element_type(0);
             auto filter_element_type = qc->get_input_element_type(1);
             auto output_element_type = qc->get_output_element_type(0);
+            auto packed = m_quantized_weights.find(&node);
+            const reference::QuantizedPackedWeights* weights =
+                packed == m_quantized_weights.end() ? nullptr : packed->second.get();
 
             if (input_element_type == element::u8 && filter_element_type == element::i8 &&
                 output_element_type == element::i8)
             {
-                reference::convolution<uint8_t, int8_t, int8_t, int32_t>(
+                reference::quantized_convolution<int8_t, int8_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const int8_t>(),
                     out[0]->get_data_ptr<int8_t>(),
@@ -1278,19 +1388,19 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const int8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int8_t>());
+                    args[7]->get_data_ptr<const int8_t>(),
+                    weights);
             }
             else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
                      output_element_type == element::u8)
             {
-                reference::convolution<uint8_t, uint8_t, uint8_t, int32_t>(
+                reference::quantized_convolution<uint8_t, uint8_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const uint8_t>(),
                     out[0]->get_data_ptr<uint8_t>(),
@@ -1300,19 +1410,19 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const uint8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const uint8_t>());
+                    args[7]->get_data_ptr<const uint8_t>(),
+                    weights);
             }
             else if (input_element_type == element::u8 && filter_element_type == element::i8 &&
                      output_element_type == element::i32)
             {
-                reference::convolution<uint8_t, int8_t, int32_t, int32_t>(
+                reference::quantized_convolution<int8_t, int32_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const int8_t>(),
                     out[0]->get_data_ptr<int32_t>(),
@@ -1322,19 +1432,19 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const int8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
+                    args[7]->get_data_ptr<const int32_t>(),
+                    weights);
             }
             else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
                      output_element_type == element::i32)
             {
-                reference::convolution<uint8_t, uint8_t, int32_t, int32_t>(
+                reference::quantized_convolution<uint8_t, int32_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const uint8_t>(),
                     out[0]->get_data_ptr<int32_t>(),
@@ -1344,14 +1454,14 @@ private:
                     qc->get_window_movement_strides(),
                     qc->get_window_dilation_strides(),
                     qc->get_padding_below(),
-                    qc->get_padding_above(),
                     qc->get_data_dilation_strides(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const uint8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
+                    args[7]->get_data_ptr<const int32_t>(),
+                    weights);
             }
             else
             {
@@ -1375,78 +1485,81 @@ private:
             auto input0_element_type = qd->get_input_element_type(0);
             auto input1_element_type = qd->get_input_element_type(1);
             auto output_element_type = qd->get_output_element_type(0);
+            auto packed = m_quantized_weights.find(&node);
+            const reference::QuantizedPackedWeights* weights =
+                packed == m_quantized_weights.end() ? nullptr : packed->second.get();
 
             if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
                 output_element_type == element::i8)
             {
-                reference::dot<uint8_t, int8_t, int8_t, int32_t>(
+                reference::quantized_dot<int8_t, int8_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const int8_t>(),
                     out[0]->get_data_ptr<int8_t>(),
                     node.get_input_shape(0),
                     node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
+                    qd->get_reduction_axes_count(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const int8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int8_t>());
+                    args[7]->get_data_ptr<const int8_t>(),
+                    weights);
             }
             else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
                      output_element_type == element::u8)
             {
-                reference::dot<uint8_t, uint8_t, uint8_t, int32_t>(
+                reference::quantized_dot<uint8_t, uint8_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const uint8_t>(),
                     out[0]->get_data_ptr<uint8_t>(),
                     node.get_input_shape(0),
                     node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
+                    qd->get_reduction_axes_count(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const uint8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const uint8_t>());
+                    args[7]->get_data_ptr<const uint8_t>(),
+                    weights);
             }
             else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
                      output_element_type == element::i32)
             {
-                reference::dot<uint8_t, uint8_t, int32_t, int32_t>(
+                reference::quantized_dot<uint8_t, int32_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const uint8_t>(),
                     out[0]->get_data_ptr<int32_t>(),
                     node.get_input_shape(0),
                     node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
+                    qd->get_reduction_axes_count(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const uint8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
+                    args[7]->get_data_ptr<const int32_t>(),
+                    weights);
             }
             else if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
                      output_element_type == element::i32)
             {
-                reference::dot<uint8_t, int8_t, int32_t, int32_t>(
+                reference::quantized_dot<int8_t, int32_t>(
                     args[0]->get_data_ptr<const uint8_t>(),
                     args[1]->get_data_ptr<const int8_t>(),
                     out[0]->get_data_ptr<int32_t>(),
                     node.get_input_shape(0),
                     node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
+                    qd->get_reduction_axes_count(),
                     args[2]->get_data_ptr<const float>(),
                     args[3]->get_data_ptr<const uint8_t>(),
                     args[4]->get_data_ptr<const float>(),
                     args[5]->get_data_ptr<const int8_t>(),
                     args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
+                    args[7]->get_data_ptr<const int32_t>(),
+                    weights);
             }
             else
             {
@@ -1482,10 +1595,10 @@ private:
 
             if (m_states.count(&node) == 0)
             {
-                m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
+                m_states[&node] = std::unique_ptr<PhiloxRNGState>(new PhiloxRNGState());
             }
 
-            auto state = static_cast<UniformRNGState*>(m_states.at(&node).get());
+            auto state = static_cast<PhiloxRNGState*>(m_states.at(&node).get());
             size_t element_count = shape_size(node.get_output_shape(0));
             if (!use_fixed_seed)
             {
@@ -1588,6 +1701,24 @@ private:
             }
             break;
         }
+        case OP_TYPEID::ScaledDotProductAttention:
+        {
+            const op::ScaledDotProductAttention* attention =
+                static_cast<const op::ScaledDotProductAttention*>(&node);
+            bool has_mask = attention->get_has_mask();
+            reference::scaled_dot_product_attention<T>(
+                args[0]->get_data_ptr<const T>(),
+                args[1]->get_data_ptr<const T>(),
+                args[2]->get_data_ptr<const T>(),
+                has_mask ? args[3]->get_data_ptr<const T>() : nullptr,
+                out[0]->get_data_ptr<T>(),
+                node.get_input_shape(0),
+                node.get_input_shape(1),
+                node.get_input_shape(2),
+                has_mask ? node.get_input_shape(3) : Shape{},
+                attention->get_scale());
+            break;
+        }
         case OP_TYPEID::ScatterAdd:
         {
             if (node.get_input_element_type(1) == element::i64)
@@ -1780,6 +1911,11 @@ private:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::TensorIterator_v1:
+        {
+            tensor_iterator(node, out, args);
+            break;
+        }
         case OP_TYPEID::TopK:
         {
             const op::TopK* topk = static_cast<const op::TopK*>(&node);
@@ -1873,11 +2009,9 @@ private:
         case OP_TYPEID::GroupConvolutionTranspose:
         case OP_TYPEID::HardSigmoid_v1:
         case OP_TYPEID::Interpolate_v1:
-        case OP_TYPEID::LayerNorm:
         case OP_TYPEID::LayerNormBackprop:
         case OP_TYPEID::Less_v1:
         case OP_TYPEID::Log_v1:
-        case OP_TYPEID::LogSoftmax:
         case OP_TYPEID::LSTMCell_v1:
         case OP_TYPEID::LSTMSequence_v1:
         case OP_TYPEID::MatMul_v1:
@@ -1885,7 +2019,6 @@ private:
         case OP_TYPEID::Maximum_v1:
         case OP_TYPEID::Minimum_v1:
         case OP_TYPEID::Multiply_v1:
-        case OP_TYPEID::MVN:
         case OP_TYPEID::Negative_v1:
         case OP_TYPEID::NormalizeL2_v1:
         case OP_TYPEID::NotEqual_v1:
@@ -1926,7 +2059,6 @@ private:
         case OP_TYPEID::Subtract_v1:
         case OP_TYPEID::Tan_v1:
         case OP_TYPEID::Tanh_v1:
-        case OP_TYPEID::TensorIterator_v1:
         case OP_TYPEID::Tile_v1:
         case OP_TYPEID::TopK_v1:
         case OP_TYPEID::Transpose_v1:
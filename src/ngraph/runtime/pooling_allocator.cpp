@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/pooling_allocator.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::PoolingAllocator::min_block_size;
+
+runtime::PoolingAllocator::PoolingAllocator(Allocator* upstream,
+                                            size_t max_block_size,
+                                            size_t max_cached_bytes)
+    : m_upstream(upstream ? upstream : get_default_allocator())
+    , m_max_block_size(max_block_size)
+    , m_max_cached_bytes(max_cached_bytes)
+    , m_created(chrono::steady_clock::now())
+{
+    NGRAPH_CHECK(max_block_size >= min_block_size,
+                 "Largest size class must hold at least ",
+                 min_block_size,
+                 " bytes");
+    m_free_blocks.resize(get_size_class(max_block_size) + 1);
+}
+
+runtime::PoolingAllocator::~PoolingAllocator()
+{
+    release();
+}
+
+size_t runtime::PoolingAllocator::get_size_class(size_t size) const
+{
+    size_t size_class = 0;
+    for (size_t block_size = min_block_size; block_size < size; block_size *= 2)
+    {
+        size_class++;
+    }
+    return size_class;
+}
+
+void* runtime::PoolingAllocator::malloc(size_t size, size_t alignment)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.allocation_count++;
+
+    void* ptr = nullptr;
+    size_t size_class = m_free_blocks.size();
+    size_t block_size = size;
+    size_t block_alignment = alignment;
+    if (size <= m_max_block_size)
+    {
+        size_class = get_size_class(size);
+        block_size = min_block_size << size_class;
+        auto& free_blocks = m_free_blocks[size_class];
+        for (auto it = free_blocks.rbegin(); it != free_blocks.rend(); ++it)
+        {
+            if (it->alignment >= alignment)
+            {
+                ptr = it->ptr;
+                block_alignment = it->alignment;
+                free_blocks.erase(next(it).base());
+                m_cached_bytes -= block_size;
+                m_stats.reuse_count++;
+                break;
+            }
+        }
+    }
+    if (!ptr)
+    {
+        ptr = m_upstream->malloc(block_size, alignment);
+        m_stats.bytes_reserved += block_size;
+    }
+
+    m_live_blocks.insert({ptr, Block{size_class, size, block_alignment}});
+    m_stats.bytes_in_use += size;
+    m_stats.peak_bytes_in_use = max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    return ptr;
+}
+
+void runtime::PoolingAllocator::free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_live_blocks.find(ptr);
+    NGRAPH_CHECK(it != m_live_blocks.end(), "Pointer was not allocated by this allocator");
+    Block block = it->second;
+    m_live_blocks.erase(it);
+    m_stats.free_count++;
+    m_stats.bytes_in_use -= block.size;
+
+    size_t block_size = block.size_class < m_free_blocks.size()
+                            ? min_block_size << block.size_class
+                            : block.size;
+    if (block.size_class < m_free_blocks.size() &&
+        m_cached_bytes + block_size <= m_max_cached_bytes)
+    {
+        m_free_blocks[block.size_class].push_back(FreeBlock{ptr, block.alignment});
+        m_cached_bytes += block_size;
+    }
+    else
+    {
+        m_upstream->free(ptr);
+        m_stats.bytes_reserved -= block_size;
+    }
+}
+
+void runtime::PoolingAllocator::release()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (size_t size_class = 0; size_class < m_free_blocks.size(); size_class++)
+    {
+        for (const FreeBlock& free_block : m_free_blocks[size_class])
+        {
+            m_upstream->free(free_block.ptr);
+            m_stats.bytes_reserved -= min_block_size << size_class;
+        }
+        m_free_blocks[size_class].clear();
+    }
+    m_cached_bytes = 0;
+}
+
+runtime::AllocatorStats runtime::PoolingAllocator::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    AllocatorStats stats = m_stats;
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - m_created;
+    if (elapsed.count() > 0)
+    {
+        stats.allocation_rate = stats.allocation_count / elapsed.count();
+    }
+    return stats;
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class PoolingAllocator;
+    }
+}
+
+/// \brief Allocator that rounds requests up to power of two size classes and keeps freed
+///        blocks in a free list per class, so buffers released by one executable or call are
+///        reused by the next one instead of going back to the upstream allocator.
+///
+/// Requests larger than the largest size class are passed straight to the upstream allocator.
+/// A cached block is only reused for requests whose alignment is no larger than the alignment
+/// it was obtained with.
+/// The allocator is thread safe and must outlive the memory it hands out.
+class ngraph::runtime::PoolingAllocator : public ngraph::runtime::Allocator
+{
+public:
+    /// \param upstream Allocator the blocks are obtained from, the default allocator if null
+    /// \param max_block_size Size of the largest size class
+    /// \param max_cached_bytes Freed blocks are returned to the upstream allocator instead of
+    ///        being cached once this many bytes are cached
+    PoolingAllocator(Allocator* upstream = nullptr,
+                     size_t max_block_size = 64 * 1024 * 1024,
+                     size_t max_cached_bytes = static_cast<size_t>(-1));
+    PoolingAllocator(const PoolingAllocator&) = delete;
+    PoolingAllocator& operator=(const PoolingAllocator&) = delete;
+    ~PoolingAllocator() override;
+
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+    AllocatorStats get_stats() const override;
+
+    /// \brief Returns the cached blocks to the upstream allocator
+    void release();
+
+    /// \brief Size of the smallest size class
+    static constexpr size_t min_block_size = 64;
+
+private:
+    struct FreeBlock
+    {
+        void* ptr;
+        /// Alignment the block was obtained with from the upstream allocator
+        size_t alignment;
+    };
+    struct Block
+    {
+        /// Index of the free list, or the number of free lists if the block is not pooled
+        size_t size_class;
+        /// Requested size
+        size_t size;
+        size_t alignment;
+    };
+
+    size_t get_size_class(size_t size) const;
+
+    Allocator* m_upstream;
+    size_t m_max_block_size;
+    size_t m_max_cached_bytes;
+    size_t m_cached_bytes = 0;
+    std::vector<std::vector<FreeBlock>> m_free_blocks;
+    std::unordered_map<void*, Block> m_live_blocks;
+    AllocatorStats m_stats;
+    std::chrono::steady_clock::time_point m_created;
+    mutable std::mutex m_mutex;
+};
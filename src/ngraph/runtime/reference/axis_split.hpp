@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Offsets of every coordinate over `axes` of a row-major tensor, with the
+            ///        remaining axes at zero, enumerated in row-major order.
+            inline std::vector<size_t> axis_offsets(const Shape& shape,
+                                                    const std::vector<size_t>& axes)
+            {
+                auto strides = row_major_strides(shape);
+                size_t count = 1;
+                for (auto axis : axes)
+                {
+                    count *= shape[axis];
+                }
+                std::vector<size_t> offsets(count);
+                std::vector<size_t> coord(axes.size(), 0);
+                size_t offset = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    offsets[i] = offset;
+                    for (size_t d = axes.size(); d-- > 0;)
+                    {
+                        offset += strides[axes[d]];
+                        if (++coord[d] < shape[axes[d]])
+                        {
+                            break;
+                        }
+                        offset -= coord[d] * strides[axes[d]];
+                        coord[d] = 0;
+                    }
+                }
+                return offsets;
+            }
+
+            /// \brief Splits a row-major tensor by a set of axes. Element `i` of group `g` is
+            ///        at outer[g] + inner[i], where groups enumerate the axes not in `axes`
+            ///        and `inner` the axes in `axes`, both in row-major order.
+            struct AxisSplit
+            {
+                AxisSplit(const Shape& shape, const AxisSet& axes)
+                {
+                    std::vector<size_t> inner_axes;
+                    std::vector<size_t> outer_axes;
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (axes.count(i) != 0)
+                        {
+                            inner_axes.push_back(i);
+                        }
+                        else
+                        {
+                            outer_axes.push_back(i);
+                        }
+                    }
+                    outer = axis_offsets(shape, outer_axes);
+                    inner = axis_offsets(shape, inner_axes);
+                    contiguous = true;
+                    for (size_t i = 0; i < inner.size() && contiguous; i++)
+                    {
+                        contiguous = inner[i] == i;
+                    }
+                }
+
+                std::vector<size_t> outer;
+                std::vector<size_t> inner;
+                /// True if the elements of each group are adjacent, i.e. inner[i] == i
+                bool contiguous;
+            };
+        }
+    }
+}
@@ -0,0 +1,388 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NGRAPH_BINARY_X86
+#include <immintrin.h>
+#endif
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Packs `count` values into u1 storage, most significant bit first. Values
+            ///        greater than zero are stored as 1, all others as 0.
+            template <typename T>
+            void pack_u1(const T* in, uint8_t* out, size_t count)
+            {
+                std::memset(out, 0, (count + 7) / 8);
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (in[i] > T(0))
+                    {
+                        out[i / 8] |= static_cast<uint8_t>(0x80 >> (i % 8));
+                    }
+                }
+            }
+
+            inline size_t popcount64(uint64_t x)
+            {
+#if defined(__GNUC__)
+                return static_cast<size_t>(__builtin_popcountll(x));
+#else
+                x = x - ((x >> 1) & 0x5555555555555555ULL);
+                x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+                x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+                return static_cast<size_t>((x * 0x0101010101010101ULL) >> 56);
+#endif
+            }
+
+            /// \brief Counts the bits that differ between two packed bit vectors of `words`
+            ///        64-bit words, i.e. popcount(a XOR b).
+            using xor_popcount_kernel = size_t (*)(const uint64_t*, const uint64_t*, size_t);
+
+            inline size_t xor_popcount_scalar(const uint64_t* a, const uint64_t* b, size_t words)
+            {
+                size_t count = 0;
+                for (size_t i = 0; i < words; i++)
+                {
+                    count += popcount64(a[i] ^ b[i]);
+                }
+                return count;
+            }
+
+#if defined(NGRAPH_BINARY_X86)
+            // Nibble lookup popcount: each byte is split into two 4-bit indices into a 16-entry
+            // table, and the byte counts are summed per 64-bit lane with SAD.
+            __attribute__((target("avx2"))) inline size_t
+                xor_popcount_avx2(const uint64_t* a, const uint64_t* b, size_t words)
+            {
+                const __m256i lut = _mm256_setr_epi8(
+                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+                const __m256i low_mask = _mm256_set1_epi8(0x0f);
+                __m256i acc = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 4 <= words; i += 4)
+                {
+                    __m256i x = _mm256_xor_si256(
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+                    __m256i lo = _mm256_and_si256(x, low_mask);
+                    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask);
+                    __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo),
+                                                    _mm256_shuffle_epi8(lut, hi));
+                    acc = _mm256_add_epi64(acc, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+                }
+                uint64_t lanes[4];
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+                size_t count = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+                return count + xor_popcount_scalar(a + i, b + i, words - i);
+            }
+
+            __attribute__((target("avx512f,avx512vpopcntdq"))) inline size_t
+                xor_popcount_avx512(const uint64_t* a, const uint64_t* b, size_t words)
+            {
+                __m512i acc = _mm512_setzero_si512();
+                size_t i = 0;
+                for (; i + 8 <= words; i += 8)
+                {
+                    __m512i x = _mm512_xor_si512(_mm512_loadu_si512(a + i),
+                                                 _mm512_loadu_si512(b + i));
+                    acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+                }
+                uint64_t lanes[8];
+                _mm512_storeu_si512(lanes, acc);
+                size_t count = 0;
+                for (uint64_t lane : lanes)
+                {
+                    count += static_cast<size_t>(lane);
+                }
+                return count + xor_popcount_scalar(a + i, b + i, words - i);
+            }
+#endif
+
+            /// \brief The fastest popcount(a XOR b) kernel supported by the host CPU, selected
+            ///        once at runtime.
+            inline xor_popcount_kernel get_xor_popcount_kernel()
+            {
+                static const xor_popcount_kernel kernel = [] {
+#if defined(NGRAPH_BINARY_X86)
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx512vpopcntdq"))
+                    {
+                        return xor_popcount_avx512;
+                    }
+                    if (__builtin_cpu_supports("avx2"))
+                    {
+                        return xor_popcount_avx2;
+                    }
+#endif
+                    return xor_popcount_scalar;
+                }();
+                return kernel;
+            }
+
+            /// \brief Returns the number of spatial positions of an [N, C, D_1, ..., D_k] shape.
+            inline size_t spatial_size(const Shape& shape)
+            {
+                size_t size = 1;
+                for (size_t i = 2; i < shape.size(); i++)
+                {
+                    size *= shape[i];
+                }
+                return size;
+            }
+
+            /// \brief Packs the data of a binary convolution so that the channels of one spatial
+            ///        position occupy consecutive 64-bit words, [N, D_1..D_k, words]. Packs the
+            ///        flattened positions [begin, end) of the N * in_spatial positions;
+            ///        `data_bits` must be zero there.
+            template <typename T>
+            void pack_binary_data(const T* in,
+                                  uint64_t* data_bits,
+                                  size_t channels,
+                                  size_t in_spatial,
+                                  size_t begin,
+                                  size_t end)
+            {
+                const size_t words = (channels + 63) / 64;
+                while (begin < end)
+                {
+                    const size_t n = begin / in_spatial;
+                    const size_t first = begin % in_spatial;
+                    const size_t last = std::min(in_spatial, first + (end - begin));
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        const T* in_channel = in + (n * channels + c) * in_spatial;
+                        uint64_t* bits = data_bits + n * in_spatial * words + c / 64;
+                        uint64_t bit = uint64_t(1) << (c % 64);
+                        for (size_t s = first; s < last; s++)
+                        {
+                            if (in_channel[s] > T(0))
+                            {
+                                bits[s * words] |= bit;
+                            }
+                        }
+                    }
+                    begin += last - first;
+                }
+            }
+
+            /// \brief Packs the filters [begin, end) of a binary convolution like
+            ///        pack_binary_data, [O, K_1..K_k, words], and sums each tap's +/-1 weights
+            ///        for the taps that land in the padded area. `is_set(i)` returns the binary
+            ///        value of element i of the [O, C, K_1, ..., K_k] filter. `filter_bits` and
+            ///        `filter_sums` must be zero for those filters.
+            template <typename IsSet>
+            void pack_binary_filter(IsSet is_set,
+                                    uint64_t* filter_bits,
+                                    float* filter_sums,
+                                    size_t channels,
+                                    size_t filter_spatial,
+                                    size_t begin,
+                                    size_t end)
+            {
+                const size_t words = (channels + 63) / 64;
+                for (size_t o = begin; o < end; o++)
+                {
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        uint64_t bit = uint64_t(1) << (c % 64);
+                        for (size_t s = 0; s < filter_spatial; s++)
+                        {
+                            bool set = is_set((o * channels + c) * filter_spatial + s);
+                            if (set)
+                            {
+                                filter_bits[(o * filter_spatial + s) * words + c / 64] |= bit;
+                            }
+                            filter_sums[o * filter_spatial + s] += set ? 1.0f : -1.0f;
+                        }
+                    }
+                }
+            }
+
+            /// \brief Computes output channel `o` of batch entry `n` of a binary convolution
+            ///        from the operands packed by pack_binary_data and pack_binary_filter.
+            template <typename T>
+            void binary_convolution_channel(const uint64_t* data_bits,
+                                            const uint64_t* filter_bits,
+                                            const float* filter_sums,
+                                            T* out,
+                                            size_t n,
+                                            size_t o,
+                                            const Shape& in_shape,
+                                            const Shape& filter_shape,
+                                            const Shape& out_shape,
+                                            const Strides& strides,
+                                            const Strides& dilations,
+                                            const CoordinateDiff& pads_begin,
+                                            float pad_value,
+                                            xor_popcount_kernel popcount_kernel)
+            {
+                const size_t channels = in_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const size_t spatial_rank = in_shape.size() - 2;
+                const size_t words = (channels + 63) / 64;
+                const size_t in_spatial = spatial_size(in_shape);
+                const size_t filter_spatial = spatial_size(filter_shape);
+                const size_t out_spatial = spatial_size(out_shape);
+
+                const uint64_t* batch_bits = data_bits + n * in_spatial * words;
+                const uint64_t* channel_filter = filter_bits + o * filter_spatial * words;
+                const float* channel_sums = filter_sums + o * filter_spatial;
+                T* out_channel = out + (n * out_channels + o) * out_spatial;
+
+                // Per-tap spatial offsets are computed with integer arithmetic on flattened
+                // indices; the coordinate vectors below are reused across iterations.
+                std::vector<size_t> out_coord(spatial_rank, 0);
+                std::vector<size_t> filter_coord(spatial_rank, 0);
+                for (size_t r = 0; r < out_spatial; r++)
+                {
+                    float acc = 0;
+                    std::fill(filter_coord.begin(), filter_coord.end(), 0);
+                    for (size_t k = 0; k < filter_spatial; k++)
+                    {
+                        bool in_bounds = true;
+                        size_t in_offset = 0;
+                        for (size_t d = 0; d < spatial_rank; d++)
+                        {
+                            int64_t pos = static_cast<int64_t>(out_coord[d] * strides[d]) -
+                                          pads_begin[d] +
+                                          static_cast<int64_t>(filter_coord[d] * dilations[d]);
+                            if (pos < 0 || pos >= static_cast<int64_t>(in_shape[d + 2]))
+                            {
+                                in_bounds = false;
+                                break;
+                            }
+                            in_offset = in_offset * in_shape[d + 2] + static_cast<size_t>(pos);
+                        }
+                        if (in_bounds)
+                        {
+                            size_t mismatches = popcount_kernel(
+                                batch_bits + in_offset * words, channel_filter + k * words, words);
+                            acc += static_cast<float>(channels) - 2.0f * mismatches;
+                        }
+                        else
+                        {
+                            acc += pad_value * channel_sums[k];
+                        }
+                        for (size_t d = spatial_rank; d-- > 0;)
+                        {
+                            if (++filter_coord[d] < filter_shape[d + 2])
+                            {
+                                break;
+                            }
+                            filter_coord[d] = 0;
+                        }
+                    }
+                    out_channel[r] = static_cast<T>(acc);
+                    for (size_t d = spatial_rank; d-- > 0;)
+                    {
+                        if (++out_coord[d] < out_shape[d + 2])
+                        {
+                            break;
+                        }
+                        out_coord[d] = 0;
+                    }
+                }
+            }
+
+            /// \brief XNOR-popcount binary convolution.
+            ///
+            /// Data and filter values are interpreted as -1 (bit 0) or +1 (bit 1). Taps that
+            /// fall into the padded area use `pad_value` as the (non-binarized) data value.
+            /// Internally both operands are repacked so that the channels of one spatial
+            /// position occupy consecutive 64-bit words, which turns the reduction over input
+            /// channels into `channels - 2 * popcount(data XOR filter)`.
+            ///
+            /// \param in Input data batch, shape [N, C, D_1, ..., D_k].
+            /// \param packed_filter Filters in u1 storage, shape [O, C, K_1, ..., K_k].
+            /// \param out Output, shape [N, O, R_1, ..., R_k].
+            template <typename T>
+            void binary_convolution(const T* in,
+                                    const uint8_t* packed_filter,
+                                    T* out,
+                                    const Shape& in_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& strides,
+                                    const Strides& dilations,
+                                    const CoordinateDiff& pads_begin,
+                                    float pad_value)
+            {
+                const size_t batch_size = in_shape[0];
+                const size_t channels = in_shape[1];
+                const size_t out_channels = filter_shape[0];
+                const size_t words = (channels + 63) / 64;
+                const size_t in_spatial = spatial_size(in_shape);
+                const size_t filter_spatial = spatial_size(filter_shape);
+
+                std::vector<uint64_t> data_bits(batch_size * in_spatial * words, 0);
+                pack_binary_data(
+                    in, data_bits.data(), channels, in_spatial, 0, batch_size * in_spatial);
+
+                std::vector<uint64_t> filter_bits(out_channels * filter_spatial * words, 0);
+                std::vector<float> filter_sums(out_channels * filter_spatial, 0);
+                pack_binary_filter(
+                    [packed_filter](size_t i) {
+                        return ((packed_filter[i / 8] >> (7 - i % 8)) & 1) != 0;
+                    },
+                    filter_bits.data(),
+                    filter_sums.data(),
+                    channels,
+                    filter_spatial,
+                    0,
+                    out_channels);
+
+                const xor_popcount_kernel popcount_kernel = get_xor_popcount_kernel();
+                for (size_t n = 0; n < batch_size; n++)
+                {
+                    for (size_t o = 0; o < out_channels; o++)
+                    {
+                        binary_convolution_channel(data_bits.data(),
+                                                   filter_bits.data(),
+                                                   filter_sums.data(),
+                                                   out,
+                                                   n,
+                                                   o,
+                                                   in_shape,
+                                                   filter_shape,
+                                                   out_shape,
+                                                   strides,
+                                                   dilations,
+                                                   pads_begin,
+                                                   pad_value,
+                                                   popcount_kernel);
+                    }
+                }
+            }
+        }
+    }
+}
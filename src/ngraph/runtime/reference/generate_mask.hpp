@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <random>
 
 #include "ngraph/state/bernoulli_rng_state.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
 
 namespace ngraph
 {
@@ -41,17 +43,59 @@ namespace ngraph
                 }
             }
 
+            /// \brief Fills elements [begin, end) of a Bernoulli mask from a Philox stream.
+            ///
+            /// Element i is 1 when word i % 4 of block counter + i / 4, as a value in [0, 1),
+            /// is less than prob, so the mask does not depend on how [0, count) is split into
+            /// ranges.
             template <typename T>
-            void generate_mask_no_state(
-                T* out, size_t count, bool training, uint32_t seed, double prob)
+            void generate_mask_range(T* out,
+                                     size_t begin,
+                                     size_t end,
+                                     bool training,
+                                     double prob,
+                                     uint64_t key,
+                                     uint64_t counter)
             {
-                std::mt19937 gen(seed);
-                std::bernoulli_distribution bd(prob);
-
-                for (size_t i = 0; i < count; i++)
+                if (!training)
                 {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
+                    std::fill(out + begin, out + end, static_cast<T>(1));
+                    return;
                 }
+                constexpr size_t chunk_blocks = 8 * PhiloxRNGState::batch_blocks;
+                uint32_t words[4 * chunk_blocks];
+                size_t i = begin;
+                while (i < end)
+                {
+                    size_t first_block = i / 4;
+                    size_t end_block = std::min((end + 3) / 4, first_block + chunk_blocks);
+                    PhiloxRNGState::generate(
+                        key, counter + first_block, end_block - first_block, words);
+                    size_t stop = std::min(end, end_block * 4);
+                    for (; i < stop; i++)
+                    {
+                        bool bit = PhiloxRNGState::to_unit(words[i - first_block * 4]) < prob;
+                        out[i] = static_cast<T>(bit);
+                    }
+                }
+            }
+
+            template <typename T>
+            void generate_mask(T* out,
+                               size_t count,
+                               ngraph::PhiloxRNGState* rng_state,
+                               bool training,
+                               double prob)
+            {
+                uint64_t counter = rng_state->advance(PhiloxRNGState::get_block_count(count, 4));
+                generate_mask_range(out, 0, count, training, prob, rng_state->get_key(), counter);
+            }
+
+            template <typename T>
+            void generate_mask_no_state(
+                T* out, size_t count, bool training, uint64_t seed, double prob)
+            {
+                generate_mask_range(out, 0, count, training, prob, seed, 0);
             }
         }
     }
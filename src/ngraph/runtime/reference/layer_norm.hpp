@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/runtime/reference/normalization.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Layer normalization over the axes from `begin_norm_axis` on. Mean and
+            ///        variance are found in one pass over each group and the normalized,
+            ///        optionally scaled and shifted, values written in a second.
+            ///
+            /// \param scale Per-element scale of a group, or nullptr
+            /// \param bias Per-element bias of a group, or nullptr
+            /// \param mean Output for the mean of each group, or nullptr
+            /// \param variance Output for the variance of each group, or nullptr
+            template <typename T>
+            void layer_norm(const T* arg,
+                            const T* scale,
+                            const T* bias,
+                            T* out,
+                            T* mean,
+                            T* variance,
+                            const Shape& shape,
+                            size_t begin_norm_axis,
+                            double epsilon)
+            {
+                size_t groups = shape_size(Shape(shape.begin(), shape.begin() + begin_norm_axis));
+                size_t group_size = shape_size(Shape(shape.begin() + begin_norm_axis, shape.end()));
+                auto identity = [](size_t i) { return i; };
+                for (size_t g = 0; g < groups; g++)
+                {
+                    const T* in = arg + g * group_size;
+                    T* group_out = out + g * group_size;
+                    T group_mean;
+                    T group_variance;
+                    mean_variance(in, group_size, identity, group_mean, group_variance);
+                    T inv_stddev = T(1) / std::sqrt(group_variance + T(epsilon));
+                    for (size_t i = 0; i < group_size; i++)
+                    {
+                        T normalized = (in[i] - group_mean) * inv_stddev;
+                        group_out[i] = scale ? normalized * scale[i] + bias[i] : normalized;
+                    }
+                    if (mean)
+                    {
+                        mean[g] = group_mean;
+                        variance[g] = group_variance;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/axis_split.hpp"
+#include "ngraph/runtime/reference/normalization.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief log(softmax(arg)) over `axes`, computed as x - max - log(sum(exp(x - max)))
+            ///        without materializing the softmax.
+            template <typename T>
+            void log_softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                AxisSplit split(shape, axes);
+                const size_t* inner = split.inner.data();
+                for (size_t offset : split.outer)
+                {
+                    softmax_group(arg + offset,
+                                  out + offset,
+                                  split.inner.size(),
+                                  [inner](size_t i) { return inner[i]; },
+                                  true);
+                }
+            }
+        }
+    }
+}
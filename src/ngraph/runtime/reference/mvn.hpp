@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/axis_split.hpp"
+#include "ngraph/runtime/reference/normalization.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Mean variance normalization over `reduction_axes`: x - mean, divided by
+            ///        sqrt(variance) + eps if `normalize_variance` is set. Mean and variance are
+            ///        found in one pass over each group.
+            template <typename T>
+            void mvn(const T* arg,
+                     T* out,
+                     const Shape& shape,
+                     const AxisSet& reduction_axes,
+                     bool normalize_variance,
+                     double eps)
+            {
+                AxisSplit split(shape, reduction_axes);
+                const size_t* inner = split.inner.data();
+                auto index = [inner](size_t i) { return inner[i]; };
+                for (size_t offset : split.outer)
+                {
+                    const T* in = arg + offset;
+                    T* group_out = out + offset;
+                    T mean;
+                    T variance;
+                    mean_variance(in, split.inner.size(), index, mean, variance);
+                    T scale = normalize_variance ? T(1) / (std::sqrt(variance) + T(eps)) : T(1);
+                    for (size_t i = 0; i < split.inner.size(); i++)
+                    {
+                        group_out[inner[i]] = (in[inner[i]] - mean) * scale;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Maximum of the `count` elements at in[index(i)], and the sum of
+            ///        exp(x - maximum) over all of them but the maximum itself, in a single pass.
+            ///        The sum is rescaled whenever a new maximum is found. Leaving out the
+            ///        maximum's own term of 1 keeps log1p(rest) accurate when it is small.
+            template <typename T, typename Index>
+            void online_max_sum(const T* in, size_t count, Index index, T& max, T& rest)
+            {
+                max = in[index(0)];
+                rest = 0;
+                for (size_t i = 1; i < count; i++)
+                {
+                    T x = in[index(i)];
+                    if (x > max)
+                    {
+                        rest = T((rest + T(1)) * std::exp(max - x));
+                        max = x;
+                    }
+                    else
+                    {
+                        rest = rest + T(std::exp(x - max));
+                    }
+                }
+            }
+
+            /// \brief Softmax, or log-softmax, of the `count` elements at in[index(i)], written
+            ///        to out[index(i)]. Reads the input twice and writes the output once.
+            template <typename T, typename Index>
+            void softmax_group(const T* in, T* out, size_t count, Index index, bool log)
+            {
+                if (count == 0)
+                {
+                    return;
+                }
+                T max;
+                T rest;
+                online_max_sum(in, count, index, max, rest);
+                if (log)
+                {
+                    // Subtracting the maximum first keeps x - max exact for large inputs
+                    T log_sum = T(std::log1p(rest));
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[index(i)] = (in[index(i)] - max) - log_sum;
+                    }
+                }
+                else
+                {
+                    T inverse = T(1) / (T(1) + rest);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[index(i)] = std::exp(in[index(i)] - max) * inverse;
+                    }
+                }
+            }
+
+            /// \brief Mean and population variance of the `count` elements at in[index(i)] in a
+            ///        single pass, using Welford's update.
+            template <typename T, typename Index>
+            void mean_variance(const T* in, size_t count, Index index, T& mean, T& variance)
+            {
+                mean = 0;
+                T m2 = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    T x = in[index(i)];
+                    T delta = x - mean;
+                    mean = mean + delta / T(i + 1);
+                    m2 = m2 + delta * (x - mean);
+                }
+                variance = count > 0 ? m2 / T(count) : T(0);
+            }
+        }
+    }
+}
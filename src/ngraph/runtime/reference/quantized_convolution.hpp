@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/reference/quantized_gemm.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Packs quantized filters of shape [O, C, K_1, ..., K_k] into one row of
+            ///        C * K_1 * ... * K_k weights per output channel.
+            template <typename FILTER>
+            void pack_quantized_convolution_weights(const FILTER* filter,
+                                                    const Shape& filter_shape,
+                                                    FILTER zero_point,
+                                                    QuantizedPackedWeights& packed)
+            {
+                size_t rows = filter_shape[0];
+                size_t depth = rows == 0 ? 0 : shape_size(filter_shape) / rows;
+                pack_quantized_weights(filter, rows, depth, depth, 1, zero_point, packed);
+            }
+
+            /// \brief Quantized convolution with integer accumulation.
+            ///
+            /// Each output position gathers its receptive field into a contiguous patch
+            /// ordered like a filter row; taps in the padding or in data dilation gaps take the
+            /// input zero point so that they contribute nothing after the zero point
+            /// correction. The patch is then reduced against every packed filter row, see
+            /// quantized_gemm_row(). Layouts are NC_I..., OC_IF... and NC_O... as for
+            /// convolution().
+            template <typename FILTER, typename OUTPUT>
+            void quantized_convolution(const uint8_t* in,
+                                       const FILTER* filter,
+                                       OUTPUT* out,
+                                       const Shape& in_shape,
+                                       const Shape& filter_shape,
+                                       const Shape& out_shape,
+                                       const Strides& stride,
+                                       const Strides& filter_dilation,
+                                       const CoordinateDiff& in_pad_below,
+                                       const Strides& in_dilation,
+                                       const float* input_scale,
+                                       const uint8_t* input_zero_point,
+                                       const float* filter_scale,
+                                       const FILTER* filter_zero_point,
+                                       const float* output_scale,
+                                       const OUTPUT* output_zero_point,
+                                       const QuantizedPackedWeights* packed = nullptr)
+            {
+                QuantizedPackedWeights local;
+                if (packed == nullptr)
+                {
+                    pack_quantized_convolution_weights(
+                        filter, filter_shape, *filter_zero_point, local);
+                    packed = &local;
+                }
+
+                const size_t batch_size = in_shape[0];
+                const size_t channels = in_shape[1];
+                const size_t out_channels = out_shape[1];
+                const size_t spatial_rank = in_shape.size() - 2;
+
+                size_t in_spatial = 1;
+                size_t filter_spatial = 1;
+                size_t out_spatial = 1;
+                for (size_t d = 0; d < spatial_rank; d++)
+                {
+                    in_spatial *= in_shape[d + 2];
+                    filter_spatial *= filter_shape[d + 2];
+                    out_spatial *= out_shape[d + 2];
+                }
+
+                const uint8_t a_zero_point = *input_zero_point;
+                const float scale = *input_scale * *filter_scale / *output_scale;
+                u8s8_dot_kernel kernel = get_u8s8_dot_kernel();
+
+                std::vector<uint8_t> patch(channels * filter_spatial);
+                std::vector<size_t> out_coord(spatial_rank, 0);
+                std::vector<size_t> filter_coord(spatial_rank, 0);
+                for (size_t n = 0; n < batch_size; n++)
+                {
+                    const uint8_t* batch_in = in + n * channels * in_spatial;
+                    OUTPUT* batch_out = out + n * out_channels * out_spatial;
+                    std::fill(out_coord.begin(), out_coord.end(), 0);
+                    for (size_t r = 0; r < out_spatial; r++)
+                    {
+                        std::fill(filter_coord.begin(), filter_coord.end(), 0);
+                        for (size_t k = 0; k < filter_spatial; k++)
+                        {
+                            // Position of the tap in the padded, dilated input.
+                            bool in_bounds = true;
+                            size_t in_offset = 0;
+                            for (size_t d = 0; d < spatial_rank && in_bounds; d++)
+                            {
+                                int64_t pos = static_cast<int64_t>(out_coord[d] * stride[d]) -
+                                              in_pad_below[d] +
+                                              static_cast<int64_t>(filter_coord[d] *
+                                                                   filter_dilation[d]);
+                                int64_t dilation = static_cast<int64_t>(in_dilation[d]);
+                                int64_t dilated_size =
+                                    (static_cast<int64_t>(in_shape[d + 2]) - 1) * dilation + 1;
+                                if (pos < 0 || pos >= dilated_size || pos % dilation != 0)
+                                {
+                                    in_bounds = false;
+                                }
+                                else
+                                {
+                                    in_offset = in_offset * in_shape[d + 2] +
+                                                static_cast<size_t>(pos / dilation);
+                                }
+                            }
+                            for (size_t c = 0; c < channels; c++)
+                            {
+                                patch[c * filter_spatial + k] =
+                                    in_bounds ? batch_in[c * in_spatial + in_offset]
+                                              : a_zero_point;
+                            }
+                            for (size_t d = spatial_rank; d-- > 0;)
+                            {
+                                if (++filter_coord[d] < filter_shape[d + 2])
+                                {
+                                    break;
+                                }
+                                filter_coord[d] = 0;
+                            }
+                        }
+
+                        quantized_gemm_row(patch.data(),
+                                           a_zero_point,
+                                           *packed,
+                                           kernel,
+                                           scale,
+                                           *output_zero_point,
+                                           batch_out + r,
+                                           out_spatial);
+
+                        for (size_t d = spatial_rank; d-- > 0;)
+                        {
+                            if (++out_coord[d] < out_shape[d + 2])
+                            {
+                                break;
+                            }
+                            out_coord[d] = 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
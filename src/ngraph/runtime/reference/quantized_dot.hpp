@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/reference/quantized_gemm.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Packs the second argument of a quantized dot, shape [R..., Q...] with
+            ///        `reduction_axes_count` reduction axes, into one row per output column.
+            template <typename INPUT1>
+            void pack_quantized_dot_weights(const INPUT1* arg1,
+                                            const Shape& arg1_shape,
+                                            size_t reduction_axes_count,
+                                            INPUT1 zero_point,
+                                            QuantizedPackedWeights& packed)
+            {
+                size_t depth = 1;
+                for (size_t i = 0; i < reduction_axes_count; i++)
+                {
+                    depth *= arg1_shape[i];
+                }
+                size_t cols = depth == 0 ? 0 : shape_size(arg1_shape) / depth;
+                pack_quantized_weights(arg1, cols, depth, 1, cols, zero_point, packed);
+            }
+
+            /// \brief Quantized dot product with integer accumulation.
+            ///
+            /// Computes the same result as dot() with scales and zero points, but accumulates
+            /// raw u8 x s8 products in 32 bits and applies the zero point corrections and the
+            /// requantization scale once per output element. `packed` may hold weights
+            /// prepared with pack_quantized_dot_weights(), e.g. at compile time for constant
+            /// weights; otherwise they are packed on every call.
+            template <typename INPUT1, typename OUTPUT>
+            void quantized_dot(const uint8_t* arg0,
+                               const INPUT1* arg1,
+                               OUTPUT* out,
+                               const Shape& arg0_shape,
+                               const Shape& arg1_shape,
+                               size_t reduction_axes_count,
+                               const float* input0_scale,
+                               const uint8_t* input0_zero_point,
+                               const float* input1_scale,
+                               const INPUT1* input1_zero_point,
+                               const float* output_scale,
+                               const OUTPUT* output_zero_point,
+                               const QuantizedPackedWeights* packed = nullptr)
+            {
+                QuantizedPackedWeights local;
+                if (packed == nullptr)
+                {
+                    pack_quantized_dot_weights(
+                        arg1, arg1_shape, reduction_axes_count, *input1_zero_point, local);
+                    packed = &local;
+                }
+
+                const size_t depth = packed->depth;
+                const size_t cols = packed->rows;
+                const size_t rows = depth == 0 ? 0 : shape_size(arg0_shape) / depth;
+                const float scale = *input0_scale * *input1_scale / *output_scale;
+                u8s8_dot_kernel kernel = get_u8s8_dot_kernel();
+                for (size_t m = 0; m < rows; m++)
+                {
+                    quantized_gemm_row(arg0 + m * depth,
+                                       *input0_zero_point,
+                                       *packed,
+                                       kernel,
+                                       scale,
+                                       *output_zero_point,
+                                       out + m * cols,
+                                       1);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,283 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NGRAPH_QUANTIZED_X86
+#include <immintrin.h>
+#if (defined(__clang__) && __clang_major__ >= 8) || (!defined(__clang__) && __GNUC__ >= 8)
+#define NGRAPH_QUANTIZED_VNNI
+#endif
+#endif
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Instruction set used by the integer-only quantized kernels.
+            enum class QuantizedISA
+            {
+                scalar,
+                avx2,
+                avx512_vnni
+            };
+
+            /// \brief Computes sum(a[i] * b[i]) of `count` unsigned by signed bytes.
+            using u8s8_dot_kernel = int32_t (*)(const uint8_t*, const int8_t*, size_t);
+
+            inline int32_t u8s8_dot_scalar(const uint8_t* a, const int8_t* b, size_t count)
+            {
+                int32_t sum = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    sum += static_cast<int32_t>(a[i]) * static_cast<int32_t>(b[i]);
+                }
+                return sum;
+            }
+
+#if defined(NGRAPH_QUANTIZED_X86)
+            // Both operands are widened to 16 bits so that madd cannot saturate; u8 * s8 pairs
+            // summed by madd always fit in the 32-bit lanes.
+            __attribute__((target("avx2"))) inline int32_t
+                u8s8_dot_avx2(const uint8_t* a, const int8_t* b, size_t count)
+            {
+                __m256i acc = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 16 <= count; i += 16)
+                {
+                    __m256i va = _mm256_cvtepu8_epi16(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+                    __m256i vb = _mm256_cvtepi8_epi16(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+                    acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+                }
+                __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(acc),
+                                               _mm256_extracti128_si256(acc, 1));
+                sum128 = _mm_hadd_epi32(sum128, sum128);
+                sum128 = _mm_hadd_epi32(sum128, sum128);
+                int32_t sum = _mm_cvtsi128_si32(sum128);
+                for (; i < count; i++)
+                {
+                    sum += static_cast<int32_t>(a[i]) * static_cast<int32_t>(b[i]);
+                }
+                return sum;
+            }
+#endif
+
+#if defined(NGRAPH_QUANTIZED_VNNI)
+            __attribute__((target("avx512f,avx512bw,avx512vnni"))) inline int32_t
+                u8s8_dot_avx512_vnni(const uint8_t* a, const int8_t* b, size_t count)
+            {
+                __m512i acc = _mm512_setzero_si512();
+                size_t i = 0;
+                for (; i + 64 <= count; i += 64)
+                {
+                    acc = _mm512_dpbusd_epi32(
+                        acc, _mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+                }
+                if (i < count)
+                {
+                    __mmask64 mask = ~__mmask64(0) >> (64 - (count - i));
+                    acc = _mm512_dpbusd_epi32(acc,
+                                              _mm512_maskz_loadu_epi8(mask, a + i),
+                                              _mm512_maskz_loadu_epi8(mask, b + i));
+                }
+                // Horizontal sum with explicit halvings. _mm512_reduce_add_epi32, the 512-bit
+                // casts and the unmasked extracts all start from an undefined register in GCC 12
+                // and trip -Wuninitialized, the zero-masked extracts do not.
+                __m256i sum256 = _mm256_add_epi32(_mm512_maskz_extracti64x4_epi64(0xff, acc, 0),
+                                                  _mm512_maskz_extracti64x4_epi64(0xff, acc, 1));
+                __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum256),
+                                               _mm256_extracti128_si256(sum256, 1));
+                sum128 = _mm_hadd_epi32(sum128, sum128);
+                sum128 = _mm_hadd_epi32(sum128, sum128);
+                return _mm_cvtsi128_si32(sum128);
+            }
+#endif
+
+            /// \brief The best instruction set supported by the host CPU.
+            inline QuantizedISA detect_quantized_isa()
+            {
+#if defined(NGRAPH_QUANTIZED_X86)
+                __builtin_cpu_init();
+#if defined(NGRAPH_QUANTIZED_VNNI)
+                if (__builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw"))
+                {
+                    return QuantizedISA::avx512_vnni;
+                }
+#endif
+                if (__builtin_cpu_supports("avx2"))
+                {
+                    return QuantizedISA::avx2;
+                }
+#endif
+                return QuantizedISA::scalar;
+            }
+
+            /// \brief The instruction set used by default. NGRAPH_QUANTIZED_ISA may be set to
+            ///        "scalar", "avx2" or "avx512_vnni" to restrict it; requests for an
+            ///        instruction set the CPU lacks fall back to the detected one.
+            inline QuantizedISA get_quantized_isa()
+            {
+                static const QuantizedISA isa = [] {
+                    QuantizedISA detected = detect_quantized_isa();
+                    const char* env = std::getenv("NGRAPH_QUANTIZED_ISA");
+                    if (env != nullptr)
+                    {
+                        std::string name(env);
+                        QuantizedISA requested = detected;
+                        if (name == "scalar")
+                        {
+                            requested = QuantizedISA::scalar;
+                        }
+                        else if (name == "avx2")
+                        {
+                            requested = QuantizedISA::avx2;
+                        }
+                        else if (name == "avx512_vnni")
+                        {
+                            requested = QuantizedISA::avx512_vnni;
+                        }
+                        return std::min(requested, detected);
+                    }
+                    return detected;
+                }();
+                return isa;
+            }
+
+            inline u8s8_dot_kernel get_u8s8_dot_kernel(QuantizedISA isa = get_quantized_isa())
+            {
+                switch (isa)
+                {
+#if defined(NGRAPH_QUANTIZED_VNNI)
+                case QuantizedISA::avx512_vnni: return u8s8_dot_avx512_vnni;
+#endif
+#if defined(NGRAPH_QUANTIZED_X86)
+                case QuantizedISA::avx2: return u8s8_dot_avx2;
+#endif
+                default: return u8s8_dot_scalar;
+                }
+            }
+
+            /// \brief Weights of a quantized dot or convolution repacked for the integer
+            ///        kernels.
+            ///
+            /// Each output channel is a contiguous row of `depth` signed bytes. Unsigned weights
+            /// are stored shifted by -128, with `zero_point` shifted to match, so a single
+            /// u8 x s8 kernel serves both filter types. `row_sums` holds the sum of every row,
+            /// which is the weight half of the zero point correction.
+            struct QuantizedPackedWeights
+            {
+                std::vector<int8_t> data;
+                std::vector<int32_t> row_sums;
+                size_t rows = 0;
+                size_t depth = 0;
+                int32_t zero_point = 0;
+            };
+
+            /// \brief Packs `rows` x `depth` weights where element (r, k) is stored at
+            ///        w[r * row_stride + k * depth_stride].
+            template <typename FILTER>
+            void pack_quantized_weights(const FILTER* w,
+                                        size_t rows,
+                                        size_t depth,
+                                        size_t row_stride,
+                                        size_t depth_stride,
+                                        FILTER zero_point,
+                                        QuantizedPackedWeights& packed)
+            {
+                static_assert(sizeof(FILTER) == 1, "quantized weights must be 8-bit");
+                const int32_t shift = std::is_signed<FILTER>::value ? 0 : 128;
+                packed.rows = rows;
+                packed.depth = depth;
+                packed.zero_point = static_cast<int32_t>(zero_point) - shift;
+                packed.data.resize(rows * depth);
+                packed.row_sums.assign(rows, 0);
+                for (size_t r = 0; r < rows; r++)
+                {
+                    int8_t* row = packed.data.data() + r * depth;
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < depth; k++)
+                    {
+                        int32_t v = static_cast<int32_t>(w[r * row_stride + k * depth_stride]);
+                        row[k] = static_cast<int8_t>(v - shift);
+                        sum += v - shift;
+                    }
+                    packed.row_sums[r] = sum;
+                }
+            }
+
+            /// \brief Rounds `acc * scale` half away from zero, adds the zero point and
+            ///        saturates to the range of OUTPUT.
+            template <typename OUTPUT>
+            OUTPUT requantize(int32_t acc, float scale, OUTPUT zero_point)
+            {
+                int64_t v = static_cast<int64_t>(std::round(static_cast<float>(acc) * scale)) +
+                            static_cast<int64_t>(zero_point);
+                v = std::max<int64_t>(v, std::numeric_limits<OUTPUT>::min());
+                v = std::min<int64_t>(v, std::numeric_limits<OUTPUT>::max());
+                return static_cast<OUTPUT>(v);
+            }
+
+            /// \brief Computes out[r * out_stride] for every weight row r from one row of
+            ///        unsigned activations:
+            ///
+            ///     sum_k (a[k] - a_zp) * (w[r, k] - w_zp) = sum_k a[k] * w[r, k]
+            ///         - w_zp * sum(a) - a_zp * sum(w[r]) + depth * a_zp * w_zp
+            ///
+            /// so only the raw u8 x s8 products are accumulated per element.
+            template <typename OUTPUT>
+            void quantized_gemm_row(const uint8_t* a,
+                                    uint8_t a_zero_point,
+                                    const QuantizedPackedWeights& weights,
+                                    u8s8_dot_kernel kernel,
+                                    float scale,
+                                    OUTPUT out_zero_point,
+                                    OUTPUT* out,
+                                    size_t out_stride)
+            {
+                const size_t depth = weights.depth;
+                int32_t a_sum = 0;
+                for (size_t k = 0; k < depth; k++)
+                {
+                    a_sum += a[k];
+                }
+                const int32_t a_zp = a_zero_point;
+                const int32_t row_bias = static_cast<int32_t>(depth) * a_zp * weights.zero_point -
+                                         weights.zero_point * a_sum;
+                for (size_t r = 0; r < weights.rows; r++)
+                {
+                    int32_t acc = kernel(a, weights.data.data() + r * depth, depth) + row_bias -
+                                  a_zp * weights.row_sums[r];
+                    out[r * out_stride] = requantize<OUTPUT>(acc, scale, out_zero_point);
+                }
+            }
+        }
+    }
+}
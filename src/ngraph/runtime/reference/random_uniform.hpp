@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <random>
 
+#include "ngraph/state/philox_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
 namespace ngraph
@@ -39,12 +41,53 @@ namespace ngraph
                 }
             }
 
+            /// \brief Fills elements [begin, end) of a tensor from a Philox stream.
+            ///
+            /// Element i takes 64 random bits from block counter + i / 2, so the values do not
+            /// depend on how [0, count) is split into ranges.
+            template <typename T>
+            void random_uniform_range(T* out,
+                                      T min_val,
+                                      T max_val,
+                                      size_t begin,
+                                      size_t end,
+                                      uint64_t key,
+                                      uint64_t counter)
+            {
+                constexpr size_t chunk_blocks = 8 * PhiloxRNGState::batch_blocks;
+                uint32_t words[4 * chunk_blocks];
+                size_t i = begin;
+                while (i < end)
+                {
+                    size_t first_block = i / 2;
+                    size_t end_block = std::min((end + 1) / 2, first_block + chunk_blocks);
+                    PhiloxRNGState::generate(
+                        key, counter + first_block, end_block - first_block, words);
+                    size_t stop = std::min(end, end_block * 2);
+                    for (; i < stop; i++)
+                    {
+                        const uint32_t* w = words + 4 * (i / 2 - first_block) + 2 * (i % 2);
+                        out[i] = static_cast<T>(PhiloxRNGState::to_unit(w[0], w[1])) *
+                                     (max_val - min_val) +
+                                 min_val;
+                    }
+                }
+            }
+
+            template <typename T>
+            void random_uniform(
+                T* out, T min_val, T max_val, size_t count, ngraph::PhiloxRNGState* rng_state)
+            {
+                uint64_t counter = rng_state->advance(PhiloxRNGState::get_block_count(count, 2));
+                random_uniform_range(
+                    out, min_val, max_val, 0, count, rng_state->get_key(), counter);
+            }
+
             template <typename T>
             void random_uniform_with_fixed_seed(
                 T* out, T min_val, T max_val, size_t count, size_t fixed_seed)
             {
-                ngraph::UniformRNGState rng_state(fixed_seed);
-                random_uniform(out, min_val, max_val, count, &rng_state);
+                random_uniform_range(out, min_val, max_val, 0, count, fixed_seed, 0);
             }
         }
     }
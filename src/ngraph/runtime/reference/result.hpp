@@ -31,7 +31,11 @@ namespace ngraph
             template <typename T>
             void result(const T* arg, T* out, size_t count)
             {
-                memcpy(out, arg, sizeof(T) * count);
+                // The result may have been computed in place in the output
+                if (arg != out)
+                {
+                    memcpy(out, arg, sizeof(T) * count);
+                }
             }
         }
     }
@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief softmax(scale * Q.K^T + mask).V for each batch entry, one query row at a
+            ///        time. The softmax is computed online: the running maximum and sum of
+            ///        exponentials are rescaled whenever a larger score is seen, so only a
+            ///        row of the output is kept as scratch instead of the score matrix.
+            ///
+            /// \param mask Additive mask of shape `mask_shape` (`[M, 1 or S_q, S_k]`), or null.
+            template <typename T>
+            void scaled_dot_product_attention(const T* query,
+                                              const T* key,
+                                              const T* value,
+                                              const T* mask,
+                                              T* out,
+                                              const Shape& query_shape,
+                                              const Shape& key_shape,
+                                              const Shape& value_shape,
+                                              const Shape& mask_shape,
+                                              double scale)
+            {
+                const size_t batch = query_shape[0];
+                const size_t query_length = query_shape[1];
+                const size_t depth = query_shape[2];
+                const size_t key_length = key_shape[1];
+                const size_t value_depth = value_shape[2];
+                const size_t mask_group = mask ? batch / mask_shape[0] : 1;
+                const size_t mask_rows = mask ? mask_shape[1] : 0;
+                const T neg_inf = -std::numeric_limits<T>::infinity();
+
+                std::vector<T> acc(value_depth);
+                for (size_t n = 0; n < batch; n++)
+                {
+                    const T* k = key + n * key_length * depth;
+                    const T* v = value + n * key_length * value_depth;
+                    for (size_t i = 0; i < query_length; i++)
+                    {
+                        const T* q = query + (n * query_length + i) * depth;
+                        const T* mask_row = nullptr;
+                        if (mask)
+                        {
+                            size_t mask_row_index = mask_rows == 1 ? 0 : i;
+                            mask_row =
+                                mask + ((n / mask_group) * mask_rows + mask_row_index) * key_length;
+                        }
+                        T max = neg_inf;
+                        T sum = 0;
+                        std::fill(acc.begin(), acc.end(), T(0));
+                        for (size_t j = 0; j < key_length; j++)
+                        {
+                            T score = 0;
+                            for (size_t d = 0; d < depth; d++)
+                            {
+                                score += q[d] * k[j * depth + d];
+                            }
+                            score = static_cast<T>(score * scale);
+                            if (mask_row)
+                            {
+                                score += mask_row[j];
+                            }
+                            if (score == neg_inf)
+                            {
+                                continue;
+                            }
+                            if (score > max)
+                            {
+                                const T correction = std::exp(max - score);
+                                sum *= correction;
+                                for (size_t d = 0; d < value_depth; d++)
+                                {
+                                    acc[d] *= correction;
+                                }
+                                max = score;
+                            }
+                            const T p = std::exp(score - max);
+                            sum += p;
+                            for (size_t d = 0; d < value_depth; d++)
+                            {
+                                acc[d] += p * v[j * value_depth + d];
+                            }
+                        }
+                        T* o = out + (n * query_length + i) * value_depth;
+                        for (size_t d = 0; d < value_depth; d++)
+                        {
+                            o[d] = acc[d] / sum;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
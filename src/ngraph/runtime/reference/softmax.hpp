@@ -16,11 +16,10 @@
 
 #pragma once
 
-#include <cmath>
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/runtime/reference/max.hpp"
-#include "ngraph/runtime/reference/sum.hpp"
-#include "ngraph/shape_util.hpp"
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/axis_split.hpp"
+#include "ngraph/runtime/reference/normalization.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -31,30 +30,16 @@ namespace ngraph
             template <typename T>
             void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
             {
-                auto temp_shape = reduce(shape, axes);
-                auto temp_elements = shape_size(temp_shape);
-                auto temp_ptr = new T[temp_elements];
-
-                max(arg, temp_ptr, shape, temp_shape, axes);
-
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
+                AxisSplit split(shape, axes);
+                const size_t* inner = split.inner.data();
+                for (size_t offset : split.outer)
                 {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
+                    softmax_group(arg + offset,
+                                  out + offset,
+                                  split.inner.size(),
+                                  [inner](size_t i) { return inner[i]; },
+                                  false);
                 }
-
-                sum(out, temp_ptr, shape, temp_shape, axes);
-
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
-                }
-
-                delete[] temp_ptr;
             }
         }
     }
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Extent of a tensor around a slicing axis. A slice of `part_size` elements along the
+            // axis consists of `outer` blocks of `part_size * inner_bytes` bytes that are
+            // `axis_size * inner_bytes` bytes apart.
+            struct AxisExtent
+            {
+                AxisExtent(const Shape& shape, size_t axis, size_t element_size)
+                    : outer(1)
+                    , axis_size(shape.at(axis))
+                    , inner_bytes(element_size)
+                {
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= shape[i];
+                    }
+                    for (size_t i = axis + 1; i < shape.size(); i++)
+                    {
+                        inner_bytes *= shape[i];
+                    }
+                }
+
+                // A slice is a single contiguous block when there is nothing outside the axis
+                bool is_contiguous() const { return outer == 1; }
+                size_t outer;
+                size_t axis_size;
+                size_t inner_bytes;
+            };
+
+            inline int64_t resolve_slice_index(int64_t value, size_t dim_size)
+            {
+                return value < 0 ? static_cast<int64_t>(dim_size) + value : value;
+            }
+
+            inline size_t
+                iteration_count(int64_t start, int64_t end, int64_t part_size, size_t dim_size)
+            {
+                start = resolve_slice_index(start, dim_size);
+                end = resolve_slice_index(end, dim_size);
+                // +1 because the left and right borders are included [start, end]
+                return static_cast<size_t>((std::abs(end - start) + 1) / part_size);
+            }
+
+            // Position along the axis of the first element of the slice used by `iteration`
+            inline size_t slice_offset(
+                int64_t start, int64_t stride, int64_t part_size, size_t dim_size, size_t iteration)
+            {
+                int64_t offset =
+                    resolve_slice_index(start, dim_size) + static_cast<int64_t>(iteration) * stride;
+                if (stride < 0)
+                {
+                    offset -= part_size - 1;
+                }
+                return static_cast<size_t>(offset);
+            }
+
+            inline void gather_slice(char* dst,
+                                     const char* src,
+                                     const AxisExtent& extent,
+                                     size_t offset,
+                                     size_t part_size)
+            {
+                size_t block = part_size * extent.inner_bytes;
+                size_t src_stride = extent.axis_size * extent.inner_bytes;
+                src += offset * extent.inner_bytes;
+                for (size_t i = 0; i < extent.outer; i++)
+                {
+                    std::memcpy(dst + i * block, src + i * src_stride, block);
+                }
+            }
+
+            inline void scatter_slice(char* dst,
+                                      const char* src,
+                                      const AxisExtent& extent,
+                                      size_t offset,
+                                      size_t part_size)
+            {
+                size_t block = part_size * extent.inner_bytes;
+                size_t dst_stride = extent.axis_size * extent.inner_bytes;
+                dst += offset * extent.inner_bytes;
+                for (size_t i = 0; i < extent.outer; i++)
+                {
+                    std::memcpy(dst + i * dst_stride, src + i * block, block);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,272 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/weight_store.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    const char s_magic[8] = {'N', 'G', 'W', 'E', 'I', 'G', 'H', '1'};
+    const size_t s_alignment = 64;
+
+    struct SegmentHeader
+    {
+        char magic[8];
+        uint64_t count;
+    };
+
+    struct SegmentEntry
+    {
+        uint64_t hash;
+        uint64_t offset;
+        uint64_t size;
+    };
+}
+
+struct runtime::WeightStore::Segment
+{
+    Segment(const string& path);
+    ~Segment();
+
+    char* base = nullptr;
+    size_t size = 0;
+};
+
+runtime::WeightStore::Segment::Segment(const string& path)
+{
+#ifdef _WIN32
+    throw ngraph_error("Attaching a weight store is not supported on Windows");
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw ngraph_error("Failed to open weight store '" + path + "'");
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SegmentHeader))
+    {
+        close(fd);
+        throw ngraph_error("Weight store '" + path + "' is truncated");
+    }
+    size = info.st_size;
+    void* ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        throw ngraph_error("Failed to map weight store '" + path + "'");
+    }
+    base = static_cast<char*>(ptr);
+#endif
+}
+
+runtime::WeightStore::Segment::~Segment()
+{
+#ifndef _WIN32
+    munmap(base, size);
+#endif
+}
+
+runtime::WeightStore* runtime::get_weight_store()
+{
+    static WeightStore* store = new WeightStore();
+    return store;
+}
+
+uint64_t runtime::WeightStore::hash(const void* data, size_t size)
+{
+    // FNV-1a over 64-bit words
+    const uint64_t prime = 0x100000001b3;
+    uint64_t h = 0xcbf29ce484222325 ^ size;
+    const char* bytes = static_cast<const char*>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        h = (h ^ word) * prime;
+    }
+    for (; i < size; i++)
+    {
+        h = (h ^ static_cast<uint8_t>(bytes[i])) * prime;
+    }
+    return h;
+}
+
+shared_ptr<const void> runtime::WeightStore::intern(const void* data, size_t size)
+{
+    uint64_t key = hash(data, size);
+
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(key);
+    for (auto it = range.first; it != range.second;)
+    {
+        shared_ptr<const void> handle = it->second.handle.lock();
+        if (!handle)
+        {
+            it = m_entries.erase(it);
+            continue;
+        }
+        if (it->second.size == size && memcmp(it->second.data, data, size) == 0)
+        {
+            m_deduplicated_bytes += size;
+            return handle;
+        }
+        ++it;
+    }
+
+    shared_ptr<AlignedBuffer> buffer = make_shared<AlignedBuffer>(size, s_alignment);
+    memcpy(buffer->get_ptr(), data, size);
+    shared_ptr<const void> handle(buffer, buffer->get_ptr());
+    m_entries.insert({key, Entry{size, handle.get(), handle}});
+    return handle;
+}
+
+void runtime::WeightStore::share(op::Constant& constant)
+{
+    shared_ptr<const void> handle = intern(constant.get_data_ptr(), constant.get_byte_size());
+    if (handle.get() != constant.get_data_ptr())
+    {
+        constant.share_data(handle.get(), handle);
+    }
+}
+
+void runtime::WeightStore::publish(const string& path) const
+{
+    vector<pair<uint64_t, shared_ptr<const void>>> buffers;
+    vector<SegmentEntry> entries;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (auto& entry : m_entries)
+        {
+            if (auto handle = entry.second.handle.lock())
+            {
+                buffers.push_back({entry.first, handle});
+                entries.push_back(SegmentEntry{entry.first, 0, entry.second.size});
+            }
+        }
+    }
+
+    size_t offset = round_up(sizeof(SegmentHeader) + entries.size() * sizeof(SegmentEntry),
+                             s_alignment);
+    for (auto& entry : entries)
+    {
+        entry.offset = offset;
+        offset = round_up(offset + entry.size, s_alignment);
+    }
+
+    // Written aside and renamed so processes never attach a partial file
+    string tmp_path = path + ".tmp";
+    {
+        ofstream out(tmp_path, ios::binary | ios::trunc);
+        if (!out)
+        {
+            throw ngraph_error("Failed to create weight store '" + tmp_path + "'");
+        }
+        SegmentHeader header;
+        memcpy(header.magic, s_magic, sizeof(s_magic));
+        header.count = entries.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries.data()),
+                  entries.size() * sizeof(SegmentEntry));
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            out.seekp(entries[i].offset);
+            out.write(static_cast<const char*>(buffers[i].second.get()), entries[i].size);
+        }
+        if (!out)
+        {
+            throw ngraph_error("Failed to write weight store '" + tmp_path + "'");
+        }
+    }
+    if (rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        remove(tmp_path.c_str());
+        throw ngraph_error("Failed to create weight store '" + path + "'");
+    }
+}
+
+void runtime::WeightStore::attach(const string& path)
+{
+    auto segment = make_shared<Segment>(path);
+    auto header = reinterpret_cast<const SegmentHeader*>(segment->base);
+    NGRAPH_CHECK(memcmp(header->magic, s_magic, sizeof(s_magic)) == 0,
+                 "'",
+                 path,
+                 "' is not a weight store");
+    NGRAPH_CHECK(sizeof(SegmentHeader) + header->count * sizeof(SegmentEntry) <= segment->size,
+                 "Weight store '",
+                 path,
+                 "' is truncated");
+    auto entries = reinterpret_cast<const SegmentEntry*>(segment->base + sizeof(SegmentHeader));
+
+    lock_guard<mutex> lock(m_mutex);
+    for (size_t i = 0; i < header->count; i++)
+    {
+        const SegmentEntry& entry = entries[i];
+        NGRAPH_CHECK(entry.offset <= segment->size &&
+                         entry.size <= segment->size - entry.offset,
+                     "Weight store '",
+                     path,
+                     "' is truncated");
+        shared_ptr<const void> handle(segment, segment->base + entry.offset);
+        m_entries.insert({entry.hash, Entry{entry.size, handle.get(), handle}});
+    }
+    m_segments.push_back(segment);
+}
+
+size_t runtime::WeightStore::get_buffer_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t count = 0;
+    for (auto& entry : m_entries)
+    {
+        count += entry.second.handle.expired() ? 0 : 1;
+    }
+    return count;
+}
+
+size_t runtime::WeightStore::get_byte_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t size = 0;
+    for (auto& entry : m_entries)
+    {
+        size += entry.second.handle.expired() ? 0 : entry.second.size;
+    }
+    return size;
+}
+
+size_t runtime::WeightStore::get_deduplicated_bytes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_deduplicated_bytes;
+}
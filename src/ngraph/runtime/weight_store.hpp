@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/op/constant.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class WeightStore;
+        /// \brief Returns the weight store shared by all executables of the process
+        WeightStore* get_weight_store();
+    }
+}
+
+/// \brief Deduplicates read-only weight buffers by content, so executables compiled from the
+///        same model, or that fold the same weights into the same layout, keep one copy.
+///
+/// Buffers are reference counted through the handles `intern` returns and are dropped from
+/// the store when the last handle goes away. The live buffers can be published to a file,
+/// which other processes attach read-only; a path on a tmpfs such as /dev/shm makes it a
+/// shared memory segment. Identical weights interned after attaching refer to the mapped
+/// pages instead of being copied.
+class ngraph::runtime::WeightStore
+{
+public:
+    WeightStore() = default;
+    WeightStore(const WeightStore&) = delete;
+    WeightStore& operator=(const WeightStore&) = delete;
+
+    /// \brief Returns a handle to a buffer holding the `size` bytes at `data`, which is
+    ///        shared with every other handle to the same bytes.
+    std::shared_ptr<const void> intern(const void* data, size_t size);
+
+    /// \brief Makes `constant` refer to the shared copy of its data. The constant keeps its
+    ///        own copy alive as well, since callers may still hold pointers into it.
+    void share(op::Constant& constant);
+
+    /// \brief Writes the live buffers to the file at `path` for `attach`
+    void publish(const std::string& path) const;
+
+    /// \brief Maps the buffers published at `path` read-only. They stay mapped as long as the
+    ///        store exists.
+    void attach(const std::string& path);
+
+    /// \brief Returns the number of live buffers
+    size_t get_buffer_count() const;
+    /// \brief Returns the size of the live buffers
+    size_t get_byte_size() const;
+    /// \brief Returns the bytes that `intern` did not copy because they were already stored
+    size_t get_deduplicated_bytes() const;
+
+    static uint64_t hash(const void* data, size_t size);
+
+private:
+    struct Entry
+    {
+        size_t size;
+        const void* data;
+        std::weak_ptr<const void> handle;
+    };
+    struct Segment;
+
+    std::unordered_multimap<uint64_t, Entry> m_entries;
+    std::vector<std::shared_ptr<Segment>> m_segments;
+    size_t m_deduplicated_bytes = 0;
+    mutable std::mutex m_mutex;
+};
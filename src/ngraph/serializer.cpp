@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <mutex>
 #include <queue>
 #include <stack>
 
@@ -125,6 +128,13 @@ public:
     json serialize_tensor_iterator_output_description(
         const std::shared_ptr<op::TensorIterator::OutputDescription>&);
 
+    /// \return The constants serialized without their "value" when binary constant data is
+    ///         enabled, in the order they were serialized.
+    const vector<const op::Constant*>& get_binary_constants() const
+    {
+        return m_binary_constants;
+    }
+
 protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
@@ -132,6 +142,7 @@ protected:
     json m_json_nodes;
     set<const Node*> m_nodes_serialized;
     queue<const Node*> m_nodes_to_serialize;
+    vector<const op::Constant*> m_binary_constants;
 };
 
 class JSONDeserializer
@@ -335,9 +346,7 @@ static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, s
                    [&](shared_ptr<Node> node) {
                        if (auto c = node->as_type<op::Constant>())
                        {
-                           uint32_t size =
-                               static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                     c->get_output_element_type(0).size());
+                           uint32_t size = static_cast<uint32_t>(c->get_byte_size());
                            writer.write(c->get_name(), c->get_data_ptr(), size);
                        }
                    },
@@ -372,10 +381,521 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+// Binary graph format, version 1. Records and constant data are stored in the byte order of
+// the host that wrote the graph, which is recorded in the header and checked on read. The
+// sections are stored in this order:
+//
+//   BinaryGraphHeader
+//   uint32_t string lengths[string_count], followed by string_bytes characters
+//   BinaryNodeRecord[node_count]         nodes in topological order
+//   BinaryEdgeRecord[edge_count]         node inputs, referenced by first_input/input_count
+//   uint32_t[control_dep_count]          node indices, referenced by first_control_dep
+//   uint32_t[parameter_count]            node indices of the function parameters
+//   uint32_t[result_count]               node indices of the function results
+//   BinaryConstantRecord[constant_count]
+//   attribute_bytes of CBOR encoded node attributes, one block per node in node order
+//   zero padding up to payload_offset
+//   constant data, each constant at a multiple of s_binary_graph_alignment
+//
+// Everything before the constant data is read in a single forward pass, so a graph can be
+// deserialized from a stream without building a json document for the whole graph.
+namespace
+{
+    const char s_binary_graph_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', 'G'};
+    constexpr uint32_t s_binary_graph_version = 1;
+    constexpr uint64_t s_binary_graph_alignment = 64;
+    constexpr uint32_t s_binary_graph_byte_order = 0x01020304;
+
+    struct BinaryGraphHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t function_name;
+        uint32_t byte_order;
+        uint32_t reserved;
+        uint64_t string_count;
+        uint64_t string_bytes;
+        uint64_t node_count;
+        uint64_t edge_count;
+        uint64_t control_dep_count;
+        uint64_t parameter_count;
+        uint64_t result_count;
+        uint64_t constant_count;
+        uint64_t attribute_bytes;
+        uint64_t payload_offset;
+    };
+    static_assert(sizeof(BinaryGraphHeader) == 104, "unexpected BinaryGraphHeader layout");
+
+    struct BinaryNodeRecord
+    {
+        uint32_t op;
+        uint32_t name;
+        uint64_t version;
+        uint64_t attribute_offset;
+        uint64_t attribute_size;
+        uint32_t first_input;
+        uint32_t input_count;
+        uint32_t first_control_dep;
+        uint32_t control_dep_count;
+    };
+    static_assert(sizeof(BinaryNodeRecord) == 48, "unexpected BinaryNodeRecord layout");
+
+    struct BinaryEdgeRecord
+    {
+        uint32_t node;
+        uint32_t output;
+    };
+    static_assert(sizeof(BinaryEdgeRecord) == 8, "unexpected BinaryEdgeRecord layout");
+
+    struct BinaryConstantRecord
+    {
+        uint32_t name;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t size;
+    };
+    static_assert(sizeof(BinaryConstantRecord) == 24, "unexpected BinaryConstantRecord layout");
+
+    class BinaryStringTable
+    {
+    public:
+        uint32_t add(const string& s)
+        {
+            auto it = m_index.find(s);
+            if (it != m_index.end())
+            {
+                return it->second;
+            }
+            uint32_t index = static_cast<uint32_t>(m_strings.size());
+            m_index.insert({s, index});
+            m_strings.push_back(s);
+            m_bytes += s.size();
+            return index;
+        }
+        const vector<string>& get_strings() const { return m_strings; }
+        uint64_t get_bytes() const { return m_bytes; }
+
+    private:
+        unordered_map<string, uint32_t> m_index;
+        vector<string> m_strings;
+        uint64_t m_bytes{0};
+    };
+
+    /// \brief Forward-only reader that keeps track of the offset from the start of the graph.
+    class BinaryGraphReader
+    {
+    public:
+        BinaryGraphReader(istream& in)
+            : m_in(in)
+        {
+        }
+
+        void read(void* data, uint64_t size)
+        {
+            m_in.read(reinterpret_cast<char*>(data), static_cast<streamsize>(size));
+            if (static_cast<uint64_t>(m_in.gcount()) != size)
+            {
+                throw ngraph_error("Unexpected end of binary graph");
+            }
+            m_offset += size;
+        }
+
+        template <typename T>
+        void read_vector(vector<T>& v, uint64_t count)
+        {
+            v.resize(count);
+            read(v.data(), count * sizeof(T));
+        }
+
+        void skip_to(uint64_t offset)
+        {
+            if (offset < m_offset)
+            {
+                throw ngraph_error("Binary graph sections are out of order");
+            }
+            m_in.ignore(static_cast<streamsize>(offset - m_offset));
+            m_offset = offset;
+        }
+
+    private:
+        istream& m_in;
+        uint64_t m_offset{0};
+    };
+
+    /// \brief Reads constant data from a binary graph file on demand. Shared by all the lazy
+    ///        constants of one graph.
+    class BinaryPayloadFile
+    {
+    public:
+        BinaryPayloadFile(const string& path)
+            : m_path(path)
+        {
+        }
+
+        void read(void* data, uint64_t offset, uint64_t size)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (!m_in.is_open())
+            {
+                m_in.open(m_path, ios_base::binary | ios_base::in);
+                if (!m_in)
+                {
+                    throw ngraph_error("Failed to reopen binary graph '" + m_path + "'");
+                }
+            }
+            m_in.clear();
+            m_in.seekg(static_cast<streamoff>(offset), ios_base::beg);
+            m_in.read(reinterpret_cast<char*>(data), static_cast<streamsize>(size));
+            if (static_cast<uint64_t>(m_in.gcount()) != size)
+            {
+                throw ngraph_error("Truncated constant data in binary graph '" + m_path + "'");
+            }
+        }
+
+    private:
+        string m_path;
+        mutex m_mutex;
+        ifstream m_in;
+    };
+}
+
+static uint64_t align_binary_offset(uint64_t offset)
+{
+    return (offset + s_binary_graph_alignment - 1) / s_binary_graph_alignment *
+           s_binary_graph_alignment;
+}
+
+template <typename T>
+static void write_binary(ostream& out, const T* data, uint64_t count)
+{
+    out.write(reinterpret_cast<const char*>(data), static_cast<streamsize>(count * sizeof(T)));
+}
+
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    if (!out)
+    {
+        throw ngraph_error("Failed to open '" + path + "' for writing");
+    }
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
+
+    BinaryStringTable strings;
+    vector<BinaryNodeRecord> nodes;
+    vector<BinaryEdgeRecord> edges;
+    vector<uint32_t> control_deps;
+    vector<uint32_t> parameters;
+    vector<uint32_t> results;
+    vector<uint8_t> attributes;
+    unordered_map<const Node*, uint32_t> node_index;
+
+    for (auto& node : func->get_ordered_ops())
+    {
+        BinaryNodeRecord record{};
+        const NodeTypeInfo& type_info = node->get_type_info();
+        record.op = strings.add(type_info.name);
+        record.name = strings.add(node->get_name());
+        record.version = type_info.version;
+        record.first_input = static_cast<uint32_t>(edges.size());
+        record.first_control_dep = static_cast<uint32_t>(control_deps.size());
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            edges.push_back({node_index.at(source.get_node()),
+                             static_cast<uint32_t>(source.get_index())});
+        }
+        for (auto& control_dep : node->get_control_dependencies())
+        {
+            control_deps.push_back(node_index.at(control_dep.get()));
+        }
+        record.input_count = static_cast<uint32_t>(edges.size()) - record.first_input;
+        record.control_dep_count =
+            static_cast<uint32_t>(control_deps.size()) - record.first_control_dep;
+
+        // Everything that is not already in the tables is kept as a CBOR attribute block
+        json node_js = serializer.serialize_node(*node);
+        for (auto key : {"name", "op", "type_info", "inputs", "control_deps"})
+        {
+            node_js.erase(key);
+        }
+        vector<uint8_t> cbor = json::to_cbor(node_js);
+        record.attribute_offset = attributes.size();
+        record.attribute_size = cbor.size();
+        attributes.insert(attributes.end(), cbor.begin(), cbor.end());
+
+        node_index[node.get()] = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(record);
+    }
+    for (auto& parameter : func->get_parameters())
+    {
+        parameters.push_back(node_index.at(parameter.get()));
+    }
+    for (auto& result : func->get_results())
+    {
+        results.push_back(node_index.at(result.get()));
+    }
+
+    BinaryGraphHeader header{};
+    memcpy(header.magic, s_binary_graph_magic, sizeof(header.magic));
+    header.version = s_binary_graph_version;
+    header.byte_order = s_binary_graph_byte_order;
+    header.function_name = strings.add(func->get_friendly_name());
+
+    // Constants, including those inside TensorIterator bodies, were collected while the nodes
+    // were serialized.
+    const vector<const op::Constant*>& constants = serializer.get_binary_constants();
+    vector<BinaryConstantRecord> constant_records;
+    for (const op::Constant* constant : constants)
+    {
+        BinaryConstantRecord record{};
+        record.name = strings.add(constant->get_name());
+        record.size = constant->get_byte_size();
+        constant_records.push_back(record);
+    }
+
+    header.string_count = strings.get_strings().size();
+    header.string_bytes = strings.get_bytes();
+    header.node_count = nodes.size();
+    header.edge_count = edges.size();
+    header.control_dep_count = control_deps.size();
+    header.parameter_count = parameters.size();
+    header.result_count = results.size();
+    header.constant_count = constant_records.size();
+    header.attribute_bytes = attributes.size();
+
+    uint64_t offset = sizeof(header) + header.string_count * sizeof(uint32_t) +
+                      header.string_bytes + nodes.size() * sizeof(BinaryNodeRecord) +
+                      edges.size() * sizeof(BinaryEdgeRecord) +
+                      (control_deps.size() + parameters.size() + results.size()) *
+                          sizeof(uint32_t) +
+                      constant_records.size() * sizeof(BinaryConstantRecord) + attributes.size();
+    uint64_t attributes_end = offset;
+    header.payload_offset = align_binary_offset(offset);
+    offset = header.payload_offset;
+    for (BinaryConstantRecord& record : constant_records)
+    {
+        record.offset = offset;
+        offset = align_binary_offset(offset + record.size);
+    }
+
+    write_binary(out, &header, 1);
+    vector<uint32_t> string_lengths;
+    for (const string& s : strings.get_strings())
+    {
+        string_lengths.push_back(static_cast<uint32_t>(s.size()));
+    }
+    write_binary(out, string_lengths.data(), string_lengths.size());
+    for (const string& s : strings.get_strings())
+    {
+        out.write(s.data(), static_cast<streamsize>(s.size()));
+    }
+    write_binary(out, nodes.data(), nodes.size());
+    write_binary(out, edges.data(), edges.size());
+    write_binary(out, control_deps.data(), control_deps.size());
+    write_binary(out, parameters.data(), parameters.size());
+    write_binary(out, results.data(), results.size());
+    write_binary(out, constant_records.data(), constant_records.size());
+    write_binary(out, attributes.data(), attributes.size());
+
+    const char padding[s_binary_graph_alignment] = {};
+    uint64_t position = attributes_end;
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        const BinaryConstantRecord& record = constant_records[i];
+        out.write(padding, static_cast<streamsize>(record.offset - position));
+        write_binary(out, static_cast<const char*>(constants[i]->get_data_ptr()), record.size);
+        position = record.offset + record.size;
+    }
+    if (!out)
+    {
+        throw ngraph_error("Failed to write binary graph");
+    }
+}
+
+bool ngraph::is_binary_graph(istream& in)
+{
+    auto position = in.tellg();
+    char magic[sizeof(s_binary_graph_magic)] = {};
+    in.read(magic, sizeof(magic));
+    bool rc = (in.gcount() == sizeof(magic) &&
+               memcmp(magic, s_binary_graph_magic, sizeof(magic)) == 0);
+    in.clear();
+    in.seekg(position);
+    return rc;
+}
+
+/// \brief Deserialize a binary graph from in. If path is not empty it names the file in is
+///        reading and the constants are loaded from it on first access, otherwise the constant
+///        data is read from in before returning.
+static shared_ptr<Function> deserialize_binary(istream& in, const string& path)
+{
+    BinaryGraphReader reader(in);
+    BinaryGraphHeader header;
+    reader.read(&header, sizeof(header));
+    if (memcmp(header.magic, s_binary_graph_magic, sizeof(header.magic)) != 0)
+    {
+        throw ngraph_error("Not a binary graph");
+    }
+    if (header.byte_order != s_binary_graph_byte_order)
+    {
+        throw ngraph_error("Binary graph was written with a different byte order");
+    }
+    if (header.version != s_binary_graph_version)
+    {
+        throw ngraph_error("Unsupported binary graph version " + to_string(header.version));
+    }
+
+    vector<uint32_t> string_lengths;
+    reader.read_vector(string_lengths, header.string_count);
+    vector<char> string_data;
+    reader.read_vector(string_data, header.string_bytes);
+    vector<string> strings;
+    strings.reserve(string_lengths.size());
+    const char* p = string_data.data();
+    for (uint32_t length : string_lengths)
+    {
+        strings.emplace_back(p, length);
+        p += length;
+    }
+
+    vector<BinaryNodeRecord> node_records;
+    reader.read_vector(node_records, header.node_count);
+    vector<BinaryEdgeRecord> edges;
+    reader.read_vector(edges, header.edge_count);
+    vector<uint32_t> control_deps;
+    reader.read_vector(control_deps, header.control_dep_count);
+    vector<uint32_t> parameter_indices;
+    reader.read_vector(parameter_indices, header.parameter_count);
+    vector<uint32_t> result_indices;
+    reader.read_vector(result_indices, header.result_count);
+    vector<BinaryConstantRecord> constant_records;
+    reader.read_vector(constant_records, header.constant_count);
+
+    unordered_map<string, const BinaryConstantRecord*> constant_map;
+    for (const BinaryConstantRecord& record : constant_records)
+    {
+        constant_map[strings.at(record.name)] = &record;
+    }
+
+    shared_ptr<BinaryPayloadFile> payload_file;
+    if (!path.empty())
+    {
+        payload_file = make_shared<BinaryPayloadFile>(path);
+    }
+    vector<pair<uint64_t, shared_ptr<op::Constant>>> stream_constants;
+
+    JSONDeserializer deserializer;
+    deserializer.set_const_data_callback(
+        [&](const string& name, const element::Type& et, const Shape& shape) {
+            shared_ptr<op::Constant> constant;
+            auto it = constant_map.find(name);
+            if (it != constant_map.end())
+            {
+                uint64_t offset = it->second->offset;
+                uint64_t size = it->second->size;
+                if (payload_file)
+                {
+                    constant = make_shared<op::Constant>(
+                        et, shape, [payload_file, offset, size](void* data) {
+                            payload_file->read(data, offset, size);
+                        });
+                }
+                else
+                {
+                    // The data follows the attributes in the stream; it is read once all the
+                    // nodes exist.
+                    constant = make_shared<op::Constant>(
+                        et, shape, [&reader, offset, size](void* data) {
+                            reader.skip_to(offset);
+                            reader.read(data, size);
+                        });
+                    stream_constants.push_back({offset, constant});
+                }
+                if (constant->get_byte_size() != size)
+                {
+                    throw ngraph_error("Size mismatch for constant '" + name + "'");
+                }
+            }
+            return constant;
+        });
+
+    vector<shared_ptr<Node>> nodes;
+    nodes.reserve(node_records.size());
+    vector<uint8_t> cbor;
+    uint64_t attribute_offset = 0;
+    for (const BinaryNodeRecord& record : node_records)
+    {
+        if (record.attribute_offset != attribute_offset)
+        {
+            throw ngraph_error("Binary graph attributes are out of order");
+        }
+        reader.read_vector(cbor, record.attribute_size);
+        attribute_offset += record.attribute_size;
+
+        json node_js = json::from_cbor(cbor);
+        node_js["name"] = strings.at(record.name);
+        node_js["op"] = strings.at(record.op);
+        node_js["type_info"] = {{"name", strings.at(record.op)}, {"version", record.version}};
+        json inputs = json::array();
+        for (uint32_t i = record.first_input; i < record.first_input + record.input_count; i++)
+        {
+            const BinaryEdgeRecord& edge = edges.at(i);
+            const string& input_name = strings.at(node_records.at(edge.node).name);
+            inputs.push_back({{"node", input_name}, {"index", edge.output}});
+        }
+        node_js["inputs"] = inputs;
+        json deps = json::array();
+        for (uint32_t i = record.first_control_dep;
+             i < record.first_control_dep + record.control_dep_count;
+             i++)
+        {
+            deps.push_back(strings.at(node_records.at(control_deps.at(i)).name));
+        }
+        node_js["control_deps"] = deps;
+        nodes.push_back(deserializer.deserialize_node(node_js));
+    }
+
+    sort(stream_constants.begin(),
+         stream_constants.end(),
+         [](const pair<uint64_t, shared_ptr<op::Constant>>& a,
+            const pair<uint64_t, shared_ptr<op::Constant>>& b) { return a.first < b.first; });
+    for (auto& stream_constant : stream_constants)
+    {
+        stream_constant.second->get_data_ptr();
+    }
+
+    ParameterVector parameters;
+    for (uint32_t index : parameter_indices)
+    {
+        auto parameter = as_type_ptr<op::Parameter>(nodes.at(index));
+        NGRAPH_CHECK(parameter, "Binary graph parameter is not a Parameter");
+        parameters.push_back(parameter);
+    }
+    ResultVector results;
+    for (uint32_t index : result_indices)
+    {
+        auto result = as_type_ptr<op::Result>(nodes.at(index));
+        NGRAPH_CHECK(result, "Binary graph result is not a Result");
+        results.push_back(result);
+    }
+    return make_shared<Function>(results, parameters, strings.at(header.function_name));
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (is_binary_graph(in))
+    {
+        rc = deserialize_binary(in, "");
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
@@ -428,7 +948,14 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (is_binary_graph(in))
+        {
+            rc = deserialize_binary(in, s);
+        }
+        else
+        {
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -1068,8 +1595,19 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::Constant>(element_type, shape, value);
+            if (m_const_data_callback && !has_key(node_js, "value"))
+            {
+                node = m_const_data_callback(node_name, element_type, shape);
+                if (!node)
+                {
+                    throw ngraph_error("No data found for constant '" + node_name + "'");
+                }
+            }
+            else
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::Constant>(element_type, shape, value);
+            }
             break;
         }
         case OP_TYPEID::Convert:
@@ -2454,6 +2992,20 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::ScaleShift>(args[0], args[1], args[2]);
             break;
         }
+        case OP_TYPEID::ScaledDotProductAttention:
+        {
+            auto scale = node_js.at("scale").get<double>();
+            if (args.size() == 4)
+            {
+                node = make_shared<op::ScaledDotProductAttention>(
+                    args[0], args[1], args[2], args[3], scale);
+            }
+            else
+            {
+                node = make_shared<op::ScaledDotProductAttention>(args[0], args[1], args[2], scale);
+            }
+            break;
+        }
         case OP_TYPEID::ScatterAdd:
         {
             node = make_shared<op::ScatterAdd>(args[0], args[1], args[2]);
@@ -3173,7 +3725,12 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant_v1:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->are_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_binary_constant_data)
+        {
+            m_binary_constants.push_back(tmp);
+        }
+        else if (tmp->are_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -4120,6 +4677,12 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::ScaleShift: { break;
     }
+    case OP_TYPEID::ScaledDotProductAttention:
+    {
+        auto tmp = static_cast<const op::ScaledDotProductAttention*>(&n);
+        node["scale"] = tmp->get_scale();
+        break;
+    }
     case OP_TYPEID::ScatterAdd: { break;
     }
     case OP_TYPEID::ScatterNDAdd: { break;
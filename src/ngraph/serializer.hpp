@@ -48,12 +48,35 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a binary graph file
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    ///
+    /// The binary graph format stores node records, edges and attributes in flat tables
+    /// followed by the raw constant data, with each constant aligned to a 64 byte offset.
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a binary graph stream
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Check if a stream holds a binary graph. The stream position is not changed.
+    /// \param in An istream to the input data
+    bool is_binary_graph(std::istream& in);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
+    ///
+    /// Accepts json, cpio and binary graph data. Constants of a binary graph read from a stream
+    /// are materialized while the stream is read.
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
     /// \param str The json formatted string to deseriailze.
+    ///
+    /// If str names a binary graph file then its constants are not read until their data is
+    /// first accessed, so the file must not be modified while the Function is in use.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
     /// \brief If enabled adds output shapes to the serialized graph
@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief A sequence whose elements are constructed in place and never move.
+    ///
+    /// The first N elements are stored inline; further elements go to separately allocated
+    /// blocks of doubling size. Unlike std::deque nothing is allocated until more than N
+    /// elements are added, and an empty sequence costs a few words. Elements need be neither
+    /// copyable nor movable.
+    template <typename T, size_t N>
+    class StableVector
+    {
+        static_assert(N > 0, "StableVector needs at least one inline element");
+        using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    public:
+        template <bool IsConst>
+        class Iterator
+        {
+            using Container =
+                typename std::conditional<IsConst, const StableVector, StableVector>::type;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+            using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+            Iterator() = default;
+            Iterator(Container* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+            operator Iterator<true>() const { return Iterator<true>(m_container, m_index); }
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            reference operator[](difference_type n) const { return *(*this + n); }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int) { return Iterator(m_container, m_index++); }
+            Iterator& operator--()
+            {
+                --m_index;
+                return *this;
+            }
+            Iterator operator--(int) { return Iterator(m_container, m_index--); }
+            Iterator& operator+=(difference_type n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(difference_type n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(difference_type n) const
+            {
+                return Iterator(m_container, m_index + n);
+            }
+            Iterator operator-(difference_type n) const
+            {
+                return Iterator(m_container, m_index - n);
+            }
+            difference_type operator-(const Iterator& other) const
+            {
+                return static_cast<difference_type>(m_index) -
+                       static_cast<difference_type>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+            bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+            bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+            bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+
+        private:
+            Container* m_container = nullptr;
+            size_t m_index = 0;
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector() { clear(); }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            void* slot = allocate_slot(m_size);
+            T* element = new (slot) T(std::forward<Args>(args)...);
+            m_size++;
+            return *element;
+        }
+
+        /// \brief Destroys the elements in reverse order and releases the overflow blocks.
+        void clear()
+        {
+            while (m_size > 0)
+            {
+                (*this)[--m_size].~T();
+            }
+            m_blocks.clear();
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T& operator[](size_t index) { return *reinterpret_cast<T*>(slot(index)); }
+        const T& operator[](size_t index) const
+        {
+            return *reinterpret_cast<const T*>(const_cast<StableVector*>(this)->slot(index));
+        }
+        T& at(size_t index)
+        {
+            check_range(index);
+            return (*this)[index];
+        }
+        const T& at(size_t index) const
+        {
+            check_range(index);
+            return (*this)[index];
+        }
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[m_size - 1]; }
+        const T& back() const { return (*this)[m_size - 1]; }
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+    private:
+        // Overflow block b holds N << b elements.
+        Storage* slot(size_t index)
+        {
+            if (index < N)
+            {
+                return &m_inline[index];
+            }
+            index -= N;
+            size_t block = 0;
+            size_t capacity = N;
+            while (index >= capacity)
+            {
+                index -= capacity;
+                capacity *= 2;
+                block++;
+            }
+            return &m_blocks[block][index];
+        }
+
+        void* allocate_slot(size_t index)
+        {
+            if (index >= N)
+            {
+                size_t capacity = N;
+                size_t first = N;
+                for (size_t block = 0; block < m_blocks.size(); block++)
+                {
+                    first += capacity;
+                    capacity *= 2;
+                }
+                if (index == first)
+                {
+                    m_blocks.emplace_back(new Storage[capacity]);
+                }
+            }
+            return slot(index);
+        }
+
+        void check_range(size_t index) const
+        {
+            if (index >= m_size)
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+
+        Storage m_inline[N];
+        std::vector<std::unique_ptr<Storage[]>> m_blocks;
+        size_t m_size = 0;
+    };
+}
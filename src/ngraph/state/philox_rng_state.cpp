@@ -0,0 +1,25 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/state/philox_rng_state.hpp"
+
+using namespace ngraph;
+
+constexpr size_t PhiloxRNGState::batch_blocks;
+constexpr uint32_t PhiloxRNGState::s_m0;
+constexpr uint32_t PhiloxRNGState::s_m1;
+constexpr uint32_t PhiloxRNGState::s_w0;
+constexpr uint32_t PhiloxRNGState::s_w1;
@@ -0,0 +1,152 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+
+#include "state.hpp"
+
+namespace ngraph
+{
+    /// \brief Counter-based random number generator state (Philox4x32-10).
+    ///
+    /// Every 128-bit counter value is mapped to four independent 32-bit random words by a
+    /// keyed bijection, so the random number for element i of a tensor can be computed
+    /// directly from (key, counter + i / elements_per_block). Kernels can therefore split a
+    /// tensor across any number of threads and still produce bit-identical output. The state
+    /// only holds the key and the next unused counter.
+    class PhiloxRNGState : public State
+    {
+    public:
+        /// \brief Number of blocks generate() computes together; the rounds are written over
+        ///        this many independent lanes so the compiler can vectorize them.
+        static constexpr size_t batch_blocks = 8;
+
+        PhiloxRNGState(uint64_t seed)
+            : State()
+            , m_key(seed)
+            , m_counter(0)
+        {
+        }
+        PhiloxRNGState()
+            : State()
+            , m_key((static_cast<uint64_t>(std::random_device()()) << 32) |
+                    std::random_device()())
+            , m_counter(0)
+        {
+        }
+        virtual void activate() override {}
+        virtual void deactivate() override {}
+        virtual ~PhiloxRNGState() override {}
+        uint64_t get_key() const { return m_key; }
+        /// \brief Reserves `blocks` consecutive counter values and returns the first one.
+        uint64_t advance(uint64_t blocks) { return m_counter.fetch_add(blocks); }
+        /// \return The number of blocks needed for `count` elements when each block provides
+        ///         `elements_per_block` elements.
+        static uint64_t get_block_count(size_t count, size_t elements_per_block)
+        {
+            return (count + elements_per_block - 1) / elements_per_block;
+        }
+
+        /// \brief One Philox4x32-10 block. `ctr` holds the 128-bit counter as four words,
+        ///        least significant first; the four random words are written to `out`.
+        static void philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+        {
+            uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+            uint32_t k0 = key[0], k1 = key[1];
+            for (size_t round = 0; round < 10; round++)
+            {
+                uint64_t p0 = static_cast<uint64_t>(s_m0) * c0;
+                uint64_t p1 = static_cast<uint64_t>(s_m1) * c2;
+                c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+                c1 = static_cast<uint32_t>(p1);
+                c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+                c3 = static_cast<uint32_t>(p0);
+                k0 += s_w0;
+                k1 += s_w1;
+            }
+            out[0] = c0;
+            out[1] = c1;
+            out[2] = c2;
+            out[3] = c3;
+        }
+
+        /// \brief Computes `blocks` consecutive blocks starting at `counter`, writing
+        ///        4 * blocks words to `out`.
+        static void generate(uint64_t key, uint64_t counter, size_t blocks, uint32_t* out)
+        {
+            for (size_t first = 0; first < blocks; first += batch_blocks)
+            {
+                uint32_t c0[batch_blocks], c1[batch_blocks], c2[batch_blocks], c3[batch_blocks];
+                for (size_t lane = 0; lane < batch_blocks; lane++)
+                {
+                    uint64_t ctr = counter + first + lane;
+                    c0[lane] = static_cast<uint32_t>(ctr);
+                    c1[lane] = static_cast<uint32_t>(ctr >> 32);
+                    c2[lane] = 0;
+                    c3[lane] = 0;
+                }
+                uint32_t k0 = static_cast<uint32_t>(key);
+                uint32_t k1 = static_cast<uint32_t>(key >> 32);
+                for (size_t round = 0; round < 10; round++)
+                {
+                    for (size_t lane = 0; lane < batch_blocks; lane++)
+                    {
+                        uint64_t p0 = static_cast<uint64_t>(s_m0) * c0[lane];
+                        uint64_t p1 = static_cast<uint64_t>(s_m1) * c2[lane];
+                        c0[lane] = static_cast<uint32_t>(p1 >> 32) ^ c1[lane] ^ k0;
+                        c1[lane] = static_cast<uint32_t>(p1);
+                        c2[lane] = static_cast<uint32_t>(p0 >> 32) ^ c3[lane] ^ k1;
+                        c3[lane] = static_cast<uint32_t>(p0);
+                    }
+                    k0 += s_w0;
+                    k1 += s_w1;
+                }
+                size_t lanes = std::min(batch_blocks, blocks - first);
+                for (size_t lane = 0; lane < lanes; lane++)
+                {
+                    uint32_t* block = out + 4 * (first + lane);
+                    block[0] = c0[lane];
+                    block[1] = c1[lane];
+                    block[2] = c2[lane];
+                    block[3] = c3[lane];
+                }
+            }
+        }
+
+        /// \return A value in [0, 1) with 32 bits of randomness.
+        static double to_unit(uint32_t x) { return x * (1.0 / 4294967296.0); }
+        /// \return A value in [0, 1) with 53 bits of randomness.
+        static double to_unit(uint32_t hi, uint32_t lo)
+        {
+            uint64_t x = (static_cast<uint64_t>(hi) << 32) | lo;
+            return static_cast<double>(x >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+    private:
+        static constexpr uint32_t s_m0 = 0xD2511F53;
+        static constexpr uint32_t s_m1 = 0xCD9E8D57;
+        static constexpr uint32_t s_w0 = 0x9E3779B9;
+        static constexpr uint32_t s_w1 = 0xBB67AE85;
+
+        uint64_t m_key;
+        std::atomic<uint64_t> m_counter;
+    };
+}
@@ -15,11 +15,15 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <exception>
 #include <forward_list>
 #include <iomanip>
 #include <map>
+#include <mutex>
 #include <numeric>
+#include <thread>
 #include <unordered_set>
 
 #include "ngraph/coordinate_diff.hpp"
@@ -197,6 +201,62 @@ size_t ngraph::round_up(size_t size, size_t alignment)
     return size + alignment - remainder;
 }
 
+void ngraph::parallel_for_each_index(size_t count,
+                                     const std::function<void(size_t)>& func,
+                                     size_t max_threads)
+{
+    if (max_threads == 0)
+    {
+        max_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    size_t num_threads = std::min(max_threads, count);
+    if (num_threads <= 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            func(i);
+        }
+        return;
+    }
+
+    atomic<size_t> next{0};
+    mutex error_mutex;
+    exception_ptr error;
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(error_mutex);
+                if (!error)
+                {
+                    error = current_exception();
+                }
+                next = count;
+            }
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
 ngraph::FpropCache ngraph::cache_fprop(std::shared_ptr<ngraph::Function> fprop,
                                        std::shared_ptr<ngraph::Function> bprop)
 {
@@ -194,6 +194,14 @@ namespace ngraph
     void ngraph_free(void*);
 
     size_t round_up(size_t size, size_t alignment);
+
+    /// \brief Calls `func(i)` for each i in [0, count) on up to `max_threads` threads, one of
+    ///        which is the calling thread. A `max_threads` of 0 uses one thread per hardware
+    ///        thread. Returns once all calls have finished and rethrows the first exception
+    ///        thrown by `func`; indices not yet started at that point are skipped.
+    void parallel_for_each_index(size_t count,
+                                 const std::function<void(size_t)>& func,
+                                 size_t max_threads = 0);
     bool is_valid_permutation(ngraph::AxisVector permutation, ngraph::Rank rank = Rank::dynamic());
     template <typename T>
     T apply_permutation(T input, ngraph::AxisVector order);
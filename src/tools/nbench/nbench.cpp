@@ -27,6 +27,7 @@
 
 #include <fstream>
 #include <iomanip>
+#include <regex>
 
 #include "benchmark.hpp"
 #include "benchmark_pipelined.hpp"
@@ -43,6 +44,7 @@
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "op_benchmark.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -184,6 +186,75 @@ element::Type get_op_element_type(const Node& op)
     return type;
 }
 
+static int run_op_benchmarks(const string& backend,
+                             const string& filter,
+                             double min_time_ms,
+                             size_t repetitions,
+                             const string& baseline,
+                             const string& save_baseline,
+                             double tolerance)
+{
+    vector<string> backends;
+    if (backend.empty())
+    {
+        backends = runtime::Backend::get_registered_devices();
+    }
+    else
+    {
+        backends.push_back(backend);
+    }
+    regex filter_regex(filter.empty() ? ".*" : filter);
+
+    int rc = 0;
+    vector<OpBenchmarkResult> results;
+    for (const OpBenchmark& benchmark : make_op_benchmarks())
+    {
+        if (!regex_search(benchmark.name, filter_regex))
+        {
+            continue;
+        }
+        for (const string& backend_name : backends)
+        {
+            try
+            {
+                results.push_back(
+                    run_op_benchmark(benchmark, backend_name, min_time_ms, repetitions));
+            }
+            catch (ngraph::unsupported_op& ue)
+            {
+                cout << "Skipping " << benchmark.name << " on " << backend_name
+                     << ", unsupported op '" << ue.what() << "'" << endl;
+            }
+            catch (exception& e)
+            {
+                cout << "Exception caught on " << benchmark.name << " on " << backend_name
+                     << "\n"
+                     << e.what() << endl;
+                rc += 1;
+            }
+        }
+    }
+
+    print_op_benchmark_results(results);
+    try
+    {
+        if (!save_baseline.empty())
+        {
+            save_op_benchmarks(results, save_baseline);
+        }
+        if (!baseline.empty() && compare_op_benchmarks(results, baseline, tolerance) > 0)
+        {
+            rc += 1;
+        }
+    }
+    catch (exception& e)
+    {
+        cout << e.what() << endl;
+        rc += 1;
+    }
+    return rc;
+}
+
 int main(int argc, char** argv)
 {
     string model_arg;
@@ -198,6 +269,13 @@ int main(int argc, char** argv)
     bool copy_data = true;
     bool dot_file = false;
     bool double_buffer = false;
+    bool op_suite = false;
+    string filter;
+    double min_time_ms = 100;
+    int repetitions = 3;
+    string baseline;
+    string save_baseline;
+    double tolerance = 0.1;
 
     configure_static_backends();
     for (int i = 1; i < argc; i++)
@@ -251,6 +329,46 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--ops")
+        {
+            op_suite = true;
+        }
+        else if (arg == "--filter")
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--baseline")
+        {
+            baseline = argv[++i];
+        }
+        else if (arg == "--save_baseline")
+        {
+            save_baseline = argv[++i];
+        }
+        else if (arg == "--min_time" || arg == "--repetitions" || arg == "--tolerance")
+        {
+            try
+            {
+                string value = argv[++i];
+                if (arg == "--min_time")
+                {
+                    min_time_ms = stod(value);
+                }
+                else if (arg == "--repetitions")
+                {
+                    repetitions = stoi(value);
+                }
+                else
+                {
+                    tolerance = stod(value) / 100;
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -269,6 +387,11 @@ int main(int argc, char** argv)
             failed = true;
         }
     }
+    if (repetitions < 1)
+    {
+        cout << "Repetitions must be at least 1\n";
+        failed = true;
+    }
     if (!model_arg.empty() && !file_util::exists(model_arg))
     {
         cout << "File " << model_arg << " not found\n";
@@ -279,9 +402,9 @@ int main(int argc, char** argv)
         cout << "Directory " << directory << " not found\n";
         failed = true;
     }
-    else if (directory.empty() && model_arg.empty())
+    else if (directory.empty() && model_arg.empty() && !op_suite)
     {
-        cout << "Either file or directory must be specified\n";
+        cout << "Either file, directory or --ops must be specified\n";
         failed = true;
     }
 
@@ -289,13 +412,14 @@ int main(int argc, char** argv)
     {
         cout << R"###(
 DESCRIPTION
-    Benchmark nGraph JSON model with given backend.
+    Benchmark nGraph JSON or binary graph model with given backend.
 
 SYNOPSIS
         nbench [-f <filename>] [-b <backend>] [-i <iterations>]
+        nbench --ops [-b <backend>] [--filter <regex>] [--baseline <json>]
 
 OPTIONS
-        -f|--file                 Serialized model file
+        -f|--file                 Serialized model file (json or binary graph)
         -b|--backend              Backend to use (default: CPU)
         -d|--directory            Directory to scan for models. All models are benchmarked.
         -i|--iterations           Iterations (default: 10)
@@ -306,10 +430,24 @@ OPTIONS
         --no_copy_data            Disable copy of input/result data every iteration
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --ops                     Run the generated single-op benchmark suite on the given
+                                  backend, or on every registered backend if -b is not given
+        --filter                  Only run op benchmarks whose name matches this regex
+        --min_time                Minimum time per op benchmark batch in ms (default: 100)
+        --repetitions             Number of timed batches per op benchmark (default: 3)
+        --save_baseline           Write the op benchmark results to this JSON file
+        --baseline                Compare the op benchmark results against this JSON file
+        --tolerance               Slowdown in percent reported as a regression (default: 10)
 )###";
         return 1;
     }
 
+    if (op_suite)
+    {
+        return run_op_benchmarks(
+            backend, filter, min_time_ms, repetitions, baseline, save_baseline, tolerance);
+    }
+
     vector<string> models;
     if (!directory.empty())
     {
@@ -442,7 +580,11 @@ OPTIONS
             if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
+                stopwatch timer;
+                timer.start();
                 shared_ptr<Function> f = deserialize(model);
+                timer.stop();
+                cout << "Deserialize time: " << timer.get_milliseconds() << "ms" << endl;
                 vector<runtime::PerformanceCounter> perf_data;
                 if (double_buffer)
                 {
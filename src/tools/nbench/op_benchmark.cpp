@@ -0,0 +1,417 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+
+#include "benchmark_utils.hpp"
+#include "ngraph/ngraph.hpp"
+#include "nlohmann/json.hpp"
+#include "op_benchmark.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+static string shape_name(const Shape& shape)
+{
+    return join(shape, "x");
+}
+
+static double tensor_bytes(const element::Type& et, const Shape& shape)
+{
+    return static_cast<double>(et.size() * shape_size(shape));
+}
+
+static void add_benchmark(vector<OpBenchmark>& benchmarks,
+                          const string& name,
+                          const shared_ptr<Node>& node,
+                          const ParameterVector& parameters,
+                          double flops)
+{
+    auto f = make_shared<Function>(node, parameters);
+    double bytes = 0;
+    for (const shared_ptr<Node>& op : f->get_ops())
+    {
+        if (op->is_parameter() || op->is_constant() || op->is_output())
+        {
+            bytes += tensor_bytes(op->get_output_element_type(0), op->get_output_shape(0));
+        }
+    }
+    benchmarks.push_back(OpBenchmark{name, f, flops, bytes});
+}
+
+static void add_convolution(vector<OpBenchmark>& benchmarks,
+                            const element::Type& et,
+                            const Shape& data_shape,
+                            const Shape& filter_shape,
+                            size_t stride,
+                            ptrdiff_t padding)
+{
+    size_t spatial_rank = data_shape.size() - 2;
+    auto data = make_shared<op::Parameter>(et, data_shape);
+    auto filters = make_shared<op::Parameter>(et, filter_shape);
+    auto conv = make_shared<op::Convolution>(data,
+                                             filters,
+                                             Strides(spatial_rank, stride),
+                                             Strides(spatial_rank, 1),
+                                             CoordinateDiff(spatial_rank, padding),
+                                             CoordinateDiff(spatial_rank, padding));
+    // One multiply and one add per filter tap of every output element
+    double flops = 2.0 * shape_size(conv->get_shape()) * shape_size(filter_shape) / filter_shape[0];
+    ostringstream name;
+    name << "Convolution/" << et.get_type_name() << "/" << shape_name(data_shape) << "/"
+         << shape_name(filter_shape) << "/s" << stride << "p" << padding;
+    add_benchmark(benchmarks, name.str(), conv, ParameterVector{data, filters}, flops);
+}
+
+static void add_dot(vector<OpBenchmark>& benchmarks,
+                    const element::Type& et,
+                    const Shape& a_shape,
+                    const Shape& b_shape)
+{
+    auto a = make_shared<op::Parameter>(et, a_shape);
+    auto b = make_shared<op::Parameter>(et, b_shape);
+    auto dot = make_shared<op::Dot>(a, b);
+    double flops = 2.0 * shape_size(dot->get_shape()) * a_shape.back();
+    string name =
+        "Dot/" + et.get_type_name() + "/" + shape_name(a_shape) + "/" + shape_name(b_shape);
+    add_benchmark(benchmarks, name, dot, ParameterVector{a, b}, flops);
+}
+
+template <typename OP>
+static void add_reduction(vector<OpBenchmark>& benchmarks,
+                          const string& op_name,
+                          const element::Type& et,
+                          const Shape& shape,
+                          const AxisSet& axes)
+{
+    auto arg = make_shared<op::Parameter>(et, shape);
+    auto reduction = make_shared<OP>(arg, axes);
+    string name = op_name + "/" + et.get_type_name() + "/" + shape_name(shape) + "/axes" +
+                  join(axes, "_");
+    add_benchmark(benchmarks, name, reduction, ParameterVector{arg}, shape_size(shape));
+}
+
+static void add_gather(vector<OpBenchmark>& benchmarks,
+                       const element::Type& et,
+                       const Shape& params_shape,
+                       size_t index_count,
+                       size_t axis)
+{
+    // Indices are constant so that they are always in range
+    uniform_int_distribution<int64_t> dist(0, params_shape[axis] - 1);
+    vector<int64_t> index_values(index_count);
+    for (int64_t& index : index_values)
+    {
+        index = dist(get_random_engine());
+    }
+    auto params = make_shared<op::Parameter>(et, params_shape);
+    auto indices = op::Constant::create(element::i64, Shape{index_count}, index_values);
+    auto gather = make_shared<op::Gather>(params, indices, axis);
+    string name = "Gather/" + et.get_type_name() + "/" + shape_name(params_shape) + "/" +
+                  to_string(index_count) + "/axis" + to_string(axis);
+    add_benchmark(benchmarks, name, gather, ParameterVector{params}, 0);
+}
+
+template <typename OP>
+static void add_pooling(vector<OpBenchmark>& benchmarks,
+                        const string& op_name,
+                        const element::Type& et,
+                        const Shape& shape,
+                        const Shape& window,
+                        size_t stride,
+                        size_t padding)
+{
+    size_t spatial_rank = shape.size() - 2;
+    auto arg = make_shared<op::Parameter>(et, shape);
+    auto pool = make_shared<OP>(arg,
+                                window,
+                                Strides(spatial_rank, stride),
+                                Shape(spatial_rank, padding),
+                                Shape(spatial_rank, padding));
+    double flops = static_cast<double>(shape_size(pool->get_shape())) * shape_size(window);
+    ostringstream name;
+    name << op_name << "/" << et.get_type_name() << "/" << shape_name(shape) << "/"
+         << shape_name(window) << "/s" << stride << "p" << padding;
+    add_benchmark(benchmarks, name.str(), pool, ParameterVector{arg}, flops);
+}
+
+template <typename OP>
+static void add_unary(vector<OpBenchmark>& benchmarks,
+                      const string& op_name,
+                      const element::Type& et,
+                      const Shape& shape)
+{
+    auto arg = make_shared<op::Parameter>(et, shape);
+    string name = op_name + "/" + et.get_type_name() + "/" + shape_name(shape);
+    add_benchmark(
+        benchmarks, name, make_shared<OP>(arg), ParameterVector{arg}, shape_size(shape));
+}
+
+template <typename OP>
+static void add_binary(vector<OpBenchmark>& benchmarks,
+                       const string& op_name,
+                       const element::Type& et,
+                       const Shape& shape)
+{
+    auto a = make_shared<op::Parameter>(et, shape);
+    auto b = make_shared<op::Parameter>(et, shape);
+    string name = op_name + "/" + et.get_type_name() + "/" + shape_name(shape);
+    add_benchmark(
+        benchmarks, name, make_shared<OP>(a, b), ParameterVector{a, b}, shape_size(shape));
+}
+
+vector<OpBenchmark> make_op_benchmarks()
+{
+    vector<OpBenchmark> benchmarks;
+
+    add_convolution(benchmarks, element::f32, Shape{1, 3, 224, 224}, Shape{64, 3, 7, 7}, 2, 3);
+    add_convolution(benchmarks, element::f32, Shape{1, 64, 56, 56}, Shape{64, 64, 3, 3}, 1, 1);
+    add_convolution(benchmarks, element::f32, Shape{1, 256, 56, 56}, Shape{64, 256, 1, 1}, 1, 0);
+    add_convolution(benchmarks, element::f32, Shape{8, 256, 14, 14}, Shape{256, 256, 3, 3}, 1, 1);
+    add_convolution(
+        benchmarks, element::f32, Shape{1, 16, 16, 16, 16}, Shape{16, 16, 3, 3, 3}, 1, 1);
+    add_convolution(benchmarks, element::f64, Shape{1, 64, 56, 56}, Shape{64, 64, 3, 3}, 1, 1);
+
+    add_dot(benchmarks, element::f32, Shape{64, 64}, Shape{64, 64});
+    add_dot(benchmarks, element::f32, Shape{256, 256}, Shape{256, 256});
+    add_dot(benchmarks, element::f32, Shape{1024, 1024}, Shape{1024, 1024});
+    add_dot(benchmarks, element::f32, Shape{1, 1024}, Shape{1024, 1024});
+    add_dot(benchmarks, element::f32, Shape{64, 4096}, Shape{4096, 64});
+    add_dot(benchmarks, element::f64, Shape{256, 256}, Shape{256, 256});
+    add_dot(benchmarks, element::i32, Shape{256, 256}, Shape{256, 256});
+
+    for (const AxisSet& axes : {AxisSet{0}, AxisSet{1}, AxisSet{0, 1}})
+    {
+        add_reduction<op::Sum>(benchmarks, "Sum", element::f32, Shape{1024, 1024}, axes);
+        add_reduction<op::Max>(benchmarks, "Max", element::f32, Shape{1024, 1024}, axes);
+    }
+    add_reduction<op::Sum>(benchmarks, "Sum", element::f32, Shape{64, 128, 128}, AxisSet{1, 2});
+    add_reduction<op::Sum>(benchmarks, "Sum", element::f64, Shape{1024, 1024}, AxisSet{1});
+    add_reduction<op::Sum>(benchmarks, "Sum", element::i32, Shape{1024, 1024}, AxisSet{1});
+    add_reduction<op::Min>(benchmarks, "Min", element::i32, Shape{1024, 1024}, AxisSet{1});
+
+    add_gather(benchmarks, element::f32, Shape{10000, 128}, 4096, 0);
+    add_gather(benchmarks, element::f32, Shape{64, 1024}, 512, 1);
+    add_gather(benchmarks, element::i32, Shape{10000, 128}, 4096, 0);
+
+    add_pooling<op::MaxPool>(
+        benchmarks, "MaxPool", element::f32, Shape{8, 64, 112, 112}, Shape{3, 3}, 2, 1);
+    add_pooling<op::MaxPool>(
+        benchmarks, "MaxPool", element::f32, Shape{8, 16, 16, 16, 16}, Shape{2, 2, 2}, 2, 0);
+    add_pooling<op::AvgPool>(
+        benchmarks, "AvgPool", element::f32, Shape{8, 256, 28, 28}, Shape{2, 2}, 2, 0);
+    add_pooling<op::AvgPool>(
+        benchmarks, "AvgPool", element::f32, Shape{8, 2048, 7, 7}, Shape{7, 7}, 1, 0);
+
+    for (const Shape& shape : {Shape{4096}, Shape{1024, 1024}, Shape{16, 512, 512}})
+    {
+        for (const element::Type& et : {element::f32, element::f64, element::i32})
+        {
+            add_binary<op::Add>(benchmarks, "Add", et, shape);
+            add_binary<op::Multiply>(benchmarks, "Multiply", et, shape);
+            add_unary<op::Relu>(benchmarks, "Relu", et, shape);
+        }
+        for (const element::Type& et : {element::f32, element::f64})
+        {
+            add_unary<op::Exp>(benchmarks, "Exp", et, shape);
+            add_unary<op::Tanh>(benchmarks, "Tanh", et, shape);
+        }
+    }
+
+    return benchmarks;
+}
+
+OpBenchmarkResult run_op_benchmark(const OpBenchmark& benchmark,
+                                   const string& backend_name,
+                                   double min_time_ms,
+                                   size_t repetitions)
+{
+    const shared_ptr<Function>& f = benchmark.function;
+    auto backend = runtime::Backend::create(backend_name);
+    auto exec = backend->compile(f);
+
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (const shared_ptr<op::Parameter>& param : f->get_parameters())
+    {
+        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+        random_init(tensor);
+        args.push_back(tensor);
+    }
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (const shared_ptr<op::Result>& result : f->get_results())
+    {
+        results.push_back(backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    set_denormals_flush_to_zero();
+
+    // Inputs are marked stale before every call so that backends which skip unchanged work
+    // still execute the op each time.
+    auto run = [&](size_t iterations) {
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            for (const shared_ptr<runtime::Tensor>& arg : args)
+            {
+                arg->set_stale(true);
+            }
+            exec->call(results, args);
+        }
+        timer.stop();
+        return static_cast<double>(timer.get_nanoseconds());
+    };
+
+    // Warm-up call, then grow the batch until it runs for at least min_time_ms
+    run(1);
+    const double min_time_ns = min_time_ms * 1e6;
+    const size_t max_iterations = 1000000000;
+    size_t iterations = 1;
+    double elapsed = run(iterations);
+    while (elapsed < min_time_ns && iterations < max_iterations)
+    {
+        double scale = elapsed > 0 ? 1.4 * min_time_ns / elapsed : 10;
+        size_t next = static_cast<size_t>(iterations * min(scale, 10.0));
+        iterations = min(max(next, iterations + 1), max_iterations);
+        elapsed = run(iterations);
+    }
+
+    vector<double> samples{elapsed / iterations};
+    while (samples.size() < max<size_t>(repetitions, 1))
+    {
+        samples.push_back(run(iterations) / iterations);
+    }
+    sort(samples.begin(), samples.end());
+    double ns_per_op = samples[samples.size() / 2];
+
+    OpBenchmarkResult result;
+    result.name = benchmark.name;
+    result.backend = backend_name;
+    result.iterations = iterations;
+    result.ns_per_op = ns_per_op;
+    // Operations per nanosecond are GFLOP/s, bytes per nanosecond are GB/s
+    result.gflops_per_second = benchmark.flops / ns_per_op;
+    result.gbytes_per_second = benchmark.bytes / ns_per_op;
+    return result;
+}
+
+void print_op_benchmark_results(const vector<OpBenchmarkResult>& results)
+{
+    size_t name_width = 9;
+    size_t backend_width = 7;
+    for (const OpBenchmarkResult& result : results)
+    {
+        name_width = max(name_width, result.name.size());
+        backend_width = max(backend_width, result.backend.size());
+    }
+    cout << left << setw(name_width + 2) << "Benchmark" << setw(backend_width + 2) << "Backend"
+         << right << setw(12) << "Iterations" << setw(16) << "ns/op" << setw(12) << "GFLOP/s"
+         << setw(12) << "GB/s" << "\n";
+    cout << fixed << setprecision(2);
+    for (const OpBenchmarkResult& result : results)
+    {
+        cout << left << setw(name_width + 2) << result.name << setw(backend_width + 2)
+             << result.backend << right << setw(12) << result.iterations << setw(16)
+             << result.ns_per_op << setw(12) << result.gflops_per_second << setw(12)
+             << result.gbytes_per_second << "\n";
+    }
+    cout.unsetf(ios_base::floatfield);
+    cout << setprecision(6) << flush;
+}
+
+void save_op_benchmarks(const vector<OpBenchmarkResult>& results, const string& path)
+{
+    json benchmarks = json::array();
+    for (const OpBenchmarkResult& result : results)
+    {
+        json entry;
+        entry["name"] = result.name;
+        entry["backend"] = result.backend;
+        entry["iterations"] = result.iterations;
+        entry["ns_per_op"] = result.ns_per_op;
+        entry["gflops_per_second"] = result.gflops_per_second;
+        entry["gbytes_per_second"] = result.gbytes_per_second;
+        benchmarks.push_back(entry);
+    }
+    json j;
+    j["context"]["ngraph_version"] = get_ngraph_version_string();
+    j["benchmarks"] = benchmarks;
+
+    ofstream out(path);
+    if (!out)
+    {
+        throw runtime_error("Could not write baseline file '" + path + "'");
+    }
+    out << j.dump(4) << endl;
+}
+
+size_t compare_op_benchmarks(const vector<OpBenchmarkResult>& results,
+                             const string& path,
+                             double tolerance)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw runtime_error("Could not read baseline file '" + path + "'");
+    }
+    json j = json::parse(in);
+    map<pair<string, string>, double> baseline;
+    for (const json& entry : j.at("benchmarks"))
+    {
+        baseline[{entry.at("name").get<string>(), entry.at("backend").get<string>()}] =
+            entry.at("ns_per_op").get<double>();
+    }
+
+    size_t name_width = 9;
+    for (const OpBenchmarkResult& result : results)
+    {
+        name_width = max(name_width, result.name.size() + result.backend.size() + 3);
+    }
+    cout << "\n---- Comparison with " << path << " ----\n";
+    cout << left << setw(name_width + 2) << "Benchmark" << right << setw(16) << "Baseline ns/op"
+         << setw(16) << "ns/op" << setw(10) << "Change" << "\n";
+    cout << fixed << setprecision(2);
+    size_t regressions = 0;
+    for (const OpBenchmarkResult& result : results)
+    {
+        cout << left << setw(name_width + 2) << (result.name + " [" + result.backend + "]")
+             << right;
+        auto it = baseline.find({result.name, result.backend});
+        if (it == baseline.end())
+        {
+            cout << setw(16) << "-" << setw(16) << result.ns_per_op << "  not in baseline\n";
+            continue;
+        }
+        double change = result.ns_per_op / it->second - 1;
+        cout << setw(16) << it->second << setw(16) << result.ns_per_op << setw(9) << showpos
+             << change * 100 << noshowpos << "%";
+        if (change > tolerance)
+        {
+            cout << "  REGRESSION";
+            regressions++;
+        }
+        cout << "\n";
+    }
+    cout.unsetf(ios_base::floatfield);
+    cout << setprecision(6) << regressions << " regression(s) above " << tolerance * 100
+         << "%" << endl;
+    return regressions;
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+/// \brief A generated single-op benchmark.
+struct OpBenchmark
+{
+    /// Unique name of the form `Op/type/shape[/attributes]`
+    std::string name;
+    std::shared_ptr<ngraph::Function> function;
+    /// Arithmetic operations performed by one call
+    double flops;
+    /// Bytes read and written by one call: parameters, constants and results
+    double bytes;
+};
+
+/// \brief Measured performance of one OpBenchmark on one backend.
+struct OpBenchmarkResult
+{
+    std::string name;
+    std::string backend;
+    size_t iterations;
+    double ns_per_op;
+    double gflops_per_second;
+    double gbytes_per_second;
+};
+
+/// \brief Generates the single-op benchmark suite: convolution, dot, reductions, gather,
+///        pooling and elementwise ops over a range of shapes, element types and attributes.
+std::vector<OpBenchmark> make_op_benchmarks();
+
+/// \brief Runs `benchmark` on `backend_name`.
+///
+/// The iteration count is grown until one batch of calls takes at least `min_time_ms`, then
+/// the batch is timed `repetitions` times and the median time per call is reported.
+OpBenchmarkResult run_op_benchmark(const OpBenchmark& benchmark,
+                                   const std::string& backend_name,
+                                   double min_time_ms,
+                                   size_t repetitions);
+
+/// \brief Prints `results` as a table of ns/op, GFLOP/s and GB/s.
+void print_op_benchmark_results(const std::vector<OpBenchmarkResult>& results);
+
+/// \brief Writes `results` to `path` as JSON, in the format read by compare_op_benchmarks.
+void save_op_benchmarks(const std::vector<OpBenchmarkResult>& results, const std::string& path);
+
+/// \brief Compares `results` against the baseline JSON file at `path` and prints the change
+///        of each benchmark found in the baseline.
+///
+/// \param tolerance Relative slowdown above which a benchmark counts as a regression, e.g. 0.1
+///                  for 10%.
+/// \return The number of regressions.
+size_t compare_op_benchmarks(const std::vector<OpBenchmarkResult>& results,
+                             const std::string& path,
+                             double tolerance);
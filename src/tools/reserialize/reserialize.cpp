@@ -42,11 +42,12 @@ DESCRIPTION
     Reserialize a serialized model
 
 SYNOPSIS
-        reserialize [-i|--input <input file>] [-o|--output <output file>]
+        reserialize [-i|--input <input file>] [-o|--output <output file>] [-b|--binary]
 
 OPTIONS
-        -i or --input  input serialized model
+        -i or --input  input serialized model, json or binary graph format
         -o or --output output serialized model
+        -b or --binary write the output in the binary graph format instead of json
         -c or --constant_to_broacast Convert large constant constants to broadcast
 )###";
 }
@@ -56,6 +57,7 @@ int main(int argc, char** argv)
     string input;
     string output;
     bool c2b = false;
+    bool binary = false;
     for (int i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -71,6 +73,10 @@ int main(int argc, char** argv)
         {
             c2b = true;
         }
+        else if (arg == "-b" || arg == "--binary")
+        {
+            binary = true;
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -92,7 +98,7 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    ifstream f(input);
+    ifstream f(input, ios_base::binary | ios_base::in);
     if (f)
     {
         ngraph::stopwatch timer;
@@ -109,7 +115,14 @@ int main(int argc, char** argv)
         }
 
         timer.start();
-        ngraph::serialize(output, function, 2);
+        if (binary)
+        {
+            ngraph::serialize_binary(output, function);
+        }
+        else
+        {
+            ngraph::serialize(output, function, 2);
+        }
         timer.stop();
         cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
     }
@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
+#include "ngraph/runtime/pooling_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(allocator, pooling_reuse)
+{
+    runtime::PoolingAllocator allocator;
+    void* a = allocator.malloc(100, 64);
+    void* b = allocator.malloc(1000, 64);
+    runtime::AllocatorStats stats = allocator.get_stats();
+    EXPECT_EQ(stats.bytes_in_use, 1100);
+    EXPECT_EQ(stats.bytes_reserved, 128 + 1024);
+    EXPECT_EQ(stats.allocation_count, 2);
+
+    allocator.free(a);
+    // Same size class as `a`
+    void* c = allocator.malloc(120, 64);
+    EXPECT_EQ(c, a);
+    // Different size class, so not served from the cached block
+    allocator.free(c);
+    void* d = allocator.malloc(300, 64);
+    EXPECT_NE(d, a);
+
+    stats = allocator.get_stats();
+    EXPECT_EQ(stats.bytes_in_use, 1300);
+    EXPECT_EQ(stats.peak_bytes_in_use, 1300);
+    EXPECT_EQ(stats.bytes_reserved, 128 + 1024 + 512);
+    EXPECT_EQ(stats.reuse_count, 1);
+    EXPECT_GT(stats.fragmentation(), 0);
+
+    allocator.free(b);
+    allocator.free(d);
+    allocator.release();
+    stats = allocator.get_stats();
+    EXPECT_EQ(stats.bytes_in_use, 0);
+    EXPECT_EQ(stats.bytes_reserved, 0);
+    EXPECT_EQ(stats.free_count, 4);
+}
+
+TEST(allocator, pooling_limits)
+{
+    runtime::PoolingAllocator allocator(nullptr, 1024, 1024);
+    // Larger than the largest size class
+    void* a = allocator.malloc(4000, 64);
+    allocator.free(a);
+    EXPECT_EQ(allocator.get_stats().bytes_reserved, 0);
+
+    void* b = allocator.malloc(1024, 64);
+    void* c = allocator.malloc(1024, 64);
+    allocator.free(b);
+    // The cache is full
+    allocator.free(c);
+    EXPECT_EQ(allocator.get_stats().bytes_reserved, 1024);
+
+    EXPECT_ANY_THROW(allocator.free(&allocator));
+}
+
+TEST(allocator, huge_page_arena)
+{
+    runtime::HugePageAllocator allocator;
+    char* a = static_cast<char*>(allocator.malloc(100, 64));
+    char* b = static_cast<char*>(allocator.malloc(5000, 4096));
+    EXPECT_EQ(reinterpret_cast<size_t>(a) % runtime::HugePageAllocator::page_size, 0);
+    EXPECT_EQ(reinterpret_cast<size_t>(b) % 4096, 0);
+    memset(a, 1, 100);
+    memset(b, 2, 5000);
+
+    runtime::AllocatorStats stats = allocator.get_stats();
+    EXPECT_EQ(stats.bytes_in_use, 5100);
+    EXPECT_EQ(stats.bytes_reserved, 32 * 1024 * 1024);
+    EXPECT_EQ(stats.reuse_count, 1);
+
+    // Freed ranges merge, so the whole chunk is available again
+    allocator.free(b);
+    allocator.free(a);
+    char* c = static_cast<char*>(allocator.malloc(32 * 1024 * 1024, 64));
+    EXPECT_EQ(c, a);
+    allocator.free(c);
+
+    // Larger than a chunk
+    void* d = allocator.malloc(33 * 1024 * 1024, 64);
+    EXPECT_EQ(allocator.get_stats().bytes_reserved, 66 * 1024 * 1024);
+    allocator.free(d);
+    allocator.release();
+    EXPECT_EQ(allocator.get_stats().bytes_reserved, 0);
+
+    EXPECT_ANY_THROW(allocator.malloc(100, 3));
+}
+
+TEST(allocator, aligned_buffer)
+{
+    runtime::HugePageAllocator allocator;
+    {
+        runtime::AlignedBuffer buffer(1000, 64, &allocator);
+        EXPECT_EQ(reinterpret_cast<size_t>(buffer.get_ptr()) % 64, 0);
+        EXPECT_EQ(allocator.get_stats().bytes_in_use, 1064);
+    }
+    EXPECT_EQ(allocator.get_stats().bytes_in_use, 0);
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/binary_convolution.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, binary_convolution_2d_no_padding)
+{
+    Shape shape_a{1, 1, 4, 4};
+    Shape shape_b{1, 1, 3, 3};
+    Shape shape_r{1, 1, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto conv = make_shared<op::v1::BinaryConvolution>(
+        A,
+        B,
+        Strides{1, 1},
+        CoordinateDiff{0, 0},
+        CoordinateDiff{0, 0},
+        Strides{1, 1},
+        op::v1::BinaryConvolution::BinaryConvolutionMode::XNOR_POPCOUNT,
+        0.0f);
+    auto f = make_shared<Function>(conv, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1, 0, 1, 0, 1, 0, 1, 0, 1});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{3, -1, 1, -1}, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, binary_convolution_2d_constant_filter_padded)
+{
+    Shape shape_a{1, 2, 3, 3};
+    Shape shape_b{2, 2, 2, 2};
+    Shape shape_r{1, 2, 3, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = op::Constant::create(
+        element::f32, shape_b, vector<float>{1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1});
+    auto conv = make_shared<op::v1::BinaryConvolution>(
+        A,
+        B,
+        Strides{1, 1},
+        CoordinateDiff{1, 1},
+        CoordinateDiff{0, 0},
+        Strides{1, 1},
+        op::v1::BinaryConvolution::BinaryConvolutionMode::XNOR_POPCOUNT,
+        1.0f);
+    auto f = make_shared<Function>(conv, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{4, 0, 2, -2, 2, 4, 2, -2, 0, -2, -2, 0, 0, 0, -2, 0, 4, -2},
+        read_vector<float>(result)));
+}
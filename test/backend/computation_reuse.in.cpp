@@ -71,3 +71,86 @@ NGRAPH_TEST(${BACKEND_NAME}, computation_reuse)
     exec->call_with_validate({result}, {a, b});
     EXPECT_TRUE(test::all_close_f(rv_saved, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, computation_reuse_stale_input)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A * B) + (B - C), ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // The interpreter and generic CPU backends only skip nodes when asked to
+    string error;
+    backend->set_config({{"incremental_execution", "true"}}, error);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{2, 2, 2, 2, 2, 2});
+    copy_data(c, vector<float>{1, 1, 1, 1, 1, 1});
+
+    auto exec = backend->compile(f, true);
+    // The interpreter and generic CPU backends only count the calls that ran a node, other
+    // backends count a skipped node as a call as well
+    bool counts_executions =
+        string("${BACKEND_NAME}") == "INTERPRETER" || string("${BACKEND_NAME}") == "GCPU";
+    auto executions = [&exec](const string& type) {
+        size_t count = 0;
+        for (const runtime::PerformanceCounter& counter : exec->get_performance_data())
+        {
+            if (counter.get_node()->description() == type)
+            {
+                count += counter.call_count();
+            }
+        }
+        return count;
+    };
+    auto expect_executions = [&](size_t multiply, size_t subtract, size_t add) {
+        if (counts_executions)
+        {
+            EXPECT_EQ(executions("Multiply"), multiply);
+            EXPECT_EQ(executions("Subtract"), subtract);
+            EXPECT_EQ(executions("Add"), add);
+        }
+    };
+
+    exec->call_with_validate({result}, {a, b, c});
+    expect_executions(1, 1, 1);
+    EXPECT_TRUE(test::all_close_f((vector<float>{3, 5, 7, 9, 11, 13}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+
+    // Nothing changed
+    a->set_stale(false);
+    b->set_stale(false);
+    c->set_stale(false);
+    exec->call_with_validate({result}, {a, b, c});
+    expect_executions(1, 1, 1);
+    EXPECT_TRUE(test::all_close_f((vector<float>{3, 5, 7, 9, 11, 13}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+
+    // Only A changed; B - C may be reused
+    copy_data(a, vector<float>{0, 1, 0, 1, 0, 1});
+    a->set_stale(true);
+    exec->call_with_validate({result}, {a, b, c});
+    expect_executions(2, 1, 2);
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 3, 1, 3, 1, 3}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+
+    // Only C changed, result written to a new tensor
+    a->set_stale(false);
+    copy_data(c, vector<float>{2, 2, 2, 2, 2, 2});
+    c->set_stale(true);
+    auto result2 = backend->create_tensor(element::f32, shape);
+    exec->call_with_validate({result2}, {a, b, c});
+    expect_executions(2, 2, 3);
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 2, 0, 2, 0, 2}),
+                                  read_vector<float>(result2),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/batching_executable.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +295,113 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_batching_executable)
+{
+    // f(x, y) = x * y + x, batched along the leading axis of both inputs
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto y = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(NodeVector{x * y + x}, ParameterVector{x, y});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    const size_t max_batch_size = 4;
+    runtime::dynamic::BatchingExecutable ex(
+        f, backend, max_batch_size, chrono::microseconds(200000));
+
+    const size_t request_count = 6;
+    vector<shared_ptr<runtime::Tensor>> xs, ys, results;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        // Requests 0 and 3 carry two samples, the others one
+        size_t batch = (i % 3 == 0) ? 2 : 1;
+        vector<float> x_values(batch * 3), y_values(batch * 3);
+        for (size_t j = 0; j < batch * 3; j++)
+        {
+            x_values[j] = static_cast<float>(i + 1);
+            y_values[j] = static_cast<float>(j);
+        }
+        xs.push_back(backend->create_tensor(element::f32, Shape{batch, 3}));
+        ys.push_back(backend->create_tensor(element::f32, Shape{batch, 3}));
+        results.push_back(backend->create_tensor(element::f32, Shape{batch, 3}));
+        copy_data(xs.back(), x_values);
+        copy_data(ys.back(), y_values);
+    }
+
+    vector<thread> clients;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        clients.emplace_back([&, i] { ex.call({results[i]}, {xs[i], ys[i]}); });
+    }
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    for (size_t i = 0; i < request_count; i++)
+    {
+        size_t batch = (i % 3 == 0) ? 2 : 1;
+        vector<float> expected(batch * 3);
+        for (size_t j = 0; j < batch * 3; j++)
+        {
+            expected[j] = (i + 1) * j + (i + 1);
+        }
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(results[i])));
+    }
+
+    auto metrics = ex.get_metrics();
+    EXPECT_EQ(metrics.request_count, request_count);
+    EXPECT_EQ(metrics.sample_count, 8);
+    EXPECT_EQ(metrics.queued_requests, 0);
+    EXPECT_GE(metrics.batch_count, 2);
+    EXPECT_LE(metrics.batch_count, request_count);
+    EXPECT_GT(metrics.get_batch_fill(max_batch_size), 0);
+    EXPECT_LE(metrics.get_batch_fill(max_batch_size), 1);
+
+    // Requests larger than the maximum batch size are rejected up front
+    auto too_large = backend->create_tensor(element::f32, Shape{max_batch_size + 1, 3});
+    EXPECT_ANY_THROW(ex.call({too_large}, {too_large, too_large}));
+
+    // So are inputs without a batch dimension
+    auto scalar = backend->create_tensor(element::f32, Shape{});
+    EXPECT_THROW(ex.call({scalar}, {scalar, scalar}), CheckFailure);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_batching_executable_coalesces_requests)
+{
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{-x}, ParameterVector{x});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // A full batch is executed as soon as it is queued, long before the delay expires
+    const size_t max_batch_size = 4;
+    runtime::dynamic::BatchingExecutable ex(f, backend, max_batch_size, chrono::seconds(60));
+
+    vector<shared_ptr<runtime::Tensor>> xs, results;
+    for (size_t i = 0; i < max_batch_size; i++)
+    {
+        xs.push_back(backend->create_tensor(element::f32, Shape{1, 2}));
+        results.push_back(backend->create_tensor(element::f32, Shape{1, 2}));
+        copy_data(xs.back(), vector<float>{static_cast<float>(i), 1.f});
+    }
+
+    vector<thread> clients;
+    for (size_t i = 0; i < max_batch_size; i++)
+    {
+        clients.emplace_back([&, i] { ex.call({results[i]}, {xs[i]}); });
+    }
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    for (size_t i = 0; i < max_batch_size; i++)
+    {
+        EXPECT_EQ(read_vector<float>(results[i]), (vector<float>{-static_cast<float>(i), -1.f}));
+    }
+
+    // All four requests were executed by a single call of the batch executable
+    auto metrics = ex.get_metrics();
+    EXPECT_EQ(metrics.request_count, max_batch_size);
+    EXPECT_EQ(metrics.batch_count, 1);
+    EXPECT_EQ(metrics.sample_count, max_batch_size);
+}
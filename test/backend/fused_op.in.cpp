@@ -1014,6 +1014,105 @@ NGRAPH_TEST(${BACKEND_NAME}, fused_clamp)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, log_softmax)
+{
+    Shape data_shape{3, 3};
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+
+    auto log_softmax = make_shared<op::LogSoftmax>(data, 1);
+    auto function = make_shared<Function>(NodeVector{log_softmax}, ParameterVector{data});
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+    // The middle row would overflow exp() without subtracting the maximum
+    test_case.add_input<float>(vector<float>{1, 2, 3, 1000, 1001, 1002, -5, 0, 5});
+    test_case.add_expected_output<float>(data_shape,
+                                         vector<float>{-2.407605964f,
+                                                       -1.407605964f,
+                                                       -0.407605964f,
+                                                       -2.407605964f,
+                                                       -1.407605964f,
+                                                       -0.407605964f,
+                                                       -10.006760444f,
+                                                       -5.006760444f,
+                                                       -0.006760444f});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scaled_dot_product_attention)
+{
+    auto query = make_shared<op::Parameter>(element::f32, Shape{2, 2, 2});
+    auto key = make_shared<op::Parameter>(element::f32, Shape{2, 3, 2});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{2, 3, 2});
+
+    auto attention = make_shared<op::ScaledDotProductAttention>(query, key, value, 0.5);
+    auto function =
+        make_shared<Function>(NodeVector{attention}, ParameterVector{query, key, value});
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 0, 0, 2, 1, 1, -1, 0});
+    test_case.add_input<float>({1, 0, 0, 1, 1, 1, 2, 0, 0, -1, 1, 0});
+    test_case.add_input<float>({1, 2, 3, 4, 5, 6, -1, 0, 0, 1, 2, 2});
+    test_case.add_expected_output<float>(
+        Shape{2, 2, 2}, {3, 4, 3.533913f, 4.533913f, 0.1164485f, 0.7849496f, 0.428068f, 1.120872f});
+    test_case.run(DEFAULT_FLOAT_TOLERANCE_BITS + 1);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scaled_dot_product_attention_broadcast_mask)
+{
+    auto query = make_shared<op::Parameter>(element::f32, Shape{2, 2, 2});
+    auto key = make_shared<op::Parameter>(element::f32, Shape{2, 3, 2});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{2, 3, 2});
+    // One mask for both batch entries and all queries, hiding the last key
+    auto mask = make_shared<op::Parameter>(element::f32, Shape{1, 1, 3});
+
+    auto attention = make_shared<op::ScaledDotProductAttention>(query, key, value, mask, 0.5);
+    auto function =
+        make_shared<Function>(NodeVector{attention}, ParameterVector{query, key, value, mask});
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 0, 0, 2, 1, 1, -1, 0});
+    test_case.add_input<float>({1, 0, 0, 1, 1, 1, 2, 0, 0, -1, 1, 0});
+    test_case.add_input<float>({1, 2, 3, 4, 5, 6, -1, 0, 0, 1, 2, 2});
+    test_case.add_input<float>({0, 0, -10000});
+    test_case.add_expected_output<float>(Shape{2, 2, 2},
+                                         {1.755081f,
+                                          2.755081f,
+                                          2.462117f,
+                                          3.462117f,
+                                          -0.8175745f,
+                                          0.1824255f,
+                                          -0.2689414f,
+                                          0.7310586f});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, log_softmax_long_rows)
+{
+    // LogSoftmax from axis 1 reduces 1200 elements per batch. Batch b holds b * 1000 + i % 3,
+    // so its maximum is b * 1000 + 2 and the sum of exponentials relative to the maximum is
+    // 400 * (exp(-2) + exp(-1) + 1).
+    Shape data_shape{3, 4, 300};
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+
+    auto log_softmax = make_shared<op::LogSoftmax>(data, 1);
+    auto function = make_shared<Function>(NodeVector{log_softmax}, ParameterVector{data});
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+
+    const size_t group_size = 1200;
+    const double log_sum = log(400.0 * (exp(-2.0) + exp(-1.0) + 1.0));
+    vector<float> data_vector(shape_size(data_shape));
+    vector<float> expected(shape_size(data_shape));
+    for (size_t i = 0; i < data_vector.size(); i++)
+    {
+        size_t b = i / group_size;
+        size_t k = (i % group_size) % 3;
+        data_vector[i] = static_cast<float>(b * 1000 + k);
+        expected[i] = static_cast<float>(static_cast<double>(k) - 2.0 - log_sum);
+    }
+    test_case.add_input<float>(data_vector);
+    test_case.add_expected_output<float>(data_shape, expected);
+
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, mvn_mean_normalization)
 {
     Shape data_shape{1, 2, 5};
@@ -1083,6 +1182,42 @@ NGRAPH_TEST(${BACKEND_NAME}, mvn_mean_variance_normalization)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, mvn_non_contiguous_axes)
+{
+    // Reducing axes 0 and 2 groups the elements with the same c and w. Element (n, c, h, w)
+    // holds c * 100 + w * 10 + n * 4 + h, so each group holds offset + k for k = 0..7, with
+    // mean offset + 3.5 and variance 5.25.
+    Shape data_shape{2, 3, 4, 5};
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+
+    auto mvn_func = make_shared<op::MVN>(data, AxisSet{0, 2});
+    auto function = make_shared<Function>(NodeVector{mvn_func}, ParameterVector{data});
+    auto test_case = test::NgraphTestCase(function, "${BACKEND_NAME}");
+
+    vector<float> data_vector;
+    vector<float> expected;
+    const double stddev = sqrt(5.25);
+    for (size_t n = 0; n < 2; n++)
+    {
+        for (size_t c = 0; c < 3; c++)
+        {
+            for (size_t h = 0; h < 4; h++)
+            {
+                for (size_t w = 0; w < 5; w++)
+                {
+                    size_t k = n * 4 + h;
+                    data_vector.push_back(static_cast<float>(c * 100 + w * 10 + k));
+                    expected.push_back(static_cast<float>((k - 3.5) / (stddev + 1e-9)));
+                }
+            }
+        }
+    }
+    test_case.add_input<float>(data_vector);
+    test_case.add_expected_output<float>(data_shape, expected);
+
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, mvn_mean_variance_normalization_split_channels)
 {
     Shape data_shape{1, 2, 5};
@@ -90,6 +90,92 @@ NGRAPH_TEST(${BACKEND_NAME}, layer_norm_affine_stats)
     EXPECT_TRUE(test::all_close_f(exp_var, read_vector<float>(var)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, layer_norm)
+{
+    auto p_data = make_shared<op::Parameter>(element::f32, Shape{2, 2, 2});
+    auto ln = make_shared<op::LayerNorm>(p_data, false, -2);
+    auto f = make_shared<Function>(ln, ParameterVector{p_data});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto data = backend->create_tensor(element::f32, Shape{2, 2, 2});
+    copy_data(data, vector<float>{-4.0f, -3.0f, -2.0f, -1.0f, 3.0f, 2.0f, 1.0f, 0.0f});
+    auto norm = backend->create_tensor(element::f32, Shape{2, 2, 2});
+
+    vector<float> exp_norm{-1.341635420f,
+                           -0.447211807f,
+                           0.447211807f,
+                           1.341635420f,
+                           1.341635420f,
+                           0.447211807f,
+                           -0.447211807f,
+                           -1.341635420f};
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({norm}, {data});
+    EXPECT_TRUE(test::all_close_f(exp_norm, read_vector<float>(norm)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, layer_norm_long_rows)
+{
+    // Rows of 2100 elements, longer than one block of the CPU kernel's blocked mean and
+    // variance. Row r alternates r - d and r + d with d = (r + 1) / 2, so its mean is r, its
+    // variance d * d, and every element normalizes to -/+ d / sqrt(d * d + epsilon).
+    Shape data_shape{4, 3, 700};
+    Shape norm_shape{3, 700};
+    auto p_data = make_shared<op::Parameter>(element::f32, data_shape);
+    auto p_scale = make_shared<op::Parameter>(element::f32, norm_shape);
+    auto p_bias = make_shared<op::Parameter>(element::f32, norm_shape);
+    auto ln = make_shared<op::LayerNorm>(p_data, p_scale, p_bias, true, 1);
+    auto f = make_shared<Function>(ln->outputs(), ParameterVector{p_data, p_scale, p_bias});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    const size_t rows = 4;
+    const size_t row_size = shape_size(norm_shape);
+    const float epsilon = 1e-5f;
+    vector<float> data_vector(shape_size(data_shape));
+    vector<float> scale_vector(row_size);
+    vector<float> bias_vector(row_size);
+    vector<float> exp_norm(shape_size(data_shape));
+    vector<float> exp_mean(rows);
+    vector<float> exp_var(rows);
+    for (size_t j = 0; j < row_size; j++)
+    {
+        scale_vector[j] = 0.25f * (j % 7);
+        bias_vector[j] = static_cast<float>(j % 5) - 2.0f;
+    }
+    for (size_t r = 0; r < rows; r++)
+    {
+        float d = 0.5f * (r + 1);
+        exp_mean[r] = r;
+        exp_var[r] = d * d;
+        for (size_t j = 0; j < row_size; j++)
+        {
+            float sign = j % 2 == 0 ? -1.0f : 1.0f;
+            data_vector[r * row_size + j] = r + sign * d;
+            exp_norm[r * row_size + j] =
+                sign * d / sqrt(d * d + epsilon) * scale_vector[j] + bias_vector[j];
+        }
+    }
+
+    auto data = backend->create_tensor(element::f32, data_shape);
+    auto scale = backend->create_tensor(element::f32, norm_shape);
+    auto bias = backend->create_tensor(element::f32, norm_shape);
+    copy_data(data, data_vector);
+    copy_data(scale, scale_vector);
+    copy_data(bias, bias_vector);
+    auto norm = backend->create_tensor(element::f32, data_shape);
+    auto mean = backend->create_tensor(element::f32, Shape{rows});
+    auto var = backend->create_tensor(element::f32, Shape{rows});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({norm, mean, var}, {data, scale, bias});
+    EXPECT_TRUE(test::all_close(exp_norm, read_vector<float>(norm), 1e-4f, 1e-5f));
+    EXPECT_TRUE(test::all_close(exp_mean, read_vector<float>(mean), 1e-5f, 1e-5f));
+    EXPECT_TRUE(test::all_close(exp_var, read_vector<float>(var), 1e-5f, 1e-5f));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, layer_norm_bprop_affine_stats)
 {
     auto p_data = make_shared<op::Parameter>(element::f32, Shape{2, 4});
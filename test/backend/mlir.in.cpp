@@ -281,3 +281,29 @@ NGRAPH_TEST(${BACKEND_NAME}, mlir_multi_call)
     EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
                                   vector<float>{35.f, 40.f, 45.f, 68.f, 82.f, 96.f}));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, mlir_reshape_slice_sum_broadcast)
+{
+    // Data movement ops and reductions lowered in a single sub-graph
+    Shape shape_in{2, 3};
+    Shape shape_out{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_in);
+    auto transpose = make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{3, 2});
+    auto slice = make_shared<op::Slice>(transpose, Coordinate{1, 0}, Coordinate{3, 2});
+    auto sum = make_shared<op::Sum>(slice, AxisSet{0});
+    auto broadcast = make_shared<op::Broadcast>(sum, shape_out, AxisSet{0});
+    auto f = make_shared<Function>(broadcast, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape_in);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape_out);
+
+    copy_data(a, vector<float>{1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(
+        test::all_close_f(read_vector<float>(result), vector<float>{5.f, 11.f, 5.f, 11.f}));
+}
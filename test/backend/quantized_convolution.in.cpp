@@ -132,3 +132,84 @@ NGRAPH_TEST(${BACKEND_NAME}, quantized_conv_int32_output)
     EXPECT_EQ((vector<int32_t>{22, 34, 30, 32, 38, 72, 90, 43, 33, 52, 43, 39}),
               read_vector<int32_t>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_conv_zero_points_padding)
+{
+    // Padded taps must contribute nothing once the input zero point is taken into account.
+    Shape shape_a{1, 2, 4, 4};
+    Shape shape_b{3, 2, 3, 3};
+    Shape shape_r{1, 3, 4, 4};
+    vector<uint8_t> a_data(shape_size(shape_a));
+    vector<int8_t> b_data(shape_size(shape_b));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<uint8_t>((i * 29 + 3) % 256);
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<int8_t>(static_cast<int>((i * 41 + 5) % 256) - 128);
+    }
+    const uint8_t a_zero_point = 100;
+    const int8_t b_zero_point = 2;
+
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = op::Constant::create(element::i8, shape_b, b_data);
+    auto C = op::Constant::create(element::f32, Shape{}, {1});
+    auto D = op::Constant::create(element::u8, Shape{}, {a_zero_point});
+    auto E = op::Constant::create(element::f32, Shape{}, {1});
+    auto F = op::Constant::create(element::i8, Shape{}, {b_zero_point});
+    auto G = op::Constant::create(element::f32, Shape{}, {1});
+    auto H = op::Constant::create(element::i32, Shape{}, {0});
+    auto CV = make_shared<op::QuantizedConvolution>(A,
+                                                    B,
+                                                    Strides{1, 1},
+                                                    Strides{1, 1},
+                                                    CoordinateDiff{1, 1},
+                                                    CoordinateDiff{1, 1},
+                                                    Strides{1, 1},
+                                                    C,
+                                                    D,
+                                                    E,
+                                                    F,
+                                                    G,
+                                                    H,
+                                                    element::i32);
+    auto f = make_shared<Function>(NodeVector{CV}, ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::i32, shape_r);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+
+    vector<int32_t> expected(shape_size(shape_r), 0);
+    for (int o = 0; o < 3; o++)
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                int32_t sum = 0;
+                for (int c = 0; c < 2; c++)
+                {
+                    for (int ky = 0; ky < 3; ky++)
+                    {
+                        for (int kx = 0; kx < 3; kx++)
+                        {
+                            int iy = y + ky - 1;
+                            int ix = x + kx - 1;
+                            if (iy < 0 || iy >= 4 || ix < 0 || ix >= 4)
+                            {
+                                continue;
+                            }
+                            sum += (a_data[(c * 4 + iy) * 4 + ix] - a_zero_point) *
+                                   (b_data[((o * 2 + c) * 3 + ky) * 3 + kx] - b_zero_point);
+                        }
+                    }
+                }
+                expected[(o * 4 + y) * 4 + x] = sum;
+            }
+        }
+    }
+    EXPECT_EQ(expected, read_vector<int32_t>(result));
+}
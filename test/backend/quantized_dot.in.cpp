@@ -113,3 +113,69 @@ NGRAPH_TEST(${BACKEND_NAME}, quantized_dot_int32_output)
     handle->call_with_validate({result}, {a, b});
     EXPECT_EQ((vector<int32_t>{9, 14, 19}), read_vector<int32_t>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_dot_zero_points_constant_weights)
+{
+    // Non-zero zero points on every operand and a reduction long enough to reach the
+    // vectorized kernels; the weights are constant so they can be packed at compile time.
+    const size_t m = 3;
+    const size_t k = 70;
+    const size_t n = 5;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    Shape shape_r{m, n};
+    vector<uint8_t> a_data(m * k);
+    vector<int8_t> b_data(k * n);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<int8_t>(static_cast<int>((i * 53 + 7) % 256) - 128);
+    }
+    const uint8_t a_zero_point = 120;
+    const int8_t b_zero_point = -3;
+    const int32_t r_zero_point = 7;
+
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = op::Constant::create(element::i8, shape_b, b_data);
+    auto input_scale = op::Constant::create(element::f32, Shape{}, {1});
+    auto input_zero_point = op::Constant::create(element::u8, Shape{}, {a_zero_point});
+    auto filter_scale = op::Constant::create(element::f32, Shape{}, {1});
+    auto filter_zero_point = op::Constant::create(element::i8, Shape{}, {b_zero_point});
+    auto output_scale = op::Constant::create(element::f32, Shape{}, {1});
+    auto output_zero_point = op::Constant::create(element::i32, Shape{}, {r_zero_point});
+    auto QD = make_shared<op::QuantizedDot>(A,
+                                            B,
+                                            1,
+                                            input_scale,
+                                            input_zero_point,
+                                            filter_scale,
+                                            filter_zero_point,
+                                            output_scale,
+                                            output_zero_point,
+                                            element::i32);
+    auto f = make_shared<Function>(NodeVector{QD}, ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::i32, shape_r);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+
+    vector<int32_t> expected(m * n);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            int32_t sum = 0;
+            for (size_t l = 0; l < k; l++)
+            {
+                sum += (a_data[i * k + l] - a_zero_point) * (b_data[l * n + j] - b_zero_point);
+            }
+            expected[i * n + j] = sum + r_zero_point;
+        }
+    }
+    EXPECT_EQ(expected, read_vector<int32_t>(result));
+}
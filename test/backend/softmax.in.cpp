@@ -290,3 +290,31 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_overflow)
                            expf(5) / d2};
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_running_max)
+{
+    // The maximum of the first row is found last, of the second row first
+    Shape shape{2, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1}), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-1, 0, 1, 2, 3, 1003, 1002, 1001, 1000, 999});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    vector<float> expected{0.011656231f,
+                           0.031684921f,
+                           0.086128544f,
+                           0.234121657f,
+                           0.636408647f,
+                           0.636408647f,
+                           0.234121657f,
+                           0.086128544f,
+                           0.031684921f,
+                           0.011656231f};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_accumulate_sequence)
+{
+    // Sequence [N, L, I] is iterated along axis 1; H accumulates X * W
+    Shape seq_shape{2, 3, 2};
+    Shape step_shape{2, 1, 2};
+    auto X = make_shared<op::Parameter>(element::f32, seq_shape);
+    auto H_init = make_shared<op::Parameter>(element::f32, step_shape);
+    auto W = make_shared<op::Parameter>(element::f32, step_shape);
+
+    auto Xi = make_shared<op::Parameter>(element::f32, step_shape);
+    auto Hi = make_shared<op::Parameter>(element::f32, step_shape);
+    auto W_body = make_shared<op::Parameter>(element::f32, step_shape);
+    auto Ho = make_shared<op::Add>(Hi, make_shared<op::Multiply>(Xi, W_body));
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho},
+                                                            ParameterVector{Xi, Hi, W_body});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 1);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    tensor_iterator->set_invariant_input(W_body, W);
+    auto last = tensor_iterator->get_iter_value(Ho, -1);
+    auto all = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 1);
+
+    auto f = make_shared<Function>(
+        ResultVector{make_shared<op::Result>(last), make_shared<op::Result>(all)},
+        ParameterVector{X, H_init, W});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto x = backend->create_tensor(element::f32, seq_shape);
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto h = backend->create_tensor(element::f32, step_shape);
+    copy_data(h, vector<float>{0, 0, 0, 0});
+    auto w = backend->create_tensor(element::f32, step_shape);
+    copy_data(w, vector<float>{1, 2, 3, 4});
+    auto result_last = backend->create_tensor(element::f32, step_shape);
+    auto result_all = backend->create_tensor(element::f32, seq_shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_last, result_all}, {x, h, w});
+    EXPECT_TRUE(
+        test::all_close_f(vector<float>{9, 24, 81, 120}, read_vector<float>(result_last)));
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 4, 4, 12, 9, 24, 21, 32, 48, 72, 81, 120},
+                                  read_vector<float>(result_all)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_reverse_leading_axis)
+{
+    // Rows of X are visited last to first; H = 2 * H + X
+    Shape seq_shape{3, 2};
+    Shape step_shape{1, 2};
+    auto X = make_shared<op::Parameter>(element::f32, seq_shape);
+    auto H_init = make_shared<op::Parameter>(element::f32, step_shape);
+
+    auto Xi = make_shared<op::Parameter>(element::f32, step_shape);
+    auto Hi = make_shared<op::Parameter>(element::f32, step_shape);
+    auto Ho = make_shared<op::Add>(make_shared<op::Add>(Hi, Hi), Xi);
+    auto body =
+        make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho}, ParameterVector{Xi, Hi});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, -1, -1, 1, 0, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    auto first = tensor_iterator->get_iter_value(Ho, 0);
+    auto all = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 0);
+
+    auto f = make_shared<Function>(
+        ResultVector{make_shared<op::Result>(first), make_shared<op::Result>(all)},
+        ParameterVector{X, H_init});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto x = backend->create_tensor(element::f32, seq_shape);
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    auto h = backend->create_tensor(element::f32, step_shape);
+    copy_data(h, vector<float>{0, 0});
+    auto result_first = backend->create_tensor(element::f32, step_shape);
+    auto result_all = backend->create_tensor(element::f32, seq_shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_first, result_all}, {x, h});
+    EXPECT_TRUE(test::all_close_f(vector<float>{5, 6}, read_vector<float>(result_first)));
+    EXPECT_TRUE(test::all_close_f(vector<float>{5, 6, 13, 16, 27, 34},
+                                  read_vector<float>(result_all)));
+}
@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/pooling_allocator.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -49,6 +52,156 @@ TEST(backend_api, config)
     EXPECT_STREQ(error.c_str(), "");
 }
 
+TEST(backend_api, planned_memory)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    // Temporaries computed in place, inside a concat, as views and in the output
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto concat = make_shared<op::Concat>(
+        NodeVector{make_shared<op::Negative>(add), make_shared<op::Multiply>(A, B)}, 0);
+    auto slice = make_shared<op::Slice>(concat, Coordinate{1, 0}, Coordinate{3, 2});
+    auto reshape = make_shared<op::Reshape>(slice, AxisVector{0, 1}, Shape{4});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Abs>(reshape), concat, add},
+                                   ParameterVector{A, B});
+    auto exec = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result0 = backend->create_tensor(element::f32, Shape{4});
+    auto result1 = backend->create_tensor(element::f32, Shape{4, 2});
+    auto result2 = backend->create_tensor(element::f32, shape);
+    for (float scale : {1.f, 2.f})
+    {
+        copy_data(a, vector<float>{1.f * scale, 2.f, 3.f, 4.f});
+        copy_data(b, vector<float>{5.f, 6.f, 7.f, 8.f});
+        exec->call_with_validate({result0, result1, result2}, {a, b});
+        EXPECT_EQ(read_vector<float>(result0),
+                  (vector<float>{10.f, 12.f, 5.f * scale, 12.f}));
+        EXPECT_EQ(read_vector<float>(result1),
+                  (vector<float>{-5.f - scale, -8.f, -10.f, -12.f, 5.f * scale, 12.f, 21.f, 32.f}));
+        EXPECT_EQ(read_vector<float>(result2), (vector<float>{5.f + scale, 8.f, 10.f, 12.f}));
+    }
+}
+
+TEST(backend_api, host_memory_allocator)
+{
+    runtime::PoolingAllocator allocator;
+    {
+        auto backend = runtime::Backend::create("INTERPRETER");
+        backend->set_host_memory_allocator(&allocator);
+        EXPECT_EQ(backend->get_host_memory_allocator(), &allocator);
+        EXPECT_ANY_THROW(backend->set_host_memory_allocator(&allocator));
+
+        Shape shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Abs>(make_shared<op::Add>(A, B)),
+                                       ParameterVector{A, B});
+        auto exec = backend->compile(f);
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1.f, 2.f, 3.f, 4.f});
+        copy_data(b, vector<float>{-5.f, 6.f, 7.f, 8.f});
+        for (size_t i = 0; i < 2; i++)
+        {
+            exec->call_with_validate({result}, {a, b});
+            EXPECT_EQ(read_vector<float>(result), (vector<float>{4.f, 8.f, 10.f, 12.f}));
+        }
+    }
+
+    // The planned memory of the second call reuses the block of the first
+    runtime::AllocatorStats stats = allocator.get_stats();
+    EXPECT_EQ(stats.allocation_count, 2);
+    EXPECT_EQ(stats.free_count, 2);
+    EXPECT_EQ(stats.reuse_count, 1);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+}
+
+TEST(backend_api, host_memory_allocator_loaded_executable)
+{
+    runtime::PoolingAllocator allocator;
+    {
+        auto backend = runtime::Backend::create("INTERPRETER");
+        backend->set_host_memory_allocator(&allocator);
+
+        Shape shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Abs>(make_shared<op::Add>(A, B)),
+                                       ParameterVector{A, B});
+        stringstream file;
+        backend->compile(f)->save(file);
+        // Executables loaded from a file plan their temporaries in the backend's allocator too
+        auto exec = backend->load(file);
+        ASSERT_NE(exec, nullptr);
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1.f, 2.f, 3.f, 4.f});
+        copy_data(b, vector<float>{-5.f, 6.f, 7.f, 8.f});
+        exec->call_with_validate({result}, {a, b});
+        EXPECT_EQ(read_vector<float>(result), (vector<float>{4.f, 8.f, 10.f, 12.f}));
+    }
+
+    runtime::AllocatorStats stats = allocator.get_stats();
+    EXPECT_EQ(stats.allocation_count, 1);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+}
+
+TEST(backend_api, intermediates_released_after_call)
+{
+    // By default the temporaries live only for the duration of a call. Incremental execution
+    // keeps them until the executable is destroyed.
+    for (bool incremental : {false, true})
+    {
+        runtime::PoolingAllocator allocator;
+        {
+            auto backend = runtime::Backend::create("INTERPRETER");
+            string error;
+            if (incremental)
+            {
+                EXPECT_TRUE(backend->set_config({{"incremental_execution", "true"}}, error));
+            }
+            backend->set_host_memory_allocator(&allocator);
+
+            Shape shape{2, 2};
+            auto A = make_shared<op::Parameter>(element::f32, shape);
+            auto B = make_shared<op::Parameter>(element::f32, shape);
+            auto f = make_shared<Function>(
+                make_shared<op::Abs>(make_shared<op::Multiply>(make_shared<op::Add>(A, B), B)),
+                ParameterVector{A, B});
+            auto exec = backend->compile(f);
+
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            copy_data(a, vector<float>{1.f, 2.f, 3.f, 4.f});
+            copy_data(b, vector<float>{-5.f, 6.f, 7.f, 8.f});
+            exec->call_with_validate({result}, {a, b});
+            EXPECT_EQ(read_vector<float>(result), (vector<float>{20.f, 48.f, 70.f, 96.f}));
+
+            runtime::AllocatorStats stats = allocator.get_stats();
+            EXPECT_GT(stats.peak_bytes_in_use, 0u);
+            if (incremental)
+            {
+                EXPECT_GT(stats.bytes_in_use, 0u);
+            }
+            else
+            {
+                EXPECT_EQ(stats.bytes_in_use, 0u);
+            }
+        }
+        EXPECT_EQ(allocator.get_stats().bytes_in_use, 0u);
+    }
+}
+
 TEST(backend_api, config_unsupported)
 {
     auto backend = runtime::Backend::create("NOP");
@@ -59,6 +212,46 @@ TEST(backend_api, config_unsupported)
     EXPECT_FALSE(error == "");
 }
 
+TEST(backend_api, compile_many)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_TRUE(backend->is_supported_property(runtime::Backend::Property::concurrent_compile));
+
+    // Functions of different sizes that share nothing, and two that share a parameter
+    vector<shared_ptr<Function>> functions;
+    for (size_t i = 1; i <= 8; i++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{i});
+        shared_ptr<Node> n = A;
+        for (size_t j = 0; j < i; j++)
+        {
+            n = make_shared<op::Add>(n, A);
+        }
+        functions.push_back(make_shared<Function>(n, ParameterVector{A}));
+    }
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    functions.push_back(make_shared<Function>(make_shared<op::Abs>(B), ParameterVector{B}));
+    functions.push_back(make_shared<Function>(make_shared<op::Negative>(B), ParameterVector{B}));
+
+    auto executables = backend->compile_many(functions);
+    ASSERT_EQ(executables.size(), functions.size());
+    for (size_t i = 1; i <= 8; i++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{i});
+        auto result = backend->create_tensor(element::f32, Shape{i});
+        copy_data(a, vector<float>(i, 1.f));
+        executables[i - 1]->call_with_validate({result}, {a});
+        EXPECT_EQ(read_vector<float>(result), vector<float>(i, static_cast<float>(i + 1)));
+    }
+    auto b = backend->create_tensor(element::f32, Shape{2});
+    auto result = backend->create_tensor(element::f32, Shape{2});
+    copy_data(b, vector<float>{-1.f, 2.f});
+    executables[8]->call_with_validate({result}, {b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{1.f, 2.f}));
+    executables[9]->call_with_validate({result}, {b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{1.f, -2.f}));
+}
+
 #ifndef NGRAPH_JSON_DISABLE
 TEST(backend_api, save_load)
 {
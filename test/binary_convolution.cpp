@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Copyright 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(binary_convolution, xor_popcount_kernels)
+{
+    // The runtime-selected kernel must agree with the scalar one, including the words left
+    // over after the last full vector
+    vector<uint64_t> a(37);
+    vector<uint64_t> b(37);
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = 0x9e3779b97f4a7c15ULL * (i + 1);
+        b[i] = ~a[i] ^ (uint64_t(1) << (i % 64));
+    }
+    auto kernel = runtime::reference::get_xor_popcount_kernel();
+    for (size_t words = 0; words <= a.size(); words++)
+    {
+        EXPECT_EQ(kernel(a.data(), b.data(), words),
+                  runtime::reference::xor_popcount_scalar(a.data(), b.data(), words))
+            << "words " << words;
+    }
+}
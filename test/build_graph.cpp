@@ -219,3 +219,23 @@ TEST(build_graph, validate_function_for_dynamic_shape)
     EXPECT_TRUE(make_function(true)->is_dynamic());
     EXPECT_FALSE(make_function(false)->is_dynamic());
 }
+
+TEST(build_graph, constant_shared_data)
+{
+    auto data = make_shared<vector<float>>(vector<float>{1, 2, 3, 4});
+    auto c = make_shared<op::Constant>(element::f32, Shape{2, 2}, data->data(), data);
+    weak_ptr<vector<float>> weak_data = data;
+    data.reset();
+
+    // The constant refers to the data instead of copying it, and keeps it alive
+    ASSERT_FALSE(weak_data.expired());
+    EXPECT_EQ(c->get_data_ptr(), weak_data.lock()->data());
+    EXPECT_EQ(c->get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+
+    auto copy = static_pointer_cast<op::Constant>(c->copy_with_new_args(NodeVector{}));
+    EXPECT_EQ(copy->get_data_ptr(), c->get_data_ptr());
+    c.reset();
+    EXPECT_FALSE(weak_data.expired());
+    copy.reset();
+    EXPECT_TRUE(weak_data.expired());
+}
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -32,4 +33,16 @@ TEST(convert_u1_to_string, convert_u1_to_string)
     {
         ASSERT_EQ(constant->convert_value_to_string(i), ref[i]);
     }
-}
\ No newline at end of file
+}
+
+TEST(convert_u1_to_string, binarization)
+{
+    // Values greater than zero are 1, as in the binarization of BinaryConvolution
+    vector<float> values{-1.f, 1.f, 0.f, 2.5f, -0.5f, 1.f, 1.f, -3.f, 1.f};
+    auto constant = op::Constant::create(element::u1, Shape{9}, values);
+    EXPECT_EQ(constant->get_vector<uint8_t>(), (vector<uint8_t>{0, 1, 0, 1, 0, 1, 1, 0, 1}));
+
+    vector<uint8_t> packed(2);
+    runtime::reference::pack_u1(values.data(), packed.data(), values.size());
+    EXPECT_EQ(memcmp(constant->get_data_ptr(), packed.data(), packed.size()), 0);
+}
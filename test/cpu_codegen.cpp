@@ -14,10 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+#include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -60,3 +66,136 @@ TEST(cpu_codegen, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector(),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+// Codegen draws from the same Philox streams as DEX and the interpreter, so seeded random ops
+// produce bit-identical values on all of them
+TEST(cpu_codegen, seeded_random_ops_match_interpreter)
+{
+    // Large enough to be split into several parallel tiles
+    Shape shape{4, 100, 100};
+    auto make_function = [&shape]() {
+        auto training = op::Constant::create(element::f32, Shape{}, {1});
+        auto mask = make_shared<op::GenerateMask>(training, shape, element::f32, 7, 0.7, true);
+        auto min_val = op::Constant::create(element::f32, Shape{}, {-2});
+        auto max_val = op::Constant::create(element::f32, Shape{}, {3});
+        auto result_shape = op::Constant::create(element::i64, Shape{shape.size()}, shape);
+        auto use_fixed_seed = op::Constant::create(element::boolean, Shape{}, {1});
+        auto uniform =
+            make_shared<op::RandomUniform>(min_val, max_val, result_shape, use_fixed_seed, 11);
+        return make_shared<Function>(NodeVector{mask, uniform}, ParameterVector{});
+    };
+    // CPUFusion turns this pattern into Dropout
+    auto make_dropout_function = [&shape]() {
+        auto input = make_shared<op::Parameter>(element::f32, shape);
+        auto training = op::Constant::create(element::f32, Shape{}, {1});
+        auto mask = make_shared<op::GenerateMask>(training, shape, element::f32, 5, 0.9, true);
+        auto keep_prob = op::Constant::create(element::f32, shape, {0.9});
+        auto output = make_shared<op::Divide>(make_shared<op::Multiply>(mask, input), keep_prob);
+        return make_shared<Function>(NodeVector{output, mask}, ParameterVector{input});
+    };
+
+    auto cpu = runtime::Backend::create("CPU");
+    auto interpreter = runtime::Backend::create("INTERPRETER");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+
+    auto run = [&shape](const shared_ptr<runtime::Executable>& handle,
+                        const shared_ptr<runtime::Backend>& backend,
+                        const vector<float>& input) {
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        if (!input.empty())
+        {
+            inputs.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(inputs.back(), input);
+        }
+        for (size_t i = 0; i < 2; i++)
+        {
+            outputs.push_back(backend->create_tensor(element::f32, shape));
+        }
+        handle->call_with_validate(outputs, inputs);
+        return vector<vector<float>>{read_vector<float>(outputs[0]),
+                                     read_vector<float>(outputs[1])};
+    };
+
+    auto codegen_values = run(cpu->compile(make_function(), pass_config), cpu, {});
+    auto interpreter_values = run(interpreter->compile(make_function()), interpreter, {});
+    EXPECT_EQ(codegen_values[0], interpreter_values[0]);
+    EXPECT_EQ(codegen_values[1], interpreter_values[1]);
+
+    vector<float> input(shape_size(shape));
+    iota(input.begin(), input.end(), 1.0f);
+    auto codegen_dropout = run(cpu->compile(make_dropout_function(), pass_config), cpu, input);
+    auto interpreter_dropout =
+        run(interpreter->compile(make_dropout_function()), interpreter, input);
+    EXPECT_EQ(codegen_dropout[1], interpreter_dropout[1]);
+    EXPECT_TRUE(test::all_close_f(codegen_dropout[0], interpreter_dropout[0]));
+}
+
+// GRUFusion runs in codegen mode as well, so Rnn layers MKLDNN does not take have to be
+// emitted as calls to the native GRU kernel
+TEST(cpu_codegen, fused_gru_matches_interpreter)
+{
+    const size_t seq_len = 5;
+    const size_t batch_size = 2;
+    const size_t hidden_size = 8;
+    auto make_function = [&]() {
+        auto data =
+            make_shared<op::Parameter>(element::f32, Shape{seq_len, batch_size, hidden_size});
+        auto W = make_shared<op::Parameter>(element::f32, Shape{3 * hidden_size, hidden_size});
+        auto R = make_shared<op::Parameter>(element::f32, Shape{3 * hidden_size, hidden_size});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{6 * hidden_size});
+        auto H_0 = make_shared<op::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        NodeVector hs;
+        shared_ptr<Node> H_t = H_0;
+        for (size_t t = 0; t < seq_len; t++)
+        {
+            auto x_t = make_shared<op::Slice>(
+                data, Coordinate{t, 0, 0}, Coordinate{t + 1, batch_size, hidden_size});
+            auto x = make_shared<op::Reshape>(
+                x_t, AxisVector{0, 1, 2}, Shape{batch_size, hidden_size});
+            H_t = make_shared<op::GRUCell>(x, W, R, H_t, hidden_size, B);
+            hs.push_back(H_t);
+        }
+        auto output = make_shared<op::Reshape>(make_shared<op::Concat>(hs, 0),
+                                               AxisVector{0, 1},
+                                               Shape{seq_len, batch_size, hidden_size});
+        return make_shared<Function>(NodeVector{output}, ParameterVector{data, W, R, B, H_0});
+    };
+
+    auto run = [](const shared_ptr<Function>& f,
+                  const shared_ptr<runtime::Executable>& handle,
+                  const shared_ptr<runtime::Backend>& backend,
+                  const vector<vector<float>>& args) {
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            auto& param = f->get_parameters().at(i);
+            inputs.push_back(backend->create_tensor(element::f32, param->get_shape()));
+            copy_data(inputs.back(), args[i]);
+        }
+        auto output = backend->create_tensor(element::f32, f->get_output_shape(0));
+        handle->call_with_validate({output}, inputs);
+        return read_vector<float>(output);
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto cpu = runtime::Backend::create("CPU");
+    auto interpreter = runtime::Backend::create("INTERPRETER");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto cpu_results = run(cpu_f, cpu->compile(cpu_f, pass_config), cpu, args);
+    auto int_results = run(int_f, interpreter->compile(int_f), interpreter, args);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(cpu_f), 1);
+    EXPECT_TRUE(test::all_close(cpu_results, int_results, 1.0e-4f, 1.0e-4f));
+}
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
 
@@ -36,6 +37,8 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/gru_cell.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/negative.hpp"
@@ -67,6 +70,7 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
@@ -76,6 +80,7 @@
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -2702,8 +2707,12 @@ TEST(cpu_fusion, MLIR_DISABLE_TEST(fuse_dropout))
         EXPECT_FALSE(test::all_close(fuse_results3.at(0), fuse_results4.at(0)));
         EXPECT_FALSE(test::all_close(fuse_results3.at(1), fuse_results4.at(1)));
 
-        // Note: Since the RNG used in Dropout kernel is different than RNG used in GenerateMask
-        // kernel, we can't compare fuse_results and nofuse_results
+        // Dropout and GenerateMask draw the same Philox stream, so with a seed the fused and
+        // unfused graphs agree
+        auto nofuse_func2 = make_function(Shape{2, 2, 256, 256}, seed, 0.9, false, true);
+        auto nofuse_results2 = execute(nofuse_func2, args, "CPU");
+        EXPECT_TRUE(test::all_close(fuse_results.at(0), nofuse_results2.at(0)));
+        EXPECT_TRUE(test::all_close(fuse_results.at(1), nofuse_results2.at(1)));
     }
 }
 
@@ -4006,3 +4015,340 @@ TEST(cpu_fusion, validate_fuse_gru_inputs)
     }
 }
 #endif
+
+// Unrolls GRUCells over the timesteps of data [T, N, H]. Returns the hidden states of the last
+// layer as [T, N, H], or [T, N, 2H] for a bidirectional layer.
+static shared_ptr<Function> make_gru_function(size_t num_layers, bool bidirectional)
+{
+    const size_t seq_len = 5;
+    const size_t batch_size = 2;
+    const size_t hidden_size = 8;
+    const size_t gates_count = 3;
+
+    auto data = make_shared<op::Parameter>(element::f32, Shape{seq_len, batch_size, hidden_size});
+    ParameterVector params{data};
+    NodeVector xs;
+    for (size_t t = 0; t < seq_len; t++)
+    {
+        auto x_t = make_shared<op::Slice>(
+            data, Coordinate{t, 0, 0}, Coordinate{t + 1, batch_size, hidden_size});
+        xs.push_back(
+            make_shared<op::Reshape>(x_t, AxisVector{0, 1, 2}, Shape{batch_size, hidden_size}));
+    }
+
+    auto make_layer = [&](const NodeVector& inputs) {
+        auto W = make_shared<op::Parameter>(element::f32,
+                                            Shape{gates_count * hidden_size, hidden_size});
+        auto R = make_shared<op::Parameter>(element::f32,
+                                            Shape{gates_count * hidden_size, hidden_size});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{2 * gates_count * hidden_size});
+        auto H_0 = make_shared<op::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        params.insert(params.end(), {W, R, B, H_0});
+
+        NodeVector hs;
+        shared_ptr<Node> H_t = H_0;
+        for (auto& x_t : inputs)
+        {
+            H_t = make_shared<op::GRUCell>(x_t, W, R, H_t, hidden_size, B);
+            hs.push_back(H_t);
+        }
+        return hs;
+    };
+
+    Shape layer_shape{seq_len, batch_size, hidden_size};
+    shared_ptr<Node> output;
+    if (bidirectional)
+    {
+        auto forward = make_layer(xs);
+        auto backward = make_layer(NodeVector(xs.rbegin(), xs.rend()));
+        auto forward_tnc = make_shared<op::Reshape>(
+            make_shared<op::Concat>(forward, 0), AxisVector{0, 1}, layer_shape);
+        auto backward_tnc = make_shared<op::Reshape>(
+            make_shared<op::Concat>(backward, 0), AxisVector{0, 1}, layer_shape);
+        output = make_shared<op::Concat>(
+            NodeVector{forward_tnc, make_shared<op::Reverse>(backward_tnc, AxisSet{0})}, 2);
+    }
+    else
+    {
+        for (size_t l = 0; l < num_layers; l++)
+        {
+            xs = make_layer(xs);
+        }
+        output =
+            make_shared<op::Reshape>(make_shared<op::Concat>(xs, 0), AxisVector{0, 1}, layer_shape);
+    }
+    return make_shared<Function>(NodeVector{output}, params);
+}
+
+static void check_gru_function(size_t num_layers, bool bidirectional)
+{
+    auto int_f = make_gru_function(num_layers, bidirectional);
+    auto cpu_f = make_gru_function(num_layers, bidirectional);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::GRUCell>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(cpu_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, fuse_gru_cells)
+{
+    auto func = make_gru_function(1, false);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::GRUFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(count_ops_of_type<op::GRUCell>(func), 0);
+    EXPECT_EQ(rnn_ops[0]->get_rnn_type(), runtime::cpu::rnn_utils::rnntype::vanilla_gru);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 5);
+
+    check_gru_function(1, false);
+}
+
+TEST(cpu_fusion, fuse_2_layer_gru)
+{
+    auto func = make_gru_function(2, false);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::GRUFusion>();
+    pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
+    pass_manager.register_pass<runtime::cpu::pass::MultiLayerRNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_num_fused_layers(), 2);
+
+    check_gru_function(2, false);
+}
+
+TEST(cpu_fusion, fuse_bi_directional_gru)
+{
+    auto func = make_gru_function(1, true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::GRUFusion>();
+    pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
+    pass_manager.register_pass<runtime::cpu::pass::BiDirectionalRnn>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_direction(), 2);
+    EXPECT_EQ(count_ops_of_type<op::Reverse>(func), 0);
+
+    check_gru_function(1, true);
+}
+
+TEST(cpu_fusion, gru_cells_without_fusion)
+{
+    // With GRUFusion disabled the cells kept for it are decomposed after it instead
+    set_environment("NGRAPH_PASS_ENABLES", "GRUFusion:0", 1);
+    auto int_f = make_gru_function(1, false);
+    auto cpu_f = make_gru_function(1, false);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    unset_environment("NGRAPH_PASS_ENABLES");
+
+    EXPECT_EQ(count_ops_of_type<op::GRUCell>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, fuse_elementwise_chain)
+{
+    Shape shape{4, 300};
+    auto make_function = [shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{300});
+        auto mul = A * B;
+        auto add = mul + make_shared<op::Broadcast>(bias, shape, AxisSet{0});
+        auto chain = make_shared<op::Tanh>(add) * B;
+        // mul is also a result, so it must stay outside of the fused chain
+        return make_shared<Function>(NodeVector{chain, mul}, ParameterVector{A, B, bias});
+    };
+
+    auto func = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::FusedElementwise>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Tanh>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(func), 0);
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, fuse_scaled_dot_product_attention)
+{
+    Shape shape{4, 128, 32};
+    auto make_function = [shape]() {
+        auto Q = make_shared<op::Parameter>(element::f32, shape);
+        auto K = make_shared<op::Parameter>(element::f32, shape);
+        auto V = make_shared<op::Parameter>(element::f32, shape);
+        auto mask = make_shared<op::Parameter>(element::f32, Shape{128});
+        Shape scores_shape{4, 128, 128};
+        auto scores = make_shared<op::BatchMatMulTranspose>(Q, K, false, true);
+        auto scaled = scores / op::Constant::create(element::f32, scores_shape, {sqrt(32.0)});
+        auto masked = scaled + make_shared<op::Broadcast>(mask, scores_shape, AxisSet{0, 1});
+        auto probabilities = make_shared<op::Softmax>(masked, AxisSet{2});
+        auto attention = make_shared<op::BatchMatMul>(probabilities, V);
+        return make_shared<Function>(NodeVector{attention}, ParameterVector{Q, K, V, mask});
+    };
+
+    auto func = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>(pass::FusionType::REGULAR_FUSIONS);
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::ScaledDotProductAttention>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Softmax>(func), 0);
+    auto attention = as_type_ptr<op::ScaledDotProductAttention>(
+        func->get_results().at(0)->get_argument(0));
+    ASSERT_NE(attention, nullptr);
+    EXPECT_FLOAT_EQ(attention->get_scale(), 1.0 / sqrt(32.0));
+    // The broadcast mask is passed to the kernel without being expanded
+    EXPECT_EQ(attention->get_input_shape(3), (Shape{1, 1, 128}));
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+// BERT-style attention: heads are split off as a separate dimension and folded into the batch
+// dimension around each batched matrix product. The mask holds one row per sample.
+static shared_ptr<Function>
+    make_multi_head_attention(size_t batch, size_t heads, size_t length, size_t depth)
+{
+    Shape head_shape{batch, heads, length, depth};
+    Shape folded_shape{batch * heads, length, depth};
+    Shape scores_shape{batch, heads, length, length};
+    auto Q = make_shared<op::Parameter>(element::f32, head_shape);
+    auto K = make_shared<op::Parameter>(element::f32, head_shape);
+    auto V = make_shared<op::Parameter>(element::f32, head_shape);
+    auto mask = make_shared<op::Parameter>(element::f32, Shape{batch, length});
+
+    auto q = make_shared<op::Reshape>(Q, AxisVector{0, 1, 2, 3}, folded_shape);
+    auto k_t =
+        make_shared<op::Reshape>(K, AxisVector{0, 1, 3, 2}, Shape{batch, heads, depth, length});
+    auto k = make_shared<op::Reshape>(
+        k_t, AxisVector{0, 1, 2, 3}, Shape{batch * heads, depth, length});
+    auto v = make_shared<op::Reshape>(V, AxisVector{0, 1, 2, 3}, folded_shape);
+    auto scores = make_shared<op::Reshape>(
+        make_shared<op::BatchMatMul>(q, k), AxisVector{0, 1, 2}, scores_shape);
+    auto scaled =
+        scores * op::Constant::create(element::f32, scores_shape, {1.0 / sqrt(double(depth))});
+    auto masked = scaled + make_shared<op::Broadcast>(mask, scores_shape, AxisSet{1, 2});
+    auto probabilities = make_shared<op::Reshape>(make_shared<op::Softmax>(masked, AxisSet{3}),
+                                                  AxisVector{0, 1, 2, 3},
+                                                  Shape{batch * heads, length, length});
+    auto attention = make_shared<op::BatchMatMul>(probabilities, v);
+    return make_shared<Function>(NodeVector{attention}, ParameterVector{Q, K, V, mask});
+}
+
+TEST(cpu_fusion, fuse_multi_head_attention)
+{
+    const size_t batch = 2;
+    const size_t length = 64;
+    auto func = make_multi_head_attention(batch, 4, length, 16);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>(pass::FusionType::REGULAR_FUSIONS);
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::ScaledDotProductAttention>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Softmax>(func), 0);
+    auto attention = as_type_ptr<op::ScaledDotProductAttention>(
+        func->get_results().at(0)->get_argument(0));
+    ASSERT_NE(attention, nullptr);
+    // One mask row per sample, shared by its heads and query positions
+    EXPECT_EQ(attention->get_input_shape(3), (Shape{batch, 1, length}));
+
+    auto int_f = make_multi_head_attention(batch, 4, length, 16);
+    auto cpu_f = make_multi_head_attention(batch, 4, length, 16);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+TEST(cpu_fusion, multi_head_attention_padding_mask)
+{
+    // Padded sequences mask their trailing keys with -inf. With 300 keys the kernel walks
+    // several key blocks, and the blocks past the padding of a sample are masked as a whole.
+    const size_t batch = 3;
+    const size_t length = 300;
+    const vector<size_t> valid_length{300, 200, 90};
+    auto int_f = make_multi_head_attention(batch, 2, length, 16);
+    auto cpu_f = make_multi_head_attention(batch, 2, length, 16);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    vector<float>& mask = args.back();
+    for (size_t n = 0; n < batch; n++)
+    {
+        for (size_t j = 0; j < length; j++)
+        {
+            mask[n * length + j] = j < valid_length[n] ? 0.0f : -numeric_limits<float>::infinity();
+        }
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::ScaledDotProductAttention>(cpu_f), 1);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
@@ -16,9 +16,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -37,8 +39,11 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -665,6 +670,72 @@ TEST(cpu_test, mkldnn_layouts_eltwise)
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
 }
 
+TEST(cpu_test, MLIR_DISABLE_TEST(global_layout_assignment))
+{
+    // The blocked convolution output goes through a non-MKLDNN elementwise op that fans out to
+    // several native-only consumers. Op-by-op selection keeps the blocked layout through Abs and
+    // reorders on every edge to a Sum, the global assignment reorders once ahead of Abs.
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 4, 4});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto conv = make_shared<op::Convolution>(A, B, Strides{1, 1}, Strides{1, 1});
+        auto abs = make_shared<op::Abs>(conv);
+        auto sum1 = make_shared<op::Sum>(abs, AxisSet{1});
+        auto sum2 = make_shared<op::Sum>(abs, AxisSet{2});
+        auto sum3 = make_shared<op::Sum>(abs, AxisSet{3});
+        return make_shared<Function>(NodeVector{sum1, sum2, sum3}, ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(-100.0f, 100.0f);
+    vector<vector<float>> args;
+    auto int_f = make_function();
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+
+    auto local_f = make_function();
+    auto local_results = execute(local_f, args, "CPU");
+
+    auto backend = runtime::Backend::create("CPU");
+    auto local_stats_f = make_function();
+    auto local_exec =
+        dynamic_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(local_stats_f));
+
+    set_environment("NGRAPH_PASS_CPU_LAYOUT_GLOBAL", "1", 1);
+    auto global_f = make_function();
+    auto global_results = execute(global_f, args, "CPU");
+    auto global_stats_f = make_function();
+    auto global_exec =
+        dynamic_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(global_stats_f));
+    unset_environment("NGRAPH_PASS_CPU_LAYOUT_GLOBAL");
+
+    EXPECT_LT(count_ops_of_type<runtime::cpu::op::ConvertLayout>(global_f),
+              count_ops_of_type<runtime::cpu::op::ConvertLayout>(local_f));
+
+    // The executables report the reorders left in the compiled function, and in global mode the
+    // model's estimate for the op-by-op choices
+    ASSERT_NE(local_exec, nullptr);
+    ASSERT_NE(global_exec, nullptr);
+    auto local_stats = local_exec->get_reorder_stats();
+    auto global_stats = global_exec->get_reorder_stats();
+    EXPECT_EQ(local_stats.count,
+              count_ops_of_type<runtime::cpu::op::ConvertLayout>(local_stats_f));
+    EXPECT_EQ(global_stats.count,
+              count_ops_of_type<runtime::cpu::op::ConvertLayout>(global_stats_f));
+    EXPECT_LT(global_stats.bytes, local_stats.bytes);
+    EXPECT_EQ(local_exec->get_estimated_local_reorder_stats().count, 0);
+    EXPECT_GT(global_exec->get_estimated_local_reorder_stats().bytes, global_stats.bytes);
+    for (size_t i = 0; i < int_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(local_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+        EXPECT_TRUE(test::all_close(global_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 TEST(cpu_test, convolution_large_padding)
 {
     Shape input_shape{1, 1, 100, 100};
@@ -2327,3 +2398,202 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+TEST(cpu_test, topk_large_vocabulary)
+{
+    Shape shape{3, 100000};
+    Shape out_shape{3, 50};
+    vector<float> a(shape_size(shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(a);
+
+    for (auto sort : {op::TopK::SortType::SORT_VALUES, op::TopK::SortType::SORT_INDICES})
+    {
+        vector<vector<int32_t>> indices;
+        vector<vector<float>> values;
+        for (auto backend_name : {"CPU", "INTERPRETER"})
+        {
+            auto A = make_shared<op::Parameter>(element::f32, shape);
+            auto B = make_shared<op::TopK>(A, 1, element::i32, 50, true, sort);
+            auto f = make_shared<Function>(NodeVector{make_shared<op::GetOutputElement>(B, 0),
+                                                      make_shared<op::GetOutputElement>(B, 1)},
+                                           ParameterVector{A});
+
+            auto backend = runtime::Backend::create(backend_name);
+            auto arg = backend->create_tensor(element::f32, shape);
+            copy_data(arg, a);
+            auto result0 = backend->create_tensor(element::i32, out_shape);
+            auto result1 = backend->create_tensor(element::f32, out_shape);
+            auto handle = backend->compile(f);
+            handle->call_with_validate({result0, result1}, {arg});
+            indices.push_back(read_vector<int32_t>(result0));
+            values.push_back(read_vector<float>(result1));
+        }
+        EXPECT_EQ(indices[1], indices[0]);
+        EXPECT_EQ(values[1], values[0]);
+    }
+}
+
+TEST(cpu_test, scatter_nd_add_duplicate_indices)
+{
+    Shape ref_shape{4, 3, 2};
+    Shape indices_shape{6, 1};
+    Shape updates_shape{6, 3, 2};
+    auto make_f = [&]() {
+        auto R = make_shared<op::Parameter>(element::f32, ref_shape);
+        auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+        auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+        auto G = make_shared<op::ScatterNDAdd>(R, I, U);
+        return make_shared<Function>(G, ParameterVector{R, I, U});
+    };
+
+    vector<float> r(shape_size(ref_shape));
+    vector<float> u(shape_size(updates_shape));
+    iota(r.begin(), r.end(), 0.5f);
+    iota(u.begin(), u.end(), 100.25f);
+    vector<int32_t> i{3, 1, 3, 0, 3, 1};
+
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    vector<vector<float>> results;
+    for (auto b : {backend, int_backend})
+    {
+        auto ref = b->create_tensor(element::f32, ref_shape);
+        auto indices = b->create_tensor(element::i32, indices_shape);
+        auto updates = b->create_tensor(element::f32, updates_shape);
+        auto result = b->create_tensor(element::f32, ref_shape);
+        copy_data(ref, r);
+        copy_data(indices, i);
+        copy_data(updates, u);
+        auto handle = b->compile(make_f());
+        handle->call_with_validate({result}, {ref, indices, updates});
+        results.push_back(read_vector<float>(result));
+    }
+    EXPECT_TRUE(test::all_close_f(results[1], results[0], MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(cpu_test, softmax_non_contiguous_axes)
+{
+    auto make_f = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4, 5});
+        return make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1, 3}),
+                                     ParameterVector{A});
+    };
+    compare_backends(make_f(), make_f(), "CPU", "INTERPRETER");
+}
+
+TEST(cpu_test, layer_norm_long_rows)
+{
+    // Rows longer than one block of the blocked mean and variance reduction
+    auto make_f = [&]() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{4, 3, 700});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{3, 700});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{3, 700});
+        auto layer_norm = make_shared<op::LayerNorm>(data, scale, bias, true, 1);
+        return make_shared<Function>(layer_norm->outputs(),
+                                     ParameterVector{data, scale, bias});
+    };
+    compare_backends(make_f(), make_f(), "CPU", "INTERPRETER");
+}
+
+TEST(cpu_test, mvn_non_contiguous_axes)
+{
+    auto make_f = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4, 5});
+        return make_shared<Function>(make_shared<op::MVN>(A, AxisSet{0, 2}),
+                                     ParameterVector{A});
+    };
+    compare_backends(make_f(), make_f(), "CPU", "INTERPRETER");
+}
+
+TEST(cpu_test, log_softmax)
+{
+    auto make_f = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{3, 4, 300});
+        return make_shared<Function>(make_shared<op::LogSoftmax>(A, 1), ParameterVector{A});
+    };
+    compare_backends(make_f(), make_f(), "CPU", "INTERPRETER");
+}
+
+TEST(cpu_test, numa_topology)
+{
+    EXPECT_EQ(runtime::cpu::numa::parse_cpu_list("0-3, 8,10-11\n"),
+              (vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_TRUE(runtime::cpu::numa::parse_cpu_list("").empty());
+
+    string sysfs = file_util::path_join(file_util::get_temp_directory_path(), "numa_topology");
+    file_util::remove_directory(sysfs);
+    file_util::make_directory(sysfs);
+    auto add_node = [&](const string& name, const string& cpus) {
+        string dir = file_util::path_join(sysfs, name);
+        file_util::make_directory(dir);
+        ofstream(file_util::path_join(dir, "cpulist")) << cpus;
+    };
+    add_node("node1", "4-5\n");
+    add_node("node0", "0-2\n");
+    // Memory-only nodes have no cpus and are skipped
+    add_node("node2", "\n");
+
+    auto nodes = runtime::cpu::numa::get_topology(sysfs);
+    file_util::remove_directory(sysfs);
+    ASSERT_EQ(nodes.size(), 2);
+    EXPECT_EQ(nodes[0].id, 0);
+    EXPECT_EQ(nodes[0].cpus, (vector<int>{0, 1, 2}));
+    EXPECT_EQ(nodes[1].id, 1);
+    EXPECT_EQ(nodes[1].cpus, (vector<int>{4, 5}));
+}
+
+TEST(cpu_test, numa_pinning_and_first_touch)
+{
+    set_environment("NGRAPH_CPU_NUMA", "1", 1);
+    runtime::cpu::executor::CPUExecutor executor(1);
+    unset_environment("NGRAPH_CPU_NUMA");
+    auto nodes = runtime::cpu::numa::get_topology();
+    if (!executor.is_numa_aware())
+    {
+        // No NUMA topology on this host
+        EXPECT_TRUE(nodes.empty());
+        return;
+    }
+    ASSERT_GE(executor.get_num_thread_pools(), nodes.size());
+
+    for (int id = 0; id < executor.get_num_thread_pools(); id++)
+    {
+        int numa_node = executor.get_numa_node(id);
+        auto node = find_if(nodes.begin(),
+                            nodes.end(),
+                            [numa_node](const runtime::cpu::numa::Node& n) {
+                                return n.id == numa_node;
+                            });
+        ASSERT_NE(node, nodes.end());
+
+        // The threads of the pool are pinned to the CPUs of its node
+        vector<int> cpus;
+        Eigen::Barrier done(1);
+        executor.get_device(id).enqueueNoNotification([&cpus, &done]() {
+            cpus = runtime::cpu::numa::get_current_thread_cpus();
+            done.Notify();
+        });
+        done.Wait();
+        EXPECT_EQ(cpus, node->cpus);
+
+        // Every page first touched through the pool, including the last partial one, is placed
+        // on the node of the pool
+        const size_t size = 64 * 4096 + 100;
+        vector<char> init(size);
+        iota(init.begin(), init.end(), 0);
+        runtime::AlignedBuffer buffer(size, 4096);
+        char* data = static_cast<char*>(buffer.get_ptr());
+        executor.first_touch(id, data, size, init.data());
+        EXPECT_TRUE(equal(init.begin(), init.end(), data));
+        for (size_t offset = 0; offset < size; offset += 4096)
+        {
+            int page_node = runtime::cpu::numa::get_memory_node(data + offset);
+            // -1 if the kernel cannot report page placement
+            if (page_node >= 0)
+            {
+                EXPECT_EQ(page_node, numa_node);
+            }
+        }
+    }
+}
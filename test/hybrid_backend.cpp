@@ -0,0 +1,180 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The preferred backend does not support Multiply, the fallback supports everything
+static shared_ptr<runtime::hybrid::HybridBackend> make_hybrid_backend()
+{
+    vector<shared_ptr<runtime::Backend>> backend_list{
+        make_shared<runtime::interpreter::INTBackend>(vector<string>{"Multiply"}),
+        make_shared<runtime::interpreter::INTBackend>()};
+    return make_shared<runtime::hybrid::HybridBackend>(backend_list);
+}
+
+static size_t count_ops(const shared_ptr<Function>& f, const string& description)
+{
+    size_t count = 0;
+    for (auto& op : f->get_ops())
+    {
+        count += op->description() == description ? 1 : 0;
+    }
+    return count;
+}
+
+TEST(hybrid_backend, partition)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto K = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto f = make_shared<Function>((A + K) * C + K, ParameterVector{A, C});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto& split = static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_split();
+    ASSERT_EQ(split.functions.size(), 3);
+    EXPECT_EQ(split.placements, (vector<size_t>{0, 1, 0}));
+    EXPECT_EQ(count_ops(split.functions[1], "Multiply"), 1);
+    // The constant is cloned into both pieces that use it
+    EXPECT_EQ(count_ops(split.functions[0], "Constant"), 1);
+    EXPECT_EQ(count_ops(split.functions[2], "Constant"), 1);
+    EXPECT_EQ(split.functions[2]->get_parameters().size(), 1);
+    // The caller's function is not placed
+    for (auto& op : f->get_ops())
+    {
+        EXPECT_EQ(op->get_placement_index(), size_t{Node::placement_invalid});
+    }
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+    handle->call_with_validate({result}, {a, c});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{19, 31, 45, 61}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(hybrid_backend, fallback_op_pulls_neighbours)
+{
+    // The Negative between two Multiplys runs on the fallback with them
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto N = make_shared<op::Negative>(A * B);
+    auto f = make_shared<Function>(N * B + A, ParameterVector{A, B});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto& split = static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_split();
+    ASSERT_EQ(split.functions.size(), 2);
+    EXPECT_EQ(split.placements, (vector<size_t>{1, 0}));
+    EXPECT_EQ(count_ops(split.functions[0], "Negative"), 1);
+    EXPECT_EQ(count_ops(split.functions[1], "Add"), 1);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{1, 2, -1, -2});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{0, -6, 0, -12}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(hybrid_backend, fallback_ops_pull_neighbour_piece)
+{
+    // Negative and Abs form a piece between two Multiplys. Moving it to the fallback removes two
+    // boundary tensors, even though neither op has all of its neighbours there.
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto N = make_shared<op::Abs>(make_shared<op::Negative>(A * B));
+    auto f = make_shared<Function>(N * B + A, ParameterVector{A, B});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto& split = static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_split();
+    ASSERT_EQ(split.functions.size(), 2);
+    EXPECT_EQ(split.placements, (vector<size_t>{1, 0}));
+    EXPECT_EQ(count_ops(split.functions[0], "Multiply"), 2);
+    EXPECT_EQ(count_ops(split.functions[0], "Negative"), 1);
+    EXPECT_EQ(count_ops(split.functions[0], "Abs"), 1);
+    EXPECT_EQ(count_ops(split.functions[1], "Add"), 1);
+
+    // The crossing value is allocated once and reused by the second call
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{1, 2, -1, -2});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{2, 10, 0, -12}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+    copy_data(b, vector<float>{2, 2, 2, 2});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{5, 10, 15, 20}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(hybrid_backend, crossing_value_is_shared)
+{
+    // A * B crosses once, through the function result that also returns it, although two ops
+    // of the next piece use it
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto product = A * B;
+    auto f = make_shared<Function>(
+        NodeVector{product, make_shared<op::Negative>(product), make_shared<op::Abs>(product)},
+        ParameterVector{A, B});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto& split = static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_split();
+    ASSERT_EQ(split.functions.size(), 2);
+    EXPECT_EQ(split.placements, (vector<size_t>{1, 0}));
+    EXPECT_EQ(split.functions[0]->get_results().size(), 1);
+    EXPECT_EQ(split.result_sources[0].function, 0);
+    EXPECT_EQ(split.result_sources[0].index, 0);
+    ASSERT_EQ(split.parameter_sources[1].size(), 1);
+    EXPECT_EQ(split.parameter_sources[1][0].function, 0);
+    EXPECT_EQ(split.parameter_sources[1][0].index, 0);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+    auto r2 = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{1, -2, 3, -4});
+    handle->call_with_validate({r0, r1, r2}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, -4, 9, -16}), read_vector<float>(r0), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{-1, 4, -9, 16}), read_vector<float>(r1), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 4, 9, 16}), read_vector<float>(r2), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -36,3 +36,73 @@ func @simple_dot(%arg0: !ng.tensor<16x8xf32>, %arg1: !ng.tensor<8x32xf32>) -> !n
    %0 = "ng.dot"(%arg0, %arg1) : (!ng.tensor<16x8xf32>, !ng.tensor<8x32xf32>) -> !ng.tensor<16x32xf32>
   "ng.return"(%0) : (!ng.tensor<16x32xf32>) -> ()
 }
+
+// -----
+
+// Sum Reduction Op
+// CHECK:       affine.for %[[I:.*]] = 0 to 4
+// CHECK:       affine.store %{{.*}}, %[[RESULT:.*]][%[[I]]]
+// CHECK:       affine.for %[[J:.*]] = 0 to 4
+// CHECK-NEXT:  affine.for %[[K:.*]] = 0 to 8
+// CHECK-DAG:   affine.load %[[RESULT]][%[[J]]]
+// CHECK-DAG:   affine.load %{{.*}}[%[[J]], %[[K]]]
+// CHECK:       %[[R:.*]] = addf
+// CHECK:       affine.store %[[R]], %[[RESULT]][%[[J]]]
+func @simple_sum(%arg0: !ng.tensor<4x8xf32>) -> !ng.tensor<4xf32> {
+  %0 = "ng.sum.red"(%arg0) {axes = [1 : i64]} : (!ng.tensor<4x8xf32>) -> !ng.tensor<4xf32>
+  "ng.return"(%0) : (!ng.tensor<4xf32>) -> ()
+}
+
+// -----
+
+// Broadcast Op
+// CHECK:       affine.for %[[I:.*]] = 0 to 4
+// CHECK-NEXT:  affine.for %[[J:.*]] = 0 to 8
+// CHECK-NEXT:  %[[V:.*]] = affine.load %{{.*}}[%[[J]]]
+// CHECK-NEXT:  affine.store %[[V]], %{{.*}}[%[[I]], %[[J]]]
+func @simple_broadcast(%arg0: !ng.tensor<8xf32>) -> !ng.tensor<4x8xf32> {
+  %0 = "ng.broadcast"(%arg0) {shape = [4 : i64, 8 : i64], axisSet = [0 : i64]} : (!ng.tensor<8xf32>) -> !ng.tensor<4x8xf32>
+  "ng.return"(%0) : (!ng.tensor<4x8xf32>) -> ()
+}
+
+// -----
+
+// Slice Op
+// CHECK:       affine.for %[[I:.*]] = 0 to 2
+// CHECK-NEXT:  affine.for %[[J:.*]] = 0 to 4
+// CHECK:       %[[V:.*]] = affine.load
+// CHECK-NEXT:  affine.store %[[V]], %{{.*}}[%[[I]], %[[J]]]
+func @simple_slice(%arg0: !ng.tensor<6x8xf32>) -> !ng.tensor<2x4xf32> {
+  %0 = "ng.slice"(%arg0) {lowerBounds = [1 : i64, 2 : i64], upperBounds = [5 : i64, 6 : i64], strides = [2 : i64, 1 : i64]} : (!ng.tensor<6x8xf32>) -> !ng.tensor<2x4xf32>
+  "ng.return"(%0) : (!ng.tensor<2x4xf32>) -> ()
+}
+
+// -----
+
+// Sigmoid Op
+// CHECK:       affine.for %[[I:.*]] = 0 to 8
+// CHECK:       %[[X:.*]] = affine.load %{{.*}}[%[[I]]]
+// CHECK:       %[[NEG:.*]] = subf %{{.*}}, %[[X]]
+// CHECK:       %[[E:.*]] = exp %[[NEG]]
+// CHECK:       %[[D:.*]] = addf %{{.*}}, %[[E]]
+// CHECK:       %[[R:.*]] = divf %{{.*}}, %[[D]]
+// CHECK:       affine.store %[[R]], %{{.*}}[%[[I]]]
+func @simple_sigmoid(%arg0: !ng.tensor<8xf32>) -> !ng.tensor<8xf32> {
+  %0 = "ng.sigmoid"(%arg0) : (!ng.tensor<8xf32>) -> !ng.tensor<8xf32>
+  "ng.return"(%0) : (!ng.tensor<8xf32>) -> ()
+}
+
+// -----
+
+// Temporaries are function arguments planned in an arena
+// CHECK-LABEL: func @arena_temps
+// CHECK-SAME:  %[[TMP:[a-z0-9]+]]: memref<4xf32>) attributes {ng.arena_offsets = [0], ng.arena_size = 64
+// CHECK-NOT:   alloc
+// CHECK:       affine.store %{{.*}}, %[[TMP]]
+// CHECK:       affine.load %{{.*}}[%{{.*}}] : memref<4xf32>
+// CHECK-NOT:   dealloc
+func @arena_temps(%arg0: !ng.tensor<4xf32>, %arg1: !ng.tensor<4xf32>) -> !ng.tensor<4xf32> {
+  %0 = "ng.add"(%arg0, %arg1) : (!ng.tensor<4xf32>, !ng.tensor<4xf32>) -> !ng.tensor<4xf32>
+  %1 = "ng.mul"(%0, %arg1) : (!ng.tensor<4xf32>, !ng.tensor<4xf32>) -> !ng.tensor<4xf32>
+  "ng.return"(%1) : (!ng.tensor<4xf32>) -> ()
+}
@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <onnx/onnxifi.h>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 
 // ===============================================[ onnxGetBackendIDs ] =======
@@ -68,3 +72,177 @@ TEST(onnxifi, get_backend_ids_consistency_check)
     EXPECT_TRUE(first_count == second_count);
     EXPECT_TRUE(std::memcmp(first_ids, second_ids, first_count) == 0);
 }
+
+// ================================================[ onnxInitBackend ] =======
+
+// Returns the ID of the INTERPRETER backend, or nullptr if it is not registered.
+// Backend IDs are reported in the order of the registered nGraph backends.
+static ::onnxBackendID get_interpreter_backend_id()
+{
+    auto backends = ngraph::runtime::BackendManager::get_registered_backends();
+    auto it = std::find(std::begin(backends), std::end(backends), "INTERPRETER");
+    ::onnxBackendID backendIDs[g_default_backend_ids_count];
+    std::size_t count{g_default_backend_ids_count};
+    if (it == std::end(backends) ||
+        ::onnxGetBackendIDs(backendIDs, &count) != ONNXIFI_STATUS_SUCCESS)
+    {
+        return nullptr;
+    }
+    return backendIDs[std::distance(std::begin(backends), it)];
+}
+
+TEST(onnxifi, init_backend)
+{
+    ::onnxBackendID backendID{get_interpreter_backend_id()};
+    ASSERT_TRUE(backendID != nullptr);
+    ::onnxBackend backend;
+    EXPECT_TRUE(::onnxInitBackend(backendID, nullptr, &backend) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, init_backend_invalid_id)
+{
+    ::onnxBackend backend;
+    EXPECT_TRUE(::onnxInitBackend(nullptr, nullptr, &backend) == ONNXIFI_STATUS_INVALID_ID);
+}
+
+TEST(onnxifi, init_backend_unsupported_property)
+{
+    const uint64_t properties[] = {1, 0};
+    ::onnxBackend backend;
+    EXPECT_TRUE(::onnxInitBackend(get_interpreter_backend_id(), properties, &backend) ==
+                ONNXIFI_STATUS_UNSUPPORTED_PROPERTY);
+}
+
+// ==================================================[ onnxInitEvent ] =======
+
+TEST(onnxifi, event_signal_wait)
+{
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(get_interpreter_backend_id(), nullptr, &backend) ==
+                ONNXIFI_STATUS_SUCCESS);
+    ::onnxEvent event;
+    EXPECT_TRUE(::onnxInitEvent(backend, &event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(event) == ONNXIFI_STATUS_INVALID_STATE);
+    EXPECT_TRUE(::onnxReleaseEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(event) == ONNXIFI_STATUS_INVALID_EVENT);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, event_invalid_backend)
+{
+    ::onnxEvent event;
+    EXPECT_TRUE(::onnxInitEvent(nullptr, &event) == ONNXIFI_STATUS_INVALID_BACKEND);
+}
+
+// ===================================================[ onnxRunGraph ] =======
+
+static ::onnxTensorDescriptorV1 make_descriptor(const char* name, const float* data)
+{
+    static const uint64_t shape[] = {1};
+    ::onnxTensorDescriptorV1 descriptor;
+    descriptor.tag = ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1;
+    descriptor.name = name;
+    descriptor.dataType = ONNXIFI_DATATYPE_FLOAT32;
+    descriptor.memoryType = ONNXIFI_MEMORY_TYPE_CPU;
+    descriptor.dimensions = 1;
+    descriptor.shape = shape;
+    descriptor.buffer = reinterpret_cast<::onnxPointer>(data);
+    return descriptor;
+}
+
+static void run_graph(::onnxBackend backend, ::onnxGraph graph)
+{
+    ::onnxMemoryFenceV1 input_fence;
+    input_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+    input_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+    EXPECT_TRUE(::onnxInitEvent(backend, &input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxMemoryFenceV1 output_fence;
+    output_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+    output_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+
+    EXPECT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, run_graph)
+{
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(get_interpreter_backend_id(), nullptr, &backend) ==
+                ONNXIFI_STATUS_SUCCESS);
+    std::string model{ngraph::file_util::read_file_to_string(
+        ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.prototxt"))};
+
+    // Graph input C is provided as a weight and bound without copying
+    float c{3};
+    ::onnxTensorDescriptorV1 weight{make_descriptor("C", &c)};
+    ::onnxGraph graph;
+    ASSERT_TRUE(::onnxInitGraph(backend, nullptr, model.size(), model.data(), 1, &weight, &graph) ==
+                ONNXIFI_STATUS_SUCCESS);
+
+    float a{1};
+    float b{2};
+    float y{0};
+    ::onnxTensorDescriptorV1 inputs[] = {make_descriptor("B", &b), make_descriptor("A", &a)};
+    ::onnxTensorDescriptorV1 output{make_descriptor("Y", &y)};
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 2, inputs, 1, &output) == ONNXIFI_STATUS_SUCCESS);
+
+    run_graph(backend, graph);
+    EXPECT_EQ(y, 6);
+
+    // Inputs and outputs are bound by address, so new values are picked up by the next run
+    a = 10;
+    run_graph(backend, graph);
+    EXPECT_EQ(y, 15);
+
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_INVALID_GRAPH);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, set_graph_io_unidentified_name)
+{
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(get_interpreter_backend_id(), nullptr, &backend) ==
+                ONNXIFI_STATUS_SUCCESS);
+    std::string model{ngraph::file_util::read_file_to_string(
+        ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.prototxt"))};
+    ::onnxGraph graph;
+    ASSERT_TRUE(::onnxInitGraph(backend, nullptr, model.size(), model.data(), 0, nullptr, &graph) ==
+                ONNXIFI_STATUS_SUCCESS);
+
+    float value{0};
+    ::onnxTensorDescriptorV1 inputs[] = {
+        make_descriptor("A", &value), make_descriptor("B", &value), make_descriptor("D", &value)};
+    ::onnxTensorDescriptorV1 output{make_descriptor("Y", &value)};
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, &output) == ONNXIFI_STATUS_UNIDENTIFIED_NAME);
+
+    ::onnxMemoryFenceV1 input_fence;
+    input_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+    input_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+    ASSERT_TRUE(::onnxInitEvent(backend, &input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxMemoryFenceV1 output_fence{input_fence};
+    EXPECT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) ==
+                ONNXIFI_STATUS_INVALID_STATE);
+
+    EXPECT_TRUE(::onnxReleaseEvent(input_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, init_graph_invalid_model)
+{
+    ::onnxBackend backend;
+    ASSERT_TRUE(::onnxInitBackend(get_interpreter_backend_id(), nullptr, &backend) ==
+                ONNXIFI_STATUS_SUCCESS);
+    const char model[] = "not a model";
+    ::onnxGraph graph;
+    EXPECT_TRUE(::onnxInitGraph(backend, nullptr, sizeof(model), model, 0, nullptr, &graph) ==
+                ONNXIFI_STATUS_INVALID_MODEL);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
@@ -14,7 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -67,3 +70,77 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+namespace
+{
+    class CountingNodePass : public pass::NodePass
+    {
+    public:
+        CountingNodePass() { set_property(pass::PassProperty::FUNCTION_LOCAL, true); }
+        bool run_on_node(std::shared_ptr<ngraph::Node> /* node */) override
+        {
+            m_count++;
+            return false;
+        }
+        std::atomic<size_t> m_count{0};
+    };
+
+    class RecordingFunctionPass : public pass::FunctionPass
+    {
+    public:
+        RecordingFunctionPass() { set_property(pass::PassProperty::FUNCTION_LOCAL, true); }
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_op_counts.push_back(f->get_ops().size());
+            return false;
+        }
+        std::mutex m_mutex;
+        std::vector<size_t> m_op_counts;
+    };
+}
+
+TEST(pass_manager, function_local_independent_components)
+{
+    // f0 has two unconnected components, f1 shares its parameter with neither
+    auto make_component = [](ParameterVector& params, ResultVector& results) {
+        auto p = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto n = make_shared<op::Negative>(make_shared<op::Abs>(p));
+        params.push_back(p);
+        results.push_back(make_shared<op::Result>(n));
+    };
+    ParameterVector params0, params1;
+    ResultVector results0, results1;
+    make_component(params0, results0);
+    make_component(params0, results0);
+    make_component(params1, results1);
+    auto f0 = make_shared<Function>(results0, params0);
+    auto f1 = make_shared<Function>(results1, params1);
+
+    pass::Manager pass_manager;
+    pass_manager.set_num_threads(4);
+    pass_manager.set_per_pass_validation(false);
+    auto counting = pass_manager.register_pass<CountingNodePass>();
+    auto recording = pass_manager.register_pass<RecordingFunctionPass>();
+    pass_manager.run_passes({f0, f1});
+
+    EXPECT_EQ(counting->m_count, f0->get_ops().size() + f1->get_ops().size());
+    // One sub-function per component of f0, and f1 as a whole, in no particular order
+    sort(recording->m_op_counts.begin(), recording->m_op_counts.end());
+    EXPECT_EQ(recording->m_op_counts, (vector<size_t>{4, 4, 4}));
+}
+
+TEST(pass_manager, function_local_shared_nodes_run_together)
+{
+    // Both functions use `p`, so they must not be processed concurrently
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f0 = make_shared<Function>(make_shared<op::Abs>(p), ParameterVector{p});
+    auto f1 = make_shared<Function>(make_shared<op::Negative>(p), ParameterVector{p});
+
+    pass::Manager pass_manager;
+    pass_manager.set_num_threads(4);
+    auto recording = pass_manager.register_pass<RecordingFunctionPass>();
+    pass_manager.run_passes({f0, f1});
+
+    EXPECT_EQ(recording->m_op_counts, (vector<size_t>{3, 3}));
+}
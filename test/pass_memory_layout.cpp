@@ -27,6 +27,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_optimization.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/test_tools.hpp"
 
@@ -232,3 +233,121 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+static size_t pool_offset(const shared_ptr<Node>& node)
+{
+    return node->get_output_tensor(0).get_pool_offset();
+}
+
+TEST(memory_layout, in_place_elementwise)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto negative = make_shared<op::Negative>(add);
+    auto abs = make_shared<op::Abs>(negative);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(abs, A), ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(32, f->get_temporary_pool_size());
+
+    pass::Manager in_place_pass_manager;
+    in_place_pass_manager.register_pass<pass::MemoryOptimization>();
+    auto memory_layout = in_place_pass_manager.register_pass<pass::MemoryLayout>();
+    in_place_pass_manager.run_passes(f);
+    // Every temporary overwrites its input, the last one in the output
+    EXPECT_EQ(0, f->get_temporary_pool_size());
+    for (auto node : NodeVector{add, negative, abs})
+    {
+        EXPECT_EQ(0, pool_offset(node));
+        EXPECT_EQ(1, memory_layout->get_output_aliases().count(&node->get_output_tensor(0)));
+    }
+}
+
+TEST(memory_layout, in_place_concat)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto multiply = make_shared<op::Multiply>(A, B);
+    auto concat = make_shared<op::Concat>(NodeVector{add, multiply}, 0);
+    auto f = make_shared<Function>(make_shared<op::Sum>(concat, AxisSet{0}), ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    // The arguments are computed in the concat output, the sum in the function output
+    EXPECT_EQ(32, f->get_temporary_pool_size());
+    EXPECT_EQ(pool_offset(concat), pool_offset(add));
+    EXPECT_EQ(pool_offset(concat) + 16, pool_offset(multiply));
+}
+
+TEST(memory_layout, in_place_concat_chain)
+{
+    Shape shape{1, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, A);
+    auto multiply = make_shared<op::Multiply>(A, A);
+    auto subtract = make_shared<op::Subtract>(A, A);
+    auto inner = make_shared<op::Concat>(NodeVector{add, multiply}, 0);
+    auto outer = make_shared<op::Concat>(NodeVector{subtract, inner}, 0);
+    auto f = make_shared<Function>(make_shared<op::Sum>(outer, AxisSet{0}), ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(24, f->get_temporary_pool_size());
+    EXPECT_EQ(pool_offset(outer), pool_offset(subtract));
+    EXPECT_EQ(pool_offset(outer) + 8, pool_offset(inner));
+    EXPECT_EQ(pool_offset(outer) + 8, pool_offset(add));
+    EXPECT_EQ(pool_offset(outer) + 16, pool_offset(multiply));
+}
+
+TEST(memory_layout, slice_and_reshape_views)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 4});
+    auto negative = make_shared<op::Negative>(A);
+    auto slice = make_shared<op::Slice>(negative, Coordinate{1, 0}, Coordinate{3, 4});
+    auto reshape = make_shared<op::Reshape>(slice, AxisVector{0, 1}, Shape{8});
+    auto strided =
+        make_shared<op::Slice>(negative, Coordinate{0, 0}, Coordinate{4, 4}, Strides{2, 1});
+    auto sum = make_shared<op::Sum>(reshape, AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{sum, make_shared<op::Sum>(strided, AxisSet{0, 1})},
+                                   ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(pool_offset(negative) + 16, pool_offset(slice));
+    EXPECT_EQ(pool_offset(slice), pool_offset(reshape));
+    // The strided slice is copied
+    EXPECT_EQ(96, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, result_shared_once)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto negative = make_shared<op::Negative>(A);
+    auto f = make_shared<Function>(NodeVector{negative, negative}, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryOptimization>();
+    auto memory_layout = pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+    // One output is computed in place, the other copies from it
+    EXPECT_EQ(0, f->get_temporary_pool_size());
+    EXPECT_EQ(1, memory_layout->get_output_aliases().count(&negative->get_output_tensor(0)));
+}
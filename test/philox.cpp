@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/random_uniform.hpp"
+#include "ngraph/state/philox_rng_state.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Known answers from the Random123 distribution
+TEST(philox, known_answers)
+{
+    uint32_t out[4];
+
+    uint32_t ctr0[4] = {0, 0, 0, 0};
+    uint32_t key0[2] = {0, 0};
+    PhiloxRNGState::philox4x32(ctr0, key0, out);
+    EXPECT_EQ((vector<uint32_t>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}),
+              vector<uint32_t>(out, out + 4));
+
+    uint32_t ctr1[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+    uint32_t key1[2] = {0xffffffff, 0xffffffff};
+    PhiloxRNGState::philox4x32(ctr1, key1, out);
+    EXPECT_EQ((vector<uint32_t>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}),
+              vector<uint32_t>(out, out + 4));
+
+    uint32_t ctr2[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+    uint32_t key2[2] = {0xa4093822, 0x299f31d0};
+    PhiloxRNGState::philox4x32(ctr2, key2, out);
+    EXPECT_EQ((vector<uint32_t>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}),
+              vector<uint32_t>(out, out + 4));
+}
+
+TEST(philox, generate_matches_block)
+{
+    const uint64_t key = 0x299f31d0a4093822;
+    const uint64_t counter = 0xfffffffffffffffb;
+    vector<uint32_t> words(4 * 11);
+    PhiloxRNGState::generate(key, counter, 11, words.data());
+    uint32_t key_words[2] = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+    for (size_t i = 0; i < 11; i++)
+    {
+        uint64_t c = counter + i;
+        uint32_t ctr[4] = {static_cast<uint32_t>(c), static_cast<uint32_t>(c >> 32), 0, 0};
+        uint32_t out[4];
+        PhiloxRNGState::philox4x32(ctr, key_words, out);
+        EXPECT_EQ(vector<uint32_t>(out, out + 4),
+                  vector<uint32_t>(words.begin() + 4 * i, words.begin() + 4 * i + 4));
+    }
+}
+
+TEST(philox, fill_independent_of_ranges)
+{
+    const size_t count = 1237;
+    vector<double> uniform(count);
+    vector<float> mask(count);
+    runtime::reference::random_uniform_range(uniform.data(), -1.0, 1.0, 0, count, 42, 7);
+    runtime::reference::generate_mask_range(mask.data(), 0, count, true, 0.25, 42, 7);
+
+    for (size_t split : {1, 3, 4, 129, 1000})
+    {
+        vector<double> uniform_split(count);
+        vector<float> mask_split(count);
+        for (size_t begin = 0; begin < count; begin += split)
+        {
+            size_t end = min(begin + split, count);
+            runtime::reference::random_uniform_range(
+                uniform_split.data(), -1.0, 1.0, begin, end, 42, 7);
+            runtime::reference::generate_mask_range(
+                mask_split.data(), begin, end, true, 0.25, 42, 7);
+        }
+        EXPECT_EQ(uniform, uniform_split);
+        EXPECT_EQ(mask, mask_split);
+    }
+
+    EXPECT_TRUE(all_of(uniform.begin(), uniform.end(), [](double x) {
+        return x >= -1.0 && x < 1.0;
+    }));
+    float ones = accumulate(mask.begin(), mask.end(), 0.0f);
+    EXPECT_GT(ones, 0.2f * count);
+    EXPECT_LT(ones, 0.3f * count);
+}
+
+TEST(philox, state_advances)
+{
+    PhiloxRNGState state(5);
+    vector<float> first(10);
+    vector<float> second(10);
+    runtime::reference::random_uniform(first.data(), 0.0f, 1.0f, first.size(), &state);
+    runtime::reference::random_uniform(second.data(), 0.0f, 1.0f, second.size(), &state);
+    EXPECT_NE(first, second);
+
+    // The second call starts right after the five blocks used by the first one
+    vector<float> expected(10);
+    runtime::reference::random_uniform_range(expected.data(), 0.0f, 1.0f, 0, 10, 5, 5);
+    EXPECT_EQ(expected, second);
+}
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace ngraph::runtime::reference;
+
+TEST(quantized_gemm, kernels_match_scalar)
+{
+    vector<uint8_t> a(300);
+    vector<int8_t> b(300);
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = static_cast<uint8_t>(255 - (i * 7) % 256);
+        b[i] = static_cast<int8_t>((i % 2) ? -128 : 127 - static_cast<int>(i % 100));
+    }
+    QuantizedISA detected = detect_quantized_isa();
+    for (auto isa : {QuantizedISA::scalar, QuantizedISA::avx2, QuantizedISA::avx512_vnni})
+    {
+        if (isa > detected)
+        {
+            continue;
+        }
+        u8s8_dot_kernel kernel = get_u8s8_dot_kernel(isa);
+        // Every tail length around the 16 and 64 byte vector widths
+        for (size_t count = 0; count <= a.size(); count++)
+        {
+            EXPECT_EQ(u8s8_dot_scalar(a.data(), b.data(), count),
+                      kernel(a.data(), b.data(), count))
+                << "isa " << static_cast<int>(isa) << " count " << count;
+        }
+    }
+}
+
+TEST(quantized_gemm, requantize_saturates)
+{
+    EXPECT_EQ(127, requantize<int8_t>(1000, 1.0f, 0));
+    EXPECT_EQ(-128, requantize<int8_t>(-1000, 1.0f, 0));
+    EXPECT_EQ(0, requantize<uint8_t>(-5, 1.0f, 2));
+    EXPECT_EQ(3, requantize<uint8_t>(5, 0.5f, 0));
+    EXPECT_EQ(-2, requantize<int32_t>(-3, 0.5f, 0));
+}
+
+TEST(quantized_gemm, dot_matches_reference)
+{
+    // Unsigned weights go through the shifted s8 packing
+    Shape shape_a{4, 33};
+    Shape shape_b{33, 6};
+    Shape shape_r{4, 6};
+    vector<uint8_t> a(shape_size(shape_a));
+    vector<uint8_t> b(shape_size(shape_b));
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = static_cast<uint8_t>((i * 13 + 1) % 256);
+    }
+    for (size_t i = 0; i < b.size(); i++)
+    {
+        b[i] = static_cast<uint8_t>((i * 29 + 3) % 256);
+    }
+    float input_scale = 0.5f;
+    float filter_scale = 0.25f;
+    float output_scale = 16.0f;
+    uint8_t input_zero_point = 3;
+    uint8_t filter_zero_point = 200;
+    int32_t output_zero_point = 1;
+
+    vector<int32_t> expected(shape_size(shape_r));
+    vector<int32_t> result(shape_size(shape_r));
+    dot<uint8_t, uint8_t, int32_t, int32_t>(a.data(),
+                                            b.data(),
+                                            expected.data(),
+                                            shape_a,
+                                            shape_b,
+                                            shape_r,
+                                            1,
+                                            &input_scale,
+                                            &input_zero_point,
+                                            &filter_scale,
+                                            &filter_zero_point,
+                                            &output_scale,
+                                            &output_zero_point);
+    quantized_dot<uint8_t, int32_t>(a.data(),
+                                    b.data(),
+                                    result.data(),
+                                    shape_a,
+                                    shape_b,
+                                    1,
+                                    &input_scale,
+                                    &input_zero_point,
+                                    &filter_scale,
+                                    &filter_zero_point,
+                                    &output_scale,
+                                    &output_zero_point);
+    EXPECT_EQ(expected, result);
+}
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/type_prop.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(type_prop, scaled_dot_product_attention)
+{
+    auto query = make_shared<op::Parameter>(element::f32, Shape{8, 16, 64});
+    auto key = make_shared<op::Parameter>(element::f32, Shape{8, 32, 64});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{8, 32, 48});
+    auto attention = make_shared<op::ScaledDotProductAttention>(query, key, value, 0.125);
+    EXPECT_EQ(attention->get_element_type(), element::f32);
+    EXPECT_EQ(attention->get_shape(), (Shape{8, 16, 48}));
+    EXPECT_FALSE(attention->get_has_mask());
+}
+
+TEST(type_prop, scaled_dot_product_attention_mask)
+{
+    auto query = make_shared<op::Parameter>(element::f32, Shape{8, 16, 64});
+    auto key = make_shared<op::Parameter>(element::f32, Shape{8, 32, 64});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{8, 32, 64});
+    // Two samples with four heads each
+    auto mask = make_shared<op::Parameter>(element::f32, Shape{2, 1, 32});
+    auto attention = make_shared<op::ScaledDotProductAttention>(query, key, value, mask, 0.125);
+    EXPECT_EQ(attention->get_shape(), (Shape{8, 16, 64}));
+    EXPECT_TRUE(attention->get_has_mask());
+}
+
+TEST(type_prop, scaled_dot_product_attention_dynamic)
+{
+    auto query =
+        make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 16, 64});
+    auto key = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto value = make_shared<op::Parameter>(element::f32,
+                                            PartialShape{8, Dimension::dynamic(), 48});
+    auto attention = make_shared<op::ScaledDotProductAttention>(query, key, value, 1.0);
+    EXPECT_TRUE(attention->get_output_partial_shape(0).same_scheme(PartialShape{8, 16, 48}));
+}
+
+TEST(type_prop, scaled_dot_product_attention_key_depth_mismatch)
+{
+    auto query = make_shared<op::Parameter>(element::f32, Shape{8, 16, 64});
+    auto key = make_shared<op::Parameter>(element::f32, Shape{8, 32, 32});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{8, 32, 64});
+    try
+    {
+        auto attention = make_shared<op::ScaledDotProductAttention>(query, key, value, 1.0);
+        FAIL() << "Key depth mismatch not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "is not compatible with query shape");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, scaled_dot_product_attention_mask_batch_mismatch)
+{
+    auto query = make_shared<op::Parameter>(element::f32, Shape{8, 16, 64});
+    auto key = make_shared<op::Parameter>(element::f32, Shape{8, 32, 64});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{8, 32, 64});
+    auto mask = make_shared<op::Parameter>(element::f32, Shape{3, 16, 32});
+    try
+    {
+        auto attention =
+            make_shared<op::ScaledDotProductAttention>(query, key, value, mask, 1.0);
+        FAIL() << "Mask batch mismatch not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "does not broadcast to the batch size");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/node_arena.hpp"
 #include "util/type_prop.hpp"
 
 using namespace std;
@@ -73,3 +74,56 @@ TEST(type_prop, DISABLED_benchmark_type_prop_convolution)
     std::cout << "Constructed " << std::fixed << num_iterations << " Convolution ops in "
               << std::fixed << total_nanosec << " ns" << std::endl;
 }
+
+// Builds an unrolled chain of Adds that all share one parameter, as the weights of an unrolled
+// recurrent network are shared by every step, then times traversals of the graph.
+static void benchmark_large_graph(const std::shared_ptr<NodeArena>& arena)
+{
+    constexpr size_t num_nodes = 1000000;
+    auto make_add = [&arena](const Output<Node>& a, const Output<Node>& b) -> shared_ptr<Node> {
+        return arena ? arena->make<op::Add>(a, b) : make_shared<op::Add>(a, b);
+    };
+
+    stopwatch sw;
+    auto p = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    sw.start();
+    shared_ptr<Node> n = p;
+    for (size_t i = 0; i < num_nodes; i++)
+    {
+        n = make_add(n, p);
+    }
+    sw.stop();
+    size_t construct_ns = sw.get_nanoseconds();
+
+    auto f = make_shared<Function>(n, ParameterVector{p});
+    constexpr size_t num_traversals = 10;
+    size_t edges = 0;
+    sw.start();
+    for (size_t i = 0; i < num_traversals; i++)
+    {
+        traverse_nodes(f, [&edges](shared_ptr<Node> node) { edges += node->get_input_size(); });
+    }
+    sw.stop();
+    size_t traverse_ns = sw.get_nanoseconds();
+
+    sw.start();
+    size_t ordered = f->get_ordered_ops().size();
+    sw.stop();
+    size_t order_ns = sw.get_nanoseconds();
+
+    std::cout << (arena ? "Arena: " : "Heap: ") << construct_ns / num_nodes
+              << " ns per node to construct, " << traverse_ns / num_traversals / num_nodes
+              << " ns per node to traverse, " << order_ns / ordered
+              << " ns per node to sort topologically, sizeof(op::Add) " << sizeof(op::Add);
+    if (arena)
+    {
+        std::cout << ", " << arena->get_allocated_bytes() / num_nodes << " arena bytes per node";
+    }
+    std::cout << " (" << edges << " edges visited)" << std::endl;
+}
+
+TEST(type_prop, DISABLED_benchmark_large_graph)
+{
+    benchmark_large_graph(nullptr);
+    benchmark_large_graph(NodeArena::create());
+}
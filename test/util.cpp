@@ -25,6 +25,7 @@
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/node_arena.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
@@ -560,6 +561,83 @@ TEST(graph, huge)
     }
 }
 
+TEST(graph, huge_arena)
+{
+    std::vector<std::weak_ptr<Node>> weak_nodes;
+    std::weak_ptr<NodeArena> weak_arena;
+    {
+        auto arena = NodeArena::create();
+        weak_arena = arena;
+        auto param = arena->make<op::Parameter>(element::f32, Shape{3, 3});
+        std::shared_ptr<Node> n = param;
+        for (size_t i = 0; i < 1000000; i++)
+        {
+            n = arena->make<op::Add>(n, param);
+        }
+        EXPECT_EQ(param->output(0).get_target_inputs().size(), 1000001);
+        auto f = make_shared<Function>(NodeVector{n}, ParameterVector{param});
+        f->map_unordered_ops(
+            [&weak_nodes](Node* node) { weak_nodes.push_back(node->shared_from_this()); });
+        EXPECT_GT(arena->get_allocated_bytes(), 1000000 * sizeof(op::Add));
+    }
+
+    for (auto& weak_node : weak_nodes)
+    {
+        EXPECT_TRUE(weak_node.expired());
+    }
+    // Outstanding weak pointers keep their control blocks, and so the arena, alive
+    EXPECT_FALSE(weak_arena.expired());
+    weak_nodes.clear();
+    EXPECT_TRUE(weak_arena.expired());
+}
+
+TEST(util, stable_vector)
+{
+    struct Pinned
+    {
+        Pinned(size_t value, std::vector<size_t>& destroyed)
+            : value(value)
+            , destroyed(destroyed)
+        {
+        }
+        ~Pinned() { destroyed.push_back(value); }
+        Pinned(const Pinned&) = delete;
+        Pinned& operator=(const Pinned&) = delete;
+
+        size_t value;
+        std::vector<size_t>& destroyed;
+    };
+
+    std::vector<size_t> destroyed;
+    {
+        StableVector<Pinned, 2> v;
+        EXPECT_TRUE(v.empty());
+        std::vector<const Pinned*> addresses;
+        for (size_t i = 0; i < 100; i++)
+        {
+            addresses.push_back(&v.emplace_back(i, destroyed));
+        }
+        ASSERT_EQ(v.size(), 100);
+        for (size_t i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(&v[i], addresses[i]);
+            EXPECT_EQ(v.at(i).value, i);
+        }
+        EXPECT_THROW(v.at(100), std::out_of_range);
+        size_t sum = 0;
+        for (const Pinned& p : v)
+        {
+            sum += p.value;
+        }
+        EXPECT_EQ(sum, 4950);
+        EXPECT_EQ(v.end() - v.begin(), 100);
+        EXPECT_EQ(v.back().value, 99);
+    }
+    ASSERT_EQ(destroyed.size(), 100);
+    EXPECT_EQ(destroyed.front(), 99);
+    EXPECT_EQ(destroyed.back(), 0);
+}
+
 TEST(util, apply_permutation)
 {
     ASSERT_EQ(apply_permutation(Shape{0, 1, 2, 3}, AxisVector{2, 1, 0, 3}), (Shape{2, 1, 0, 3}));
@@ -654,6 +732,35 @@ TEST(util, clone_function_friendly_name)
     EXPECT_TRUE(found_B);
 }
 
+TEST(util, friendly_name_interned)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+
+    A->set_friendly_name("layer");
+    B->set_friendly_name(string("lay") + "er");
+    C->set_friendly_name("other");
+    EXPECT_EQ(A->get_friendly_name(), "layer");
+    EXPECT_EQ(&A->get_friendly_name(), &B->get_friendly_name());
+    EXPECT_EQ(C->get_friendly_name(), "other");
+
+    // Renaming one node leaves the others alone, and clearing the name falls back to the
+    // unique name
+    A->set_friendly_name("renamed");
+    EXPECT_EQ(A->get_friendly_name(), "renamed");
+    EXPECT_EQ(B->get_friendly_name(), "layer");
+    B->set_friendly_name("");
+    EXPECT_EQ(B->get_friendly_name(), B->get_name());
+
+    // A name released by every node can be interned again
+    C.reset();
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    D->set_friendly_name("other");
+    EXPECT_EQ(D->get_friendly_name(), "other");
+}
+
 TEST(util, clone_function_op_annotations)
 {
     Shape shape{2, 2};
@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/weight_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(weight_store, intern)
+{
+    runtime::WeightStore store;
+    vector<float> a{1, 2, 3, 4};
+    vector<float> b{1, 2, 3, 4};
+    vector<float> c{1, 2, 3, 5};
+
+    auto handle_a = store.intern(a.data(), a.size() * sizeof(float));
+    auto handle_b = store.intern(b.data(), b.size() * sizeof(float));
+    auto handle_c = store.intern(c.data(), c.size() * sizeof(float));
+    EXPECT_EQ(handle_a, handle_b);
+    EXPECT_NE(handle_a, handle_c);
+    EXPECT_NE(handle_a.get(), a.data());
+    EXPECT_EQ(memcmp(handle_c.get(), c.data(), c.size() * sizeof(float)), 0);
+    EXPECT_EQ(store.get_buffer_count(), 2);
+    EXPECT_EQ(store.get_byte_size(), 32);
+    EXPECT_EQ(store.get_deduplicated_bytes(), 16);
+
+    // Buffers are dropped with their last handle
+    handle_a.reset();
+    EXPECT_EQ(store.get_buffer_count(), 2);
+    handle_b.reset();
+    EXPECT_EQ(store.get_buffer_count(), 1);
+    handle_c.reset();
+    EXPECT_EQ(store.get_buffer_count(), 0);
+}
+
+TEST(weight_store, share_constants)
+{
+    runtime::WeightStore store;
+    auto make_constant = [] {
+        return op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    };
+    auto c1 = make_constant();
+    auto c2 = make_constant();
+    const float* c2_data = c2->get_data_ptr<float>();
+    store.share(*c1);
+    store.share(*c2);
+    EXPECT_EQ(c1->get_data_ptr(), c2->get_data_ptr());
+    EXPECT_EQ(c2->get_vector<float>(), (vector<float>{1, 2, 3, 4, 5, 6}));
+    // Data handed out before sharing stays valid with the constant
+    EXPECT_NE(c2->get_data_ptr<float>(), c2_data);
+    EXPECT_EQ(vector<float>(c2_data, c2_data + 6), (vector<float>{1, 2, 3, 4, 5, 6}));
+
+    // The shared buffer outlives the constants it was interned from
+    c1.reset();
+    EXPECT_EQ(store.get_buffer_count(), 1);
+    c2.reset();
+    EXPECT_EQ(store.get_buffer_count(), 0);
+}
+
+TEST(weight_store, publish_attach)
+{
+    string path =
+        file_util::path_join(file_util::get_temp_directory_path(), "weight_store_test.bin");
+    vector<int32_t> a{1, 2, 3};
+    vector<int8_t> b{4, 5, 6, 7, 8};
+    {
+        runtime::WeightStore store;
+        auto handle_a = store.intern(a.data(), a.size() * sizeof(int32_t));
+        auto handle_b = store.intern(b.data(), b.size());
+        store.publish(path);
+    }
+
+    runtime::WeightStore store;
+    store.attach(path);
+    file_util::remove_file(path);
+    EXPECT_EQ(store.get_buffer_count(), 2);
+
+    auto handle_b = store.intern(b.data(), b.size());
+    EXPECT_EQ(store.get_deduplicated_bytes(), b.size());
+    EXPECT_EQ(memcmp(handle_b.get(), b.data(), b.size()), 0);
+    EXPECT_EQ(reinterpret_cast<size_t>(handle_b.get()) % 64, 0);
+
+    EXPECT_ANY_THROW(store.attach(path));
+}